@@ -0,0 +1,56 @@
+/*****************************************************************************
+ * \file
+ * \brief This header defines the timing loop shared by the benchmarks
+ *****************************************************************************/
+
+#ifndef BIT_CORE_BENCHMARK_BENCH_TIMER_HPP
+#define BIT_CORE_BENCHMARK_BENCH_TIMER_HPP
+
+#include <algorithm> // std::min
+#include <chrono>    // std::chrono::steady_clock
+#include <cstddef>   // std::size_t
+#include <cstdio>    // std::printf
+
+namespace bench {
+
+  /// \brief Gets the time of one call to \p fn with \p args, in seconds
+  ///
+  /// \p fn is called through a volatile pointer so it cannot be hoisted out
+  /// of the loop, and its results are summed so the loop is not discarded.
+  /// The number of calls is doubled until the best of three rounds takes at
+  /// least 20ms.
+  ///
+  /// \param fn a pointer to the function to time
+  /// \param args the arguments to call \p fn with
+  /// \return the best time of a single call, in seconds
+  template<typename Function, typename...Args>
+  double seconds_per_call( Function fn, const Args&...args )
+  {
+    using result_type = decltype( fn( args... ) );
+
+    volatile Function f = fn;
+
+    auto iterations = std::size_t{1};
+    for( ;; iterations *= 2 ) {
+      auto best = 1e300;
+      for( auto round = 0; round < 3; ++round ) {
+        auto sink = result_type{};
+        const auto start = std::chrono::steady_clock::now();
+        for( auto i = std::size_t{0}; i < iterations; ++i ) {
+          sink += f( args... );
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        if( sink == static_cast<result_type>(1) ) std::printf( " " );
+
+        best = std::min( best, std::chrono::duration<double>( end - start ).count() );
+      }
+      if( best >= 0.02 ) {
+        return best / static_cast<double>(iterations);
+      }
+    }
+  }
+
+} // namespace bench
+
+#endif /* BIT_CORE_BENCHMARK_BENCH_TIMER_HPP */
@@ -0,0 +1,167 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares the find_first_of family against the naive scan over
+ *        every character of the set, and measures tokenizing with a
+ *        reusable char_set
+ *****************************************************************************/
+
+#include <bit/core/containers/char_set.hpp>
+#include <bit/core/containers/string_view.hpp>
+
+#include "bench_timer.hpp"
+
+#include <algorithm> // std::min
+#include <cstddef>   // std::size_t
+#include <cstdio>    // std::printf
+#include <random>    // std::mt19937
+#include <string>    // std::string
+
+namespace {
+
+  constexpr auto haystack_size = std::size_t{1} << 16;
+
+  /// The scan used by basic_string_view::find_first_of before char_set
+  std::size_t naive_find_first_of( bit::core::string_view h, bit::core::string_view v )
+  {
+    for( auto i = std::size_t{0}; i < h.size(); ++i ) {
+      for( auto j = std::size_t{0}; j < v.size(); ++j ) {
+        if( v[j] == h[i] ) return i;
+      }
+    }
+    return bit::core::string_view::npos;
+  }
+
+  std::size_t view_find_first_of( bit::core::string_view h, bit::core::string_view v )
+  {
+    return h.find_first_of( v );
+  }
+
+  std::size_t view_find_last_of( bit::core::string_view h, bit::core::string_view v )
+  {
+    return h.find_last_of( v );
+  }
+
+  std::size_t string_find_first_of( const std::string& h, const std::string& v )
+  {
+    return h.find_first_of( v );
+  }
+
+  /// Gets the time per call of \p fn in nanoseconds
+  template<typename Function, typename...Args>
+  double nanoseconds( Function fn, const Args&...args )
+  {
+    return bench::seconds_per_call( fn, args... ) * 1e9;
+  }
+
+  //---------------------------------------------------------------------------
+
+  std::size_t count_tokens_naive( const std::string& text, const std::string& delimiters )
+  {
+    const auto view  = bit::core::string_view( text );
+    const auto delim = bit::core::string_view( delimiters );
+
+    auto count = std::size_t{0};
+    auto pos   = std::size_t{0};
+    while( pos < view.size() ) {
+      const auto end = std::min( pos + naive_find_first_of( view.substr( pos ), delim ), view.size() );
+      count += (end != pos);
+      pos = end + 1;
+    }
+    return count;
+  }
+
+  std::size_t count_tokens_view( const std::string& text, const std::string& delimiters )
+  {
+    const auto view = bit::core::string_view( text );
+
+    auto count = std::size_t{0};
+    auto pos   = std::size_t{0};
+    while( pos < view.size() ) {
+      const auto end = std::min( view.find_first_of( delimiters, pos ), view.size() );
+      count += (end != pos);
+      pos = end + 1;
+    }
+    return count;
+  }
+
+  std::size_t count_tokens_set( const std::string& text, const bit::core::char_set& delimiters )
+  {
+    const auto view = bit::core::string_view( text );
+
+    auto count = std::size_t{0};
+    auto pos   = std::size_t{0};
+    while( pos < view.size() ) {
+      const auto end = std::min( view.find_first_of( delimiters, pos ), view.size() );
+      count += (end != pos);
+      pos = end + 1;
+    }
+    return count;
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  auto engine = std::mt19937{ 42u };
+  auto letter = std::uniform_int_distribution<int>{ 'a', 'z' };
+
+  // Scanning: the only member of the set is the last character
+  std::printf( "%zu byte haystack, GB/s\n\n", haystack_size );
+  std::printf( "%-6s %10s %10s %10s %12s %10s\n",
+               "set", "naive", "first_of", "last_of", "std::string", "speedup" );
+
+  for( auto size : {1u, 2u, 4u, 8u, 16u, 32u} ) {
+    auto set = std::string{};
+    for( auto i = 0u; i < size; ++i ) {
+      set.push_back( static_cast<char>( (i % 2u) ? '0' + i % 10u : 'A' + i ) );
+    }
+
+    auto h = std::string( haystack_size, '\0' );
+    for( auto& c : h ) c = static_cast<char>( letter( engine ) );
+    h.back()  = set[0];
+    auto rh   = h;
+    rh.back() = 'a';
+    rh.front() = set[0];
+
+    const auto hv  = bit::core::string_view( h );
+    const auto rhv = bit::core::string_view( rh );
+    const auto sv  = bit::core::string_view( set );
+
+    const auto gbps = [&]( double ns ) { return static_cast<double>(h.size()) / ns; };
+
+    const auto naive = gbps( nanoseconds( naive_find_first_of, hv, sv ) );
+    const auto first = gbps( nanoseconds( view_find_first_of, hv, sv ) );
+    const auto last  = gbps( nanoseconds( view_find_last_of, rhv, sv ) );
+    const auto std_s = gbps( nanoseconds( string_find_first_of, h, set ) );
+
+    std::printf( "%-6u %10.2f %10.2f %10.2f %12.2f %9.2fx\n",
+                 size, naive, first, last, std_s, first / naive );
+  }
+
+  // Tokenizing: words of 1 to 12 letters separated by one of the delimiters
+  {
+    const auto delimiters = std::string( " \t\n,;.:" );
+    const auto set        = bit::core::char_set( delimiters.data(), delimiters.size() );
+
+    auto length = std::uniform_int_distribution<int>{ 1, 12 };
+    auto delim  = std::uniform_int_distribution<std::size_t>{ 0, delimiters.size() - 1 };
+
+    auto text = std::string{};
+    while( text.size() < haystack_size ) {
+      for( auto n = length( engine ); n > 0; --n ) {
+        text.push_back( static_cast<char>( letter( engine ) ) );
+      }
+      text.push_back( delimiters[delim( engine )] );
+    }
+
+    const auto tokens = static_cast<double>( count_tokens_set( text, set ) );
+
+    std::printf( "\ntokenizing %zu bytes with %zu delimiters, ns/token\n\n",
+                 text.size(), delimiters.size() );
+    std::printf( "%-28s %8.2f\n", "naive", nanoseconds( count_tokens_naive, text, delimiters ) / tokens );
+    std::printf( "%-28s %8.2f\n", "find_first_of(string_view)", nanoseconds( count_tokens_view, text, delimiters ) / tokens );
+    std::printf( "%-28s %8.2f\n", "find_first_of(char_set)", nanoseconds( count_tokens_set, text, set ) / tokens );
+  }
+
+  return 0;
+}
@@ -0,0 +1,91 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares the ASCII case folding of insensitive_char_traits against
+ *        the per-character std::toupper it replaced, and the folding hash
+ *        against hashing a lowered copy
+ *
+ * Strings are header-like text whose copies differ from the original only
+ * in the case of their letters, so every comparison runs to the end.
+ *****************************************************************************/
+
+#include <bit/core/containers/string_view.hpp>
+
+#include "bench_timer.hpp"
+
+#include <cstddef>   // std::size_t
+#include <cstdio>    // std::printf
+#include <locale>    // std::toupper, std::locale
+#include <string>    // std::string
+
+namespace {
+
+  using traits = bit::core::insensitive_char_traits<char>;
+
+  /// The comparison used by insensitive_char_traits before ASCII folding
+  int locale_compare( const std::string& a, const std::string& b )
+  {
+    const auto* s1 = a.data();
+    const auto* s2 = b.data();
+    auto count = a.size();
+    while( count-- != 0 ) {
+      if( std::toupper( *s1, std::locale() ) < std::toupper( *s2, std::locale() ) ) return -1;
+      if( std::toupper( *s1, std::locale() ) > std::toupper( *s2, std::locale() ) ) return 1;
+      ++s1; ++s2;
+    }
+    return 0;
+  }
+
+  int ascii_compare( const std::string& a, const std::string& b )
+  {
+    return traits::compare( a.data(), b.data(), a.size() );
+  }
+
+  int lowered_hash( const std::string& a, const std::string& )
+  {
+    auto lowered = a;
+    for( auto& c : lowered ) c = traits::to_lower( c );
+    return static_cast<int>( bit::core::hash_string_segment( lowered.data(), lowered.size() ) );
+  }
+
+  int folding_hash( const std::string& a, const std::string& )
+  {
+    return static_cast<int>( bit::core::hash_insensitive_string_segment( a.data(), a.size() ) );
+  }
+
+  using function = int(*)( const std::string&, const std::string& );
+
+  /// Gets the time of one call in nanoseconds
+  double nanoseconds_per_call( function f, const std::string& a, const std::string& b )
+  {
+    return bench::seconds_per_call( f, a, b ) * 1e9;
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  std::printf( "ns per call\n\n" );
+  std::printf( "%6s %10s %10s %9s %12s %12s %9s\n",
+               "length", "toupper", "ascii", "speedup", "lowered+hash", "folding hash", "speedup" );
+
+  const auto text = std::string( "Content-Type: text/html; charset=UTF-8\r\nAccept-Encoding: gzip\r\n" );
+
+  for( auto size : {12u, 32u, 64u, 256u, 4096u} ) {
+    auto a = std::string{};
+    while( a.size() < size ) a += text;
+    a.resize( size );
+
+    auto b = a;
+    for( auto i = std::size_t{0}; i < b.size(); i += 3 ) b[i] = traits::to_lower( b[i] );
+
+    const auto c0 = nanoseconds_per_call( locale_compare, a, b );
+    const auto c1 = nanoseconds_per_call( ascii_compare, a, b );
+    const auto h0 = nanoseconds_per_call( lowered_hash, a, b );
+    const auto h1 = nanoseconds_per_call( folding_hash, a, b );
+
+    std::printf( "%6u %10.1f %10.1f %8.1fx %12.1f %12.1f %8.1fx\n",
+                 size, c0, c1, c0 / c1, h0, h1, h0 / h1 );
+  }
+
+  return 0;
+}
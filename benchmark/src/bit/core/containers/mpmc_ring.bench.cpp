@@ -0,0 +1,148 @@
+/*****************************************************************************
+ * \file
+ * \brief Measures how the throughput of mpmc_ring scales with the number of
+ *        threads, against a ring_deque guarded by a mutex
+ *
+ * Each test runs N producers and N consumers over one queue, for N from 1
+ * up to the number of hardware threads, and reports millions of messages
+ * per second through the queue. Waiting threads spin, and only yield after
+ * a long run of failed attempts.
+ *****************************************************************************/
+
+#include <bit/core/containers/mpmc_ring.hpp>
+#include <bit/core/containers/ring_deque.hpp>
+
+#include <algorithm> // std::max
+#include <chrono>    // std::chrono::steady_clock
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <cstdio>    // std::printf
+#include <mutex>     // std::mutex, std::lock_guard
+#include <thread>    // std::thread, std::this_thread::yield
+#include <vector>    // std::vector
+
+namespace {
+
+  constexpr std::size_t capacity = 1024u;
+
+  /// Calls \p fn until it returns true, spinning before yielding
+  template<typename Fn>
+  void spin_until( Fn fn )
+  {
+    for( auto spins = 0u; !fn(); ++spins ) {
+      if( spins >= 1024u ) {
+        std::this_thread::yield();
+        spins = 0u;
+      }
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // Queues
+  //---------------------------------------------------------------------------
+
+  class locked_queue
+  {
+  public:
+
+    locked_queue() : m_deque( capacity ) {}
+
+    bool try_push( std::uint64_t value )
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      if( m_deque.full() ) return false;
+      m_deque.push_back( value );
+      return true;
+    }
+
+    bool try_pop( std::uint64_t& value )
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      if( m_deque.empty() ) return false;
+      value = m_deque.front();
+      m_deque.pop_front();
+      return true;
+    }
+
+  private:
+
+    std::mutex m_mutex;
+    bit::core::ring_deque<std::uint64_t> m_deque;
+  };
+
+  class lock_free_queue
+  {
+  public:
+
+    lock_free_queue() : m_ring( capacity ) {}
+
+    bool try_push( std::uint64_t value ) { return m_ring.try_push( value ); }
+
+    bool try_pop( std::uint64_t& value ) { return m_ring.try_pop( value ); }
+
+  private:
+
+    bit::core::mpmc_ring<std::uint64_t> m_ring;
+  };
+
+  //---------------------------------------------------------------------------
+
+  /// Gets millions of messages per second with \p threads producers and
+  /// \p threads consumers moving \p count messages in total
+  template<typename Queue>
+  double throughput( std::size_t threads, std::size_t count )
+  {
+    Queue queue;
+    const auto per_thread = count / threads;
+
+    auto sums = std::vector<std::uint64_t>( threads, 0u );
+    auto workers = std::vector<std::thread>{};
+
+    const auto start = std::chrono::steady_clock::now();
+    for( auto t = std::size_t{0}; t < threads; ++t ) {
+      workers.emplace_back( [&queue, per_thread]{
+        for( auto i = std::size_t{0}; i < per_thread; ++i ) {
+          spin_until( [&]{ return queue.try_push( i ); } );
+        }
+      } );
+      workers.emplace_back( [&queue, &sums, per_thread, t]{
+        auto value = std::uint64_t{};
+        for( auto i = std::size_t{0}; i < per_thread; ++i ) {
+          spin_until( [&]{ return queue.try_pop( value ); } );
+          sums[t] += value;
+        }
+      } );
+    }
+    for( auto& worker : workers ) {
+      worker.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // Prevent the loops from being discarded
+    for( const auto sum : sums ) {
+      if( sum == 1u ) std::printf( " " );
+    }
+
+    const auto elapsed = std::chrono::duration<double>( end - start ).count();
+    return static_cast<double>(per_thread * threads) / elapsed * 1e-6;
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  const auto messages = std::size_t{4000000};
+  const auto hardware = std::max( 2u, std::thread::hardware_concurrency() );
+
+  std::printf( "millions of messages per second (%u hardware threads)\n\n",
+               std::thread::hardware_concurrency() );
+  std::printf( "%-24s %14s %12s\n", "producers x consumers", "mutex+deque", "mpmc_ring" );
+  for( auto threads = std::size_t{1}; threads <= hardware / 2u; threads *= 2u ) {
+    const auto locked    = throughput<locked_queue>( threads, messages );
+    const auto lock_free = throughput<lock_free_queue>( threads, messages );
+
+    std::printf( "%10zu x %-11zu %14.2f %12.2f\n", threads, threads, locked, lock_free );
+  }
+
+  return 0;
+}
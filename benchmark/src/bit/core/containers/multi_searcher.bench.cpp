@@ -0,0 +1,99 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares multi_searcher against one basic_string_view::find per
+ *        pattern when checking a buffer for any of a set of keywords
+ *
+ * The buffer is lowercase English-like text, and the keywords are random
+ * lowercase words of 5 to 10 letters that do not occur in it, so every
+ * search scans the whole buffer. Sets of up to 16 keywords use the Teddy
+ * engine; larger sets use Aho-Corasick.
+ *****************************************************************************/
+
+#include <bit/core/containers/multi_searcher.hpp>
+
+#include "bench_timer.hpp"
+
+#include <cstddef>   // std::size_t
+#include <cstdio>    // std::printf
+#include <random>    // std::mt19937
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+namespace {
+
+  constexpr auto buffer_size = std::size_t{1} << 16;
+
+  const char* const words[] = {
+    "the", "of", "and", "to", "in", "is", "that", "for", "it", "as", "was",
+    "with", "be", "by", "on", "not", "he", "this", "are", "or", "his", "from",
+    "at", "which", "but", "have", "an", "had", "they", "you", "were", "there",
+    "one", "all", "we", "can", "her", "has", "been", "if", "more", "when",
+    "will", "would", "who", "so", "no", "other", "time", "people", "these"
+  };
+
+  struct keywords
+  {
+    std::vector<std::string> patterns;
+    bit::core::multi_searcher searcher;
+  };
+
+  std::size_t find_each( const keywords& k, bit::core::string_view h )
+  {
+    for( const auto& p : k.patterns ) {
+      const auto i = h.find( bit::core::string_view( p.data(), p.size() ) );
+      if( i != bit::core::string_view::npos ) return i;
+    }
+    return bit::core::string_view::npos;
+  }
+
+  std::size_t find_any( const keywords& k, bit::core::string_view h )
+  {
+    return k.searcher.find_first( h ).position;
+  }
+
+  using search_function = std::size_t(*)( const keywords&, bit::core::string_view );
+
+  /// Gets the throughput of \p search in gigabytes per second
+  double gigabytes_per_second( search_function search,
+                               const keywords& k,
+                               bit::core::string_view h )
+  {
+    return static_cast<double>(h.size()) / bench::seconds_per_call( search, k, h ) / 1e9;
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  auto engine = std::mt19937{ 42u };
+  auto pick   = std::uniform_int_distribution<std::size_t>{ 0u, sizeof(words) / sizeof(words[0]) - 1u };
+  auto letter = std::uniform_int_distribution<int>{ 'a', 'z' };
+  auto length = std::uniform_int_distribution<std::size_t>{ 5u, 10u };
+
+  auto text = std::string{};
+  while( text.size() < buffer_size ) {
+    text += words[pick( engine )];
+    text += ' ';
+  }
+  const auto h = bit::core::string_view( text.data(), text.size() );
+
+  std::printf( "%zu byte buffer, GB/s\n\n", text.size() );
+  std::printf( "%8s %12s %14s %9s\n", "keywords", "find each", "multi_searcher", "speedup" );
+
+  for( auto count : {4u, 8u, 16u, 64u, 256u, 1024u} ) {
+    auto patterns = std::vector<std::string>{};
+    while( patterns.size() < count ) {
+      auto p = std::string( length( engine ), '\0' );
+      for( auto& c : p ) c = static_cast<char>( letter( engine ) );
+      if( text.find( p ) == std::string::npos ) patterns.push_back( p );
+    }
+    const auto k = keywords{ patterns, bit::core::multi_searcher( patterns.begin(), patterns.end() ) };
+
+    const auto a = gigabytes_per_second( find_each, k, h );
+    const auto b = gigabytes_per_second( find_any, k, h );
+
+    std::printf( "%8u %12.3f %14.3f %8.1fx\n", count, a, b, b / a );
+  }
+
+  return 0;
+}
@@ -0,0 +1,191 @@
+/*****************************************************************************
+ * \file
+ * \brief Measures ring_buffer push/pop, iteration and random access in the
+ *        power-of-two mode, against the general mode with the same capacity
+ *
+ * The push/pop test keeps the buffer half full and repeatedly pushes to the
+ * back and pops from the front, so that both ends keep wrapping around. The
+ * overwrite test keeps pushing into a full buffer. The iteration and index
+ * tests sum every entry of a full buffer whose front is not at the start of
+ * the storage. The bulk test pushes blocks of entries with one call and pops
+ * them again with another, so that each block is copied in at most two
+ * pieces.
+ *
+ * The tests are not inlined, so that the buffers are used through a
+ * reference as they would be in real code, rather than held in registers.
+ *****************************************************************************/
+
+#include <bit/core/containers/ring_buffer.hpp>
+#include <bit/core/utilities/aligned_storage.hpp>
+#include <bit/core/utilities/compiler_traits.hpp> // BIT_NO_INLINE
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <cstdio>  // std::printf
+
+namespace {
+
+  constexpr std::size_t capacity = 1024u;
+
+  //---------------------------------------------------------------------------
+  // Tests
+  //---------------------------------------------------------------------------
+
+  /// Gets the nanoseconds per push/pop pair
+  template<typename Buffer>
+  BIT_NO_INLINE double push_pop( Buffer& buffer, std::size_t count )
+  {
+    buffer.clear();
+    for( auto i = std::size_t{0}; i < buffer.capacity() / 2u; ++i ) {
+      buffer.push_back( i );
+    }
+
+    auto sum = std::uint64_t{0};
+    const auto start = std::chrono::steady_clock::now();
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      buffer.push_back( i );
+      sum += buffer.front();
+      buffer.pop_front();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // Prevent the loop from being discarded
+    if( sum == 1u ) std::printf( " " );
+
+    const auto elapsed = std::chrono::duration<double,std::nano>( end - start ).count();
+    return elapsed / static_cast<double>(count);
+  }
+
+  /// Gets the nanoseconds per push into a full buffer
+  template<typename Buffer>
+  BIT_NO_INLINE double overwrite( Buffer& buffer, std::size_t count )
+  {
+    buffer.clear();
+    for( auto i = std::size_t{0}; i < buffer.capacity(); ++i ) {
+      buffer.push_back( i );
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      buffer.push_back( i );
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // Prevent the loop from being discarded
+    if( buffer.back() == 1u ) std::printf( " " );
+
+    const auto elapsed = std::chrono::duration<double,std::nano>( end - start ).count();
+    return elapsed / static_cast<double>(count);
+  }
+
+  /// Gets the nanoseconds per entry when pushing and popping in blocks
+  template<typename Buffer>
+  BIT_NO_INLINE double bulk( Buffer& buffer, std::size_t count )
+  {
+    constexpr auto block = std::size_t{96};
+    std::uint64_t values[block] = {};
+
+    buffer.clear();
+    for( auto i = std::size_t{0}; i < buffer.capacity() / 2u; ++i ) {
+      buffer.push_back( i );
+    }
+
+    auto sum = std::uint64_t{0};
+    const auto start = std::chrono::steady_clock::now();
+    for( auto i = std::size_t{0}; i < count; i += block ) {
+      values[0] = i;
+      buffer.push_back( values, values + block );
+      sum += buffer.front();
+      buffer.pop_front( block );
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // Prevent the loop from being discarded
+    if( sum == 1u ) std::printf( " " );
+
+    const auto elapsed = std::chrono::duration<double,std::nano>( end - start ).count();
+    return elapsed / static_cast<double>(count);
+  }
+
+  /// Fills the buffer so that its front is in the middle of the storage
+  template<typename Buffer>
+  void fill_wrapped( Buffer& buffer )
+  {
+    buffer.clear();
+    for( auto i = std::size_t{0}; i < buffer.capacity() + buffer.capacity() / 2u; ++i ) {
+      buffer.push_back( i );
+    }
+  }
+
+  /// Gets the nanoseconds per entry when iterating a full buffer
+  template<typename Buffer>
+  BIT_NO_INLINE double iterate( Buffer& buffer, std::size_t passes )
+  {
+    fill_wrapped( buffer );
+
+    auto sum = std::uint64_t{0};
+    const auto start = std::chrono::steady_clock::now();
+    for( auto pass = std::size_t{0}; pass < passes; ++pass ) {
+      for( const auto v : buffer ) {
+        sum += v;
+      }
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // Prevent the loop from being discarded
+    if( sum == 1u ) std::printf( " " );
+
+    const auto elapsed = std::chrono::duration<double,std::nano>( end - start ).count();
+    return elapsed / static_cast<double>(passes * buffer.size());
+  }
+
+  /// Gets the nanoseconds per entry when indexing a full buffer
+  template<typename Buffer>
+  BIT_NO_INLINE double index( Buffer& buffer, std::size_t passes )
+  {
+    fill_wrapped( buffer );
+
+    auto sum = std::uint64_t{0};
+    const auto start = std::chrono::steady_clock::now();
+    for( auto pass = std::size_t{0}; pass < passes; ++pass ) {
+      for( auto i = std::size_t{0}; i < buffer.size(); ++i ) {
+        sum += buffer[i];
+      }
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // Prevent the loop from being discarded
+    if( sum == 1u ) std::printf( " " );
+
+    const auto elapsed = std::chrono::duration<double,std::nano>( end - start ).count();
+    return elapsed / static_cast<double>(passes * buffer.size());
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  const auto count  = std::size_t{50000000};
+  const auto passes = std::size_t{20000};
+
+  bit::core::aligned_storage_for<std::uint64_t[capacity]> general_storage;
+  bit::core::aligned_storage_for<std::uint64_t[capacity]> masked_storage;
+  bit::core::ring_buffer<std::uint64_t> general( &general_storage, capacity );
+  bit::core::ring_buffer<std::uint64_t,true> masked( &masked_storage, capacity );
+
+  std::printf( "ns per operation (capacity %zu)\n\n", capacity );
+  std::printf( "%-12s %12s %14s\n", "test", "general", "power of two" );
+  std::printf( "%-12s %12.2f %14.2f\n", "push/pop",
+               push_pop( general, count ), push_pop( masked, count ) );
+  std::printf( "%-12s %12.2f %14.2f\n", "overwrite",
+               overwrite( general, count ), overwrite( masked, count ) );
+  std::printf( "%-12s %12.2f %14.2f\n", "bulk",
+               bulk( general, count ), bulk( masked, count ) );
+  std::printf( "%-12s %12.2f %14.2f\n", "iterate",
+               iterate( general, passes ), iterate( masked, passes ) );
+  std::printf( "%-12s %12.2f %14.2f\n", "index",
+               index( general, passes ), index( masked, passes ) );
+
+  return 0;
+}
@@ -0,0 +1,139 @@
+/*****************************************************************************
+ * \file
+ * \brief Measures ring_deque with ring_grow_policy as an unbounded FIFO,
+ *        against std::deque
+ *
+ * The fill test pushes entries into a new queue and then drains it, so the
+ * ring_deque keeps growing and relocating its entries into fresh memory.
+ * The refill test does the same with one queue that is kept between rounds,
+ * as a long-lived FIFO would be. The steady test
+ * pushes a burst and pops a slightly smaller one each round, so that the
+ * queue slowly grows while both ends keep moving, which is where
+ * std::deque allocates and frees its blocks.
+ *****************************************************************************/
+
+#include <bit/core/containers/ring_deque.hpp>
+#include <bit/core/utilities/compiler_traits.hpp> // BIT_NO_INLINE
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <cstdio>  // std::printf
+#include <deque>   // std::deque
+#include <memory>  // std::allocator
+
+namespace {
+
+  using ring_queue = bit::core::ring_deque<std::uint64_t,
+                                           std::allocator<std::uint64_t>,
+                                           bit::core::ring_grow_policy>;
+  using std_queue  = std::deque<std::uint64_t>;
+
+  //---------------------------------------------------------------------------
+  // Tests
+  //---------------------------------------------------------------------------
+
+  /// Pushes \p count entries into \p queue, and then drains it
+  template<typename Queue>
+  std::uint64_t fill_and_drain( Queue& queue, std::size_t count )
+  {
+    auto sum = std::uint64_t{0};
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      queue.push_back( i );
+    }
+    while( !queue.empty() ) {
+      sum += queue.front();
+      queue.pop_front();
+    }
+    return sum;
+  }
+
+  /// Gets the nanoseconds per entry to fill a new queue with \p count
+  /// entries, and then drain it
+  template<typename Queue>
+  BIT_NO_INLINE double fill( std::size_t count, std::size_t rounds )
+  {
+    auto sum = std::uint64_t{0};
+    const auto start = std::chrono::steady_clock::now();
+    for( auto round = std::size_t{0}; round < rounds; ++round ) {
+      Queue queue;
+      sum += fill_and_drain( queue, count );
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // Prevent the loop from being discarded
+    if( sum == 1u ) std::printf( " " );
+
+    const auto elapsed = std::chrono::duration<double,std::nano>( end - start ).count();
+    return elapsed / static_cast<double>(count * rounds);
+  }
+
+  /// Gets the nanoseconds per entry to fill the same queue with \p count
+  /// entries, and then drain it
+  template<typename Queue>
+  BIT_NO_INLINE double refill( std::size_t count, std::size_t rounds )
+  {
+    Queue queue;
+
+    auto sum = std::uint64_t{0};
+    const auto start = std::chrono::steady_clock::now();
+    for( auto round = std::size_t{0}; round < rounds; ++round ) {
+      sum += fill_and_drain( queue, count );
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // Prevent the loop from being discarded
+    if( sum == 1u ) std::printf( " " );
+
+    const auto elapsed = std::chrono::duration<double,std::nano>( end - start ).count();
+    return elapsed / static_cast<double>(count * rounds);
+  }
+
+  /// Gets the nanoseconds per push/pop pair when pushing bursts of 64
+  /// entries and popping bursts of 63
+  template<typename Queue>
+  BIT_NO_INLINE double steady( std::size_t count )
+  {
+    Queue queue;
+
+    auto sum = std::uint64_t{0};
+    const auto start = std::chrono::steady_clock::now();
+    for( auto i = std::size_t{0}; i < count; i += 64u ) {
+      for( auto j = std::size_t{0}; j < 64u; ++j ) {
+        queue.push_back( i + j );
+      }
+      for( auto j = std::size_t{0}; j < 63u; ++j ) {
+        sum += queue.front();
+        queue.pop_front();
+      }
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // Prevent the loop from being discarded
+    if( sum == 1u || queue.empty() ) std::printf( " " );
+
+    const auto elapsed = std::chrono::duration<double,std::nano>( end - start ).count();
+    return elapsed / static_cast<double>(count);
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  std::printf( "ns per entry\n\n" );
+  std::printf( "%-18s %12s %12s\n", "test", "std::deque", "ring_deque" );
+  for( auto count = std::size_t{1000}; count <= 1000000u; count *= 10u ) {
+    const auto rounds = 10000000u / count;
+    std::printf( "fill %-13zu %12.2f %12.2f\n", count,
+                 fill<std_queue>( count, rounds ), fill<ring_queue>( count, rounds ) );
+  }
+  for( auto count = std::size_t{1000}; count <= 1000000u; count *= 10u ) {
+    const auto rounds = 10000000u / count;
+    std::printf( "refill %-11zu %12.2f %12.2f\n", count,
+                 refill<std_queue>( count, rounds ), refill<ring_queue>( count, rounds ) );
+  }
+  std::printf( "%-18s %12.2f %12.2f\n", "steady",
+               steady<std_queue>( 50000000u ), steady<ring_queue>( 50000000u ) );
+
+  return 0;
+}
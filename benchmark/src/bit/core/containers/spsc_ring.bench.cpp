@@ -0,0 +1,172 @@
+/*****************************************************************************
+ * \file
+ * \brief Measures handing messages between two threads with spsc_ring,
+ *        against a ring_deque guarded by a mutex
+ *
+ * The ping-pong test bounces a single message between the threads through
+ * a pair of queues, so that every handoff waits for the previous one; the
+ * time per handoff is half a round trip. The stream test has one thread
+ * push as fast as the other pops, and reports the time per message.
+ *
+ * Waiting threads spin, and only yield after a long run of failed
+ * attempts, so the numbers are only meaningful with at least two cores.
+ *****************************************************************************/
+
+#include <bit/core/containers/spsc_ring.hpp>
+#include <bit/core/containers/ring_deque.hpp>
+#include <bit/core/utilities/aligned_storage.hpp>
+
+#include <chrono>  // std::chrono::steady_clock
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <cstdio>  // std::printf
+#include <mutex>   // std::mutex, std::lock_guard
+#include <thread>  // std::thread, std::this_thread::yield
+
+namespace {
+
+  constexpr std::size_t capacity = 1024u;
+
+  /// Calls \p fn until it returns true, spinning before yielding
+  template<typename Fn>
+  void spin_until( Fn fn )
+  {
+    for( auto spins = 0u; !fn(); ++spins ) {
+      if( spins >= 1024u ) {
+        std::this_thread::yield();
+        spins = 0u;
+      }
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // Queues
+  //---------------------------------------------------------------------------
+
+  class locked_queue
+  {
+  public:
+
+    locked_queue() : m_deque( capacity ) {}
+
+    bool try_push( std::uint64_t value )
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      if( m_deque.full() ) return false;
+      m_deque.push_back( value );
+      return true;
+    }
+
+    bool try_pop( std::uint64_t& value )
+    {
+      std::lock_guard<std::mutex> lock( m_mutex );
+      if( m_deque.empty() ) return false;
+      value = m_deque.front();
+      m_deque.pop_front();
+      return true;
+    }
+
+  private:
+
+    std::mutex m_mutex;
+    bit::core::ring_deque<std::uint64_t> m_deque;
+  };
+
+  class lock_free_queue
+  {
+  public:
+
+    lock_free_queue() : m_ring( &m_storage, capacity ) {}
+
+    bool try_push( std::uint64_t value ) { return m_ring.try_push( value ); }
+
+    bool try_pop( std::uint64_t& value ) { return m_ring.try_pop( value ); }
+
+  private:
+
+    bit::core::aligned_storage_for<std::uint64_t[capacity]> m_storage;
+    bit::core::spsc_ring<std::uint64_t> m_ring;
+  };
+
+  //---------------------------------------------------------------------------
+  // Tests
+  //---------------------------------------------------------------------------
+
+  /// Gets the nanoseconds per handoff when bouncing one message
+  template<typename Queue>
+  double ping_pong( std::size_t round_trips )
+  {
+    Queue ping;
+    Queue pong;
+
+    auto echo = std::thread( [&]{
+      auto value = std::uint64_t{};
+      for( auto i = std::size_t{0}; i < round_trips; ++i ) {
+        spin_until( [&]{ return ping.try_pop( value ); } );
+        spin_until( [&]{ return pong.try_push( value + 1u ); } );
+      }
+    } );
+
+    const auto start = std::chrono::steady_clock::now();
+    auto value = std::uint64_t{};
+    for( auto i = std::size_t{0}; i < round_trips; ++i ) {
+      spin_until( [&]{ return ping.try_push( value ); } );
+      spin_until( [&]{ return pong.try_pop( value ); } );
+    }
+    const auto end = std::chrono::steady_clock::now();
+    echo.join();
+
+    // Prevent the loop from being discarded
+    if( value != round_trips ) std::printf( " " );
+
+    const auto elapsed = std::chrono::duration<double,std::nano>( end - start ).count();
+    return elapsed / static_cast<double>(2u * round_trips);
+  }
+
+  /// Gets the nanoseconds per message when streaming \p count messages
+  template<typename Queue>
+  double stream( std::size_t count )
+  {
+    Queue queue;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto producer = std::thread( [&]{
+      for( auto i = std::size_t{0}; i < count; ++i ) {
+        spin_until( [&]{ return queue.try_push( i ); } );
+      }
+    } );
+
+    auto sum = std::uint64_t{0};
+    auto value = std::uint64_t{};
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      spin_until( [&]{ return queue.try_pop( value ); } );
+      sum += value;
+    }
+    producer.join();
+    const auto end = std::chrono::steady_clock::now();
+
+    // Prevent the loop from being discarded
+    if( sum == 1u ) std::printf( " " );
+
+    const auto elapsed = std::chrono::duration<double,std::nano>( end - start ).count();
+    return elapsed / static_cast<double>(count);
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  const auto round_trips = std::size_t{200000};
+  const auto messages    = std::size_t{10000000};
+
+  std::printf( "ns per message (%u hardware threads)\n\n", std::thread::hardware_concurrency() );
+  std::printf( "%-12s %16s %12s\n", "test", "mutex+deque", "spsc_ring" );
+  std::printf( "%-12s %16.1f %12.1f\n", "ping-pong",
+               ping_pong<locked_queue>( round_trips ),
+               ping_pong<lock_free_queue>( round_trips ) );
+  std::printf( "%-12s %16.1f %12.1f\n", "stream",
+               stream<locked_queue>( messages ),
+               stream<lock_free_queue>( messages ) );
+
+  return 0;
+}
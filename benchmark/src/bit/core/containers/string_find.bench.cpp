@@ -0,0 +1,154 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares basic_string_view::find and rfind against a naive
+ *        character-by-character search and std::string::find
+ *
+ * Each needle is placed once at the end (or, for rfind, the start) of the
+ * haystack, so every search scans the full buffer. The 'text' haystack is
+ * random lowercase letters; the 'periodic' haystack is a run of a single
+ * character that every needle but the last character matches; and the
+ * 'filtered' haystack is the same run, searched for a needle that differs
+ * only in its middle character.
+ *****************************************************************************/
+
+#include <bit/core/containers/string_view.hpp>
+
+#include "bench_timer.hpp"
+
+#include <cstddef>   // std::size_t
+#include <cstdio>    // std::printf
+#include <random>    // std::mt19937
+#include <string>    // std::string
+
+namespace {
+
+  constexpr auto haystack_size = std::size_t{1} << 16;
+
+  /// The search used by basic_string_view::find before vectorization
+  std::size_t naive_find( bit::core::string_view h, bit::core::string_view v )
+  {
+    const auto max_index = h.size() - v.size() + 1;
+    for( auto i = std::size_t{0}; i < max_index; ++i ) {
+      auto j = v.size();
+      for( ; j > 0; --j ) {
+        if( v[j-1] != h[i+j-1] ) break;
+      }
+      if( j == 0 ) return i;
+    }
+    return bit::core::string_view::npos;
+  }
+
+  /// The search used by basic_string_view::rfind before vectorization
+  std::size_t naive_rfind( bit::core::string_view h, bit::core::string_view v )
+  {
+    const auto max_index = h.size() - v.size() + 1;
+    for( auto i = max_index; i > 0; --i ) {
+      auto j = std::size_t{0};
+      for( ; j < v.size(); ++j ) {
+        if( v[j] != h[i+j-1] ) break;
+      }
+      if( j == v.size() ) return i - 1;
+    }
+    return bit::core::string_view::npos;
+  }
+
+  std::size_t view_find( bit::core::string_view h, bit::core::string_view v )
+  {
+    return h.find( v );
+  }
+
+  std::size_t view_rfind( bit::core::string_view h, bit::core::string_view v )
+  {
+    return h.rfind( v );
+  }
+
+  using search_function = std::size_t(*)( bit::core::string_view, bit::core::string_view );
+  using string_function = std::size_t(*)( const std::string&, const std::string& );
+
+  std::size_t string_find( const std::string& h, const std::string& v )
+  {
+    return h.find( v );
+  }
+
+  std::size_t string_rfind( const std::string& h, const std::string& v )
+  {
+    return h.rfind( v );
+  }
+
+  /// Gets the throughput of \p search in gigabytes per second
+  template<typename Function, typename String>
+  double gigabytes_per_second( Function search, const String& h, const String& v )
+  {
+    return static_cast<double>(h.size()) / bench::seconds_per_call( search, h, v ) / 1e9;
+  }
+
+  void report( const char* haystack_name,
+               const char* op,
+               const std::string& h,
+               const std::string& needle,
+               search_function naive,
+               search_function view,
+               string_function string )
+  {
+    const auto hv = bit::core::string_view( h );
+    const auto nv = bit::core::string_view( needle );
+
+    const auto a = gigabytes_per_second( naive, hv, nv );
+    const auto b = gigabytes_per_second( view, hv, nv );
+    const auto c = gigabytes_per_second( string, h, needle );
+
+    std::printf( "%-9s %-6s %7zu %10.2f %10.2f %12.2f %8.2fx\n",
+                 haystack_name, op, needle.size(), a, b, c, b / a );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  std::printf( "%zu byte haystacks, GB/s\n\n", haystack_size );
+  std::printf( "%-9s %-6s %7s %10s %10s %12s %9s\n",
+               "haystack", "op", "needle", "naive", "find", "std::string", "speedup" );
+
+  auto engine = std::mt19937{ 42u };
+  auto letter = std::uniform_int_distribution<int>{ 'a', 'z' };
+
+  for( auto length : {1u, 2u, 4u, 8u, 16u, 32u, 64u, 256u} ) {
+    // Text: the needle is only found at the very end (or start)
+    {
+      auto needle = std::string( length, '\0' );
+      for( auto& c : needle ) c = static_cast<char>( letter( engine ) );
+      needle.back() = '#';
+
+      auto h = std::string( haystack_size - length, '\0' );
+      for( auto& c : h ) c = static_cast<char>( letter( engine ) );
+
+      report( "text", "find", h + needle, needle, naive_find, view_find, string_find );
+      report( "text", "rfind", needle + h, needle, naive_rfind, view_rfind, string_rfind );
+    }
+
+    // Periodic: every position is a partial match of the needle
+    {
+      auto needle = std::string( length, 'a' );
+      needle.back() = 'b';
+      const auto h = std::string( haystack_size - length, 'a' );
+
+      auto rneedle = std::string( length, 'a' );
+      rneedle.front() = 'b';
+
+      report( "periodic", "find", h + needle, needle, naive_find, view_find, string_find );
+      report( "periodic", "rfind", rneedle + h, rneedle, naive_rfind, view_rfind, string_rfind );
+    }
+
+    // Adversarial: every position passes the first/last character filter
+    if( length >= 3u ) {
+      auto needle = std::string( length, 'a' );
+      needle[length / 2] = 'b';
+      const auto h = std::string( haystack_size - length, 'a' );
+
+      report( "filtered", "find", h + needle, needle, naive_find, view_find, string_find );
+      report( "filtered", "rfind", needle + h, needle, naive_rfind, view_rfind, string_rfind );
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,127 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares the precompiled searchers against basic_string_view::find
+ *        when one needle is searched for across many haystacks
+ *
+ * The haystacks are short lines of English-like text built from common
+ * words, and each needle is a phrase of those words that does not occur, so
+ * every search scans its whole line. Lines are short enough that per-search
+ * setup is a visible part of the cost.
+ *****************************************************************************/
+
+#include <bit/core/containers/string_searcher.hpp>
+
+#include "bench_timer.hpp"
+
+#include <algorithm> // std::min
+#include <cstddef>   // std::size_t
+#include <cstdio>    // std::printf
+#include <random>    // std::mt19937
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+namespace {
+
+  constexpr auto line_count = std::size_t{4096};
+
+  const char* const words[] = {
+    "the", "of", "and", "to", "in", "is", "that", "for", "it", "as", "was",
+    "with", "be", "by", "on", "not", "he", "this", "are", "or", "his", "from",
+    "at", "which", "but", "have", "an", "had", "they", "you", "were", "there",
+    "one", "all", "we", "can", "her", "has", "been", "if", "more", "when",
+    "will", "would", "who", "so", "no", "other", "time", "people", "these"
+  };
+
+  std::string make_line( std::mt19937& engine, std::size_t min_size )
+  {
+    auto pick = std::uniform_int_distribution<std::size_t>{ 0u, sizeof(words) / sizeof(words[0]) - 1u };
+
+    auto result = std::string{};
+    while( result.size() < min_size ) {
+      result += words[pick( engine )];
+      result += ' ';
+    }
+    return result;
+  }
+
+  using lines = std::vector<bit::core::string_view>;
+
+  std::size_t view_find( const lines& haystacks, bit::core::string_view needle )
+  {
+    auto sum = std::size_t{0};
+    for( auto h : haystacks ) sum += h.find( needle );
+    return sum;
+  }
+
+  template<typename Searcher>
+  std::size_t searcher_find( const lines& haystacks, bit::core::string_view needle )
+  {
+    // Built once per pass over all lines, as a caller reusing it would
+    const auto searcher = Searcher( needle );
+
+    auto sum = std::size_t{0};
+    for( auto h : haystacks ) sum += h.find( searcher );
+    return sum;
+  }
+
+  using search_function = std::size_t(*)( const lines&, bit::core::string_view );
+
+  /// Gets the time of one search in nanoseconds
+  double nanoseconds_per_line( search_function search,
+                               const lines& haystacks,
+                               bit::core::string_view needle )
+  {
+    return bench::seconds_per_call( search, haystacks, needle ) * 1e9
+           / static_cast<double>(haystacks.size());
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  std::printf( "%zu lines per search, ns per line\n\n", line_count );
+  std::printf( "%6s %-32s %8s %10s %8s %9s\n",
+               "line", "needle", "find", "horspool", "simd", "speedup" );
+
+  const char* const needles[] = {
+    "the time",
+    "there were people",
+    "which would have been the one",
+    "these people have not been there when we were"
+  };
+
+  auto engine = std::mt19937{ 42u };
+
+  for( auto size : {64u, 256u, 1024u} ) {
+    auto storage = std::vector<std::string>{};
+    for( auto i = std::size_t{0}; i < line_count; ++i ) {
+      auto line = make_line( engine, size );
+
+      // Remove every occurrence, so that each search scans the whole line
+      for( const auto* needle : needles ) {
+        for( auto p = line.find( needle ); p != std::string::npos; p = line.find( needle ) ) {
+          line[p] = 'T';
+        }
+      }
+      storage.push_back( line );
+    }
+
+    auto haystacks = lines{};
+    for( const auto& line : storage ) {
+      haystacks.push_back( bit::core::string_view( line.data(), line.size() ) );
+    }
+
+    for( const auto* needle : needles ) {
+      const auto nv = bit::core::string_view( needle );
+
+      const auto a = nanoseconds_per_line( view_find, haystacks, nv );
+      const auto b = nanoseconds_per_line( searcher_find<bit::core::boyer_moore_horspool_searcher>, haystacks, nv );
+      const auto c = nanoseconds_per_line( searcher_find<bit::core::simd_searcher>, haystacks, nv );
+
+      std::printf( "%6u %-32.32s %8.1f %10.1f %8.1f %8.2fx\n",
+                   size, needle, a, b, c, a / std::min( b, c ) );
+    }
+  }
+
+  return 0;
+}
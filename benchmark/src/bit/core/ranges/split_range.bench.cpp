@@ -0,0 +1,92 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares the lazy split range against splitting a std::string
+ *        with find and substr into a vector of copies
+ *
+ * Each call sums the lengths of the fields of a comma separated line, so
+ * the work per field is the same and only the splitting differs.
+ *****************************************************************************/
+
+#include <bit/core/ranges/split_range.hpp>
+
+#include "bench_timer.hpp"
+
+#include <cstddef>   // std::size_t
+#include <cstdio>    // std::printf
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+namespace {
+
+  std::size_t substr_split( const std::string& s )
+  {
+    auto fields = std::vector<std::string>{};
+    auto start  = std::size_t{0};
+    for( ;; ) {
+      const auto p = s.find( ',', start );
+      if( p == std::string::npos ) break;
+      fields.push_back( s.substr( start, p - start ) );
+      start = p + 1;
+    }
+    fields.push_back( s.substr( start ) );
+
+    auto total = std::size_t{0};
+    for( const auto& field : fields ) total += field.size();
+    return total;
+  }
+
+  std::size_t lazy_split( const std::string& s )
+  {
+    auto total = std::size_t{0};
+    for( auto field : bit::core::split( bit::core::string_view{s.data(), s.size()}, ',' ) ) {
+      total += field.size();
+    }
+    return total;
+  }
+
+  std::size_t lazy_split_set( const std::string& s )
+  {
+    static const auto delimiters = bit::core::char_set{",;"};
+
+    auto total = std::size_t{0};
+    for( auto field : bit::core::split( bit::core::string_view{s.data(), s.size()}, delimiters ) ) {
+      total += field.size();
+    }
+    return total;
+  }
+
+  using function = std::size_t(*)( const std::string& );
+
+  /// Gets the time of one call in nanoseconds
+  double nanoseconds_per_call( function f, const std::string& s )
+  {
+    return bench::seconds_per_call( f, s ) * 1e9;
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  std::printf( "ns per line\n\n" );
+  std::printf( "%6s %6s %12s %10s %9s %10s\n",
+               "fields", "width", "find+substr", "split", "speedup", "char_set" );
+
+  for( auto width : {4u, 24u, 200u} ) {
+    for( auto fields : {8u, 64u} ) {
+      auto s = std::string{};
+      for( auto i = 0u; i < fields; ++i ) {
+        if( i != 0 ) s += ',';
+        s += std::string( width, static_cast<char>('a' + i % 26) );
+      }
+
+      const auto t0 = nanoseconds_per_call( substr_split, s );
+      const auto t1 = nanoseconds_per_call( lazy_split, s );
+      const auto t2 = nanoseconds_per_call( lazy_split_set, s );
+
+      std::printf( "%6u %6u %12.1f %10.1f %8.1fx %10.1f\n",
+                   fields, width, t0, t1, t0 / t1, t2 );
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,131 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares bit::core::format_to against std::to_string and
+ *        std::snprintf
+ *
+ * Each call formats every value of a list and sums the lengths written.
+ * Floating point values are formatted by snprintf with "%.17g", which
+ * round-trips like format_to but is not the shortest form.
+ *****************************************************************************/
+
+#include <bit/core/utilities/format.hpp>
+
+#include "bench_timer.hpp"
+
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <cstdio>    // std::printf, std::snprintf
+#include <cstring>   // std::memcpy
+#include <string>    // std::to_string
+#include <vector>    // std::vector
+
+namespace {
+
+  template<typename T>
+  using function = std::size_t(*)( const std::vector<T>& );
+
+  std::size_t to_string_integers( const std::vector<long long>& values )
+  {
+    auto total = std::size_t{0};
+    for( auto v : values ) total += std::to_string( v ).size();
+    return total;
+  }
+
+  std::size_t snprintf_integers( const std::vector<long long>& values )
+  {
+    auto total = std::size_t{0};
+    char buffer[32];
+    for( auto v : values ) {
+      total += static_cast<std::size_t>( std::snprintf( buffer, sizeof(buffer), "%lld", v ) );
+    }
+    return total;
+  }
+
+  std::size_t format_integers( const std::vector<long long>& values )
+  {
+    auto total = std::size_t{0};
+    char buffer[32];
+    for( auto v : values ) total += bit::core::format_to( buffer, v ).size();
+    return total;
+  }
+
+  std::size_t snprintf_doubles( const std::vector<double>& values )
+  {
+    auto total = std::size_t{0};
+    char buffer[32];
+    for( auto v : values ) {
+      total += static_cast<std::size_t>( std::snprintf( buffer, sizeof(buffer), "%.17g", v ) );
+    }
+    return total;
+  }
+
+  std::size_t format_doubles( const std::vector<double>& values )
+  {
+    auto total = std::size_t{0};
+    char buffer[32];
+    for( auto v : values ) total += bit::core::format_to( buffer, v ).size();
+    return total;
+  }
+
+  /// Gets the time of one value in nanoseconds
+  template<typename T>
+  double nanoseconds_per_value( function<T> f, const std::vector<T>& values )
+  {
+    return bench::seconds_per_call( f, values ) * 1e9 / static_cast<double>(values.size());
+  }
+
+  std::uint64_t next_random( std::uint64_t& state )
+  {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state ^ (state >> 29);
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  constexpr auto count = 10000;
+
+  auto state = std::uint64_t{1};
+
+  std::printf( "ns per value\n\n" );
+  std::printf( "%-24s %10s %10s %10s %9s\n", "integers", "to_string", "snprintf", "format_to", "speedup" );
+  for( auto bits : {10u, 32u, 63u} ) {
+    auto values = std::vector<long long>{};
+    for( auto i = 0; i < count; ++i ) {
+      values.push_back( static_cast<long long>( next_random( state ) >> (64u - bits) ) );
+    }
+    const auto t0 = nanoseconds_per_value( to_string_integers, values );
+    const auto t1 = nanoseconds_per_value( snprintf_integers, values );
+    const auto t2 = nanoseconds_per_value( format_integers, values );
+
+    std::printf( "%2u-bit %17s %10.1f %10.1f %10.1f %8.1fx\n", bits, "", t0, t1, t2, t1 / t2 );
+  }
+
+  std::printf( "\n%-24s %10s %10s %10s %9s\n", "doubles", "", "%.17g", "format_to", "speedup" );
+  {
+    auto values = std::vector<double>{};
+    for( auto i = 0; i < count; ++i ) {
+      values.push_back( static_cast<double>( next_random( state ) % 1000000u ) / 100.0 );
+    }
+    const auto t1 = nanoseconds_per_value( snprintf_doubles, values );
+    const auto t2 = nanoseconds_per_value( format_doubles, values );
+
+    std::printf( "%-24s %10s %10.1f %10.1f %8.1fx\n", "prices", "", t1, t2, t1 / t2 );
+  }
+  {
+    auto values = std::vector<double>{};
+    while( values.size() < static_cast<std::size_t>(count) ) {
+      const auto bits = next_random( state ) & 0x7fefffffffffffffull;
+      auto d = 0.0;
+      std::memcpy( &d, &bits, sizeof(d) );
+      values.push_back( d );
+    }
+    const auto t1 = nanoseconds_per_value( snprintf_doubles, values );
+    const auto t2 = nanoseconds_per_value( format_doubles, values );
+
+    std::printf( "%-24s %10s %10.1f %10.1f %8.1fx\n", "random bits", "", t1, t2, t1 / t2 );
+  }
+
+  return 0;
+}
@@ -0,0 +1,603 @@
+/*****************************************************************************
+ * \file
+ * \brief Measures the throughput, latency and quality of the library hashes
+ *
+ * Every result is written to stdout as one JSON object per line, so runs can
+ * be stored and compared to find regressions:
+ *
+ * \code
+ * {"suite":"throughput","hash":"wide","size":64,"metric":"gb_per_s","value":9.87}
+ * \endcode
+ *
+ * The suites are:
+ * - throughput   : GB/s hashing keys of a fixed length
+ * - latency      : ns per hash when each key depends on the previous hash
+ * - avalanche    : how far flipping one input bit is from flipping each
+ *                  output bit with probability 1/2 (0 is ideal, 1 is worst)
+ * - distribution : keys landing in an occupied bucket of a table with as
+ *                  many buckets as keys, against a uniformly random hash
+ * - collisions   : full and 32-bit collisions among many distinct keys
+ * - adversarial  : chain lengths in a power-of-two table for integer keys
+ *                  chosen to collide under the unkeyed hashes
+ *
+ * Passing suite names as arguments runs only those suites. All inputs are
+ * generated from fixed seeds, so quality results are reproducible. Hashes
+ * are called through function pointers, so timings of small keys include
+ * the cost of a call.
+ *****************************************************************************/
+
+#include <bit/core/utilities/checksum.hpp>
+#include <bit/core/utilities/hash.hpp>
+#include <bit/core/utilities/keyed_hash.hpp>
+
+#include <algorithm> // std::sort, std::min
+#include <chrono>    // std::chrono::steady_clock
+#include <cmath>     // std::pow, std::fabs, std::sqrt
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <cstdio>    // std::printf, std::snprintf
+#include <cstring>   // std::strcmp, std::memcpy
+#include <random>    // std::mt19937_64
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+namespace {
+
+  //---------------------------------------------------------------------------
+  // Output
+  //---------------------------------------------------------------------------
+
+  void emit( const char* suite,
+             const char* hash,
+             std::size_t size,
+             const char* metric,
+             double value )
+  {
+    std::printf( "{\"suite\":\"%s\",\"hash\":\"%s\",\"size\":%zu,"
+                 "\"metric\":\"%s\",\"value\":%.6g}\n",
+                 suite, hash, size, metric, value );
+    std::fflush( stdout );
+  }
+
+  /// Keeps \p value alive so that the computation producing it is not
+  /// discarded
+  template<typename T>
+  void do_not_optimize( const T& value )
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile( "" : : "r,m"(value) : "memory" );
+#else
+    static volatile T sink;
+    sink = value;
+#endif
+  }
+
+  template<typename Fn>
+  double best_seconds( int repetitions, Fn fn )
+  {
+    auto best = 1e300;
+    for( auto i = 0; i < repetitions; ++i ) {
+      const auto start = std::chrono::steady_clock::now();
+      fn();
+      const auto end = std::chrono::steady_clock::now();
+
+      best = std::min( best, std::chrono::duration<double>( end - start ).count() );
+    }
+    return best;
+  }
+
+  //---------------------------------------------------------------------------
+  // Hashes under test
+  //---------------------------------------------------------------------------
+
+  // A fixed key keeps keyed results reproducible between runs
+  constexpr auto bench_key = bit::core::hash_key{
+    0x0123456789abcdefull, 0xfedcba9876543210ull
+  };
+
+  struct string_hash
+  {
+    const char* name;
+    bit::core::hash_t (*function)( const char*, std::size_t );
+  };
+
+  const string_hash string_hashes[] = {
+    { "default", []( const char* p, std::size_t n ) {
+        return bit::core::hash_string_segment( p, n );
+    } },
+    { "wide", []( const char* p, std::size_t n ) {
+        return bit::core::hash_string_segment( p, n, bit::core::wide_hash_policy{} );
+    } },
+    { "fnv1", []( const char* p, std::size_t n ) {
+        return bit::core::hash_string_segment( p, n, bit::core::fnv1_hash_policy{} );
+    } },
+    { "keyed", []( const char* p, std::size_t n ) {
+        return bit::core::hash_string_segment( p, n, bit::core::keyed_hash_policy{ bench_key } );
+    } },
+  };
+
+  struct integer_hash
+  {
+    const char* name;
+    bit::core::hash_t (*function)( std::uint64_t );
+  };
+
+  const integer_hash integer_hashes[] = {
+    { "hash<uint64_t>", []( std::uint64_t k ) {
+        return bit::core::hash<std::uint64_t>{}( k );
+    } },
+    { "mixed_hash<uint64_t>", []( std::uint64_t k ) {
+        return bit::core::mixed_hash<std::uint64_t>{}( k );
+    } },
+    { "keyed_hash<uint64_t>", []( std::uint64_t k ) {
+        return bit::core::keyed_hash<std::uint64_t>{ bench_key }( k );
+    } },
+    { "hash_combine", []( std::uint64_t k ) {
+        return bit::core::hash_combine( static_cast<bit::core::hash_t>(k >> 32),
+                                        static_cast<bit::core::hash_t>(k & 0xffffffffu) );
+    } },
+    { "hash_combine_mixed", []( std::uint64_t k ) {
+        return bit::core::hash_combine_mixed( static_cast<bit::core::hash_t>(k >> 32),
+                                              static_cast<bit::core::hash_t>(k & 0xffffffffu) );
+    } },
+    { "hash_combine_keyed", []( std::uint64_t k ) {
+        return bit::core::hash_combine_keyed( bench_key,
+                                              static_cast<bit::core::hash_t>(k >> 32),
+                                              static_cast<bit::core::hash_t>(k & 0xffffffffu) );
+    } },
+  };
+
+  std::vector<char> make_random_bytes( std::size_t size, std::uint64_t seed )
+  {
+    auto engine = std::mt19937_64{ seed };
+    auto result = std::vector<char>( size );
+    for( auto& c : result ) {
+      c = static_cast<char>( engine() );
+    }
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  // Throughput
+  //---------------------------------------------------------------------------
+
+  void run_throughput()
+  {
+    constexpr auto buffer_size = std::size_t{1} << 20;
+    constexpr auto total_bytes = std::size_t{1} << 25;
+
+    const auto buffer = make_random_bytes( buffer_size, 1u );
+    const std::size_t sizes[] = { 4u, 8u, 16u, 32u, 64u, 256u, 1024u, 4096u, 65536u };
+
+    const auto report = [&]( const char* name, std::size_t size, auto fn ) {
+      const auto keys = buffer_size / size;
+      const auto passes = std::max( std::size_t{1}, total_bytes / buffer_size );
+
+      const auto seconds = best_seconds( 3, [&]{
+        for( auto pass = std::size_t{0}; pass < passes; ++pass ) {
+          for( auto i = std::size_t{0}; i < keys; ++i ) {
+            do_not_optimize( fn( buffer.data() + i * size, size ) );
+          }
+        }
+      });
+      const auto bytes = static_cast<double>(passes * keys * size);
+      emit( "throughput", name, size, "gb_per_s", bytes / seconds / 1e9 );
+    };
+
+    for( auto size : sizes ) {
+      for( const auto& h : string_hashes ) {
+        report( h.name, size, h.function );
+      }
+      report( "crc32c", size, []( const char* p, std::size_t n ) {
+        return bit::core::crc32c( { reinterpret_cast<const bit::core::byte*>(p),
+                                    static_cast<std::ptrdiff_t>(n) } );
+      });
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // Latency
+  //---------------------------------------------------------------------------
+
+  void run_latency()
+  {
+    constexpr auto buffer_size = std::size_t{1} << 12;
+    constexpr auto iterations  = std::size_t{1} << 22;
+
+    const auto buffer = make_random_bytes( buffer_size + 64u, 2u );
+    const std::size_t sizes[] = { 1u, 2u, 4u, 8u, 12u, 16u, 24u, 32u, 64u };
+
+    for( auto size : sizes ) {
+      for( const auto& h : string_hashes ) {
+        auto hash = bit::core::hash_t{};
+
+        // Each key starts where the previous hash says, so hashes can not
+        // overlap and the time per hash is its latency
+        const auto seconds = best_seconds( 3, [&]{
+          for( auto i = std::size_t{0}; i < iterations; ++i ) {
+            const auto offset = static_cast<std::size_t>(hash) & (buffer_size - 1u);
+            hash = h.function( buffer.data() + offset, size );
+          }
+          do_not_optimize( hash );
+        });
+        emit( "latency", h.name, size, "ns", seconds * 1e9 / iterations );
+      }
+    }
+
+    for( const auto& h : integer_hashes ) {
+      auto hash = bit::core::hash_t{};
+
+      const auto seconds = best_seconds( 3, [&]{
+        for( auto i = std::size_t{0}; i < iterations; ++i ) {
+          hash = h.function( static_cast<std::uint64_t>(hash) + i );
+        }
+        do_not_optimize( hash );
+      });
+      emit( "latency", h.name, sizeof(std::uint64_t), "ns", seconds * 1e9 / iterations );
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // Avalanche
+  //---------------------------------------------------------------------------
+
+  constexpr auto hash_bits = sizeof(bit::core::hash_t) * 8u;
+  constexpr auto avalanche_trials = 1000u;
+
+  /// Flips every input bit of \p trials random inputs of \p size bytes, and
+  /// reports the mean and worst deviation from a 1/2 chance of each output
+  /// bit flipping
+  template<typename Fn>
+  void report_avalanche( const char* name, std::size_t size, Fn fn )
+  {
+    const auto input_bits = size * 8u;
+    auto flips = std::vector<std::size_t>( input_bits * hash_bits, 0u );
+    auto engine = std::mt19937_64{ 3u };
+    auto input = std::vector<char>( size );
+
+    for( auto t = 0u; t < avalanche_trials; ++t ) {
+      for( auto& c : input ) c = static_cast<char>( engine() );
+      const auto base = static_cast<std::uint64_t>( fn( input.data(), size ) );
+
+      for( auto bit = std::size_t{0}; bit < input_bits; ++bit ) {
+        input[bit / 8u] ^= static_cast<char>( 1u << (bit % 8u) );
+        const auto diff = base ^ static_cast<std::uint64_t>( fn( input.data(), size ) );
+        input[bit / 8u] ^= static_cast<char>( 1u << (bit % 8u) );
+
+        for( auto out = std::size_t{0}; out < hash_bits; ++out ) {
+          flips[bit * hash_bits + out] += (diff >> out) & 1u;
+        }
+      }
+    }
+
+    auto total = 0.0;
+    auto worst = 0.0;
+    for( auto count : flips ) {
+      const auto bias = std::fabs( 2.0 * static_cast<double>(count) / avalanche_trials - 1.0 );
+      total += bias;
+      worst  = std::max( worst, bias );
+    }
+    emit( "avalanche", name, size, "mean_bias", total / static_cast<double>(flips.size()) );
+    emit( "avalanche", name, size, "worst_bias", worst );
+  }
+
+  void run_avalanche()
+  {
+    const std::size_t sizes[] = { 4u, 8u, 16u, 32u };
+
+    // Sampling noise alone gives an ideal hash a mean bias of about
+    // sqrt(2 / (pi * trials))
+    emit( "avalanche", "random", 0u, "mean_bias",
+          std::sqrt( 2.0 / (3.14159265358979 * avalanche_trials) ) );
+
+    for( auto size : sizes ) {
+      for( const auto& h : string_hashes ) {
+        report_avalanche( h.name, size, h.function );
+      }
+    }
+
+    for( const auto& h : integer_hashes ) {
+      report_avalanche( h.name, sizeof(std::uint64_t), [&]( const char* p, std::size_t ) {
+        auto key = std::uint64_t{};
+        std::memcpy( &key, p, sizeof(key) );
+        return h.function( key );
+      });
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // Key sets
+  //---------------------------------------------------------------------------
+
+  struct key_set
+  {
+    const char* name;
+    std::vector<std::string> keys;
+  };
+
+  /// Builds the string key shapes that tables commonly hold
+  std::vector<key_set> make_key_sets( std::size_t count )
+  {
+    auto result = std::vector<key_set>{};
+    char buffer[64];
+
+    auto ids = key_set{ "ids", {} };
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      std::snprintf( buffer, sizeof(buffer), "%zu", i );
+      ids.keys.emplace_back( buffer );
+    }
+    result.push_back( std::move(ids) );
+
+    auto prefixed = key_set{ "prefixed", {} };
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      std::snprintf( buffer, sizeof(buffer), "user:session:%08zu", i );
+      prefixed.keys.emplace_back( buffer );
+    }
+    result.push_back( std::move(prefixed) );
+
+    auto paths = key_set{ "paths", {} };
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      std::snprintf( buffer, sizeof(buffer), "assets/%zu/%zu/file%zu.dat",
+                     i % 16u, (i / 16u) % 64u, i );
+      paths.keys.emplace_back( buffer );
+    }
+    result.push_back( std::move(paths) );
+
+    auto words = key_set{ "words", {} };
+    auto engine = std::mt19937_64{ 4u };
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      auto key = std::string( 3u + engine() % 12u, ' ' );
+      for( auto& c : key ) c = static_cast<char>( 'a' + engine() % 26u );
+      key += std::to_string( i ); // keep keys distinct
+      words.keys.push_back( std::move(key) );
+    }
+    result.push_back( std::move(words) );
+
+    return result;
+  }
+
+  std::vector<std::uint64_t> make_integer_keys( std::size_t count,
+                                                unsigned shift )
+  {
+    auto result = std::vector<std::uint64_t>( count );
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      result[i] = static_cast<std::uint64_t>(i) << shift;
+    }
+    return result;
+  }
+
+  //---------------------------------------------------------------------------
+  // Distribution
+  //---------------------------------------------------------------------------
+
+  /// Counts the keys that land in an occupied bucket when \p hashes are
+  /// placed in as many power-of-two buckets
+  std::size_t count_bucket_collisions( const std::vector<std::uint64_t>& hashes )
+  {
+    const auto mask = hashes.size() - 1u;
+    auto used = std::vector<bool>( hashes.size(), false );
+    auto collisions = std::size_t{0};
+
+    for( auto h : hashes ) {
+      auto slot = used[static_cast<std::size_t>(h & mask)];
+      collisions += slot ? 1u : 0u;
+      slot = true;
+    }
+    return collisions;
+  }
+
+  void report_distribution( const char* hash,
+                            const char* keys,
+                            const std::vector<std::uint64_t>& hashes )
+  {
+    const auto name = std::string{ hash } + "/" + keys;
+    emit( "distribution", name.c_str(), hashes.size(), "collisions",
+          static_cast<double>( count_bucket_collisions( hashes ) ) );
+  }
+
+  void run_distribution()
+  {
+    constexpr auto count = std::size_t{1} << 16;
+
+    // With as many buckets as keys, a uniformly random hash leaves
+    // n(1 - 1/n)^n buckets empty, and so has that many collisions
+    const auto n = static_cast<double>(count);
+    emit( "distribution", "random", count, "collisions", n * std::pow( 1.0 - 1.0 / n, n ) );
+
+    for( const auto& set : make_key_sets( count ) ) {
+      for( const auto& h : string_hashes ) {
+        auto hashes = std::vector<std::uint64_t>{};
+        for( const auto& key : set.keys ) {
+          hashes.push_back( static_cast<std::uint64_t>( h.function( key.data(), key.size() ) ) );
+        }
+        report_distribution( h.name, set.name, hashes );
+      }
+    }
+
+    const struct { const char* name; unsigned shift; } integer_sets[] = {
+      { "sequential", 0u }, { "sequential<<8", 8u }, { "sequential<<32", 32u },
+    };
+    for( const auto& set : integer_sets ) {
+      const auto keys = make_integer_keys( count, set.shift );
+      for( const auto& h : integer_hashes ) {
+        auto hashes = std::vector<std::uint64_t>{};
+        for( auto key : keys ) {
+          hashes.push_back( static_cast<std::uint64_t>( h.function( key ) ) );
+        }
+        report_distribution( h.name, set.name, hashes );
+      }
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // Collisions
+  //---------------------------------------------------------------------------
+
+  std::size_t count_duplicates( std::vector<std::uint64_t> values )
+  {
+    std::sort( values.begin(), values.end() );
+
+    auto result = std::size_t{0};
+    for( auto i = std::size_t{1}; i < values.size(); ++i ) {
+      result += (values[i] == values[i - 1]) ? 1u : 0u;
+    }
+    return result;
+  }
+
+  void report_collisions( const char* hash,
+                          const char* keys,
+                          std::vector<std::uint64_t> hashes )
+  {
+    const auto name  = std::string{ hash } + "/" + keys;
+    const auto count = hashes.size();
+    emit( "collisions", name.c_str(), count, "full",
+          static_cast<double>( count_duplicates( hashes ) ) );
+
+    for( auto& h : hashes ) {
+      h &= 0xffffffffu;
+    }
+    emit( "collisions", name.c_str(), count, "low32",
+          static_cast<double>( count_duplicates( std::move(hashes) ) ) );
+  }
+
+  void run_collisions()
+  {
+    constexpr auto count = std::size_t{1} << 20;
+
+    // n keys share about n^2 / 2^33 of 2^32 possible low halves
+    const auto n = static_cast<double>(count);
+    emit( "collisions", "random", count, "low32", n * n / std::pow( 2.0, 33.0 ) );
+
+    for( const auto& set : make_key_sets( count ) ) {
+      for( const auto& h : string_hashes ) {
+        auto hashes = std::vector<std::uint64_t>{};
+        hashes.reserve( count );
+        for( const auto& key : set.keys ) {
+          hashes.push_back( static_cast<std::uint64_t>( h.function( key.data(), key.size() ) ) );
+        }
+        report_collisions( h.name, set.name, std::move(hashes) );
+      }
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // Adversarial
+  //---------------------------------------------------------------------------
+
+  /// Inverts x ^= x >> shift
+  std::uint64_t unxorshift( std::uint64_t x, unsigned shift )
+  {
+    auto result = x;
+    for( auto i = 0u; i < 64u / shift; ++i ) {
+      result = x ^ (result >> shift);
+    }
+    return result;
+  }
+
+  /// Computes the inverse of the odd \p value modulo 2^64
+  std::uint64_t inverse( std::uint64_t value )
+  {
+    auto result = value;
+    for( auto i = 0; i < 5; ++i ) {
+      result *= 2u - value * result;
+    }
+    return result;
+  }
+
+  /// Inverts the 64-bit hash_mix, which an attacker can do just as easily
+  std::uint64_t unmix( std::uint64_t h )
+  {
+    h = unxorshift( h, 31u );
+    h *= inverse( 0x94d049bb133111ebull );
+    h = unxorshift( h, 27u );
+    h *= inverse( 0xbf58476d1ce4e5b9ull );
+    h = unxorshift( h, 30u );
+    return h;
+  }
+
+  /// Reports the longest chain and the mean number of keys compared per
+  /// successful lookup in a chained table with as many buckets as keys
+  void report_chains( const char* hash,
+                      const char* keys,
+                      const std::vector<std::uint64_t>& hashes )
+  {
+    const auto mask = hashes.size() - 1u;
+    auto loads = std::vector<std::size_t>( hashes.size(), 0u );
+    for( auto h : hashes ) {
+      ++loads[static_cast<std::size_t>(h & mask)];
+    }
+
+    auto longest = std::size_t{0};
+    auto compares = 0.0;
+    for( auto load : loads ) {
+      longest   = std::max( longest, load );
+      compares += 0.5 * static_cast<double>(load) * static_cast<double>(load + 1u);
+    }
+
+    const auto name = std::string{ hash } + "/" + keys;
+    emit( "adversarial", name.c_str(), hashes.size(), "longest_chain",
+          static_cast<double>(longest) );
+    emit( "adversarial", name.c_str(), hashes.size(), "mean_compares",
+          compares / static_cast<double>(hashes.size()) );
+  }
+
+  void run_adversarial()
+  {
+    constexpr auto count = std::size_t{1} << 12;
+    constexpr auto shift = 12u;
+
+    // Keys chosen so that the unkeyed integer hashes put them all in bucket 0
+    const auto multiples = make_integer_keys( count, shift );
+
+    auto preimages = std::vector<std::uint64_t>( count );
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      preimages[i] = unmix( static_cast<std::uint64_t>(i) << shift );
+    }
+
+    const struct { const char* name; const std::vector<std::uint64_t>& keys; } sets[] = {
+      { "multiples", multiples }, { "mix_preimages", preimages },
+    };
+
+    for( const auto& set : sets ) {
+      for( const auto& h : integer_hashes ) {
+        auto hashes = std::vector<std::uint64_t>{};
+        for( auto key : set.keys ) {
+          hashes.push_back( static_cast<std::uint64_t>( h.function( key ) ) );
+        }
+        report_chains( h.name, set.name, hashes );
+      }
+    }
+  }
+
+  //---------------------------------------------------------------------------
+
+  struct suite
+  {
+    const char* name;
+    void (*run)();
+  };
+
+  const suite suites[] = {
+    { "throughput",   &run_throughput },
+    { "latency",      &run_latency },
+    { "avalanche",    &run_avalanche },
+    { "distribution", &run_distribution },
+    { "collisions",   &run_collisions },
+    { "adversarial",  &run_adversarial },
+  };
+
+} // anonymous namespace
+
+int main( int argc, char** argv )
+{
+  for( const auto& s : suites ) {
+    auto selected = (argc <= 1);
+    for( auto i = 1; i < argc; ++i ) {
+      selected = selected || (std::strcmp( argv[i], s.name ) == 0);
+    }
+    if( selected ) {
+      s.run();
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,187 @@
+/*****************************************************************************
+ * \file
+ * \brief Measures how evenly integer and pointer hashes are distributed
+ *        over power-of-two bucket tables
+ *
+ * Each key set is inserted into a table with as many buckets as keys, and
+ * the number of colliding keys is compared against the number expected
+ * from a uniformly random hash.
+ *****************************************************************************/
+
+#include <bit/core/utilities/hash.hpp>
+
+#include <algorithm> // std::max_element, std::count
+#include <chrono>    // std::chrono::steady_clock
+#include <cmath>     // std::pow
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <cstdio>    // std::printf
+#include <vector>    // std::vector
+
+namespace {
+
+  constexpr auto key_count = std::size_t{1} << 16;
+
+  struct distribution
+  {
+    std::size_t collisions; ///< Keys that landed in an occupied bucket
+    std::size_t max_load;   ///< Largest number of keys in one bucket
+  };
+
+  distribution measure( const std::vector<bit::core::hash_t>& hashes )
+  {
+    const auto mask = hashes.size() - 1;
+    auto loads = std::vector<std::size_t>( hashes.size(), 0u );
+
+    for( auto h : hashes ) {
+      ++loads[static_cast<std::size_t>(h) & mask];
+    }
+
+    // With as many buckets as keys, every empty bucket implies a collision
+    const auto empty = static_cast<std::size_t>( std::count( loads.begin(), loads.end(), 0u ) );
+
+    return { empty, *std::max_element( loads.begin(), loads.end() ) };
+  }
+
+  /// Collisions expected when n keys are hashed uniformly into n buckets
+  double expected_collisions( std::size_t n )
+  {
+    const auto buckets = static_cast<double>(n);
+    const auto used    = buckets * (1.0 - std::pow( 1.0 - 1.0 / buckets, buckets ));
+
+    return buckets - used;
+  }
+
+  template<typename Key, typename Hasher>
+  std::vector<bit::core::hash_t> hash_all( const std::vector<Key>& keys,
+                                           Hasher hasher )
+  {
+    auto result = std::vector<bit::core::hash_t>{};
+    result.reserve( keys.size() );
+    for( const auto& key : keys ) {
+      result.push_back( hasher(key) );
+    }
+    return result;
+  }
+
+  void report( const char* name,
+               const std::vector<bit::core::hash_t>& identity,
+               const std::vector<bit::core::hash_t>& mixed )
+  {
+    const auto a = measure( identity );
+    const auto b = measure( mixed );
+
+    std::printf( "%-28s %12zu %10zu %12zu %10zu %12.0f\n",
+                 name,
+                 a.collisions, a.max_load,
+                 b.collisions, b.max_load,
+                 expected_collisions( identity.size() ) );
+  }
+
+  template<typename Key>
+  void report_keys( const char* name, const std::vector<Key>& keys )
+  {
+    report( name,
+            hash_all( keys, bit::core::hash<Key>{} ),
+            hash_all( keys, bit::core::mixed_hash<Key>{} ) );
+  }
+
+  //---------------------------------------------------------------------------
+
+  template<typename Hasher>
+  double nanoseconds_per_key( const std::vector<std::uint64_t>& keys,
+                              Hasher hasher )
+  {
+    constexpr auto iterations = 200;
+
+    auto sink  = std::size_t{0};
+    const auto start = std::chrono::steady_clock::now();
+    for( auto i = 0; i < iterations; ++i ) {
+      for( auto key : keys ) {
+        sink += static_cast<std::size_t>( hasher(key) );
+      }
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    // Prevent the loop from being discarded
+    if( sink == 1 ) std::printf( " " );
+
+    const auto elapsed = std::chrono::duration<double,std::nano>( end - start ).count();
+    return elapsed / static_cast<double>(iterations * keys.size());
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  std::printf( "%zu keys into %zu buckets\n\n", key_count, key_count );
+  std::printf( "%-28s %12s %10s %12s %10s %12s\n",
+               "keys", "hash", "max load", "mixed_hash", "max load", "random" );
+
+  // Integers
+  {
+    auto keys = std::vector<std::uint64_t>( key_count );
+
+    for( auto i = std::size_t{0}; i < key_count; ++i ) keys[i] = i;
+    report_keys( "sequential", keys );
+
+    for( auto i = std::size_t{0}; i < key_count; ++i ) keys[i] = i << 8;
+    report_keys( "sequential << 8", keys );
+
+    for( auto i = std::size_t{0}; i < key_count; ++i ) keys[i] = i << 32;
+    report_keys( "sequential << 32", keys );
+
+    for( auto i = std::size_t{0}; i < key_count; ++i ) keys[i] = i * 1000;
+    report_keys( "multiples of 1000", keys );
+  }
+
+  // Pointers
+  {
+    // The pointers are only hashed, never dereferenced, so the addresses are
+    // generated from a page-aligned base rather than backed by storage
+    auto storage = std::vector<char>( 4096 );
+    const auto base = (reinterpret_cast<std::uintptr_t>(storage.data()) + 4095u) & ~std::uintptr_t{4095u};
+
+    auto keys = std::vector<const char*>( key_count );
+    const auto make_keys = [&]( std::size_t stride ) {
+      for( auto i = std::size_t{0}; i < key_count; ++i ) {
+        keys[i] = reinterpret_cast<const char*>( base + i * stride );
+      }
+    };
+
+    make_keys( 16 );
+    report_keys( "pointers aligned to 16", keys );
+
+    make_keys( 64 );
+    report_keys( "pointers aligned to 64", keys );
+
+    make_keys( 4096 );
+    report_keys( "pointers aligned to 4096", keys );
+  }
+
+  // Pairs of small integers
+  {
+    auto combined = std::vector<bit::core::hash_t>{};
+    auto mixed    = std::vector<bit::core::hash_t>{};
+    for( auto i = std::size_t{0}; i < 256; ++i ) {
+      for( auto j = std::size_t{0}; j < key_count / 256; ++j ) {
+        combined.push_back( bit::core::hash_combine( bit::core::hash_value(i), bit::core::hash_value(j) ) );
+        mixed.push_back( bit::core::hash_combine_mixed( bit::core::hash_value(i), bit::core::hash_value(j) ) );
+      }
+    }
+    report( "pairs (combine)", combined, mixed );
+  }
+
+  // Cost of mixing
+  {
+    auto keys = std::vector<std::uint64_t>( 4096 );
+    for( auto i = std::size_t{0}; i < keys.size(); ++i ) keys[i] = i;
+
+    std::printf( "\n%-28s %8.2f ns\n", "hash<uint64_t>",
+                 nanoseconds_per_key( keys, bit::core::hash<std::uint64_t>{} ) );
+    std::printf( "%-28s %8.2f ns\n", "mixed_hash<uint64_t>",
+                 nanoseconds_per_key( keys, bit::core::mixed_hash<std::uint64_t>{} ) );
+  }
+
+  return 0;
+}
@@ -0,0 +1,106 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares hashing short keys one at a time against hash_many
+ *
+ * Keys are stored in separately allocated strings visited in a shuffled
+ * order, so that larger key sets also measure the cost of reaching each
+ * key's characters.
+ *****************************************************************************/
+
+#include <bit/core/utilities/hash_many.hpp>
+
+#include <algorithm> // std::shuffle
+#include <chrono>    // std::chrono::steady_clock
+#include <cstddef>   // std::size_t
+#include <cstdio>    // std::printf
+#include <memory>    // std::unique_ptr
+#include <random>    // std::mt19937
+#include <vector>    // std::vector
+
+namespace {
+
+  struct key_set
+  {
+    std::vector<std::unique_ptr<char[]>>  storage;
+    std::vector<bit::core::string_view>   views;
+  };
+
+  key_set make_keys( std::size_t count, std::size_t min_length, std::size_t max_length )
+  {
+    auto engine = std::mt19937{ 42u };
+    auto length = std::uniform_int_distribution<std::size_t>{ min_length, max_length };
+    auto letter = std::uniform_int_distribution<int>{ 'a', 'z' };
+
+    auto result = key_set{};
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      const auto n = length( engine );
+      auto key = std::unique_ptr<char[]>( new char[n + 1] );
+      for( auto j = std::size_t{0}; j < n; ++j ) {
+        key[j] = static_cast<char>( letter( engine ) );
+      }
+      result.views.emplace_back( key.get(), n );
+      result.storage.push_back( std::move(key) );
+    }
+    std::shuffle( result.views.begin(), result.views.end(), engine );
+    return result;
+  }
+
+  template<typename Fn>
+  double nanoseconds_per_key( std::size_t keys, Fn fn )
+  {
+    const auto iterations = std::max( std::size_t{1}, (std::size_t{1} << 24) / keys );
+
+    const auto start = std::chrono::steady_clock::now();
+    for( auto i = std::size_t{0}; i < iterations; ++i ) {
+      fn();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const auto elapsed = std::chrono::duration<double,std::nano>( end - start ).count();
+    return elapsed / static_cast<double>(iterations * keys);
+  }
+
+  template<typename HashPolicy>
+  void report( const char* name, const key_set& keys, HashPolicy policy )
+  {
+    const auto& views = keys.views;
+    auto hashes = std::vector<bit::core::hash_t>( views.size() );
+
+    const auto single = nanoseconds_per_key( views.size(), [&]{
+      for( auto i = std::size_t{0}; i < views.size(); ++i ) {
+        hashes[i] = policy( views[i].data(), views[i].size() );
+      }
+    });
+    const auto batch = nanoseconds_per_key( views.size(), [&]{
+      bit::core::detail::hash_many_strings( views.data(), views.size(), hashes.data(), policy );
+    });
+
+    std::printf( "%-14s %10zu %12.2f %12.2f %8.2fx\n",
+                 name, views.size(), single, batch, single / batch );
+  }
+
+  void report_sizes( std::size_t min_length, std::size_t max_length )
+  {
+    for( auto count : { std::size_t{1} << 10, std::size_t{1} << 20 } ) {
+      const auto keys = make_keys( count, min_length, max_length );
+
+      report( "wide", keys, bit::core::wide_hash_policy{} );
+      report( "fnv1", keys, bit::core::fnv1_hash_policy{} );
+    }
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  std::printf( "%-14s %10s %12s %12s %9s\n",
+               "policy", "keys", "single ns", "batch ns", "speedup" );
+
+  std::printf( "\nkeys of 4 to 16 characters\n" );
+  report_sizes( 4u, 16u );
+
+  std::printf( "\nkeys of 8 to 64 characters\n" );
+  report_sizes( 8u, 64u );
+
+  return 0;
+}
@@ -0,0 +1,196 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares bit::core::parse against strtoll and strtod
+ *
+ * Each call parses every number of a list of comma separated values, so
+ * that the per-call overhead of the C functions is included. The C
+ * functions need a null terminated copy of a string_view, which is the
+ * common case when the numbers come from a larger buffer; the "in place"
+ * columns skip that copy.
+ *****************************************************************************/
+
+#include <bit/core/utilities/parse.hpp>
+
+#include "bench_timer.hpp"
+
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <cstdio>    // std::printf, std::snprintf
+#include <cstdlib>   // std::strtod, std::strtoll
+#include <cstring>   // std::memcpy
+#include <string>    // std::string
+#include <vector>    // std::vector
+
+namespace {
+
+  using fields = std::vector<bit::core::string_view>;
+
+  double parse_integers( const fields& f )
+  {
+    auto sum = 0.0;
+    for( auto s : f ) {
+      const auto r = bit::core::parse<long long>( s );
+      sum += static_cast<double>( r ? *r : 0 );
+    }
+    return sum;
+  }
+
+  double strtoll_copy( const fields& f )
+  {
+    auto sum = 0.0;
+    char buffer[64];
+    for( auto s : f ) {
+      std::memcpy( buffer, s.data(), s.size() );
+      buffer[s.size()] = '\0';
+      sum += static_cast<double>( std::strtoll( buffer, nullptr, 10 ) );
+    }
+    return sum;
+  }
+
+  double strtoll_in_place( const fields& f )
+  {
+    auto sum = 0.0;
+    for( auto s : f ) {
+      sum += static_cast<double>( std::strtoll( s.data(), nullptr, 10 ) );
+    }
+    return sum;
+  }
+
+  double parse_doubles( const fields& f )
+  {
+    auto sum = 0.0;
+    for( auto s : f ) {
+      const auto r = bit::core::parse<double>( s );
+      sum += r ? *r : 0.0;
+    }
+    return sum;
+  }
+
+  double strtod_copy( const fields& f )
+  {
+    auto sum = 0.0;
+    char buffer[64];
+    for( auto s : f ) {
+      std::memcpy( buffer, s.data(), s.size() );
+      buffer[s.size()] = '\0';
+      sum += std::strtod( buffer, nullptr );
+    }
+    return sum;
+  }
+
+  double strtod_in_place( const fields& f )
+  {
+    auto sum = 0.0;
+    for( auto s : f ) {
+      sum += std::strtod( s.data(), nullptr );
+    }
+    return sum;
+  }
+
+  using function = double(*)( const fields& );
+
+  /// Gets the time of one number in nanoseconds
+  double nanoseconds_per_number( function f, const fields& numbers )
+  {
+    return bench::seconds_per_call( f, numbers ) * 1e9 / static_cast<double>(numbers.size());
+  }
+
+  /// Splits \p text at each comma
+  fields split_fields( const std::string& text )
+  {
+    auto result = fields{};
+    auto start  = std::size_t{0};
+    for( auto i = std::size_t{0}; i <= text.size(); ++i ) {
+      if( i == text.size() || text[i] == ',' ) {
+        result.emplace_back( text.data() + start, i - start );
+        start = i + 1;
+      }
+    }
+    return result;
+  }
+
+  std::uint64_t next_random( std::uint64_t& state )
+  {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state ^ (state >> 29);
+  }
+
+  void report( const char* name,
+               const std::string& text,
+               function parse,
+               function copy,
+               function in_place )
+  {
+    const auto numbers = split_fields( text );
+    const auto t0 = nanoseconds_per_number( copy, numbers );
+    const auto t1 = nanoseconds_per_number( in_place, numbers );
+    const auto t2 = nanoseconds_per_number( parse, numbers );
+
+    std::printf( "%-24s %10.1f %10.1f %10.1f %8.1fx\n", name, t0, t1, t2, t0 / t2 );
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  constexpr auto count = 10000;
+
+  std::printf( "ns per number\n\n" );
+  std::printf( "%-24s %10s %10s %10s %9s\n", "input", "strto*", "in place", "parse", "speedup" );
+
+  auto state = std::uint64_t{1};
+  char buffer[64];
+
+  {
+    auto text = std::string{};
+    for( auto i = 0; i < count; ++i ) {
+      if( i != 0 ) text += ',';
+      text += std::to_string( next_random( state ) % 1000u );
+    }
+    report( "integers, 1-3 digits", text, parse_integers, strtoll_copy, strtoll_in_place );
+  }
+  {
+    auto text = std::string{};
+    for( auto i = 0; i < count; ++i ) {
+      if( i != 0 ) text += ',';
+      text += std::to_string( static_cast<long long>( next_random( state ) >> 1 ) );
+    }
+    report( "integers, 19 digits", text, parse_integers, strtoll_copy, strtoll_in_place );
+  }
+  {
+    auto text = std::string{};
+    for( auto i = 0; i < count; ++i ) {
+      if( i != 0 ) text += ',';
+      std::snprintf( buffer, sizeof(buffer), "%.2f",
+                     static_cast<double>( next_random( state ) % 100000u ) / 7.0 );
+      text += buffer;
+    }
+    report( "prices, %.2f", text, parse_doubles, strtod_copy, strtod_in_place );
+  }
+  {
+    auto text = std::string{};
+    for( auto i = 0; i < count; ++i ) {
+      if( i != 0 ) text += ',';
+      const auto bits = (next_random( state ) & 0x000fffffffffffffull) | 0x3ff0000000000000ull;
+      auto d = 0.0;
+      std::memcpy( &d, &bits, sizeof(d) );
+      std::snprintf( buffer, sizeof(buffer), "%.17g", d );
+      text += buffer;
+    }
+    report( "doubles in [1,2), %.17g", text, parse_doubles, strtod_copy, strtod_in_place );
+  }
+  {
+    auto text = std::string{};
+    for( auto i = 0; i < count; ++i ) {
+      if( i != 0 ) text += ',';
+      auto bits = next_random( state ) & 0x7fefffffffffffffull;
+      auto d = 0.0;
+      std::memcpy( &d, &bits, sizeof(d) );
+      std::snprintf( buffer, sizeof(buffer), "%.17g", d );
+      text += buffer;
+    }
+    report( "random doubles, %.17g", text, parse_doubles, strtod_copy, strtod_in_place );
+  }
+
+  return 0;
+}
@@ -0,0 +1,206 @@
+/*****************************************************************************
+ * \file
+ * \brief Compares the UTF-8 validation and conversion of bit::core against
+ *        std::codecvt_utf8 and std::codecvt_utf8_utf16
+ *
+ * Each text is about 1 MiB of UTF-8, built from a fixed alphabet whose mix
+ * of sequence lengths resembles the named script. Throughput is measured in
+ * bytes of UTF-8 per second in every direction.
+ *
+ * The vectorized paths need SSSE3 or AVX2; configure with, for example,
+ * -DCMAKE_CXX_FLAGS=-march=native to measure them.
+ *****************************************************************************/
+
+#include <bit/core/utilities/unicode.hpp>
+
+#include "bench_timer.hpp"
+
+#include <codecvt>   // std::codecvt_utf8, std::codecvt_utf8_utf16
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <cstdio>    // std::printf
+#include <cwchar>    // std::mbstate_t
+#include <string>    // std::string, std::u16string
+#include <vector>    // std::vector
+
+namespace {
+
+  struct text
+  {
+    std::string    utf8;
+    std::u16string utf16;
+    mutable std::vector<char>     bytes;
+    mutable std::vector<char16_t> units;
+    mutable std::vector<char32_t> points;
+  };
+
+  using function = std::size_t(*)( const text& );
+
+  //---------------------------------------------------------------------------
+  // std::codecvt
+  //---------------------------------------------------------------------------
+
+  std::size_t codecvt_validate( const text& t )
+  {
+    static const std::codecvt_utf8<char32_t> cvt;
+    auto state = std::mbstate_t{};
+    const auto* first = t.utf8.data();
+    const auto* last  = first + t.utf8.size();
+
+    return static_cast<std::size_t>( cvt.length( state, first, last, t.utf8.size() ) );
+  }
+
+  std::size_t codecvt_utf8_to_utf16( const text& t )
+  {
+    static const std::codecvt_utf8_utf16<char16_t> cvt;
+    auto state = std::mbstate_t{};
+    const char* next = nullptr;
+    char16_t* out = nullptr;
+    cvt.in( state, t.utf8.data(), t.utf8.data() + t.utf8.size(), next,
+            t.units.data(), t.units.data() + t.units.size(), out );
+
+    return static_cast<std::size_t>( out - t.units.data() );
+  }
+
+  std::size_t codecvt_utf8_to_utf32( const text& t )
+  {
+    static const std::codecvt_utf8<char32_t> cvt;
+    auto state = std::mbstate_t{};
+    const char* next = nullptr;
+    char32_t* out = nullptr;
+    cvt.in( state, t.utf8.data(), t.utf8.data() + t.utf8.size(), next,
+            t.points.data(), t.points.data() + t.points.size(), out );
+
+    return static_cast<std::size_t>( out - t.points.data() );
+  }
+
+  std::size_t codecvt_utf16_to_utf8( const text& t )
+  {
+    static const std::codecvt_utf8_utf16<char16_t> cvt;
+    auto state = std::mbstate_t{};
+    const char16_t* next = nullptr;
+    char* out = nullptr;
+    cvt.out( state, t.utf16.data(), t.utf16.data() + t.utf16.size(), next,
+             t.bytes.data(), t.bytes.data() + t.bytes.size(), out );
+
+    return static_cast<std::size_t>( out - t.bytes.data() );
+  }
+
+  //---------------------------------------------------------------------------
+  // bit::core
+  //---------------------------------------------------------------------------
+
+  std::size_t core_validate( const text& t )
+  {
+    const auto valid = bit::core::is_valid_utf8( bit::core::string_view( t.utf8.data(), t.utf8.size() ) );
+
+    return valid ? t.utf8.size() : 0u;
+  }
+
+  std::size_t core_utf8_to_utf16( const text& t )
+  {
+    const auto result = bit::core::utf8_to_utf16(
+      bit::core::string_view( t.utf8.data(), t.utf8.size() ),
+      bit::core::span<char16_t>( t.units.data(), static_cast<std::ptrdiff_t>(t.units.size()) )
+    );
+    return result ? result->size() : 0u;
+  }
+
+  std::size_t core_utf8_to_utf32( const text& t )
+  {
+    const auto result = bit::core::utf8_to_utf32(
+      bit::core::string_view( t.utf8.data(), t.utf8.size() ),
+      bit::core::span<char32_t>( t.points.data(), static_cast<std::ptrdiff_t>(t.points.size()) )
+    );
+    return result ? result->size() : 0u;
+  }
+
+  std::size_t core_utf16_to_utf8( const text& t )
+  {
+    const auto result = bit::core::utf16_to_utf8(
+      bit::core::u16string_view( t.utf16.data(), t.utf16.size() ),
+      bit::core::span<char>( t.bytes.data(), static_cast<std::ptrdiff_t>(t.bytes.size()) )
+    );
+    return result ? result->size() : 0u;
+  }
+
+  //---------------------------------------------------------------------------
+
+  /// Gets the throughput in GB of UTF-8 per second
+  double gigabytes_per_second( function f, const text& t )
+  {
+    return static_cast<double>(t.utf8.size()) / bench::seconds_per_call( f, t ) * 1e-9;
+  }
+
+  std::uint64_t next_random( std::uint64_t& state )
+  {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state ^ (state >> 29);
+  }
+
+  /// Builds about 1 MiB of text by drawing code points from \p alphabet
+  text make_text( std::u32string alphabet, std::uint64_t& state )
+  {
+    auto result = text{};
+    while( result.utf8.size() < (1u << 20) ) {
+      const auto c = alphabet[next_random( state ) % alphabet.size()];
+      char buffer[4];
+      const auto n = bit::core::detail::unicode_encode( c, buffer, 4u );
+      result.utf8.append( buffer, n );
+
+      char16_t units[2];
+      const auto m = bit::core::detail::unicode_encode( c, units, 2u );
+      result.utf16.append( units, m );
+    }
+    result.bytes.resize( result.utf8.size() );
+    result.units.resize( result.utf8.size() );
+    result.points.resize( result.utf8.size() );
+    return result;
+  }
+
+  void report( const char* name, const text& t )
+  {
+    struct row
+    {
+      const char* name;
+      function baseline;
+      function core;
+    };
+
+    const row rows[] = {
+      { "validate",      codecvt_validate,      core_validate },
+      { "utf8 -> utf16", codecvt_utf8_to_utf16, core_utf8_to_utf16 },
+      { "utf8 -> utf32", codecvt_utf8_to_utf32, core_utf8_to_utf32 },
+      { "utf16 -> utf8", codecvt_utf16_to_utf8, core_utf16_to_utf8 },
+    };
+
+    for( const auto& r : rows ) {
+      const auto t0 = gigabytes_per_second( r.baseline, t );
+      const auto t1 = gigabytes_per_second( r.core, t );
+
+      std::printf( "%-10s %-16s %10.2f %10.2f %8.1fx\n", name, r.name, t0, t1, t1 / t0 );
+    }
+  }
+
+} // anonymous namespace
+
+int main()
+{
+  auto state = std::uint64_t{1};
+
+  const auto english = make_text( U"etaoinshrdlucmfwyp ETAOIN,.\n", state );
+  const auto french  = make_text( U"etaoinshrdlucmfwyp ETAOIN,.éèàç", state );
+  const auto russian = make_text( U"оеаинтсрвл  ,.", state );
+  const auto chinese = make_text( U"的一是不了人我在有他，。", state );
+  const auto emoji   = make_text( U"abc é中\U0001F600\U0001F44D\U0001F389", state );
+
+  std::printf( "GB/s of UTF-8\n\n" );
+  std::printf( "%-10s %-16s %10s %10s %9s\n", "text", "operation", "codecvt", "core", "speedup" );
+  report( "english", english );
+  report( "french",  french );
+  report( "russian", russian );
+  report( "chinese", chinese );
+  report( "emoji",   emoji );
+
+  return 0;
+}
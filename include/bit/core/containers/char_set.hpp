@@ -0,0 +1,255 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a set of byte-sized characters, for scanning
+ *        strings for any of a set of delimiters in a single pass
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_CONTAINERS_CHAR_SET_HPP
+#define BIT_CORE_CONTAINERS_CHAR_SET_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/compiler_traits.hpp" // BIT_IS_CONSTANT_EVALUATED, BIT_PLATFORM_HAS_SSSE3
+#include "detail/string_search.hpp"         // detail::string_search_lowest_bit
+
+#include <algorithm>   // std::min
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint8_t, std::uint16_t, std::uint64_t
+#include <cstring>     // std::memchr
+#include <type_traits> // std::true_type, std::false_type
+
+//! \def BIT_CORE_CHAR_SET_SIMD
+//!
+//! \brief Defined as 1 if char_set always scans with the SSSE3 \c pshufb
+//!        classifier, as 2 if it does so only after detecting support at
+//!        runtime, and left undefined if it never does
+#if defined(BIT_PROCESSOR_X86_64) || defined(BIT_PROCESSOR_X86)
+# if defined(BIT_PLATFORM_HAS_SSSE3) || defined(BIT_PLATFORM_HAS_AVX)
+#   define BIT_CORE_CHAR_SET_SIMD 1
+# elif defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+#   define BIT_CORE_CHAR_SET_SIMD 2
+# endif
+#endif
+
+#if defined(BIT_CORE_CHAR_SET_SIMD)
+# include <tmmintrin.h> // _mm_shuffle_epi8
+# if defined(_MSC_VER)
+#   include <intrin.h>  // __cpuid, _BitScanForward, _BitScanReverse
+# endif
+#endif
+
+namespace bit {
+  namespace core {
+
+    //=========================================================================
+    // class : char_set
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A set of byte-sized characters
+    ///
+    /// Membership is stored as a 256-bit table, so testing a character costs
+    /// the same no matter how many characters are in the set. Sets whose
+    /// characters fall into at most 8 distinct rows of the 16x16 table of
+    /// high and low nibbles -- which includes every set of up to 8
+    /// characters -- additionally carry a nibble-shuffle classifier, which
+    /// tests 16 characters of a string at once with SSSE3.
+    ///
+    /// Building a set is more expensive than scanning a short string, so a
+    /// set of delimiters that is used repeatedly should be built once:
+    ///
+    /// \code
+    /// static const auto whitespace = bit::core::char_set(" \t\r\n");
+    ///
+    /// auto first = line.find_first_not_of( whitespace );
+    /// \endcode
+    ///
+    /// Characters are compared exactly, independent of any char traits.
+    ///////////////////////////////////////////////////////////////////////////
+    class char_set
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using size_type = std::size_t;
+
+      //-----------------------------------------------------------------------
+      // Public Members
+      //-----------------------------------------------------------------------
+    public:
+
+      static constexpr size_type npos = static_cast<size_type>(-1);
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty set
+      constexpr char_set() noexcept;
+
+      /// \brief Constructs a set of the \p count characters starting at \p s
+      ///
+      /// \param s pointer to the characters
+      /// \param count the number of characters
+      constexpr char_set( const char* s, size_type count ) noexcept;
+
+      /// \brief Constructs a set of the characters of the null-terminated
+      ///        string \p s
+      ///
+      /// \param s pointer to the null-terminated string
+      constexpr explicit char_set( const char* s ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Adds the character \p c to this set
+      ///
+      /// \param c the character to add
+      constexpr void insert( char c ) noexcept;
+
+      /// \brief Removes the character \p c from this set
+      ///
+      /// \param c the character to remove
+      constexpr void erase( char c ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Determines whether \p c is in this set
+      ///
+      /// \param c the character to test
+      /// \return \c true if \p c is in this set
+      constexpr bool contains( char c ) const noexcept;
+
+      /// \brief Determines whether this set has no characters
+      ///
+      /// \return \c true if this set is empty
+      constexpr bool empty() const noexcept;
+
+      /// \brief Counts the characters in this set
+      ///
+      /// \return the number of characters in this set
+      constexpr size_type size() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Operations
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Finds the first character at or after \p pos of the \p count
+      ///        characters starting at \p s that is in this set
+      ///
+      /// \param s pointer to the characters to scan
+      /// \param count the number of characters to scan
+      /// \param pos the position to start scanning at
+      /// \return the position of the character, or \c npos if none is found
+      constexpr size_type find_first_in( const char* s,
+                                         size_type count,
+                                         size_type pos = 0 ) const noexcept;
+
+      /// \brief Finds the first character at or after \p pos of the \p count
+      ///        characters starting at \p s that is not in this set
+      ///
+      /// \param s pointer to the characters to scan
+      /// \param count the number of characters to scan
+      /// \param pos the position to start scanning at
+      /// \return the position of the character, or \c npos if none is found
+      constexpr size_type find_first_not_in( const char* s,
+                                             size_type count,
+                                             size_type pos = 0 ) const noexcept;
+
+      /// \brief Finds the last character at or before \p pos of the \p count
+      ///        characters starting at \p s that is in this set
+      ///
+      /// \param s pointer to the characters to scan
+      /// \param count the number of characters to scan
+      /// \param pos the position to start scanning backwards from
+      /// \return the position of the character, or \c npos if none is found
+      constexpr size_type find_last_in( const char* s,
+                                        size_type count,
+                                        size_type pos = npos ) const noexcept;
+
+      /// \brief Finds the last character at or before \p pos of the \p count
+      ///        characters starting at \p s that is not in this set
+      ///
+      /// \param s pointer to the characters to scan
+      /// \param count the number of characters to scan
+      /// \param pos the position to start scanning backwards from
+      /// \return the position of the character, or \c npos if none is found
+      constexpr size_type find_last_not_in( const char* s,
+                                            size_type count,
+                                            size_type pos = npos ) const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Rebuilds the nibble-shuffle classifier from the table
+      constexpr void update_classifier() noexcept;
+
+      /// \brief Scans [first, last) forwards for a character whose
+      ///        membership equals \p member
+      size_type scan_forward( const char* s,
+                              size_type first,
+                              size_type last,
+                              bool member ) const noexcept;
+
+      /// \brief Scans [0, end) backwards for a character whose membership
+      ///        equals \p member
+      size_type scan_backward( const char* s,
+                               size_type end,
+                               bool member ) const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      std::uint64_t m_bits[4];   ///< Membership of each character
+      std::uint8_t  m_low[16];   ///< Buckets of each low nibble
+      std::uint8_t  m_high[16];  ///< Bucket of each high nibble
+      bool          m_classify;  ///< Whether m_low and m_high are exact
+    };
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/char_set.inl"
+
+#endif /* BIT_CORE_CONTAINERS_CHAR_SET_HPP */
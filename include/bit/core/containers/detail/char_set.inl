@@ -0,0 +1,691 @@
+#ifndef BIT_CORE_CONTAINERS_DETAIL_CHAR_SET_INL
+#define BIT_CORE_CONTAINERS_DETAIL_CHAR_SET_INL
+
+namespace bit { namespace core { namespace detail {
+
+  /// \brief The number of characters classified at once
+  constexpr std::size_t char_set_block_size() noexcept{ return 16u; }
+
+  //---------------------------------------------------------------------------
+  // Nibble-Shuffle Classifier
+  //---------------------------------------------------------------------------
+
+  // A character c is in the set if m_low[c & 0xf] & m_high[c >> 4] is
+  // nonzero. Each high nibble whose row of 16 characters is nonempty is
+  // assigned one of 8 bucket bits, shared with any other high nibble that has
+  // an identical row, and m_low records which buckets contain each low
+  // nibble. pshufb looks up both tables for 16 characters at once.
+
+#if defined(BIT_CORE_CHAR_SET_SIMD)
+
+  /// \brief Determines whether the processor has the SSSE3 \c pshufb
+  ///        instruction
+  inline bool char_set_has_simd()
+    noexcept
+  {
+# if BIT_CORE_CHAR_SET_SIMD == 1
+    return true;
+# elif defined(_MSC_VER)
+    static const bool result = []{
+      int info[4];
+      __cpuid( info, 1 );
+      return (info[2] & (1 << 9)) != 0;
+    }();
+    return result;
+# else
+    static const bool result = (__builtin_cpu_init(),
+                                __builtin_cpu_supports("ssse3") != 0);
+    return result;
+# endif
+  }
+
+  /// \brief Classifies the 16 characters at \p p, returning a mask with a
+  ///        bit set for each character whose membership equals \p member
+# if defined(__GNUC__) || defined(__clang__)
+  __attribute__((target("ssse3")))
+# endif
+  inline std::uint32_t char_set_classify( const char* p,
+                                          const std::uint8_t* low,
+                                          const std::uint8_t* high,
+                                          bool member )
+    noexcept
+  {
+    const auto nibble = _mm_set1_epi8( 0x0f );
+    const auto v      = _mm_loadu_si128( reinterpret_cast<const __m128i*>(p) );
+
+    const auto lo = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>(low) ),
+                                      _mm_and_si128( v, nibble ) );
+    const auto hi = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>(high) ),
+                                      _mm_and_si128( _mm_srli_epi16( v, 4 ), nibble ) );
+
+    const auto absent = _mm_cmpeq_epi8( _mm_and_si128( lo, hi ), _mm_setzero_si128() );
+    const auto mask   = static_cast<std::uint32_t>( _mm_movemask_epi8( absent ) );
+
+    return member ? (mask ^ 0xffffu) : mask;
+  }
+
+  /// \brief Finds the first character in [first, last) of \p s whose
+  ///        membership equals \p member
+  ///
+  /// \pre last - first >= char_set_block_size()
+  inline std::size_t char_set_simd_find_first( const char* s,
+                                               std::size_t first,
+                                               std::size_t last,
+                                               const std::uint8_t* low,
+                                               const std::uint8_t* high,
+                                               bool member )
+    noexcept
+  {
+    constexpr auto block = char_set_block_size();
+
+    auto i = first;
+    for( ; last - i >= block; i += block ) {
+      const auto mask = char_set_classify( s + i, low, high, member );
+      if( mask != 0u ) {
+        return i + string_search_lowest_bit( mask );
+      }
+    }
+    if( i != last ) {
+      // The final block overlaps characters that are already known not to
+      // match, so the lowest bit set is at or after i
+      const auto mask = char_set_classify( s + last - block, low, high, member );
+      if( mask != 0u ) {
+        return last - block + string_search_lowest_bit( mask );
+      }
+    }
+    return string_search_npos();
+  }
+
+  /// \brief Finds the last character in [0, end) of \p s whose membership
+  ///        equals \p member
+  ///
+  /// \pre end >= char_set_block_size()
+  inline std::size_t char_set_simd_find_last( const char* s,
+                                              std::size_t end,
+                                              const std::uint8_t* low,
+                                              const std::uint8_t* high,
+                                              bool member )
+    noexcept
+  {
+    constexpr auto block = char_set_block_size();
+
+    auto i = end;
+    for( ; i >= block; i -= block ) {
+      const auto mask = char_set_classify( s + i - block, low, high, member );
+      if( mask != 0u ) {
+        return i - block + string_search_highest_bit( mask );
+      }
+    }
+    if( i != 0u ) {
+      const auto mask = char_set_classify( s, low, high, member );
+      if( mask != 0u ) {
+        return string_search_highest_bit( mask );
+      }
+    }
+    return string_search_npos();
+  }
+
+#endif
+
+} } } // namespace bit::core::detail
+
+//=============================================================================
+// class : char_set
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+inline constexpr bit::core::char_set::char_set()
+  noexcept
+  : m_bits{},
+    m_low{},
+    m_high{},
+    m_classify(true)
+{
+
+}
+
+inline constexpr bit::core::char_set::char_set( const char* s,
+                                                size_type count )
+  noexcept
+  : m_bits{},
+    m_low{},
+    m_high{},
+    m_classify(true)
+{
+  for( auto i = size_type{0}; i < count; ++i ) {
+    const auto c = static_cast<unsigned char>(s[i]);
+    m_bits[c >> 6] |= std::uint64_t{1u} << (c & 63u);
+  }
+  update_classifier();
+}
+
+inline constexpr bit::core::char_set::char_set( const char* s )
+  noexcept
+  : m_bits{},
+    m_low{},
+    m_high{},
+    m_classify(true)
+{
+  for( ; *s != '\0'; ++s ) {
+    const auto c = static_cast<unsigned char>(*s);
+    m_bits[c >> 6] |= std::uint64_t{1u} << (c & 63u);
+  }
+  update_classifier();
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+inline constexpr void bit::core::char_set::insert( char c )
+  noexcept
+{
+  const auto u = static_cast<unsigned char>(c);
+  m_bits[u >> 6] |= std::uint64_t{1u} << (u & 63u);
+  update_classifier();
+}
+
+inline constexpr void bit::core::char_set::erase( char c )
+  noexcept
+{
+  const auto u = static_cast<unsigned char>(c);
+  m_bits[u >> 6] &= ~(std::uint64_t{1u} << (u & 63u));
+  update_classifier();
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+inline constexpr bool bit::core::char_set::contains( char c )
+  const noexcept
+{
+  const auto u = static_cast<unsigned char>(c);
+  return ((m_bits[u >> 6] >> (u & 63u)) & 1u) != 0u;
+}
+
+inline constexpr bool bit::core::char_set::empty()
+  const noexcept
+{
+  return (m_bits[0] | m_bits[1] | m_bits[2] | m_bits[3]) == 0u;
+}
+
+inline constexpr bit::core::char_set::size_type
+  bit::core::char_set::size()
+  const noexcept
+{
+  auto result = size_type{0};
+  for( auto word : m_bits ) {
+    for( ; word != 0u; word &= word - 1u ) {
+      ++result;
+    }
+  }
+  return result;
+}
+
+//-----------------------------------------------------------------------------
+// Operations
+//-----------------------------------------------------------------------------
+
+inline constexpr bit::core::char_set::size_type
+  bit::core::char_set::find_first_in( const char* s,
+                                      size_type count,
+                                      size_type pos )
+  const noexcept
+{
+  if( pos >= count ) {
+    return npos;
+  }
+  if( !BIT_IS_CONSTANT_EVALUATED() ) {
+    return scan_forward( s, pos, count, true );
+  }
+  for( auto i = pos; i < count; ++i ) {
+    if( contains( s[i] ) ) return i;
+  }
+  return npos;
+}
+
+inline constexpr bit::core::char_set::size_type
+  bit::core::char_set::find_first_not_in( const char* s,
+                                          size_type count,
+                                          size_type pos )
+  const noexcept
+{
+  if( pos >= count ) {
+    return npos;
+  }
+  if( !BIT_IS_CONSTANT_EVALUATED() ) {
+    return scan_forward( s, pos, count, false );
+  }
+  for( auto i = pos; i < count; ++i ) {
+    if( !contains( s[i] ) ) return i;
+  }
+  return npos;
+}
+
+inline constexpr bit::core::char_set::size_type
+  bit::core::char_set::find_last_in( const char* s,
+                                     size_type count,
+                                     size_type pos )
+  const noexcept
+{
+  const auto end = (pos < count) ? pos + 1 : count;
+
+  if( !BIT_IS_CONSTANT_EVALUATED() ) {
+    return scan_backward( s, end, true );
+  }
+  for( auto i = end; i > 0; --i ) {
+    if( contains( s[i - 1] ) ) return i - 1;
+  }
+  return npos;
+}
+
+inline constexpr bit::core::char_set::size_type
+  bit::core::char_set::find_last_not_in( const char* s,
+                                         size_type count,
+                                         size_type pos )
+  const noexcept
+{
+  const auto end = (pos < count) ? pos + 1 : count;
+
+  if( !BIT_IS_CONSTANT_EVALUATED() ) {
+    return scan_backward( s, end, false );
+  }
+  for( auto i = end; i > 0; --i ) {
+    if( !contains( s[i - 1] ) ) return i - 1;
+  }
+  return npos;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+inline constexpr void bit::core::char_set::update_classifier()
+  noexcept
+{
+  std::uint16_t rows[8] = {};
+  auto buckets = 0u;
+
+  for( auto i = 0u; i < 16u; ++i ) {
+    m_low[i]  = 0u;
+    m_high[i] = 0u;
+  }
+  m_classify = true;
+
+  for( auto h = 0u; h < 16u; ++h ) {
+    const auto row = static_cast<std::uint16_t>( m_bits[h >> 2] >> ((h & 3u) * 16u) );
+    if( row == 0u ) continue;
+
+    auto b = 0u;
+    while( b < buckets && rows[b] != row ) ++b;
+    if( b == buckets ) {
+      if( buckets == 8u ) {
+        m_classify = false;
+        return;
+      }
+      rows[buckets++] = row;
+    }
+    m_high[h] = static_cast<std::uint8_t>( 1u << b );
+  }
+
+  for( auto b = 0u; b < buckets; ++b ) {
+    for( auto l = 0u; l < 16u; ++l ) {
+      if( (rows[b] >> l) & 1u ) {
+        m_low[l] = static_cast<std::uint8_t>( m_low[l] | (1u << b) );
+      }
+    }
+  }
+}
+
+inline bit::core::char_set::size_type
+  bit::core::char_set::scan_forward( const char* s,
+                                     size_type first,
+                                     size_type last,
+                                     bool member )
+  const noexcept
+{
+#if defined(BIT_CORE_CHAR_SET_SIMD)
+  if( m_classify && last - first >= detail::char_set_block_size() && detail::char_set_has_simd() ) {
+    return detail::char_set_simd_find_first( s, first, last, m_low, m_high, member );
+  }
+#endif
+  for( auto i = first; i < last; ++i ) {
+    if( contains( s[i] ) == member ) return i;
+  }
+  return npos;
+}
+
+inline bit::core::char_set::size_type
+  bit::core::char_set::scan_backward( const char* s,
+                                      size_type end,
+                                      bool member )
+  const noexcept
+{
+#if defined(BIT_CORE_CHAR_SET_SIMD)
+  if( m_classify && end >= detail::char_set_block_size() && detail::char_set_has_simd() ) {
+    return detail::char_set_simd_find_last( s, end, m_low, m_high, member );
+  }
+#endif
+  for( auto i = end; i > 0; --i ) {
+    if( contains( s[i - 1] ) == member ) return i - 1;
+  }
+  return npos;
+}
+
+//=============================================================================
+// detail : basic_string_view searches
+//=============================================================================
+
+namespace bit { namespace core { namespace detail {
+
+  /// \brief Finds the first character in [first, last) of \p h whose
+  ///        presence in the \p m characters of \p x equals \p member
+  template<typename Traits, typename CharT>
+  inline constexpr std::size_t char_set_naive_find_first( const CharT* h,
+                                                          std::size_t first,
+                                                          std::size_t last,
+                                                          const CharT* x,
+                                                          std::size_t m,
+                                                          bool member )
+    noexcept
+  {
+    for( auto i = first; i < last; ++i ) {
+      auto found = false;
+      for( auto j = std::size_t{0}; j < m && !found; ++j ) {
+        found = Traits::eq( x[j], h[i] );
+      }
+      if( found == member ) return i;
+    }
+    return string_search_npos();
+  }
+
+  /// \brief Finds the last character in [0, end) of \p h whose presence in
+  ///        the \p m characters of \p x equals \p member
+  template<typename Traits, typename CharT>
+  inline constexpr std::size_t char_set_naive_find_last( const CharT* h,
+                                                         std::size_t end,
+                                                         const CharT* x,
+                                                         std::size_t m,
+                                                         bool member )
+    noexcept
+  {
+    for( auto i = end; i > 0; --i ) {
+      auto found = false;
+      for( auto j = std::size_t{0}; j < m && !found; ++j ) {
+        found = Traits::eq( x[j], h[i - 1] );
+      }
+      if( found == member ) return i - 1;
+    }
+    return string_search_npos();
+  }
+
+  /// The number of characters a search scans with a plain table before
+  /// building a char_set
+  constexpr std::size_t char_set_prefix_size() noexcept{ return 64u; }
+
+  /// \brief A 256-bit membership table, which is cheaper than a char_set
+  ///        to build for a single short search
+  struct char_set_table
+  {
+    std::uint64_t bits[4];
+
+    char_set_table( const char* x, std::size_t m )
+      noexcept
+      : bits{}
+    {
+      for( auto j = std::size_t{0}; j < m; ++j ) {
+        const auto c = static_cast<unsigned char>(x[j]);
+        bits[c >> 6] |= std::uint64_t{1u} << (c & 63u);
+      }
+    }
+
+    bool contains( char c )
+      const noexcept
+    {
+      const auto u = static_cast<unsigned char>(c);
+      return ((bits[u >> 6] >> (u & 63u)) & 1u) != 0u;
+    }
+  };
+
+#if defined(BIT_PLATFORM_HAS_SSE2)
+
+  /// The largest set that a search compares against directly, one
+  /// character at a time, instead of building a table
+  constexpr std::size_t char_set_compare_size() noexcept{ return 16u; }
+
+  /// \brief Compares the 16 characters at \p p against each of the \p m
+  ///        characters in \p x, returning a mask with a bit set for each
+  ///        character whose membership equals \p member
+  inline std::uint32_t char_set_compare( const char* p,
+                                         const __m128i* x,
+                                         std::size_t m,
+                                         bool member )
+    noexcept
+  {
+    const auto v = _mm_loadu_si128( reinterpret_cast<const __m128i*>(p) );
+
+    auto found = _mm_setzero_si128();
+    for( auto j = std::size_t{0}; j < m; ++j ) {
+      found = _mm_or_si128( found, _mm_cmpeq_epi8( v, x[j] ) );
+    }
+    const auto mask = static_cast<std::uint32_t>( _mm_movemask_epi8( found ) );
+
+    return member ? mask : (mask ^ 0xffffu);
+  }
+
+#endif
+
+  /// \brief Finds the first character in [first, last) of \p p whose
+  ///        presence in the \p m characters of \p x equals \p member,
+  ///        without building a char_set
+  inline std::size_t char_set_prefix_find_first( const char* p,
+                                                 std::size_t first,
+                                                 std::size_t last,
+                                                 const char* x,
+                                                 std::size_t m,
+                                                 bool member )
+    noexcept
+  {
+#if defined(BIT_PLATFORM_HAS_SSE2)
+    constexpr auto block = char_set_block_size();
+
+    if( m <= char_set_compare_size() && last - first >= block ) {
+      __m128i chars[16];
+      for( auto j = std::size_t{0}; j < m; ++j ) {
+        chars[j] = _mm_set1_epi8( x[j] );
+      }
+
+      auto i = first;
+      for( ; last - i >= block; i += block ) {
+        const auto mask = char_set_compare( p + i, chars, m, member );
+        if( mask != 0u ) return i + string_search_lowest_bit( mask );
+      }
+      if( i != last ) {
+        const auto mask = char_set_compare( p + last - block, chars, m, member );
+        if( mask != 0u ) return last - block + string_search_lowest_bit( mask );
+      }
+      return string_search_npos();
+    }
+#endif
+    const auto table = char_set_table( x, m );
+    for( auto i = first; i < last; ++i ) {
+      if( table.contains( p[i] ) == member ) return i;
+    }
+    return string_search_npos();
+  }
+
+  /// \brief Finds the last character in [first, end) of \p p whose
+  ///        presence in the \p m characters of \p x equals \p member,
+  ///        without building a char_set
+  inline std::size_t char_set_prefix_find_last( const char* p,
+                                                std::size_t first,
+                                                std::size_t end,
+                                                const char* x,
+                                                std::size_t m,
+                                                bool member )
+    noexcept
+  {
+#if defined(BIT_PLATFORM_HAS_SSE2)
+    constexpr auto block = char_set_block_size();
+
+    if( m <= char_set_compare_size() && end - first >= block ) {
+      __m128i chars[16];
+      for( auto j = std::size_t{0}; j < m; ++j ) {
+        chars[j] = _mm_set1_epi8( x[j] );
+      }
+
+      auto i = end;
+      for( ; i - first >= block; i -= block ) {
+        const auto mask = char_set_compare( p + i - block, chars, m, member );
+        if( mask != 0u ) return i - block + string_search_highest_bit( mask );
+      }
+      if( i != first ) {
+        const auto mask = char_set_compare( p + first, chars, m, member );
+        if( mask != 0u ) return first + string_search_highest_bit( mask );
+      }
+      return string_search_npos();
+    }
+#endif
+    const auto table = char_set_table( x, m );
+    for( auto i = end; i > first; --i ) {
+      if( table.contains( p[i - 1] ) == member ) return i - 1;
+    }
+    return string_search_npos();
+  }
+
+  template<typename Traits, typename CharT>
+  inline std::size_t char_set_find_first( const CharT* h,
+                                          std::size_t first,
+                                          std::size_t last,
+                                          const CharT* x,
+                                          std::size_t m,
+                                          bool member,
+                                          std::true_type )
+    noexcept
+  {
+    const auto* p = reinterpret_cast<const char*>(h);
+    const auto* s = reinterpret_cast<const char*>(x);
+
+    if( m == 1u && member ) {
+      const auto* q = static_cast<const char*>( std::memchr( p + first, static_cast<unsigned char>(s[0]), last - first ) );
+      return (q == nullptr) ? string_search_npos() : static_cast<std::size_t>(q - p);
+    }
+
+    // Matches are often close by, as when tokenizing, so a short prefix is
+    // scanned before paying for a char_set
+    const auto prefix = first + std::min( last - first, char_set_prefix_size() );
+    const auto result = char_set_prefix_find_first( p, first, prefix, s, m, member );
+    if( result != string_search_npos() || prefix == last ) {
+      return result;
+    }
+
+    const auto set = char_set( s, m );
+    return member ? set.find_first_in( p, last, prefix )
+                  : set.find_first_not_in( p, last, prefix );
+  }
+
+  template<typename Traits, typename CharT>
+  inline std::size_t char_set_find_first( const CharT* h,
+                                          std::size_t first,
+                                          std::size_t last,
+                                          const CharT* x,
+                                          std::size_t m,
+                                          bool member,
+                                          std::false_type )
+    noexcept
+  {
+    return char_set_naive_find_first<Traits>( h, first, last, x, m, member );
+  }
+
+  template<typename Traits, typename CharT>
+  inline std::size_t char_set_find_last( const CharT* h,
+                                         std::size_t end,
+                                         const CharT* x,
+                                         std::size_t m,
+                                         bool member,
+                                         std::true_type )
+    noexcept
+  {
+    const auto* p = reinterpret_cast<const char*>(h);
+    const auto* s = reinterpret_cast<const char*>(x);
+
+    const auto rest   = end - std::min( end, char_set_prefix_size() );
+    const auto result = char_set_prefix_find_last( p, rest, end, s, m, member );
+    if( result != string_search_npos() || rest == 0u ) {
+      return result;
+    }
+
+    const auto set = char_set( s, m );
+    return member ? set.find_last_in( p, rest, rest - 1u )
+                  : set.find_last_not_in( p, rest, rest - 1u );
+  }
+
+  template<typename Traits, typename CharT>
+  inline std::size_t char_set_find_last( const CharT* h,
+                                         std::size_t end,
+                                         const CharT* x,
+                                         std::size_t m,
+                                         bool member,
+                                         std::false_type )
+    noexcept
+  {
+    return char_set_naive_find_last<Traits>( h, end, x, m, member );
+  }
+
+  //---------------------------------------------------------------------------
+
+  /// \brief Finds the first character in [first, last) of \p s whose
+  ///        membership in \p set equals \p member
+  template<typename CharT>
+  inline constexpr std::size_t char_set_find_first( const char_set& set,
+                                                    const CharT* s,
+                                                    std::size_t first,
+                                                    std::size_t last,
+                                                    bool member )
+    noexcept
+  {
+    static_assert( sizeof(CharT) == 1, "char_set can only search byte-sized characters" );
+
+    if( !BIT_IS_CONSTANT_EVALUATED() ) {
+      const auto* p = reinterpret_cast<const char*>(s);
+      return member ? set.find_first_in( p, last, first )
+                    : set.find_first_not_in( p, last, first );
+    }
+    for( auto i = first; i < last; ++i ) {
+      if( set.contains( static_cast<char>(s[i]) ) == member ) return i;
+    }
+    return string_search_npos();
+  }
+
+  /// \brief Finds the last character in [0, end) of \p s whose membership
+  ///        in \p set equals \p member
+  template<typename CharT>
+  inline constexpr std::size_t char_set_find_last( const char_set& set,
+                                                   const CharT* s,
+                                                   std::size_t end,
+                                                   bool member )
+    noexcept
+  {
+    static_assert( sizeof(CharT) == 1, "char_set can only search byte-sized characters" );
+
+    if( end == 0u ) {
+      return string_search_npos();
+    }
+    if( !BIT_IS_CONSTANT_EVALUATED() ) {
+      const auto* p = reinterpret_cast<const char*>(s);
+      return member ? set.find_last_in( p, end, end - 1u )
+                    : set.find_last_not_in( p, end, end - 1u );
+    }
+    for( auto i = end; i > 0; --i ) {
+      if( set.contains( static_cast<char>(s[i - 1]) ) == member ) return i - 1;
+    }
+    return string_search_npos();
+  }
+
+} } } // namespace bit::core::detail
+
+#endif /* BIT_CORE_CONTAINERS_DETAIL_CHAR_SET_INL */
@@ -0,0 +1,392 @@
+#ifndef BIT_CORE_CONTAINERS_DETAIL_MPMC_RING_INL
+#define BIT_CORE_CONTAINERS_DETAIL_MPMC_RING_INL
+
+namespace bit { namespace core { namespace detail {
+
+  /// \brief Rounds \p n up to a power of two, and to at least 2
+  ///
+  /// With a single slot, the sequence number a producer waits for on the
+  /// next lap equals the one it just published, so it would construct over
+  /// the live entry
+  ///
+  /// \throws std::length_error if no power of two holds \p n
+  inline std::size_t mpmc_ring_capacity( std::size_t n )
+  {
+    constexpr auto max_capacity = (std::numeric_limits<std::size_t>::max() >> 1) + 1u;
+
+    BIT_ASSERT_OR_THROW( n <= max_capacity,
+                         std::length_error,
+                         "mpmc_ring: capacity too large" );
+
+    auto result = std::size_t{2};
+    while( result < n ) {
+      result *= 2u;
+    }
+    return result;
+  }
+
+} } } // namespace bit::core::detail
+
+//=============================================================================
+// detail::mpmc_ring_core
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructor
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::core::detail::mpmc_ring_core<T>
+  ::mpmc_ring_core( slot_type* slots, size_type capacity )
+  noexcept
+  : m_slots( slots ),
+    m_mask( capacity - 1u ),
+    m_enqueue( 0u ),
+    m_dequeue( 0u )
+{
+  for( auto i = size_type{0}; i < capacity; ++i ) {
+    const auto slot = ::new( static_cast<void*>(slots + i) ) slot_type;
+    slot->sequence.store( i, std::memory_order_relaxed );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Operations
+//-----------------------------------------------------------------------------
+
+template<typename T>
+template<typename...Args>
+inline bool bit::core::detail::mpmc_ring_core<T>::try_emplace( Args&&...args )
+{
+  using tag_type = std::integral_constant<bool,std::is_nothrow_constructible<T,Args...>::value>;
+
+  return emplace( tag_type{}, std::forward<Args>(args)... );
+}
+
+template<typename T>
+inline bool bit::core::detail::mpmc_ring_core<T>::try_pop( T& value )
+  noexcept
+{
+  auto position = m_dequeue.load( std::memory_order_relaxed );
+  slot_type* slot;
+
+  for( ;; ) {
+    slot = &m_slots[position & m_mask];
+    const auto sequence = slot->sequence.load( std::memory_order_acquire );
+    const auto difference = static_cast<std::ptrdiff_t>(sequence - (position + 1u));
+
+    if( difference == 0 ) {
+      if( m_dequeue.compare_exchange_weak( position, position + 1u,
+                                           std::memory_order_relaxed ) ) {
+        break;
+      }
+    } else if( difference < 0 ) {
+      // The producer of this lap has not published yet
+      return false;
+    } else {
+      position = m_dequeue.load( std::memory_order_relaxed );
+    }
+  }
+
+  const auto p = reinterpret_cast<T*>(&slot->storage);
+  value = std::move(*p);
+  destroy_at( p );
+  slot->sequence.store( position + m_mask + 1u, std::memory_order_release );
+  return true;
+}
+
+template<typename T>
+inline bool bit::core::detail::mpmc_ring_core<T>::empty()
+  const noexcept
+{
+  return size() == 0u;
+}
+
+template<typename T>
+inline typename bit::core::detail::mpmc_ring_core<T>::size_type
+  bit::core::detail::mpmc_ring_core<T>::size()
+  const noexcept
+{
+  // The dequeue counter is loaded first, so it is never ahead of the
+  // enqueue counter; the enqueue counter may however have run ahead since,
+  // so the result is clamped
+  const auto dequeue = m_dequeue.load( std::memory_order_acquire );
+  const auto enqueue = m_enqueue.load( std::memory_order_acquire );
+  const auto result  = enqueue - dequeue;
+
+  return result < capacity() ? result : capacity();
+}
+
+template<typename T>
+inline typename bit::core::detail::mpmc_ring_core<T>::size_type
+  bit::core::detail::mpmc_ring_core<T>::capacity()
+  const noexcept
+{
+  return m_mask + 1u;
+}
+
+template<typename T>
+inline typename bit::core::detail::mpmc_ring_core<T>::slot_type*
+  bit::core::detail::mpmc_ring_core<T>::slots()
+  const noexcept
+{
+  return m_slots;
+}
+
+template<typename T>
+inline void bit::core::detail::mpmc_ring_core<T>::destroy_entries()
+  noexcept
+{
+  const auto enqueue = m_enqueue.load( std::memory_order_acquire );
+  for( auto position = m_dequeue.load( std::memory_order_relaxed ); position != enqueue; ++position ) {
+    destroy_at( reinterpret_cast<T*>(&m_slots[position & m_mask].storage) );
+  }
+  m_dequeue.store( enqueue, std::memory_order_relaxed );
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline typename bit::core::detail::mpmc_ring_core<T>::slot_type*
+  bit::core::detail::mpmc_ring_core<T>::claim_push( size_type& position )
+  noexcept
+{
+  position = m_enqueue.load( std::memory_order_relaxed );
+
+  for( ;; ) {
+    const auto slot = &m_slots[position & m_mask];
+    const auto sequence = slot->sequence.load( std::memory_order_acquire );
+    const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+    if( difference == 0 ) {
+      if( m_enqueue.compare_exchange_weak( position, position + 1u,
+                                           std::memory_order_relaxed ) ) {
+        return slot;
+      }
+    } else if( difference < 0 ) {
+      // The consumer of the previous lap has not released the slot yet
+      return nullptr;
+    } else {
+      position = m_enqueue.load( std::memory_order_relaxed );
+    }
+  }
+}
+
+template<typename T>
+template<typename...Args>
+inline bool bit::core::detail::mpmc_ring_core<T>::emplace( std::true_type,
+                                                          Args&&...args )
+  noexcept
+{
+  auto position = size_type{};
+  const auto slot = claim_push( position );
+  if( slot == nullptr ) return false;
+
+  ::new( static_cast<void*>(&slot->storage) ) T( std::forward<Args>(args)... );
+  slot->sequence.store( position + 1u, std::memory_order_release );
+  return true;
+}
+
+template<typename T>
+template<typename...Args>
+inline bool bit::core::detail::mpmc_ring_core<T>::emplace( std::false_type,
+                                                          Args&&...args )
+{
+  // A claimed slot must be published, so nothing may throw once it is
+  // claimed
+  auto value = T( std::forward<Args>(args)... );
+
+  return emplace( std::true_type{}, std::move(value) );
+}
+
+//=============================================================================
+// mpmc_ring
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructor / Destructor
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Allocator>
+inline bit::core::mpmc_ring<T,Allocator>
+  ::mpmc_ring( size_type capacity, const Allocator& alloc )
+  : mpmc_ring( slot_allocator( alloc ), detail::mpmc_ring_capacity( capacity ) )
+{
+
+}
+
+template<typename T, typename Allocator>
+inline bit::core::mpmc_ring<T,Allocator>
+  ::mpmc_ring( slot_allocator alloc, size_type capacity )
+  : m_core( std::allocator_traits<slot_allocator>::allocate( alloc, capacity ), capacity ),
+    m_allocator( std::move(alloc) )
+{
+
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Allocator>
+inline bit::core::mpmc_ring<T,Allocator>::~mpmc_ring()
+{
+  m_core.destroy_entries();
+
+  // The slots hold nothing that needs destructing once the entries are gone
+  const auto capacity = m_core.capacity();
+  const auto slots = m_core.slots();
+  std::allocator_traits<slot_allocator>::deallocate( m_allocator, slots, capacity );
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Allocator>
+template<typename...Args, typename>
+inline bool bit::core::mpmc_ring<T,Allocator>::try_emplace( Args&&...args )
+{
+  return m_core.try_emplace( std::forward<Args>(args)... );
+}
+
+template<typename T, typename Allocator>
+inline bool bit::core::mpmc_ring<T,Allocator>::try_push( const T& value )
+{
+  return m_core.try_emplace( value );
+}
+
+template<typename T, typename Allocator>
+inline bool bit::core::mpmc_ring<T,Allocator>::try_push( T&& value )
+{
+  return m_core.try_emplace( std::move(value) );
+}
+
+template<typename T, typename Allocator>
+inline bool bit::core::mpmc_ring<T,Allocator>::try_pop( T& value )
+  noexcept
+{
+  return m_core.try_pop( value );
+}
+
+//-----------------------------------------------------------------------------
+// Capacity
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Allocator>
+inline bool bit::core::mpmc_ring<T,Allocator>::empty()
+  const noexcept
+{
+  return m_core.empty();
+}
+
+template<typename T, typename Allocator>
+inline typename bit::core::mpmc_ring<T,Allocator>::size_type
+  bit::core::mpmc_ring<T,Allocator>::size()
+  const noexcept
+{
+  return m_core.size();
+}
+
+template<typename T, typename Allocator>
+inline typename bit::core::mpmc_ring<T,Allocator>::size_type
+  bit::core::mpmc_ring<T,Allocator>::capacity()
+  const noexcept
+{
+  return m_core.capacity();
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Allocator>
+inline typename bit::core::mpmc_ring<T,Allocator>::allocator_type
+  bit::core::mpmc_ring<T,Allocator>::get_allocator()
+  const
+{
+  return allocator_type( m_allocator );
+}
+
+//=============================================================================
+// mpmc_ring_array
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructor / Destructor
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline bit::core::mpmc_ring_array<T,N>::mpmc_ring_array()
+  noexcept
+  : m_core( m_slots, N )
+{
+
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline bit::core::mpmc_ring_array<T,N>::~mpmc_ring_array()
+{
+  m_core.destroy_entries();
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+template<typename...Args, typename>
+inline bool bit::core::mpmc_ring_array<T,N>::try_emplace( Args&&...args )
+{
+  return m_core.try_emplace( std::forward<Args>(args)... );
+}
+
+template<typename T, std::size_t N>
+inline bool bit::core::mpmc_ring_array<T,N>::try_push( const T& value )
+{
+  return m_core.try_emplace( value );
+}
+
+template<typename T, std::size_t N>
+inline bool bit::core::mpmc_ring_array<T,N>::try_push( T&& value )
+{
+  return m_core.try_emplace( std::move(value) );
+}
+
+template<typename T, std::size_t N>
+inline bool bit::core::mpmc_ring_array<T,N>::try_pop( T& value )
+  noexcept
+{
+  return m_core.try_pop( value );
+}
+
+//-----------------------------------------------------------------------------
+// Capacity
+//-----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline bool bit::core::mpmc_ring_array<T,N>::empty()
+  const noexcept
+{
+  return m_core.empty();
+}
+
+template<typename T, std::size_t N>
+inline typename bit::core::mpmc_ring_array<T,N>::size_type
+  bit::core::mpmc_ring_array<T,N>::size()
+  const noexcept
+{
+  return m_core.size();
+}
+
+template<typename T, std::size_t N>
+inline typename bit::core::mpmc_ring_array<T,N>::size_type
+  bit::core::mpmc_ring_array<T,N>::capacity()
+  const noexcept
+{
+  return N;
+}
+
+#endif /* BIT_CORE_CONTAINERS_DETAIL_MPMC_RING_INL */
@@ -0,0 +1,515 @@
+#ifndef BIT_CORE_CONTAINERS_DETAIL_MULTI_SEARCHER_INL
+#define BIT_CORE_CONTAINERS_DETAIL_MULTI_SEARCHER_INL
+
+namespace bit { namespace core { namespace detail {
+
+  /// \brief The largest pattern set searched with the Teddy engine
+  constexpr std::size_t multi_searcher_teddy_limit() noexcept{ return 16u; }
+
+  /// \brief The number of Teddy buckets, one per bit of a mask byte
+  constexpr std::size_t multi_searcher_bucket_count() noexcept{ return 8u; }
+
+  /// \brief Marks a transition that is not yet known during construction
+  constexpr std::uint32_t multi_searcher_no_state() noexcept{ return 0xffffffffu; }
+
+  /// \brief Marks a transition into a state at which a pattern ends
+  constexpr std::uint32_t multi_searcher_output_flag() noexcept{ return 0x80000000u; }
+
+#if defined(BIT_CORE_CHAR_SET_SIMD)
+
+  /// \brief Scans blocks of 16 start positions in [i, last) of \p h for
+  ///        the first block in which any pattern may start
+  ///
+  /// \return the start of that block, with its candidate positions in
+  ///         \p mask and their buckets in \p buckets; or the first unscanned
+  ///         start, with \p mask set to 0
+# if defined(__GNUC__) || defined(__clang__)
+  __attribute__((target("ssse3")))
+# endif
+  inline std::size_t multi_searcher_teddy_scan( const char* h,
+                                                std::size_t i,
+                                                std::size_t last,
+                                                const std::uint8_t (*low)[16],
+                                                const std::uint8_t (*high)[16],
+                                                std::size_t width,
+                                                std::uint8_t* buckets,
+                                                std::uint32_t& mask )
+    noexcept
+  {
+    const auto nibble = _mm_set1_epi8( 0x0f );
+    const auto zero   = _mm_setzero_si128();
+
+    for( ; last - i >= 16u; i += 16u ) {
+      auto result = _mm_set1_epi8( -1 );
+
+      // A position is a candidate for a bucket if each of its first bytes
+      // shares both nibbles with the same byte of a pattern in the bucket
+      for( auto k = std::size_t{0}; k < width; ++k ) {
+        const auto in = _mm_loadu_si128( reinterpret_cast<const __m128i*>( h + i + k ) );
+        const auto lo = _mm_and_si128( in, nibble );
+        const auto hi = _mm_and_si128( _mm_srli_epi16( in, 4 ), nibble );
+
+        const auto l = _mm_loadu_si128( reinterpret_cast<const __m128i*>( low[k] ) );
+        const auto u = _mm_loadu_si128( reinterpret_cast<const __m128i*>( high[k] ) );
+
+        result = _mm_and_si128( result, _mm_and_si128( _mm_shuffle_epi8( l, lo ),
+                                                       _mm_shuffle_epi8( u, hi ) ) );
+      }
+
+      const auto empty = static_cast<std::uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( result, zero ) ) );
+      if( empty != 0xffffu ) {
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( buckets ), result );
+        mask = empty ^ 0xffffu;
+        return i;
+      }
+    }
+    mask = 0u;
+    return i;
+  }
+
+#endif
+
+} } } // namespace bit::core::detail
+
+//=============================================================================
+// class : multi_searcher
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+inline bit::core::multi_searcher
+  ::multi_searcher( std::initializer_list<string_view> patterns )
+  : multi_searcher( patterns.begin(), patterns.end() )
+{
+
+}
+
+template<typename InputIt>
+inline bit::core::multi_searcher::multi_searcher( InputIt first, InputIt last )
+  : m_storage{},
+    m_offsets{},
+    m_max_size{0},
+    m_classes{},
+    m_class_count{0},
+    m_transitions{},
+    m_output_begin{},
+    m_outputs{},
+    m_dictionary{},
+    m_teddy{false},
+    m_teddy_width{0},
+    m_low{},
+    m_high{},
+    m_bucket_begin{},
+    m_bucket_patterns{}
+{
+  for( ; first != last; ++first ) {
+    const auto pattern = string_view( *first );
+
+    m_offsets.push_back( m_storage.size() );
+    m_storage.append( pattern.data(), pattern.size() );
+  }
+  m_offsets.push_back( m_storage.size() );
+
+  compile();
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+inline bit::core::multi_searcher::size_type
+  bit::core::multi_searcher::size()
+  const noexcept
+{
+  return m_offsets.size() - 1u;
+}
+
+inline bit::core::string_view
+  bit::core::multi_searcher::pattern( size_type n )
+  const noexcept
+{
+  return string_view( m_storage.data() + m_offsets[n], pattern_size( n ) );
+}
+
+//-----------------------------------------------------------------------------
+// Operations
+//-----------------------------------------------------------------------------
+
+inline bit::core::multi_searcher::match
+  bit::core::multi_searcher::find_first( string_view haystack, size_type pos )
+  const noexcept
+{
+  if( !use_teddy() ) {
+    return automaton_find_first( haystack, pos );
+  }
+
+  const auto* h = haystack.data();
+  const auto n  = haystack.size();
+
+  auto result = match{ npos, 0u, npos };
+  teddy_candidates( h, n, pos, [&]( size_type i, std::uint32_t buckets ) {
+    const auto p = teddy_match( h, n, i, buckets );
+    if( p == npos ) {
+      return false;
+    }
+    result = match{ i, pattern_size( p ), p };
+    return true;
+  });
+  return result;
+}
+
+template<std::ptrdiff_t Extent>
+inline bit::core::multi_searcher::match
+  bit::core::multi_searcher
+  ::find_first( basic_string_span<char,std::char_traits<char>,Extent> haystack,
+                size_type pos )
+  const noexcept
+{
+  return find_first( string_view( haystack.data(), haystack.size() ), pos );
+}
+
+template<typename Fn>
+inline void bit::core::multi_searcher::find_all( string_view haystack, Fn&& fn )
+  const
+{
+  const auto* h = haystack.data();
+  const auto n  = haystack.size();
+
+  if( use_teddy() ) {
+    teddy_candidates( h, n, 0u, [&]( size_type i, std::uint32_t buckets ) {
+      for( ; buckets != 0u; buckets &= buckets - 1u ) {
+        const auto b = detail::string_search_lowest_bit( buckets );
+
+        for( auto k = m_bucket_begin[b]; k < m_bucket_begin[b + 1u]; ++k ) {
+          const auto p = size_type{m_bucket_patterns[k]};
+          if( matches_at( h, n, i, p ) ) {
+            fn( match{ i, pattern_size( p ), p } );
+          }
+        }
+      }
+      return false;
+    });
+    return;
+  }
+
+  auto row = std::uint32_t{0};
+  for( auto i = size_type{0}; i < n; ++i ) {
+    const auto next = m_transitions[row + m_classes[static_cast<unsigned char>(h[i])]];
+    row = next & ~detail::multi_searcher_output_flag();
+    if( (next & detail::multi_searcher_output_flag()) == 0u ) {
+      continue;
+    }
+
+    for( auto s = row / m_class_count; s != 0u; s = m_dictionary[s] ) {
+      for( auto k = m_output_begin[s]; k < m_output_begin[s + 1u]; ++k ) {
+        const auto p = size_type{m_outputs[k]};
+        const auto length = pattern_size( p );
+        fn( match{ i + 1u - length, length, p } );
+      }
+    }
+  }
+}
+
+template<std::ptrdiff_t Extent, typename Fn>
+inline void bit::core::multi_searcher
+  ::find_all( basic_string_span<char,std::char_traits<char>,Extent> haystack,
+              Fn&& fn )
+  const
+{
+  find_all( string_view( haystack.data(), haystack.size() ), std::forward<Fn>(fn) );
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+inline void bit::core::multi_searcher::compile()
+{
+  for( auto n = size_type{0}; n < size(); ++n ) {
+    m_max_size = std::max( m_max_size, pattern_size( n ) );
+  }
+  compile_automaton();
+  compile_teddy();
+}
+
+inline void bit::core::multi_searcher::compile_automaton()
+{
+  constexpr auto none = detail::multi_searcher_no_state();
+
+  // Bytes that appear in no pattern all behave alike, and share class 0
+  bool used[256] = {};
+  for( auto c : m_storage ) {
+    used[static_cast<unsigned char>(c)] = true;
+  }
+  m_class_count = 1u;
+  for( auto b = 0; b < 256; ++b ) {
+    m_classes[b] = used[b] ? static_cast<std::uint16_t>(m_class_count++) : std::uint16_t{0};
+  }
+  const auto classes = m_class_count;
+
+  // Build the trie of the patterns, with state 0 as the root
+  auto next   = std::vector<std::uint32_t>( classes, none );
+  auto output = std::vector<std::vector<std::uint32_t>>( 1u );
+
+  for( auto n = size_type{0}; n < size(); ++n ) {
+    const auto p = pattern( n );
+    if( p.empty() ) {
+      continue;
+    }
+
+    auto s = std::uint32_t{0};
+    for( auto c : p ) {
+      const auto index = s * classes + m_classes[static_cast<unsigned char>(c)];
+      if( next[index] == none ) {
+        next[index] = static_cast<std::uint32_t>( output.size() );
+        output.emplace_back();
+        next.resize( output.size() * classes, none );
+      }
+      s = next[index];
+    }
+    output[s].push_back( static_cast<std::uint32_t>(n) );
+  }
+
+  // Fill in the missing transitions breadth-first, so that the failure
+  // state of each state is complete before the state itself
+  const auto states = output.size();
+  auto fail  = std::vector<std::uint32_t>( states, 0u );
+  auto queue = std::vector<std::uint32_t>{};
+  queue.reserve( states );
+  m_dictionary.assign( states, 0u );
+
+  for( auto c = size_type{0}; c < classes; ++c ) {
+    if( next[c] == none ) {
+      next[c] = 0u;
+    } else {
+      queue.push_back( next[c] );
+    }
+  }
+  for( auto q = size_type{0}; q < queue.size(); ++q ) {
+    const auto s = queue[q];
+
+    for( auto c = size_type{0}; c < classes; ++c ) {
+      const auto t = next[s * classes + c];
+      const auto f = next[fail[s] * classes + c];
+
+      if( t == none ) {
+        next[s * classes + c] = f;
+      } else {
+        fail[t] = f;
+        m_dictionary[t] = output[f].empty() ? m_dictionary[f] : f;
+        queue.push_back( t );
+      }
+    }
+  }
+
+  m_output_begin.resize( states + 1u );
+  for( auto s = size_type{0}; s < states; ++s ) {
+    m_output_begin[s] = static_cast<std::uint32_t>( m_outputs.size() );
+    m_outputs.insert( m_outputs.end(), output[s].begin(), output[s].end() );
+  }
+  m_output_begin[states] = static_cast<std::uint32_t>( m_outputs.size() );
+
+  // Store transitions as row offsets, flagging those into a state at which
+  // some pattern ends. The offsets must stay clear of the flag bit
+  BIT_ASSERT( states * classes <= detail::multi_searcher_output_flag(),
+              "multi_searcher: too many pattern characters for 31-bit transitions" );
+
+  m_transitions.resize( next.size() );
+  for( auto i = size_type{0}; i < next.size(); ++i ) {
+    const auto t = next[i];
+    const auto flag = (!output[t].empty() || m_dictionary[t] != 0u)
+                    ? detail::multi_searcher_output_flag() : std::uint32_t{0};
+    m_transitions[i] = static_cast<std::uint32_t>( t * classes ) | flag;
+  }
+}
+
+inline void bit::core::multi_searcher::compile_teddy()
+{
+  constexpr auto bucket_count = detail::multi_searcher_bucket_count();
+
+  auto order = std::vector<size_type>{};
+  for( auto n = size_type{0}; n < size(); ++n ) {
+    if( pattern_size( n ) != 0u ) order.push_back( n );
+  }
+  if( order.empty() || size() > detail::multi_searcher_teddy_limit() ) {
+    return;
+  }
+
+  auto width = size_type{3};
+  for( auto n : order ) {
+    width = std::min( width, pattern_size( n ) );
+  }
+
+  // Patterns sharing leading bytes share a bucket, so that a bucket's
+  // nibble masks admit as few other byte sequences as possible
+  std::sort( order.begin(), order.end(), [&]( size_type a, size_type b ) {
+    return pattern( a ).substr( 0, width ) < pattern( b ).substr( 0, width );
+  });
+
+  const auto buckets = std::min( bucket_count, order.size() );
+  auto bucket_of = std::vector<size_type>( size(), 0u );
+  for( auto r = size_type{0}; r < order.size(); ++r ) {
+    bucket_of[order[r]] = r * buckets / order.size();
+  }
+
+  // Group pattern indices by bucket, in increasing order within each
+  auto count = size_type{0};
+  for( auto b = size_type{0}; b < bucket_count; ++b ) {
+    m_bucket_begin[b] = static_cast<std::uint8_t>(count);
+
+    for( auto n = size_type{0}; n < size(); ++n ) {
+      if( pattern_size( n ) == 0u || bucket_of[n] != b ) {
+        continue;
+      }
+      m_bucket_patterns[count++] = static_cast<std::uint8_t>(n);
+
+      const auto p = pattern( n );
+      for( auto k = size_type{0}; k < width; ++k ) {
+        const auto c = static_cast<unsigned char>(p[k]);
+        m_low[k][c & 0x0fu] |= static_cast<std::uint8_t>(1u << b);
+        m_high[k][c >> 4]   |= static_cast<std::uint8_t>(1u << b);
+      }
+    }
+  }
+  m_bucket_begin[bucket_count] = static_cast<std::uint8_t>(count);
+
+  m_teddy_width = width;
+  m_teddy = true;
+}
+
+inline bit::core::multi_searcher::size_type
+  bit::core::multi_searcher::pattern_size( size_type n )
+  const noexcept
+{
+  return m_offsets[n + 1u] - m_offsets[n];
+}
+
+inline bool bit::core::multi_searcher::matches_at( const char* h,
+                                                   size_type size,
+                                                   size_type i,
+                                                   size_type n )
+  const noexcept
+{
+  const auto length = pattern_size( n );
+
+  return length != 0u && length <= size - i &&
+         std::memcmp( h + i, m_storage.data() + m_offsets[n], length ) == 0;
+}
+
+inline bool bit::core::multi_searcher::use_teddy()
+  const noexcept
+{
+#if defined(BIT_CORE_CHAR_SET_SIMD)
+  return m_teddy && detail::char_set_has_simd();
+#else
+  return false;
+#endif
+}
+
+template<typename Fn>
+inline void bit::core::multi_searcher::teddy_candidates( const char* h,
+                                                         size_type n,
+                                                         size_type pos,
+                                                         Fn&& fn )
+  const
+{
+  auto i = pos;
+
+#if defined(BIT_CORE_CHAR_SET_SIMD)
+  const auto last = (n >= m_teddy_width) ? n - m_teddy_width + 1u : size_type{0};
+
+  std::uint8_t buckets[16];
+  while( i < last && last - i >= 16u ) {
+    auto mask = std::uint32_t{0};
+    i = detail::multi_searcher_teddy_scan( h, i, last, m_low, m_high,
+                                           m_teddy_width, buckets, mask );
+    if( mask == 0u ) {
+      break;
+    }
+
+    for( ; mask != 0u; mask &= mask - 1u ) {
+      const auto j = detail::string_search_lowest_bit( mask );
+      if( fn( i + j, std::uint32_t{buckets[j]} ) ) {
+        return;
+      }
+    }
+    i += 16u;
+  }
+#endif
+
+  // Too few positions remain for a full block; try every bucket
+  for( ; i < n; ++i ) {
+    if( fn( i, std::uint32_t{0xffu} ) ) {
+      return;
+    }
+  }
+}
+
+inline bit::core::multi_searcher::size_type
+  bit::core::multi_searcher::teddy_match( const char* h,
+                                          size_type n,
+                                          size_type i,
+                                          std::uint32_t buckets )
+  const noexcept
+{
+  auto result = npos;
+
+  for( ; buckets != 0u; buckets &= buckets - 1u ) {
+    const auto b = detail::string_search_lowest_bit( buckets );
+
+    // Patterns are in increasing order within a bucket, so only the first
+    // match in each bucket can be the lowest
+    for( auto k = m_bucket_begin[b]; k < m_bucket_begin[b + 1u]; ++k ) {
+      const auto p = size_type{m_bucket_patterns[k]};
+      if( p >= result ) {
+        break;
+      }
+      if( matches_at( h, n, i, p ) ) {
+        result = p;
+        break;
+      }
+    }
+  }
+  return result;
+}
+
+inline bit::core::multi_searcher::match
+  bit::core::multi_searcher::automaton_find_first( string_view haystack,
+                                                   size_type pos )
+  const noexcept
+{
+  const auto* h = haystack.data();
+  const auto n  = haystack.size();
+
+  auto result = match{ npos, 0u, npos };
+  auto row = std::uint32_t{0};
+
+  for( auto i = pos; i < n; ++i ) {
+    // Any match starting at or before the best so far has ended by now
+    if( result.position != npos && i >= result.position + m_max_size ) {
+      break;
+    }
+
+    const auto next = m_transitions[row + m_classes[static_cast<unsigned char>(h[i])]];
+    row = next & ~detail::multi_searcher_output_flag();
+    if( (next & detail::multi_searcher_output_flag()) == 0u ) {
+      continue;
+    }
+
+    for( auto s = row / m_class_count; s != 0u; s = m_dictionary[s] ) {
+      for( auto k = m_output_begin[s]; k < m_output_begin[s + 1u]; ++k ) {
+        const auto p = size_type{m_outputs[k]};
+        const auto start = i + 1u - pattern_size( p );
+
+        if( start < result.position || (start == result.position && p < result.pattern) ) {
+          result = match{ start, pattern_size( p ), p };
+        }
+      }
+    }
+  }
+  return result;
+}
+
+#endif /* BIT_CORE_CONTAINERS_DETAIL_MULTI_SEARCHER_INL */
@@ -143,6 +143,24 @@ inline typename bit::core::ring_array<T,N>::const_reference
   return m_buffer.back();
 }
 
+//----------------------------------------------------------------------------
+
+template<typename T, std::size_t N>
+inline typename bit::core::ring_array<T,N>::reference
+  bit::core::ring_array<T,N>::operator[]( size_type n )
+  noexcept
+{
+  return m_buffer[n];
+}
+
+template<typename T, std::size_t N>
+inline typename bit::core::ring_array<T,N>::const_reference
+  bit::core::ring_array<T,N>::operator[]( size_type n )
+  const noexcept
+{
+  return m_buffer[n];
+}
+
 //----------------------------------------------------------------------------
 // Modifiers
 //----------------------------------------------------------------------------
@@ -202,7 +220,7 @@ inline void bit::core::ring_array<T,N>::pop_front()
 template<typename T, std::size_t N>
 inline void bit::core::ring_array<T,N>::pop_back()
 {
-  m_buffer.pop_front();
+  m_buffer.pop_back();
 }
 
 //----------------------------------------------------------------------------
@@ -11,8 +11,10 @@
 
 template<typename C, typename T>
 inline bit::core::detail::ring_buffer_iterator<C,T>
-  ::ring_buffer_iterator( C& container, T* ptr, bool compare_twice )
-  : m_ptr{ptr},
+  ::ring_buffer_iterator( C& container,
+                          size_type position,
+                          bool compare_twice )
+  : m_position{position},
     m_container{&container},
     m_compare_twice{compare_twice}
 {
@@ -29,7 +31,7 @@ inline bit::core::detail::ring_buffer_iterator<C,T>&
   noexcept
 {
   m_compare_twice = false;
-  m_container->increment( m_ptr );
+  m_position = m_container->increment( m_position );
   return (*this);
 }
 
@@ -40,7 +42,7 @@ inline bit::core::detail::ring_buffer_iterator<C,T>
 {
   auto iter = (*this);
   m_compare_twice = false;
-  m_container->increment( m_ptr );
+  m_position = m_container->increment( m_position );
   return iter;
 }
 
@@ -52,7 +54,7 @@ inline bit::core::detail::ring_buffer_iterator<C,T>&
   noexcept
 {
   m_compare_twice = false;
-  m_container->decrement( m_ptr );
+  m_position = m_container->decrement( m_position );
   return (*this);
 }
 
@@ -63,7 +65,7 @@ inline bit::core::detail::ring_buffer_iterator<C,T>
 {
   auto iter = (*this);
   m_compare_twice = false;
-  m_container->decrement( m_ptr );
+  m_position = m_container->decrement( m_position );
   return iter;
 }
 
@@ -76,7 +78,7 @@ inline typename bit::core::detail::ring_buffer_iterator<C,T>::reference
   bit::core::detail::ring_buffer_iterator<C,T>::operator*()
   noexcept
 {
-  return *m_ptr;
+  return *m_container->entry( m_position );
 }
 
 template<typename C, typename T>
@@ -84,7 +86,7 @@ inline typename bit::core::detail::ring_buffer_iterator<C,T>::pointer
   bit::core::detail::ring_buffer_iterator<C,T>::operator->()
   noexcept
 {
-  return m_ptr;
+  return m_container->entry( m_position );
 }
 
 //-----------------------------------------------------------------------------
@@ -97,7 +99,7 @@ inline bool
                                 const ring_buffer_iterator<C,T>& rhs )
   noexcept
 {
-  return lhs.m_compare_twice == rhs.m_compare_twice && lhs.m_ptr == rhs.m_ptr;
+  return lhs.m_compare_twice == rhs.m_compare_twice && lhs.m_position == rhs.m_position;
 }
 
 template<typename C, typename T>
@@ -117,45 +119,48 @@ inline bool
 // Constructor
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline bit::core::ring_buffer<T>::ring_buffer()
+template<typename T, bool PowerOfTwo>
+inline bit::core::ring_buffer<T,PowerOfTwo>::ring_buffer()
   noexcept
   : ring_buffer( nullptr )
 {
 
 }
 
-template<typename T>
-inline bit::core::ring_buffer<T>::ring_buffer( std::nullptr_t )
+template<typename T, bool PowerOfTwo>
+inline bit::core::ring_buffer<T,PowerOfTwo>::ring_buffer( std::nullptr_t )
   noexcept
   : ring_buffer(nullptr,0)
 {
 
 }
 
-template<typename T>
-inline bit::core::ring_buffer<T>::ring_buffer( void* buffer,
-                                                      size_type size )
+template<typename T, bool PowerOfTwo>
+inline bit::core::ring_buffer<T,PowerOfTwo>::ring_buffer( void* buffer,
+                                                          size_type size )
   noexcept
   : m_buffer(static_cast<T*>(buffer)),
-    m_begin(m_buffer),
-    m_end(m_buffer),
+    m_head(0),
+    m_tail(0),
     m_capacity(size),
     m_size(0)
 {
-
+  BIT_ASSERT( !PowerOfTwo || (size & (size - 1u)) == 0u,
+              "ring_buffer: capacity must be a power of two" );
 }
 
-template<typename T>
-inline bit::core::ring_buffer<T>
+template<typename T, bool PowerOfTwo>
+inline bit::core::ring_buffer<T,PowerOfTwo>
   ::ring_buffer( ring_buffer&& other )
   noexcept
   : m_buffer( other.m_buffer ),
-    m_begin( other.m_begin ),
-    m_end( other.m_end ),
+    m_head( other.m_head ),
+    m_tail( other.m_tail ),
     m_capacity( other.m_capacity ),
     m_size( other.m_size )
 {
+  other.m_head     = 0;
+  other.m_tail     = 0;
   other.m_size     = 0;
   other.m_capacity = 0;
   other.m_buffer   = nullptr;
@@ -163,17 +168,17 @@ inline bit::core::ring_buffer<T>
 
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline bit::core::ring_buffer<T>::~ring_buffer()
+template<typename T, bool PowerOfTwo>
+inline bit::core::ring_buffer<T,PowerOfTwo>::~ring_buffer()
 {
   clear();
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T>
-bit::core::ring_buffer<T>&
-  bit::core::ring_buffer<T>::operator=( ring_buffer other )
+template<typename T, bool PowerOfTwo>
+bit::core::ring_buffer<T,PowerOfTwo>&
+  bit::core::ring_buffer<T,PowerOfTwo>::operator=( ring_buffer other )
   noexcept
 {
   other.swap(*this);
@@ -185,131 +190,204 @@ bit::core::ring_buffer<T>&
 // Modifiers
 //-----------------------------------------------------------------------------
 
-template<typename T>
+template<typename T, bool PowerOfTwo>
 template<typename...Args,typename>
-inline typename bit::core::ring_buffer<T>::reference
-  bit::core::ring_buffer<T>::emplace_back( Args&&...args )
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::reference
+  bit::core::ring_buffer<T,PowerOfTwo>::emplace_back( Args&&...args )
 {
   if(full()) {
-    destroy_at( m_begin );
-    increment( m_begin );
-  } else {
+    destroy_at( entry( m_head ) );
+    m_head = increment( m_head );
+  } else if( !PowerOfTwo ) {
     ++m_size;
   }
 
+  // The positions are computed before constructing, since the construction
+  // may otherwise force them to be reloaded
+  const auto result = entry( m_tail );
+  const auto tail   = increment( m_tail );
+
 #if BIT_COMPILER_EXCEPTIONS_ENABLED
   try {
 #endif
-    uninitialized_construct_at<T>(m_end, std::forward<Args>(args)... );
+    uninitialized_construct_at<T>(result, std::forward<Args>(args)... );
 #if BIT_COMPILER_EXCEPTIONS_ENABLED
   } catch (...) {
-    --m_size;
+    if( !PowerOfTwo ) --m_size;
     throw;
   }
 #endif
-  auto result = m_end;
-  increment( m_end );
+  m_tail = tail;
 
   return (*result);
 }
 
-template<typename T>
+template<typename T, bool PowerOfTwo>
 template<typename...Args,typename>
-inline typename bit::core::ring_buffer<T>::reference
-  bit::core::ring_buffer<T>::emplace_front( Args&&...args )
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::reference
+  bit::core::ring_buffer<T,PowerOfTwo>::emplace_front( Args&&...args )
 {
   if(full()) {
-    decrement( m_end );
-    destroy_at( m_end );
-  } else {
+    m_tail = decrement( m_tail );
+    destroy_at( entry( m_tail ) );
+  } else if( !PowerOfTwo ) {
     ++m_size;
   }
-  decrement( m_begin );
+
+  const auto head   = decrement( m_head );
+  const auto result = entry( head );
 
 #if BIT_COMPILER_EXCEPTIONS_ENABLED
   try {
 #endif
-    uninitialized_construct_at<T>(m_begin, std::forward<Args>(args)... );
+    uninitialized_construct_at<T>(result, std::forward<Args>(args)... );
 #if BIT_COMPILER_EXCEPTIONS_ENABLED
   } catch (...) {
-    increment( m_begin );
-    --m_size;
+    if( !PowerOfTwo ) --m_size;
     throw;
   }
 #endif
-  return (*m_begin);
+  m_head = head;
+
+  return (*result);
 }
 
 //----------------------------------------------------------------------
 
-template<typename T>
+template<typename T, bool PowerOfTwo>
 template<typename U,typename>
-inline void bit::core::ring_buffer<T>::push_back( const T& value )
+inline void bit::core::ring_buffer<T,PowerOfTwo>::push_back( const T& value )
 {
   emplace_back( value );
 }
 
-template<typename T>
+template<typename T, bool PowerOfTwo>
 template<typename U,typename>
-inline void bit::core::ring_buffer<T>::push_back( T&& value )
+inline void bit::core::ring_buffer<T,PowerOfTwo>::push_back( T&& value )
 {
   emplace_back( std::move(value) );
 }
 
 //----------------------------------------------------------------------
 
-template<typename T>
+template<typename T, bool PowerOfTwo>
 template<typename U,typename>
-inline void bit::core::ring_buffer<T>::push_front( const T& value )
+inline void bit::core::ring_buffer<T,PowerOfTwo>::push_front( const T& value )
 {
   emplace_front( value );
 }
 
-template<typename T>
+template<typename T, bool PowerOfTwo>
 template<typename U,typename>
-inline void bit::core::ring_buffer<T>::push_front( T&& value )
+inline void bit::core::ring_buffer<T,PowerOfTwo>::push_front( T&& value )
 {
   emplace_front( std::move(value) );
 }
 
 //----------------------------------------------------------------------
 
-template<typename T>
-inline void bit::core::ring_buffer<T>::pop_front()
+template<typename T, bool PowerOfTwo>
+template<typename InputIt, typename>
+inline void bit::core::ring_buffer<T,PowerOfTwo>::push_back( InputIt first,
+                                                             InputIt last )
+{
+  using source_type  = typename std::iterator_traits<InputIt>::value_type;
+  using is_copyable_block = conjunction<
+    std::is_trivially_copyable<T>,
+    std::is_same<std::remove_cv_t<source_type>,T>,
+    is_contiguous_iterator<InputIt>
+  >;
+
+  push_back_range( first, last, is_copyable_block{} );
+}
+
+//----------------------------------------------------------------------
+
+template<typename T, bool PowerOfTwo>
+template<typename InputIt, typename>
+inline void bit::core::ring_buffer<T,PowerOfTwo>::assign( InputIt first,
+                                                          InputIt last )
 {
-  destroy_at( m_begin );
-  increment( m_begin );
-  --m_size;
+  clear();
+  push_back( first, last );
 }
 
-template<typename T>
-inline void bit::core::ring_buffer<T>::pop_back()
+template<typename T, bool PowerOfTwo>
+inline void bit::core::ring_buffer<T,PowerOfTwo>::assign( size_type n,
+                                                          const T& value )
 {
-  destroy_at( m_end );
-  decrement( m_end );
-  --m_size;
+  clear();
+  for( n = std::min( n, m_capacity ); n > 0u; --n ) {
+    emplace_back( value );
+  }
 }
 
 //----------------------------------------------------------------------
 
-template<typename T>
-inline void bit::core::ring_buffer<T>::clear()
-  noexcept
+template<typename T, bool PowerOfTwo>
+inline void bit::core::ring_buffer<T,PowerOfTwo>::pop_front()
 {
-  while( !empty() ) {
-    pop_back();
+  destroy_at( entry( m_head ) );
+  m_head = increment( m_head );
+  if( !PowerOfTwo ) --m_size;
+}
+
+template<typename T, bool PowerOfTwo>
+inline void bit::core::ring_buffer<T,PowerOfTwo>::pop_front( size_type n )
+{
+  BIT_ASSERT( n <= size(), "ring_buffer::pop_front: not enough entries" );
+
+  if( !std::is_trivially_destructible<T>::value ) {
+    for( ; n > 0u; --n ) {
+      pop_front();
+    }
+    return;
   }
+
+  m_head = advance( m_head, n );
+  if( !PowerOfTwo ) m_size -= n;
 }
 
-template<typename T>
-inline void bit::core::ring_buffer<T>::swap( ring_buffer& other )
+//----------------------------------------------------------------------
+
+template<typename T, bool PowerOfTwo>
+template<typename U,typename>
+inline void bit::core::ring_buffer<T,PowerOfTwo>::commit_back( size_type n )
+  noexcept
+{
+  BIT_ASSERT( n <= m_capacity - size(),
+              "ring_buffer::commit_back: not enough free entries" );
+
+  m_tail = advance( m_tail, n );
+  if( !PowerOfTwo ) m_size += n;
+}
+
+template<typename T, bool PowerOfTwo>
+inline void bit::core::ring_buffer<T,PowerOfTwo>::pop_back()
+{
+  m_tail = decrement( m_tail );
+  destroy_at( entry( m_tail ) );
+  if( !PowerOfTwo ) --m_size;
+}
+
+//----------------------------------------------------------------------
+
+template<typename T, bool PowerOfTwo>
+inline void bit::core::ring_buffer<T,PowerOfTwo>::clear()
+  noexcept
+{
+  pop_front( size() );
+}
+
+template<typename T, bool PowerOfTwo>
+inline void bit::core::ring_buffer<T,PowerOfTwo>::swap( ring_buffer& other )
   noexcept
 {
   using std::swap;
 
   swap(m_buffer, other.m_buffer);
-  swap(m_begin, other.m_begin);
-  swap(m_end, other.m_end);
+  swap(m_head, other.m_head);
+  swap(m_tail, other.m_tail);
   swap(m_capacity, other.m_capacity);
   swap(m_size, other.m_size);
 }
@@ -318,41 +396,41 @@ inline void bit::core::ring_buffer<T>::swap( ring_buffer& other )
 // Capacity
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline bool bit::core::ring_buffer<T>::empty()
+template<typename T, bool PowerOfTwo>
+inline bool bit::core::ring_buffer<T,PowerOfTwo>::empty()
   const noexcept
 {
-  return m_size == 0u;
+  return size() == 0u;
 }
 
-template<typename T>
-inline bool bit::core::ring_buffer<T>::full()
+template<typename T, bool PowerOfTwo>
+inline bool bit::core::ring_buffer<T,PowerOfTwo>::full()
   const noexcept
 {
-  return m_size == m_capacity;
+  return size() == m_capacity;
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::size_type
-  bit::core::ring_buffer<T>::size()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::size_type
+  bit::core::ring_buffer<T,PowerOfTwo>::size()
   const noexcept
 {
-  return m_size;
+  return PowerOfTwo ? (m_tail - m_head) : m_size;
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::size_type
-  bit::core::ring_buffer<T>::max_size()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::size_type
+  bit::core::ring_buffer<T,PowerOfTwo>::max_size()
   const noexcept
 {
   return m_capacity;
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::size_type
-  bit::core::ring_buffer<T>::capacity()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::size_type
+  bit::core::ring_buffer<T,PowerOfTwo>::capacity()
   const noexcept
 {
   return m_capacity;
@@ -362,55 +440,130 @@ inline typename bit::core::ring_buffer<T>::size_type
 // Element Access
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::reference
-  bit::core::ring_buffer<T>::front()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::reference
+  bit::core::ring_buffer<T,PowerOfTwo>::front()
+  noexcept
+{
+  return *entry( m_head );
+}
+
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::const_reference
+  bit::core::ring_buffer<T,PowerOfTwo>::front()
+  const noexcept
+{
+  return *entry( m_head );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::reference
+  bit::core::ring_buffer<T,PowerOfTwo>::back()
   noexcept
 {
-  return *m_begin;
+  return *entry( decrement( m_tail ) );
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::const_reference
-  bit::core::ring_buffer<T>::front()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::const_reference
+  bit::core::ring_buffer<T,PowerOfTwo>::back()
   const noexcept
 {
-  return *m_begin;
+  return *entry( decrement( m_tail ) );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::reference
+  bit::core::ring_buffer<T,PowerOfTwo>::operator[]( size_type n )
+  noexcept
+{
+  if( PowerOfTwo ) {
+    return *entry( m_head + n );
+  }
+
+  // The head is always less than the capacity, so this wraps at most once
+  const auto position = m_head + n;
+  return *entry( (position < m_capacity) ? position : position - m_capacity );
+}
+
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::const_reference
+  bit::core::ring_buffer<T,PowerOfTwo>::operator[]( size_type n )
+  const noexcept
+{
+  if( PowerOfTwo ) {
+    return *entry( m_head + n );
+  }
+
+  const auto position = m_head + n;
+  return *entry( (position < m_capacity) ? position : position - m_capacity );
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::reference
-  bit::core::ring_buffer<T>::back()
+template<typename T, bool PowerOfTwo>
+inline bit::core::span<T> bit::core::ring_buffer<T,PowerOfTwo>::array_one()
   noexcept
 {
-  auto ptr = m_end;
-  return *decrement( ptr );
+  return { entry( m_head ), static_cast<std::ptrdiff_t>(array_one_size()) };
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::const_reference
-  bit::core::ring_buffer<T>::back()
+template<typename T, bool PowerOfTwo>
+inline bit::core::span<const T> bit::core::ring_buffer<T,PowerOfTwo>::array_one()
   const noexcept
 {
-  auto ptr = m_end;
-  return *decrement( ptr );
+  return { entry( m_head ), static_cast<std::ptrdiff_t>(array_one_size()) };
+}
+
+template<typename T, bool PowerOfTwo>
+inline bit::core::span<T> bit::core::ring_buffer<T,PowerOfTwo>::array_two()
+  noexcept
+{
+  return { m_buffer, static_cast<std::ptrdiff_t>(size() - array_one_size()) };
+}
+
+template<typename T, bool PowerOfTwo>
+inline bit::core::span<const T> bit::core::ring_buffer<T,PowerOfTwo>::array_two()
+  const noexcept
+{
+  return { m_buffer, static_cast<std::ptrdiff_t>(size() - array_one_size()) };
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::pointer
-  bit::core::ring_buffer<T>::data()
+template<typename T, bool PowerOfTwo>
+inline bit::core::span<T> bit::core::ring_buffer<T,PowerOfTwo>::free_array_one()
+  noexcept
+{
+  return { entry( m_tail ), static_cast<std::ptrdiff_t>(free_array_one_size()) };
+}
+
+template<typename T, bool PowerOfTwo>
+inline bit::core::span<T> bit::core::ring_buffer<T,PowerOfTwo>::free_array_two()
+  noexcept
+{
+  const auto free = m_capacity - size();
+
+  return { m_buffer, static_cast<std::ptrdiff_t>(free - free_array_one_size()) };
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::pointer
+  bit::core::ring_buffer<T,PowerOfTwo>::data()
   noexcept
 {
   return m_buffer;
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::const_pointer
-  bit::core::ring_buffer<T>::data()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::const_pointer
+  bit::core::ring_buffer<T,PowerOfTwo>::data()
   const noexcept
 {
   return m_buffer;
@@ -420,159 +573,256 @@ inline typename bit::core::ring_buffer<T>::const_pointer
 // Iteration
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::iterator
-  bit::core::ring_buffer<T>::begin()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::iterator
+  bit::core::ring_buffer<T,PowerOfTwo>::begin()
   noexcept
 {
-  return iterator{ (*this), m_begin, (capacity()) > 0 && full() };
+  return iterator{ (*this), m_head, (capacity()) > 0 && full() };
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::const_iterator
-  bit::core::ring_buffer<T>::begin()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::const_iterator
+  bit::core::ring_buffer<T,PowerOfTwo>::begin()
   const noexcept
 {
-  return const_iterator{ (*this), m_begin, (capacity()) > 0 && full() };
+  return const_iterator{ (*this), m_head, (capacity()) > 0 && full() };
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::const_iterator
-  bit::core::ring_buffer<T>::cbegin()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::const_iterator
+  bit::core::ring_buffer<T,PowerOfTwo>::cbegin()
   const noexcept
 {
-  return const_iterator{ (*this), m_begin, (capacity()) > 0 && full() };
+  return const_iterator{ (*this), m_head, (capacity()) > 0 && full() };
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::iterator
-  bit::core::ring_buffer<T>::end()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::iterator
+  bit::core::ring_buffer<T,PowerOfTwo>::end()
   noexcept
 {
-  return iterator{ (*this), m_end, false };
+  return iterator{ (*this), m_tail, false };
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::const_iterator
-  bit::core::ring_buffer<T>::end()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::const_iterator
+  bit::core::ring_buffer<T,PowerOfTwo>::end()
   const noexcept
 {
-  return const_iterator{ (*this), m_end, false };
+  return const_iterator{ (*this), m_tail, false };
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::const_iterator
-  bit::core::ring_buffer<T>::cend()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::const_iterator
+  bit::core::ring_buffer<T,PowerOfTwo>::cend()
   const noexcept
 {
-  return const_iterator{ (*this), m_end, false };
+  return const_iterator{ (*this), m_tail, false };
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::reverse_iterator
-  bit::core::ring_buffer<T>::rbegin()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::reverse_iterator
+  bit::core::ring_buffer<T,PowerOfTwo>::rbegin()
   noexcept
 {
-  return reverse_iterator{ iterator{(*this), m_end, (capacity()) > 0 && full()} };
+  return reverse_iterator{ iterator{(*this), m_tail, (capacity()) > 0 && full()} };
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::const_reverse_iterator
-  bit::core::ring_buffer<T>::rbegin()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::const_reverse_iterator
+  bit::core::ring_buffer<T,PowerOfTwo>::rbegin()
   const noexcept
 {
-  return const_reverse_iterator{ const_iterator{(*this), m_end, (capacity()) > 0 && full()} };
+  return const_reverse_iterator{ const_iterator{(*this), m_tail, (capacity()) > 0 && full()} };
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::const_reverse_iterator
-  bit::core::ring_buffer<T>::crbegin()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::const_reverse_iterator
+  bit::core::ring_buffer<T,PowerOfTwo>::crbegin()
   const noexcept
 {
-  return const_reverse_iterator{ const_iterator{(*this), m_end, (capacity()) > 0 && full()} };
+  return const_reverse_iterator{ const_iterator{(*this), m_tail, (capacity()) > 0 && full()} };
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::reverse_iterator
-  bit::core::ring_buffer<T>::rend()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::reverse_iterator
+  bit::core::ring_buffer<T,PowerOfTwo>::rend()
   noexcept
 {
-  return reverse_iterator{ iterator{(*this), m_begin, false} };
+  return reverse_iterator{ iterator{(*this), m_head, false} };
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::const_reverse_iterator
-  bit::core::ring_buffer<T>::rend()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::const_reverse_iterator
+  bit::core::ring_buffer<T,PowerOfTwo>::rend()
   const noexcept
 {
-  return const_reverse_iterator{ const_iterator{(*this), m_begin, false} };
+  return const_reverse_iterator{ const_iterator{(*this), m_head, false} };
 }
 
-template<typename T>
-inline typename bit::core::ring_buffer<T>::const_reverse_iterator
-  bit::core::ring_buffer<T>::crend()
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::const_reverse_iterator
+  bit::core::ring_buffer<T,PowerOfTwo>::crend()
   const noexcept
 {
-  return const_reverse_iterator{ const_iterator{(*this), m_begin, false} };
+  return const_reverse_iterator{ const_iterator{(*this), m_head, false} };
 }
 //-----------------------------------------------------------------------------
 // Private Members
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline T*& bit::core::ring_buffer<T>::increment( T*& iter )
-  noexcept
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::size_type
+  bit::core::ring_buffer<T,PowerOfTwo>::increment( size_type position )
+  const noexcept
 {
-  if( iter == &m_buffer[m_capacity-1] ) {
-    return (iter = &m_buffer[0]);
+  if( PowerOfTwo ) {
+    return position + 1u;
   }
-  return ++iter;
+  return (position + 1u == m_capacity) ? 0u : position + 1u;
 }
 
-template<typename T>
-inline const T*& bit::core::ring_buffer<T>::increment( const T*& iter )
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::size_type
+  bit::core::ring_buffer<T,PowerOfTwo>::decrement( size_type position )
   const noexcept
 {
-  if( iter == &m_buffer[m_capacity-1] ) {
-    return (iter = &m_buffer[0]);
+  if( PowerOfTwo ) {
+    return position - 1u;
   }
-  return ++iter;
+  return (position == 0u) ? m_capacity - 1u : position - 1u;
+}
+
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::size_type
+  bit::core::ring_buffer<T,PowerOfTwo>::advance( size_type position,
+                                                 size_type n )
+  const noexcept
+{
+  if( PowerOfTwo ) {
+    return position + n;
+  }
+
+  // n is at most the capacity, so this wraps at most once
+  position += n;
+  return (position < m_capacity) ? position : position - m_capacity;
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T>
-inline T*& bit::core::ring_buffer<T>::decrement( T*& iter )
-  noexcept
+template<typename T, bool PowerOfTwo>
+inline T* bit::core::ring_buffer<T,PowerOfTwo>::entry( size_type position )
+  const noexcept
 {
-  if( iter == &m_buffer[0] ) {
-    return (iter = &m_buffer[m_capacity-1]);
+  if( PowerOfTwo ) {
+    return &m_buffer[position & (m_capacity - 1u)];
   }
-  return --iter;
+  return &m_buffer[position];
 }
 
-template<typename T>
-inline const T*& bit::core::ring_buffer<T>::decrement( const T*& iter )
+//-----------------------------------------------------------------------------
+
+template<typename T, bool PowerOfTwo>
+inline void bit::core::ring_buffer<T,PowerOfTwo>::rebind( T* buffer,
+                                                          size_type capacity,
+                                                          size_type count )
+  noexcept
+{
+  BIT_ASSERT( count <= capacity, "ring_buffer::rebind: too many entries" );
+  BIT_ASSERT( !PowerOfTwo || (capacity & (capacity - 1u)) == 0u,
+              "ring_buffer::rebind: capacity must be a power of two" );
+
+  m_buffer   = buffer;
+  m_capacity = capacity;
+  m_head     = 0u;
+  m_tail     = advance( 0u, count );
+  m_size     = count;
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::size_type
+  bit::core::ring_buffer<T,PowerOfTwo>::array_one_size()
   const noexcept
 {
-  if( iter == &m_buffer[0] ) {
-    return (iter = &m_buffer[m_capacity-1]);
+  const auto offset = static_cast<size_type>(entry( m_head ) - m_buffer);
+
+  return std::min( size(), m_capacity - offset );
+}
+
+template<typename T, bool PowerOfTwo>
+inline typename bit::core::ring_buffer<T,PowerOfTwo>::size_type
+  bit::core::ring_buffer<T,PowerOfTwo>::free_array_one_size()
+  const noexcept
+{
+  if( m_capacity == 0u ) return 0u;
+
+  const auto offset = static_cast<size_type>(entry( m_tail ) - m_buffer);
+
+  return std::min( m_capacity - size(), m_capacity - offset );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, bool PowerOfTwo>
+template<typename InputIt>
+inline void bit::core::ring_buffer<T,PowerOfTwo>::push_back_range( InputIt first,
+                                                                   InputIt last,
+                                                                   std::false_type )
+{
+  for( ; first != last; ++first ) {
+    emplace_back( *first );
   }
-  return --iter;
+}
+
+template<typename T, bool PowerOfTwo>
+template<typename InputIt>
+inline void bit::core::ring_buffer<T,PowerOfTwo>::push_back_range( InputIt first,
+                                                                   InputIt last,
+                                                                   std::true_type )
+{
+  if( first == last || m_capacity == 0u ) return;
+
+  auto count  = static_cast<size_type>(last - first);
+  auto source = std::addressof(*first);
+
+  // Only the last capacity() entries would survive the pushes anyway
+  if( count > m_capacity ) {
+    source += (count - m_capacity);
+    count   = m_capacity;
+  }
+
+  // Make room first, as pushing one entry at a time would
+  const auto available = m_capacity - size();
+  if( count > available ) {
+    pop_front( count - available );
+  }
+
+  // The new entries start at the tail, and wrap at most once
+  const auto offset = static_cast<size_type>(entry( m_tail ) - m_buffer);
+  const auto before_wrap = std::min( count, m_capacity - offset );
+
+  std::memcpy( m_buffer + offset, source, before_wrap * sizeof(T) );
+  std::memcpy( m_buffer, source + before_wrap, (count - before_wrap) * sizeof(T) );
+
+  m_tail = advance( m_tail, count );
+  if( !PowerOfTwo ) m_size += count;
 }
 
 //-----------------------------------------------------------------------------
 // Free-functions
 //-----------------------------------------------------------------------------
 
-template<typename T>
-void bit::core::swap( ring_buffer<T>& lhs, ring_buffer<T>& rhs )
+template<typename T, bool P>
+void bit::core::swap( ring_buffer<T,P>& lhs, ring_buffer<T,P>& rhs )
   noexcept
 {
   lhs.swap(rhs);
@@ -582,49 +832,49 @@ void bit::core::swap( ring_buffer<T>& lhs, ring_buffer<T>& rhs )
 // Comparisons
 //-----------------------------------------------------------------------------
 
-template<typename T>
-bool bit::core::operator==( const ring_buffer<T>& lhs,
-                            const ring_buffer<T>& rhs )
+template<typename T, bool P>
+bool bit::core::operator==( const ring_buffer<T,P>& lhs,
+                            const ring_buffer<T,P>& rhs )
   noexcept
 {
-  return std::equal(lhs.begin(),lhs.end(),rhs.begin(),lhs.end());
+  return std::equal(lhs.begin(),lhs.end(),rhs.begin(),rhs.end());
 }
 
-template<typename T>
-bool bit::core::operator!=( const ring_buffer<T>& lhs,
-                            const ring_buffer<T>& rhs )
+template<typename T, bool P>
+bool bit::core::operator!=( const ring_buffer<T,P>& lhs,
+                            const ring_buffer<T,P>& rhs )
   noexcept
 {
   return !(lhs==rhs);
 }
 
-template<typename T>
-bool bit::core::operator<( const ring_buffer<T>& lhs,
-                           const ring_buffer<T>& rhs )
+template<typename T, bool P>
+bool bit::core::operator<( const ring_buffer<T,P>& lhs,
+                           const ring_buffer<T,P>& rhs )
   noexcept
 {
   return std::lexicographical_compare(lhs.begin(),lhs.end(),rhs.begin(),rhs.end());
 }
 
-template<typename T>
-bool bit::core::operator>( const ring_buffer<T>& lhs,
-                           const ring_buffer<T>& rhs )
+template<typename T, bool P>
+bool bit::core::operator>( const ring_buffer<T,P>& lhs,
+                           const ring_buffer<T,P>& rhs )
   noexcept
 {
   return (rhs<lhs);
 }
 
-template<typename T>
-bool bit::core::operator<=( const ring_buffer<T>& lhs,
-                            const ring_buffer<T>& rhs )
+template<typename T, bool P>
+bool bit::core::operator<=( const ring_buffer<T,P>& lhs,
+                            const ring_buffer<T,P>& rhs )
   noexcept
 {
   return !(rhs<lhs);
 }
 
-template<typename T>
-bool bit::core::operator>=( const ring_buffer<T>& lhs,
-                            const ring_buffer<T>& rhs )
+template<typename T, bool P>
+bool bit::core::operator>=( const ring_buffer<T,P>& lhs,
+                            const ring_buffer<T,P>& rhs )
   noexcept
 {
   return !(lhs<rhs);
@@ -36,9 +36,16 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include "../ring_buffer.hpp"
+#include "../span.hpp"
 #include "../../utilities/compressed_pair.hpp"
+#include "../../utilities/uninitialized_storage.hpp" // uninitialized_move_at
+#include "../../traits/properties/is_trivially_relocatable.hpp"
 
+#include <cstring>     // std::memcpy
+#include <memory>      // std::allocator_traits
 #include <tuple>
+#include <type_traits> // std::is_nothrow_move_constructible
 #include <utility>
 
 namespace bit {
@@ -113,6 +120,83 @@ namespace bit {
           m_storage.swap(other.m_storage);
         }
 
+        /// \brief Moves the entries into a new allocation of \p n entries
+        ///
+        /// Trivially relocatable entries are copied with at most two calls
+        /// to \c std::memcpy, and nothrow-movable entries are moved one at a
+        /// time. Other entries are copied, leaving this storage unchanged if
+        /// a copy throws.
+        ///
+        /// \pre \p n is not less than \c buffer().size()
+        ///
+        /// \param n the new capacity
+        void reallocate( std::size_t n )
+        {
+          using tag_type = std::integral_constant<bool,
+            is_trivially_relocatable<T>::value ||
+            std::is_nothrow_move_constructible<T>::value
+          >;
+
+          reallocate( n, tag_type{} );
+        }
+
+        //---------------------------------------------------------------------
+        // Private Member Functions
+        //---------------------------------------------------------------------
+      private:
+
+        void reallocate( std::size_t n, std::true_type )
+        {
+          using traits_type = std::allocator_traits<Allocator>;
+          auto& buffer    = m_storage.first();
+          auto& allocator = m_storage.second();
+
+          // Nothing can throw once the new memory is allocated
+          const auto p     = traits_type::allocate( allocator, n );
+          const auto size  = buffer.size();
+          const auto first = buffer.array_one();
+          const auto count = static_cast<std::size_t>(first.size());
+
+          relocate( p, first, is_trivially_relocatable<T>{} );
+          relocate( p + count, buffer.array_two(), is_trivially_relocatable<T>{} );
+
+          if( buffer.data() != nullptr ) {
+            traits_type::deallocate( allocator, buffer.data(), buffer.capacity() );
+          }
+          buffer.rebind( p, n, size );
+        }
+
+        void reallocate( std::size_t n, std::false_type )
+        {
+          auto storage = ring_buffer_storage{ n, get_allocator() };
+
+          for( const auto& v : buffer() ) {
+            storage.buffer().emplace_back( v );
+          }
+
+          // Swap the active storage
+          buffer().swap( storage.buffer() );
+        }
+
+        static void relocate( T* p, span<T> entries, std::true_type )
+          noexcept
+        {
+          if( entries.empty() ) return;
+
+          std::memcpy( static_cast<void*>(p),
+                       static_cast<const void*>(entries.data()),
+                       static_cast<std::size_t>(entries.size()) * sizeof(T) );
+        }
+
+        static void relocate( T* p, span<T> entries, std::false_type )
+          noexcept
+        {
+          for( auto& v : entries ) {
+            uninitialized_move_at( p++, std::move(v) );
+            destroy_at( &v );
+          }
+        }
+
         //---------------------------------------------------------------------
         // Private Member Types
         //---------------------------------------------------------------------
@@ -9,22 +9,22 @@
 // Constructors
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-bit::core::ring_deque<T,Allocator>::ring_deque()
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::ring_deque<T,Allocator,OverflowPolicy>::ring_deque()
   : ring_deque( Allocator() )
 {
 
 }
 
-template<typename T, typename Allocator>
-bit::core::ring_deque<T,Allocator>::ring_deque( const Allocator& alloc )
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::ring_deque<T,Allocator,OverflowPolicy>::ring_deque( const Allocator& alloc )
   : ring_deque( 0, alloc )
 {
 
 }
 
-template<typename T, typename Allocator>
-bit::core::ring_deque<T,Allocator>
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::ring_deque<T,Allocator,OverflowPolicy>
   ::ring_deque( size_type count, const T& value, const Allocator& alloc )
   : ring_deque( count, alloc )
 {
@@ -33,16 +33,16 @@ bit::core::ring_deque<T,Allocator>
   }
 }
 
-template<typename T, typename Allocator>
-bit::core::ring_deque<T,Allocator>
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::ring_deque<T,Allocator,OverflowPolicy>
   ::ring_deque( size_type count, const Allocator& alloc )
   : m_storage( count, alloc )
 {
 
 }
 
-template<typename T, typename Allocator>
-bit::core::ring_deque<T,Allocator>
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::ring_deque<T,Allocator,OverflowPolicy>
   ::ring_deque( const ring_deque& other )
   : ring_deque( other.capacity(), other.get_allocator() )
 {
@@ -52,8 +52,8 @@ bit::core::ring_deque<T,Allocator>
 }
 
 
-template<typename T, typename Allocator>
-bit::core::ring_deque<T,Allocator>
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::ring_deque<T,Allocator,OverflowPolicy>
   ::ring_deque( const ring_deque& other, const Allocator& alloc )
   : ring_deque( other.capacity(), alloc )
 {
@@ -63,16 +63,16 @@ bit::core::ring_deque<T,Allocator>
 }
 
 
-template<typename T, typename Allocator>
-bit::core::ring_deque<T,Allocator>
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::ring_deque<T,Allocator,OverflowPolicy>
   ::ring_deque( ring_deque&& other )
   : ring_deque( std::move(other), other.get_allocator() )
 {
 
 }
 
-template<typename T, typename Allocator>
-bit::core::ring_deque<T,Allocator>
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::ring_deque<T,Allocator,OverflowPolicy>
   ::ring_deque( ring_deque&& other, const Allocator& alloc )
   : m_storage( std::move(other.m_storage), alloc )
 {
@@ -81,9 +81,9 @@ bit::core::ring_deque<T,Allocator>
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-bit::core::ring_deque<T,Allocator>&
-  bit::core::ring_deque<T,Allocator>::operator=( ring_deque other )
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::ring_deque<T,Allocator,OverflowPolicy>&
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::operator=( ring_deque other )
 {
  swap(*this,other);
 
@@ -94,9 +94,9 @@ bit::core::ring_deque<T,Allocator>&
 // Element Access
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::allocator_type
-  bit::core::ring_deque<T,Allocator>::get_allocator()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::allocator_type
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::get_allocator()
   const
 {
   return m_storage.get_allocator();
@@ -104,17 +104,17 @@ typename bit::core::ring_deque<T,Allocator>::allocator_type
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::reference
-  bit::core::ring_deque<T,Allocator>::front()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::reference
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::front()
   noexcept
 {
   return m_storage.buffer().front();
 }
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::const_reference
-  bit::core::ring_deque<T,Allocator>::front()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::const_reference
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::front()
   const noexcept
 {
   return m_storage.buffer().front();
@@ -122,35 +122,97 @@ typename bit::core::ring_deque<T,Allocator>::const_reference
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::reference
-  bit::core::ring_deque<T,Allocator>::back()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::reference
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::back()
   noexcept
 {
   return m_storage.buffer().back();
 }
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::const_reference
-  bit::core::ring_deque<T,Allocator>::back()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::const_reference
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::back()
   const noexcept
 {
   return m_storage.buffer().back();
 }
 
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::reference
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::operator[]( size_type n )
+  noexcept
+{
+  return m_storage.buffer()[n];
+}
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::const_reference
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::operator[]( size_type n )
+  const noexcept
+{
+  return m_storage.buffer()[n];
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::span<T> bit::core::ring_deque<T,Allocator,OverflowPolicy>::array_one()
+  noexcept
+{
+  return m_storage.buffer().array_one();
+}
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::span<const T> bit::core::ring_deque<T,Allocator,OverflowPolicy>::array_one()
+  const noexcept
+{
+  return m_storage.buffer().array_one();
+}
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::span<T> bit::core::ring_deque<T,Allocator,OverflowPolicy>::array_two()
+  noexcept
+{
+  return m_storage.buffer().array_two();
+}
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::span<const T> bit::core::ring_deque<T,Allocator,OverflowPolicy>::array_two()
+  const noexcept
+{
+  return m_storage.buffer().array_two();
+}
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::span<T> bit::core::ring_deque<T,Allocator,OverflowPolicy>::free_array_one()
+  noexcept
+{
+  return m_storage.buffer().free_array_one();
+}
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+bit::core::span<T> bit::core::ring_deque<T,Allocator,OverflowPolicy>::free_array_two()
+  noexcept
+{
+  return m_storage.buffer().free_array_two();
+}
+
 //-----------------------------------------------------------------------------
 // Capacity
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-bool bit::core::ring_deque<T,Allocator>::empty()
+template<typename T, typename Allocator, typename OverflowPolicy>
+bool bit::core::ring_deque<T,Allocator,OverflowPolicy>::empty()
   const noexcept
 {
   return m_storage.buffer().empty();
 }
 
-template<typename T, typename Allocator>
-bool bit::core::ring_deque<T,Allocator>::full()
+template<typename T, typename Allocator, typename OverflowPolicy>
+bool bit::core::ring_deque<T,Allocator,OverflowPolicy>::full()
   const noexcept
 {
   return m_storage.buffer().full();
@@ -158,25 +220,28 @@ bool bit::core::ring_deque<T,Allocator>::full()
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::size_type
-  bit::core::ring_deque<T,Allocator>::size()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::size_type
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::size()
   const noexcept
 {
   return m_storage.buffer().size();
 }
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::size_type
-  bit::core::ring_deque<T,Allocator>::max_size()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::size_type
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::max_size()
   const noexcept
 {
+  if( grows::value ) {
+    return std::allocator_traits<Allocator>::max_size( m_storage.get_allocator() );
+  }
   return m_storage.buffer().max_size();
 }
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::size_type
-  bit::core::ring_deque<T,Allocator>::capacity()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::size_type
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::capacity()
   const noexcept
 {
   return m_storage.buffer().capacity();
@@ -186,82 +251,148 @@ typename bit::core::ring_deque<T,Allocator>::size_type
 // Modifiers
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline void bit::core::ring_deque<T,Allocator>::resize( size_type n )
+template<typename T, typename Allocator, typename OverflowPolicy>
+inline void bit::core::ring_deque<T,Allocator,OverflowPolicy>::resize( size_type n )
 {
-  if( m_storage.buffer().capacity() > n ) {
+  if( m_storage.buffer().capacity() >= n ) {
     return;
   }
 
-  resize( std::is_nothrow_move_constructible<T>{}, n );
+  m_storage.reallocate( n );
 }
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename OverflowPolicy>
 template<typename...Args,typename>
-typename bit::core::ring_deque<T,Allocator>::reference
-  bit::core::ring_deque<T,Allocator>::emplace_back( Args&&...args )
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::reference
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::emplace_back( Args&&...args )
 {
-  return m_storage.buffer().emplace_back( std::forward<Args>(args)... );
+  return emplace_back( grows{}, std::forward<Args>(args)... );
 }
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename OverflowPolicy>
 template<typename...Args,typename>
-typename bit::core::ring_deque<T,Allocator>::reference
-  bit::core::ring_deque<T,Allocator>::emplace_front( Args&&...args )
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::reference
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::emplace_front( Args&&...args )
 {
-  return m_storage.buffer().emplace_front( std::forward<Args>(args)... );
+  return emplace_front( grows{}, std::forward<Args>(args)... );
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename OverflowPolicy>
 template<typename U, typename>
-void bit::core::ring_deque<T,Allocator>::push_back( const value_type& value )
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::push_back( const value_type& value )
 {
-  m_storage.buffer().push_back(value);
+  emplace_back( value );
 }
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename OverflowPolicy>
 template<typename U, typename>
-void bit::core::ring_deque<T,Allocator>::push_back( value_type&& value )
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::push_back( value_type&& value )
 {
-  m_storage.buffer().push_back( std::move(value) );
+  emplace_back( std::move(value) );
+}
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+template<typename InputIt, typename>
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::push_back( InputIt first,
+                                                                  InputIt last )
+{
+  using category = typename std::iterator_traits<InputIt>::iterator_category;
+  using is_multi_pass = std::is_base_of<std::forward_iterator_tag,category>;
+
+  if( grows::value ) {
+    if( !is_multi_pass::value ) {
+      // The length is not known up-front, so grow as entries arrive
+      for( ; first != last; ++first ) {
+        emplace_back( *first );
+      }
+      return;
+    }
+    grow( static_cast<size_type>(std::distance( first, last )) );
+  }
+
+  m_storage.buffer().push_back( first, last );
+}
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+template<typename U, typename>
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::commit_back( size_type n )
+  noexcept
+{
+  m_storage.buffer().commit_back( n );
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename OverflowPolicy>
+template<typename InputIt, typename>
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::assign( InputIt first,
+                                                               InputIt last )
+{
+  clear();
+  push_back( first, last );
+}
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::assign( size_type n,
+                                                               const T& value )
+{
+  clear();
+  if( grows::value ) {
+    grow( n );
+  }
+
+  m_storage.buffer().assign( n, value );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Allocator, typename OverflowPolicy>
 template<typename U, typename>
-void bit::core::ring_deque<T,Allocator>::push_front( const value_type& value )
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::push_front( const value_type& value )
 {
-  m_storage.buffer().push_front(value);
+  emplace_front( value );
 }
 
-template<typename T, typename Allocator>
+template<typename T, typename Allocator, typename OverflowPolicy>
 template<typename U, typename>
-void bit::core::ring_deque<T,Allocator>::push_front( value_type&& value )
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::push_front( value_type&& value )
 {
-  m_storage.buffer().push_front( std::move(value) );
+  emplace_front( std::move(value) );
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-void bit::core::ring_deque<T,Allocator>::pop_front()
+template<typename T, typename Allocator, typename OverflowPolicy>
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::pop_front()
 {
   m_storage.buffer().pop_front();
 }
 
-template<typename T, typename Allocator>
-void bit::core::ring_deque<T,Allocator>::pop_back()
+template<typename T, typename Allocator, typename OverflowPolicy>
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::pop_front( size_type n )
+{
+  m_storage.buffer().pop_front( n );
+}
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::pop_back()
 {
   m_storage.buffer().pop_back();
 }
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-void bit::core::ring_deque<T,Allocator>::swap( ring_deque& other )
+template<typename T, typename Allocator, typename OverflowPolicy>
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::clear()
+{
+  m_storage.buffer().clear();
+}
+
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+void bit::core::ring_deque<T,Allocator,OverflowPolicy>::swap( ring_deque& other )
   noexcept
 {
   m_storage.swap( other.m_storage );
@@ -271,25 +402,25 @@ void bit::core::ring_deque<T,Allocator>::swap( ring_deque& other )
 // Iterators
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::iterator
-  bit::core::ring_deque<T,Allocator>::begin()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::iterator
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::begin()
   noexcept
 {
   return m_storage.buffer().begin();
 }
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::const_iterator
-  bit::core::ring_deque<T,Allocator>::begin()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::const_iterator
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::begin()
   const noexcept
 {
   return m_storage.buffer().begin();
 }
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::const_iterator
-  bit::core::ring_deque<T,Allocator>::cbegin()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::const_iterator
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::cbegin()
   const noexcept
 {
   return m_storage.buffer().cbegin();
@@ -298,25 +429,25 @@ typename bit::core::ring_deque<T,Allocator>::const_iterator
 //-----------------------------------------------------------------------------
 
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::iterator
-  bit::core::ring_deque<T,Allocator>::end()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::iterator
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::end()
   noexcept
 {
   return m_storage.buffer().end();
 }
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::const_iterator
-  bit::core::ring_deque<T,Allocator>::end()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::const_iterator
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::end()
   const noexcept
 {
   return m_storage.buffer().end();
 }
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::const_iterator
-  bit::core::ring_deque<T,Allocator>::cend()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::const_iterator
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::cend()
   const noexcept
 {
   return m_storage.buffer().cend();
@@ -324,25 +455,25 @@ typename bit::core::ring_deque<T,Allocator>::const_iterator
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::reverse_iterator
-  bit::core::ring_deque<T,Allocator>::rbegin()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::reverse_iterator
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::rbegin()
   noexcept
 {
   return m_storage.buffer().rbegin();
 }
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::const_reverse_iterator
-  bit::core::ring_deque<T,Allocator>::rbegin()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::const_reverse_iterator
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::rbegin()
   const noexcept
 {
   return m_storage.buffer().rbegin();
 }
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::const_reverse_iterator
-  bit::core::ring_deque<T,Allocator>::crbegin()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::const_reverse_iterator
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::crbegin()
   const noexcept
 {
   return m_storage.buffer().crbegin();
@@ -350,69 +481,109 @@ typename bit::core::ring_deque<T,Allocator>::const_reverse_iterator
 
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::reverse_iterator
-  bit::core::ring_deque<T,Allocator>::rend()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::reverse_iterator
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::rend()
   noexcept
 {
   return m_storage.buffer().rend();
 }
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::const_reverse_iterator
-  bit::core::ring_deque<T,Allocator>::rend()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::const_reverse_iterator
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::rend()
   const noexcept
 {
   return m_storage.buffer().rend();
 }
 
-template<typename T, typename Allocator>
-typename bit::core::ring_deque<T,Allocator>::const_reverse_iterator
-  bit::core::ring_deque<T,Allocator>::crend()
+template<typename T, typename Allocator, typename OverflowPolicy>
+typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::const_reverse_iterator
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::crend()
   const noexcept
 {
   return m_storage.buffer().crend();
 }
 
 //-----------------------------------------------------------------------------
-// Private Modifiers
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+inline void bit::core::ring_deque<T,Allocator,OverflowPolicy>::grow( size_type count )
+{
+  const auto required = size() + count;
+  if( required <= capacity() ) {
+    return;
+  }
+
+  // Start at a few entries rather than growing through 1, 2 and 4
+  m_storage.reallocate( std::max( required, std::max( capacity() * 2u, size_type{8} ) ) );
+}
+
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline void bit::core::ring_deque<T,Allocator>::resize( std::true_type,
-                                                           size_type n )
+template<typename T, typename Allocator, typename OverflowPolicy>
+template<typename...Args>
+inline typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::reference
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::emplace_back( std::false_type,
+                                                                   Args&&...args )
 {
-  auto storage = storage_type{ n, m_storage.get_allocator() };
+  return m_storage.buffer().emplace_back( std::forward<Args>(args)... );
+}
 
-  for( auto&& v : m_storage.buffer() ) {
-    storage.buffer().emplace_back( std::move(v) );
+template<typename T, typename Allocator, typename OverflowPolicy>
+template<typename...Args>
+inline typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::reference
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::emplace_back( std::true_type,
+                                                                   Args&&...args )
+{
+  if( !full() ) {
+    return m_storage.buffer().emplace_back( std::forward<Args>(args)... );
   }
 
-  // Swap the active storage
-  m_storage.buffer().swap( storage.buffer() );
+  // The arguments may refer to an entry that growing would relocate, so
+  // the new entry is constructed first
+  auto value = T( std::forward<Args>(args)... );
+  grow( 1u );
+  return m_storage.buffer().emplace_back( std::move(value) );
 }
 
-template<typename T, typename Allocator>
-inline void bit::core::ring_deque<T,Allocator>::resize( std::false_type,
-                                                           size_type n )
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Allocator, typename OverflowPolicy>
+template<typename...Args>
+inline typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::reference
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::emplace_front( std::false_type,
+                                                                    Args&&...args )
 {
-  auto storage = storage_type{ n, m_storage.get_allocator() };
+  return m_storage.buffer().emplace_front( std::forward<Args>(args)... );
+}
 
-  for( const auto& v : m_storage.buffer() ) {
-    storage.buffer().emplace_back( v );
+template<typename T, typename Allocator, typename OverflowPolicy>
+template<typename...Args>
+inline typename bit::core::ring_deque<T,Allocator,OverflowPolicy>::reference
+  bit::core::ring_deque<T,Allocator,OverflowPolicy>::emplace_front( std::true_type,
+                                                                    Args&&...args )
+{
+  if( !full() ) {
+    return m_storage.buffer().emplace_front( std::forward<Args>(args)... );
   }
 
-  // Swap the active storage
-  m_storage.buffer().swap( storage.buffer() );
+  // The arguments may refer to an entry that growing would relocate, so
+  // the new entry is constructed first
+  auto value = T( std::forward<Args>(args)... );
+  grow( 1u );
+  return m_storage.buffer().emplace_front( std::move(value) );
 }
 
 //-----------------------------------------------------------------------------
 // Utilities
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline void bit::core::swap( ring_deque<T,Allocator>& lhs,
-                            ring_deque<T,Allocator>& rhs )
+template<typename T, typename Allocator, typename OverflowPolicy>
+inline void bit::core::swap( ring_deque<T,Allocator,OverflowPolicy>& lhs,
+                            ring_deque<T,Allocator,OverflowPolicy>& rhs )
   noexcept
 {
   lhs.swap(rhs);
@@ -422,17 +593,17 @@ inline void bit::core::swap( ring_deque<T,Allocator>& lhs,
 // Equality
 //-----------------------------------------------------------------------------
 
-template<typename T, typename Allocator>
-inline bool bit::core::operator==( const ring_deque<T,Allocator>& lhs,
-                                  const ring_deque<T,Allocator>& rhs )
+template<typename T, typename Allocator, typename OverflowPolicy>
+inline bool bit::core::operator==( const ring_deque<T,Allocator,OverflowPolicy>& lhs,
+                                  const ring_deque<T,Allocator,OverflowPolicy>& rhs )
   noexcept
 {
   return std::equal(lhs.begin(),lhs.end(),rhs.begin(),rhs.end());
 }
 
-template<typename T, typename Allocator>
-inline bool bit::core::operator!=( const ring_deque<T,Allocator>& lhs,
-                                  const ring_deque<T,Allocator>& rhs )
+template<typename T, typename Allocator, typename OverflowPolicy>
+inline bool bit::core::operator!=( const ring_deque<T,Allocator,OverflowPolicy>& lhs,
+                                  const ring_deque<T,Allocator,OverflowPolicy>& rhs )
   noexcept
 {
   return !(lhs==rhs);
@@ -0,0 +1,215 @@
+#ifndef BIT_CORE_CONTAINERS_DETAIL_SPSC_RING_INL
+#define BIT_CORE_CONTAINERS_DETAIL_SPSC_RING_INL
+
+//=============================================================================
+// spsc_ring
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructor / Destructor
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::core::spsc_ring<T>::spsc_ring( void* buffer, size_type size )
+  noexcept
+  : m_buffer( static_cast<T*>(buffer) ),
+    m_capacity( size ),
+    m_tail( 0u ),
+    m_cached_head( 0u ),
+    m_head( 0u ),
+    m_cached_tail( 0u )
+{
+
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::core::spsc_ring<T>::~spsc_ring()
+{
+  const auto tail = m_tail.load( std::memory_order_acquire );
+  for( auto head = m_head.load( std::memory_order_relaxed ); head != tail; head = advance( head, 1u ) ) {
+    destroy_at( entry( head ) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Producer
+//-----------------------------------------------------------------------------
+
+template<typename T>
+template<typename...Args, typename>
+inline bool bit::core::spsc_ring<T>::try_emplace( Args&&...args )
+{
+  const auto tail = m_tail.load( std::memory_order_relaxed );
+  if( free_entries( tail, 1u ) == 0u ) return false;
+
+  ::new( static_cast<void*>(entry( tail )) ) T( std::forward<Args>(args)... );
+  m_tail.store( advance( tail, 1u ), std::memory_order_release );
+  return true;
+}
+
+template<typename T>
+inline bool bit::core::spsc_ring<T>::try_push( const T& value )
+{
+  return try_emplace( value );
+}
+
+template<typename T>
+inline bool bit::core::spsc_ring<T>::try_push( T&& value )
+{
+  return try_emplace( std::move(value) );
+}
+
+template<typename T>
+template<typename InputIt>
+inline typename bit::core::spsc_ring<T>::size_type
+  bit::core::spsc_ring<T>::try_push( InputIt first, size_type count )
+{
+  const auto tail = m_tail.load( std::memory_order_relaxed );
+  const auto available = free_entries( tail, count );
+  const auto n = available < count ? available : count;
+
+  // Publish whatever was constructed, even if a constructor throws
+  auto index = tail;
+  auto guard = on_scope_exit( [&]{
+    m_tail.store( index, std::memory_order_release );
+  } );
+
+  for( auto i = size_type{0}; i < n; ++i, ++first ) {
+    ::new( static_cast<void*>(entry( index )) ) T( *first );
+    index = advance( index, 1u );
+  }
+  return n;
+}
+
+//-----------------------------------------------------------------------------
+// Consumer
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bool bit::core::spsc_ring<T>::try_pop( T& value )
+{
+  const auto head = m_head.load( std::memory_order_relaxed );
+  if( used_entries( head, 1u ) == 0u ) return false;
+
+  const auto p = entry( head );
+  value = std::move(*p);
+  destroy_at( p );
+  m_head.store( advance( head, 1u ), std::memory_order_release );
+  return true;
+}
+
+template<typename T>
+template<typename OutputIt>
+inline typename bit::core::spsc_ring<T>::size_type
+  bit::core::spsc_ring<T>::try_pop( OutputIt out, size_type count )
+{
+  const auto head = m_head.load( std::memory_order_relaxed );
+  const auto available = used_entries( head, count );
+  const auto n = available < count ? available : count;
+
+  // Release whatever was destroyed, even if an assignment throws
+  auto index = head;
+  auto guard = on_scope_exit( [&]{
+    m_head.store( index, std::memory_order_release );
+  } );
+
+  for( auto i = size_type{0}; i < n; ++i, ++out ) {
+    const auto p = entry( index );
+    *out = std::move(*p);
+    destroy_at( p );
+    index = advance( index, 1u );
+  }
+  return n;
+}
+
+//-----------------------------------------------------------------------------
+// Capacity
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline bool bit::core::spsc_ring<T>::empty()
+  const noexcept
+{
+  return m_head.load( std::memory_order_acquire ) ==
+         m_tail.load( std::memory_order_acquire );
+}
+
+template<typename T>
+inline typename bit::core::spsc_ring<T>::size_type
+  bit::core::spsc_ring<T>::size()
+  const noexcept
+{
+  // The head is loaded first, so the tail is never behind it; the tail may
+  // however have run ahead since, so the result is clamped
+  const auto head = m_head.load( std::memory_order_acquire );
+  const auto tail = m_tail.load( std::memory_order_acquire );
+  const auto result = distance( head, tail );
+
+  return result < m_capacity ? result : m_capacity;
+}
+
+template<typename T>
+inline typename bit::core::spsc_ring<T>::size_type
+  bit::core::spsc_ring<T>::capacity()
+  const noexcept
+{
+  return m_capacity;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename T>
+inline typename bit::core::spsc_ring<T>::size_type
+  bit::core::spsc_ring<T>::distance( size_type head, size_type tail )
+  const noexcept
+{
+  return tail >= head ? tail - head : tail + 2u * m_capacity - head;
+}
+
+template<typename T>
+inline typename bit::core::spsc_ring<T>::size_type
+  bit::core::spsc_ring<T>::advance( size_type index, size_type n )
+  const noexcept
+{
+  index += n;
+  return index >= 2u * m_capacity ? index - 2u * m_capacity : index;
+}
+
+template<typename T>
+inline T* bit::core::spsc_ring<T>::entry( size_type index )
+  const noexcept
+{
+  return m_buffer + (index >= m_capacity ? index - m_capacity : index);
+}
+
+template<typename T>
+inline typename bit::core::spsc_ring<T>::size_type
+  bit::core::spsc_ring<T>::free_entries( size_type tail, size_type wanted )
+  noexcept
+{
+  auto result = m_capacity - distance( m_cached_head, tail );
+  if( result < wanted ) {
+    m_cached_head = m_head.load( std::memory_order_acquire );
+    result = m_capacity - distance( m_cached_head, tail );
+  }
+  return result;
+}
+
+template<typename T>
+inline typename bit::core::spsc_ring<T>::size_type
+  bit::core::spsc_ring<T>::used_entries( size_type head, size_type wanted )
+  noexcept
+{
+  auto result = distance( head, m_cached_tail );
+  if( result < wanted ) {
+    m_cached_tail = m_tail.load( std::memory_order_acquire );
+    result = distance( head, m_cached_tail );
+  }
+  return result;
+}
+
+#endif /* BIT_CORE_CONTAINERS_DETAIL_SPSC_RING_INL */
@@ -1,6 +1,234 @@
 #ifndef BIT_CORE_CONTAINERS_DETAIL_STRING_INL
 #define BIT_CORE_CONTAINERS_DETAIL_STRING_INL
 
+//----------------------------------------------------------------------------
+// Case Folding
+//----------------------------------------------------------------------------
+
+namespace bit { namespace core { namespace detail {
+
+  /// \brief Lowers each ASCII letter in the 8 bytes of \p w
+  ///
+  /// A byte is an uppercase letter if adding 0x3f to its low 7 bits carries
+  /// into its top bit ('A' or above), adding 0x25 does not ('Z' or below),
+  /// and its own top bit is clear. Neither sum can carry into the next byte.
+  inline constexpr std::uint64_t insensitive_fold_word( std::uint64_t w )
+    noexcept
+  {
+    constexpr auto ones = std::uint64_t{0x0101010101010101ull};
+
+    const auto low7  = w & (ones * 0x7fu);
+    const auto upper = (low7 + ones * 0x3fu) & ~(low7 + ones * 0x25u) & ~w & (ones * 0x80u);
+    return w | (upper >> 2);
+  }
+
+#if defined(BIT_PLATFORM_HAS_AVX2)
+  constexpr std::size_t insensitive_block_size() noexcept{ return 32u; }
+
+  /// \brief Raises each ASCII letter in \p x
+  inline __m256i insensitive_to_upper( __m256i x )
+    noexcept
+  {
+    // x - 'a' is below 26 exactly for lowercase letters; biasing it by 128
+    // makes that an ordinary signed comparison
+    const auto biased = _mm256_add_epi8( x, _mm256_set1_epi8( static_cast<char>(128 - 'a') ) );
+    const auto lower  = _mm256_cmpgt_epi8( _mm256_set1_epi8( static_cast<char>(-128 + 26) ), biased );
+    return _mm256_sub_epi8( x, _mm256_and_si256( lower, _mm256_set1_epi8( 0x20 ) ) );
+  }
+
+  /// \brief Gets a mask of the positions among the 32 at \p a and \p b
+  ///        whose characters differ other than in case
+  inline std::uint32_t insensitive_mismatch_block( const char* a, const char* b )
+    noexcept
+  {
+    const auto x = insensitive_to_upper( _mm256_loadu_si256( reinterpret_cast<const __m256i*>(a) ) );
+    const auto y = insensitive_to_upper( _mm256_loadu_si256( reinterpret_cast<const __m256i*>(b) ) );
+
+    return ~static_cast<std::uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( x, y ) ) );
+  }
+
+  /// \brief Gets a mask of the positions among the 32 at \p p that hold
+  ///        either \p upper or \p lower
+  inline std::uint32_t insensitive_match_block( const char* p, char upper, char lower )
+    noexcept
+  {
+    const auto x = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(p) );
+    const auto eq = _mm256_or_si256( _mm256_cmpeq_epi8( x, _mm256_set1_epi8( upper ) ),
+                                     _mm256_cmpeq_epi8( x, _mm256_set1_epi8( lower ) ) );
+
+    return static_cast<std::uint32_t>( _mm256_movemask_epi8( eq ) );
+  }
+#elif defined(BIT_PLATFORM_HAS_SSE2)
+  constexpr std::size_t insensitive_block_size() noexcept{ return 16u; }
+
+  /// \brief Raises each ASCII letter in \p x
+  inline __m128i insensitive_to_upper( __m128i x )
+    noexcept
+  {
+    // x - 'a' is below 26 exactly for lowercase letters; biasing it by 128
+    // makes that an ordinary signed comparison
+    const auto biased = _mm_add_epi8( x, _mm_set1_epi8( static_cast<char>(128 - 'a') ) );
+    const auto lower  = _mm_cmplt_epi8( biased, _mm_set1_epi8( static_cast<char>(-128 + 26) ) );
+    return _mm_sub_epi8( x, _mm_and_si128( lower, _mm_set1_epi8( 0x20 ) ) );
+  }
+
+  /// \brief Gets a mask of the positions among the 16 at \p a and \p b
+  ///        whose characters differ other than in case
+  inline std::uint32_t insensitive_mismatch_block( const char* a, const char* b )
+    noexcept
+  {
+    const auto x = insensitive_to_upper( _mm_loadu_si128( reinterpret_cast<const __m128i*>(a) ) );
+    const auto y = insensitive_to_upper( _mm_loadu_si128( reinterpret_cast<const __m128i*>(b) ) );
+
+    return static_cast<std::uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( x, y ) ) ) ^ 0xffffu;
+  }
+
+  /// \brief Gets a mask of the positions among the 16 at \p p that hold
+  ///        either \p upper or \p lower
+  inline std::uint32_t insensitive_match_block( const char* p, char upper, char lower )
+    noexcept
+  {
+    const auto x = _mm_loadu_si128( reinterpret_cast<const __m128i*>(p) );
+    const auto eq = _mm_or_si128( _mm_cmpeq_epi8( x, _mm_set1_epi8( upper ) ),
+                                  _mm_cmpeq_epi8( x, _mm_set1_epi8( lower ) ) );
+
+    return static_cast<std::uint32_t>( _mm_movemask_epi8( eq ) );
+  }
+#else
+  constexpr std::size_t insensitive_block_size() noexcept{ return 8u; }
+
+  /// \brief Gets a mask of the positions among the 8 at \p a and \p b
+  ///        whose characters differ other than in case
+  inline std::uint32_t insensitive_mismatch_block( const char* a, const char* b )
+    noexcept
+  {
+    auto x = std::uint64_t{};
+    auto y = std::uint64_t{};
+    std::memcpy( &x, a, 8u );
+    std::memcpy( &y, b, 8u );
+
+    // Only whether the words differ matters here; the caller finds where
+    return (insensitive_fold_word( x ) != insensitive_fold_word( y )) ? 0xffu : 0u;
+  }
+
+  /// \brief Gets a mask of the positions among the 8 at \p p that hold
+  ///        either \p upper or \p lower
+  inline std::uint32_t insensitive_match_block( const char* p, char upper, char lower )
+    noexcept
+  {
+    auto result = std::uint32_t{0};
+    for( auto i = 0u; i < 8u; ++i ) {
+      result |= static_cast<std::uint32_t>( p[i] == upper || p[i] == lower ) << i;
+    }
+    return result;
+  }
+#endif
+
+  /// \brief Compares \p count characters of \p s1 and \p s2, ignoring the
+  ///        case of ASCII letters
+  template<typename Traits, typename CharT>
+  inline constexpr int insensitive_naive_compare( const CharT* s1,
+                                                  const CharT* s2,
+                                                  std::size_t count )
+    noexcept
+  {
+    for( ; count != 0; --count, ++s1, ++s2 ) {
+      const auto a = Traits::to_upper( *s1 );
+      const auto b = Traits::to_upper( *s2 );
+      if( a < b ) return -1;
+      if( b < a ) return 1;
+    }
+    return 0;
+  }
+
+  template<typename Traits, typename CharT>
+  inline constexpr const CharT* insensitive_naive_find( const CharT* s,
+                                                        std::size_t n,
+                                                        CharT a )
+    noexcept
+  {
+    const auto ua = Traits::to_upper( a );
+
+    for( ; n != 0; --n, ++s ) {
+      if( Traits::to_upper( *s ) == ua ) return s;
+    }
+    return nullptr;
+  }
+
+  //--------------------------------------------------------------------------
+
+  template<typename Traits, typename CharT>
+  inline int insensitive_compare( const CharT* s1,
+                                  const CharT* s2,
+                                  std::size_t count,
+                                  std::true_type )
+    noexcept
+  {
+    constexpr auto block = insensitive_block_size();
+
+    const auto* a = reinterpret_cast<const char*>( s1 );
+    const auto* b = reinterpret_cast<const char*>( s2 );
+
+    auto i = std::size_t{0};
+    for( ; count - i >= block; i += block ) {
+      const auto mask = insensitive_mismatch_block( a + i, b + i );
+      if( mask != 0u ) {
+        i += string_search_lowest_bit( mask );
+        break;
+      }
+    }
+    return insensitive_naive_compare<Traits>( s1 + i, s2 + i, count - i );
+  }
+
+  template<typename Traits, typename CharT>
+  inline int insensitive_compare( const CharT* s1,
+                                  const CharT* s2,
+                                  std::size_t count,
+                                  std::false_type )
+    noexcept
+  {
+    return insensitive_naive_compare<Traits>( s1, s2, count );
+  }
+
+  template<typename Traits, typename CharT>
+  inline const CharT* insensitive_find( const CharT* s,
+                                        std::size_t n,
+                                        CharT a,
+                                        std::true_type )
+    noexcept
+  {
+    constexpr auto block = insensitive_block_size();
+
+    const auto upper = static_cast<char>( Traits::to_upper( a ) );
+    const auto lower = static_cast<char>( Traits::to_lower( a ) );
+    const auto* p = reinterpret_cast<const char*>( s );
+
+    if( upper == lower ) {
+      return static_cast<const CharT*>( std::memchr( s, upper, n ) );
+    }
+
+    auto i = std::size_t{0};
+    for( ; n - i >= block; i += block ) {
+      const auto mask = insensitive_match_block( p + i, upper, lower );
+      if( mask != 0u ) {
+        return s + i + string_search_lowest_bit( mask );
+      }
+    }
+    return insensitive_naive_find<Traits>( s + i, n - i, a );
+  }
+
+  template<typename Traits, typename CharT>
+  inline const CharT* insensitive_find( const CharT* s,
+                                        std::size_t n,
+                                        CharT a,
+                                        std::false_type )
+    noexcept
+  {
+    return insensitive_naive_find<Traits>( s, n, a );
+  }
+
+} } } // namespace bit::core::detail
+
 //----------------------------------------------------------------------------
 // Char Traits
 //----------------------------------------------------------------------------
@@ -10,7 +238,15 @@ inline constexpr CharT
   bit::core::insensitive_char_traits<CharT>::to_upper( CharT ch )
   noexcept
 {
-  return std::toupper( ch, std::locale() );
+  return (ch >= CharT('a') && ch <= CharT('z')) ? static_cast<CharT>(ch - CharT('a') + CharT('A')) : ch;
+}
+
+template<typename CharT>
+inline constexpr CharT
+  bit::core::insensitive_char_traits<CharT>::to_lower( CharT ch )
+  noexcept
+{
+  return (ch >= CharT('A') && ch <= CharT('Z')) ? static_cast<CharT>(ch - CharT('A') + CharT('a')) : ch;
 }
 
 //----------------------------------------------------------------------------
@@ -40,12 +276,12 @@ inline constexpr int
                                                      std::size_t count )
   noexcept
 {
-  while( count-- != 0 ) {
-    if( to_upper(*s1) < to_upper(*s2) ) return -1;
-    if( to_upper(*s1) > to_upper(*s2) ) return 1;
-    ++s1; ++s2;
+  if(!BIT_IS_CONSTANT_EVALUATED()) {
+    return detail::insensitive_compare<insensitive_char_traits>(
+      s1, s2, count, std::integral_constant<bool,sizeof(CharT) == 1>{}
+    );
   }
-  return 0;
+  return detail::insensitive_naive_compare<insensitive_char_traits>( s1, s2, count );
 }
 
 //----------------------------------------------------------------------------
@@ -53,18 +289,135 @@ inline constexpr int
 template<typename CharT>
 inline constexpr const CharT*
   bit::core::insensitive_char_traits<CharT>::find( const CharT* s,
-                                                  int n, CharT a )
+                                                  std::size_t n,
+                                                  CharT a )
   noexcept
 {
-  auto const ua = to_upper(a);
-
-  while( n-- != 0 ) {
-    if( to_upper(*s) == ua ) return s;
-    ++s;
+  if(!BIT_IS_CONSTANT_EVALUATED()) {
+    return detail::insensitive_find<insensitive_char_traits>(
+      s, n, a, std::integral_constant<bool,sizeof(CharT) == 1>{}
+    );
   }
-  return nullptr;
+  return detail::insensitive_naive_find<insensitive_char_traits>( s, n, a );
 }
 
+//----------------------------------------------------------------------------
+// Hashing
+//----------------------------------------------------------------------------
+
+namespace bit { namespace core { namespace detail {
+
+  /// \brief Lowers ASCII letters as they are read by the hash
+  struct insensitive_hash_fold
+  {
+    template<typename CharT>
+    constexpr CharT operator()( CharT c ) const noexcept
+    {
+      return insensitive_char_traits<CharT>::to_lower( c );
+    }
+  };
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \brief A reader that loads words from memory, lowering the ASCII
+  ///        letters in each
+  ////////////////////////////////////////////////////////////////////////////
+  class insensitive_hash_reader
+  {
+  public:
+
+    explicit insensitive_hash_reader( const char* p )
+      noexcept
+      : m_data(p)
+    {
+
+    }
+
+    std::uint64_t byte( std::size_t i )
+      const noexcept
+    {
+      return static_cast<unsigned char>( insensitive_hash_fold{}( m_data[i] ) );
+    }
+
+    std::uint64_t read32( std::size_t i )
+      const noexcept
+    {
+      auto result = std::uint32_t{0};
+      std::memcpy( &result, m_data + i, sizeof(result) );
+      return insensitive_fold_word( result );
+    }
+
+    std::uint64_t read64( std::size_t i )
+      const noexcept
+    {
+      auto result = std::uint64_t{0};
+      std::memcpy( &result, m_data + i, sizeof(result) );
+      return insensitive_fold_word( result );
+    }
+
+    /// \copydoc wide_hash_accumulate_memory
+    void accumulate( wide_hash_state& state,
+                     std::size_t i,
+                     std::size_t stripes,
+                     std::size_t index,
+                     std::size_t last )
+      const noexcept
+    {
+      constexpr auto stripe_size = wide_hash_stripe_size();
+      constexpr auto chunk       = std::size_t{8};
+
+      // Fold a few stripes at a time into a buffer, so that the stripes are
+      // still accumulated with the vectorized loop
+      unsigned char buffer[chunk * stripe_size];
+
+      while( stripes != 0 ) {
+        const auto n = (stripes < chunk) ? stripes : chunk;
+        fold( buffer, i, n * stripe_size );
+        wide_hash_accumulate_memory( state, buffer, n, index, nullptr );
+
+        i       += n * stripe_size;
+        index   += n;
+        stripes -= n;
+      }
+      fold( buffer, last, stripe_size );
+      wide_hash_accumulate_memory( state, buffer, 0u, index, buffer );
+    }
+
+  private:
+
+    void fold( unsigned char* out, std::size_t i, std::size_t n )
+      const noexcept
+    {
+      for( auto j = std::size_t{0}; j < n; j += 8u ) {
+        const auto w = read64( i + j );
+        std::memcpy( out + j, &w, sizeof(w) );
+      }
+    }
+
+    const char* m_data;
+  };
+
+  template<typename CharT>
+  inline std::uint64_t insensitive_hash_chars( const CharT* str,
+                                               std::size_t count,
+                                               std::true_type )
+    noexcept
+  {
+    return wide_hash( insensitive_hash_reader{ reinterpret_cast<const char*>(str) }, count, 0u );
+  }
+
+  template<typename CharT>
+  inline std::uint64_t insensitive_hash_chars( const CharT* str,
+                                               std::size_t count,
+                                               std::false_type )
+    noexcept
+  {
+    return wide_hash( wide_hash_constexpr_reader<CharT,insensitive_hash_fold>{str},
+                      count * sizeof(CharT),
+                      0u );
+  }
+
+} } } // namespace bit::core::detail
+
 //----------------------------------------------------------------------------
 // Utilities
 //----------------------------------------------------------------------------
@@ -77,4 +430,32 @@ bit::core::hash_t
   return hash_string_segment( str.data(), str.size() );
 }
 
+template<typename CharT, typename Allocator>
+bit::core::hash_t
+  bit::core::hash_value( const std::basic_string<CharT,insensitive_char_traits<CharT>,Allocator>& str )
+  noexcept
+{
+  return hash_insensitive_string_segment( str.data(), str.size() );
+}
+
+template<typename CharT>
+inline constexpr bit::core::hash_t
+  bit::core::hash_insensitive_string_segment( const CharT* str,
+                                              std::size_t count )
+  noexcept
+{
+#if !defined(BIT_BIG_ENDIAN)
+  if(!BIT_IS_CONSTANT_EVALUATED()) {
+    return static_cast<hash_t>( static_cast<std::size_t>(
+      detail::insensitive_hash_chars( str, count, std::integral_constant<bool,sizeof(CharT) == 1>{} )
+    ) );
+  }
+#endif
+  return static_cast<hash_t>( static_cast<std::size_t>(
+    detail::wide_hash( detail::wide_hash_constexpr_reader<CharT,detail::insensitive_hash_fold>{str},
+                       count * sizeof(CharT),
+                       0u )
+  ) );
+}
+
 #endif /* BIT_CORE_CONTAINERS_DETAIL_STRING_INL */
@@ -0,0 +1,596 @@
+#ifndef BIT_CORE_CONTAINERS_DETAIL_STRING_INTERNER_INL
+#define BIT_CORE_CONTAINERS_DETAIL_STRING_INTERNER_INL
+
+//=============================================================================
+// detail::interned_empty
+//=============================================================================
+
+template<typename CharT, typename Traits>
+constexpr CharT bit::core::detail::interned_empty<CharT,Traits>::terminator;
+
+template<typename CharT, typename Traits>
+constexpr bit::core::detail::interned_entry<CharT>
+  bit::core::detail::interned_empty<CharT,Traits>::value;
+
+//=============================================================================
+// basic_interned_string
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline bit::core::basic_interned_string<CharT,Traits>::basic_interned_string()
+  noexcept
+  : m_entry( &detail::interned_empty<CharT,Traits>::value )
+{
+
+}
+
+template<typename CharT, typename Traits>
+inline bit::core::basic_interned_string<CharT,Traits>
+  ::basic_interned_string( const entry_type* entry )
+  noexcept
+  : m_entry( entry )
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline const typename bit::core::basic_interned_string<CharT,Traits>::char_type*
+  bit::core::basic_interned_string<CharT,Traits>::data()
+  const noexcept
+{
+  return m_entry->data;
+}
+
+template<typename CharT, typename Traits>
+inline const typename bit::core::basic_interned_string<CharT,Traits>::char_type*
+  bit::core::basic_interned_string<CharT,Traits>::c_str()
+  const noexcept
+{
+  return m_entry->data;
+}
+
+template<typename CharT, typename Traits>
+inline typename bit::core::basic_interned_string<CharT,Traits>::size_type
+  bit::core::basic_interned_string<CharT,Traits>::size()
+  const noexcept
+{
+  return m_entry->size;
+}
+
+template<typename CharT, typename Traits>
+inline typename bit::core::basic_interned_string<CharT,Traits>::size_type
+  bit::core::basic_interned_string<CharT,Traits>::length()
+  const noexcept
+{
+  return m_entry->size;
+}
+
+template<typename CharT, typename Traits>
+inline bool bit::core::basic_interned_string<CharT,Traits>::empty()
+  const noexcept
+{
+  return m_entry->size == 0u;
+}
+
+template<typename CharT, typename Traits>
+inline bit::core::hash_t bit::core::basic_interned_string<CharT,Traits>::hash()
+  const noexcept
+{
+  return m_entry->hash;
+}
+
+template<typename CharT, typename Traits>
+inline typename bit::core::basic_interned_string<CharT,Traits>::view_type
+  bit::core::basic_interned_string<CharT,Traits>::view()
+  const noexcept
+{
+  return view_type( m_entry->data, m_entry->size );
+}
+
+template<typename CharT, typename Traits>
+inline bit::core::basic_interned_string<CharT,Traits>::operator view_type()
+  const noexcept
+{
+  return view_type( m_entry->data, m_entry->size );
+}
+
+//-----------------------------------------------------------------------------
+// Comparisons
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline bool bit::core::operator==( const basic_interned_string<CharT,Traits>& lhs,
+                                   const basic_interned_string<CharT,Traits>& rhs )
+  noexcept
+{
+  return lhs.m_entry == rhs.m_entry;
+}
+
+template<typename CharT, typename Traits>
+inline bool bit::core::operator!=( const basic_interned_string<CharT,Traits>& lhs,
+                                   const basic_interned_string<CharT,Traits>& rhs )
+  noexcept
+{
+  return !(lhs == rhs);
+}
+
+//-----------------------------------------------------------------------------
+// Hashing
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline bit::core::hash_t
+  bit::core::hash_value( const basic_interned_string<CharT,Traits>& str )
+  noexcept
+{
+  return str.hash();
+}
+
+//=============================================================================
+// basic_string_interner
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors / Destructor
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Allocator>
+inline bit::core::basic_string_interner<CharT,Traits,Allocator>
+  ::basic_string_interner()
+  : basic_string_interner( Allocator() )
+{
+
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline bit::core::basic_string_interner<CharT,Traits,Allocator>
+  ::basic_string_interner( const Allocator& alloc )
+  : m_allocator( alloc ),
+    m_slots( nullptr ),
+    m_capacity( 0u ),
+    m_size( 0u ),
+    m_blocks( nullptr ),
+    m_cursor( nullptr ),
+    m_limit( nullptr ),
+    m_arena_units( 0u )
+{
+
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline bit::core::basic_string_interner<CharT,Traits,Allocator>
+  ::basic_string_interner( basic_string_interner&& other )
+  noexcept
+  : m_allocator( std::move(other.m_allocator) ),
+    m_slots( other.m_slots ),
+    m_capacity( other.m_capacity ),
+    m_size( other.m_size ),
+    m_blocks( other.m_blocks ),
+    m_cursor( other.m_cursor ),
+    m_limit( other.m_limit ),
+    m_arena_units( other.m_arena_units )
+{
+  other.m_slots       = nullptr;
+  other.m_capacity    = 0u;
+  other.m_size        = 0u;
+  other.m_blocks      = nullptr;
+  other.m_cursor      = nullptr;
+  other.m_limit       = nullptr;
+  other.m_arena_units = 0u;
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Allocator>
+inline bit::core::basic_string_interner<CharT,Traits,Allocator>
+  ::~basic_string_interner()
+{
+  if( m_slots != nullptr ) {
+    auto allocator = slot_allocator( m_allocator );
+    std::allocator_traits<slot_allocator>::deallocate( allocator, m_slots, m_capacity );
+  }
+
+  auto allocator = unit_allocator( m_allocator );
+  while( m_blocks != nullptr ) {
+    const auto next  = m_blocks->next;
+    const auto units = m_blocks->units;
+    std::allocator_traits<unit_allocator>::deallocate(
+      allocator, reinterpret_cast<unit_type*>(m_blocks), units
+    );
+    m_blocks = next;
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Capacity
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Allocator>
+inline typename bit::core::basic_string_interner<CharT,Traits,Allocator>::size_type
+  bit::core::basic_string_interner<CharT,Traits,Allocator>::size()
+  const noexcept
+{
+  return m_size;
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline bool bit::core::basic_string_interner<CharT,Traits,Allocator>::empty()
+  const noexcept
+{
+  return m_size == 0u;
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline typename bit::core::basic_string_interner<CharT,Traits,Allocator>::size_type
+  bit::core::basic_string_interner<CharT,Traits,Allocator>::memory_usage()
+  const noexcept
+{
+  return m_arena_units * sizeof(unit_type) + m_capacity * sizeof(slot);
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline void bit::core::basic_string_interner<CharT,Traits,Allocator>
+  ::reserve( size_type n )
+{
+  // Keep the load factor at or below 3/4
+  auto capacity = size_type{16u};
+  while( capacity / 4u * 3u < n ) {
+    capacity *= 2u;
+  }
+  if( capacity > m_capacity ) {
+    rehash( capacity );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Interning
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Allocator>
+inline typename bit::core::basic_string_interner<CharT,Traits,Allocator>::handle_type
+  bit::core::basic_string_interner<CharT,Traits,Allocator>::intern( view_type str )
+{
+  if( str.empty() ) return handle_type();
+
+  return intern( str, hash_value( str ) );
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+template<std::ptrdiff_t Extent>
+inline typename bit::core::basic_string_interner<CharT,Traits,Allocator>::handle_type
+  bit::core::basic_string_interner<CharT,Traits,Allocator>
+  ::intern( basic_string_span<CharT,Traits,Extent> str )
+{
+  return intern( view_type( str.data(), static_cast<size_type>(str.size()) ) );
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline bit::core::optional<typename bit::core::basic_string_interner<CharT,Traits,Allocator>::handle_type>
+  bit::core::basic_string_interner<CharT,Traits,Allocator>::find( view_type str )
+  const noexcept
+{
+  if( str.empty() ) return handle_type();
+
+  const auto entry = find_entry( str, hash_value( str ) );
+  if( entry == nullptr ) return nullopt;
+
+  return handle_type( entry );
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline bool bit::core::basic_string_interner<CharT,Traits,Allocator>
+  ::contains( view_type str )
+  const noexcept
+{
+  return str.empty() || find_entry( str, hash_value( str ) ) != nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Allocator>
+inline typename bit::core::basic_string_interner<CharT,Traits,Allocator>::allocator_type
+  bit::core::basic_string_interner<CharT,Traits,Allocator>::get_allocator()
+  const
+{
+  return m_allocator;
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Allocator>
+inline const typename bit::core::basic_string_interner<CharT,Traits,Allocator>::entry_type*
+  bit::core::basic_string_interner<CharT,Traits,Allocator>
+  ::find_entry( view_type str, hash_t hash )
+  const noexcept
+{
+  if( m_capacity == 0u ) return nullptr;
+
+  const auto mask = m_capacity - 1u;
+  auto i = static_cast<size_type>(hash) & mask;
+
+  // The hash is compared before the entry is touched, so probing past
+  // other strings only reads the table
+  while( m_slots[i].entry != nullptr ) {
+    const auto& s = m_slots[i];
+    if( s.hash == hash && s.entry->size == str.size() &&
+        Traits::compare( s.entry->data, str.data(), str.size() ) == 0 ) {
+      return s.entry;
+    }
+    i = (i + 1u) & mask;
+  }
+  return nullptr;
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline typename bit::core::basic_string_interner<CharT,Traits,Allocator>::handle_type
+  bit::core::basic_string_interner<CharT,Traits,Allocator>
+  ::intern( view_type str, hash_t hash )
+{
+  const auto found = find_entry( str, hash );
+  if( found != nullptr ) return handle_type( found );
+
+  if( (m_size + 1u) > m_capacity / 4u * 3u ) {
+    rehash( m_capacity == 0u ? 16u : m_capacity * 2u );
+  }
+
+  // The table is grown first, so that nothing is changed if either
+  // allocation throws
+  const auto entry = make_entry( str, hash );
+
+  const auto mask = m_capacity - 1u;
+  auto i = static_cast<size_type>(hash) & mask;
+  while( m_slots[i].entry != nullptr ) {
+    i = (i + 1u) & mask;
+  }
+  m_slots[i].hash  = hash;
+  m_slots[i].entry = entry;
+  ++m_size;
+
+  return handle_type( entry );
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline const typename bit::core::basic_string_interner<CharT,Traits,Allocator>::entry_type*
+  bit::core::basic_string_interner<CharT,Traits,Allocator>
+  ::make_entry( view_type str, hash_t hash )
+{
+  const auto size = str.size();
+  const auto p = static_cast<unsigned char*>(
+    allocate( sizeof(entry_type) + (size + 1u) * sizeof(CharT) )
+  );
+
+  const auto data = reinterpret_cast<CharT*>(p + sizeof(entry_type));
+  Traits::copy( data, str.data(), size );
+  data[size] = CharT();
+
+  return ::new(static_cast<void*>(p)) entry_type{ hash, size, data };
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline void* bit::core::basic_string_interner<CharT,Traits,Allocator>
+  ::allocate( size_type bytes )
+{
+  constexpr auto align = alignof(entry_type);
+  bytes = (bytes + align - 1u) & ~(align - 1u);
+
+  if( static_cast<size_type>(m_limit - m_cursor) < bytes ) {
+    constexpr auto first_units = size_type{4096u} / sizeof(unit_type);
+    constexpr auto max_units   = size_type{1u << 20} / sizeof(unit_type);
+
+    // Blocks double in size up to max_units, but a string larger than that
+    // gets a block of its own size
+    auto units = m_blocks == nullptr ? first_units : m_blocks->units * 2u;
+    if( units > max_units ) units = max_units;
+
+    const auto needed = (sizeof(block) + bytes + sizeof(unit_type) - 1u) / sizeof(unit_type);
+    if( units < needed ) units = needed;
+
+    auto allocator = unit_allocator( m_allocator );
+    const auto p = reinterpret_cast<unsigned char*>(
+      std::allocator_traits<unit_allocator>::allocate( allocator, units )
+    );
+
+    m_blocks = ::new(static_cast<void*>(p)) block{ m_blocks, units };
+    m_cursor = p + sizeof(block);
+    m_limit  = p + units * sizeof(unit_type);
+    m_arena_units += units;
+  }
+
+  const auto result = m_cursor;
+  m_cursor += bytes;
+  return result;
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline void bit::core::basic_string_interner<CharT,Traits,Allocator>
+  ::rehash( size_type capacity )
+{
+  using traits_type = std::allocator_traits<slot_allocator>;
+
+  auto allocator = slot_allocator( m_allocator );
+  const auto slots = traits_type::allocate( allocator, capacity );
+  for( auto i = size_type{0}; i < capacity; ++i ) {
+    ::new(static_cast<void*>(slots + i)) slot{ hash_t{}, nullptr };
+  }
+
+  const auto mask = capacity - 1u;
+  for( auto i = size_type{0}; i < m_capacity; ++i ) {
+    const auto& s = m_slots[i];
+    if( s.entry == nullptr ) continue;
+
+    auto j = static_cast<size_type>(s.hash) & mask;
+    while( slots[j].entry != nullptr ) {
+      j = (j + 1u) & mask;
+    }
+    slots[j] = s;
+  }
+
+  if( m_slots != nullptr ) {
+    traits_type::deallocate( allocator, m_slots, m_capacity );
+  }
+  m_slots    = slots;
+  m_capacity = capacity;
+}
+
+//=============================================================================
+// basic_concurrent_string_interner
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Allocator>
+constexpr typename bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>::size_type
+  bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>::shard_count;
+
+template<typename CharT, typename Traits, typename Allocator>
+inline bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>
+  ::shard::shard( const Allocator& alloc )
+  : mutex(),
+    interner( alloc )
+{
+
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>
+  ::basic_concurrent_string_interner()
+  : basic_concurrent_string_interner( Allocator() )
+{
+
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>
+  ::basic_concurrent_string_interner( const Allocator& alloc )
+  : basic_concurrent_string_interner( alloc, std::make_index_sequence<shard_count>() )
+{
+
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+template<std::size_t...Idxs>
+inline bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>
+  ::basic_concurrent_string_interner( const Allocator& alloc,
+                                      std::index_sequence<Idxs...> )
+  : m_shards{ { (static_cast<void>(Idxs), alloc) }... }
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Capacity
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Allocator>
+inline typename bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>::size_type
+  bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>::size()
+  const
+{
+  auto result = size_type{0};
+  for( auto& s : m_shards ) {
+    std::lock_guard<std::mutex> lock( s.mutex );
+    result += s.interner.size();
+  }
+  return result;
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline typename bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>::size_type
+  bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>::memory_usage()
+  const
+{
+  auto result = size_type{0};
+  for( auto& s : m_shards ) {
+    std::lock_guard<std::mutex> lock( s.mutex );
+    result += s.interner.memory_usage();
+  }
+  return result;
+}
+
+//-----------------------------------------------------------------------------
+// Interning
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Allocator>
+inline typename bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>::handle_type
+  bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>
+  ::intern( view_type str )
+{
+  if( str.empty() ) return handle_type();
+
+  // Hash outside of the lock, so that only the probe is serialized
+  const auto hash = hash_value( str );
+  auto& s = shard_for( hash );
+
+  std::lock_guard<std::mutex> lock( s.mutex );
+  return s.interner.intern( str, hash );
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+template<std::ptrdiff_t Extent>
+inline typename bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>::handle_type
+  bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>
+  ::intern( basic_string_span<CharT,Traits,Extent> str )
+{
+  return intern( view_type( str.data(), static_cast<size_type>(str.size()) ) );
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline bit::core::optional<typename bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>::handle_type>
+  bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>
+  ::find( view_type str )
+  const
+{
+  if( str.empty() ) return handle_type();
+
+  const auto hash = hash_value( str );
+  auto& s = shard_for( hash );
+
+  std::lock_guard<std::mutex> lock( s.mutex );
+  const auto entry = s.interner.find_entry( str, hash );
+  if( entry == nullptr ) return nullopt;
+
+  return handle_type( entry );
+}
+
+template<typename CharT, typename Traits, typename Allocator>
+inline bool bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>
+  ::contains( view_type str )
+  const
+{
+  return find( str ).has_value();
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Allocator>
+inline typename bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>::shard&
+  bit::core::basic_concurrent_string_interner<CharT,Traits,Allocator>
+  ::shard_for( hash_t hash )
+  const noexcept
+{
+  // The table of each shard indexes with the low bits of the hash, so the
+  // shard is picked with the high bits
+  constexpr auto shift = sizeof(std::size_t) * CHAR_BIT - 4u;
+  static_assert( shard_count == (1u << 4), "shard_for assumes 16 shards" );
+
+  return m_shards[static_cast<std::size_t>(hash) >> shift];
+}
+
+#endif /* BIT_CORE_CONTAINERS_DETAIL_STRING_INTERNER_INL */
@@ -0,0 +1,634 @@
+/*****************************************************************************
+ * \file
+ * \brief This internal header contains the runtime substring search used by
+ *        basic_string_view::find and basic_string_view::rfind
+ *
+ * \note This is an internal header file, included by other library headers.
+ *       Do not attempt to use it directly.
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_CONTAINERS_DETAIL_STRING_SEARCH_HPP
+#define BIT_CORE_CONTAINERS_DETAIL_STRING_SEARCH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../../utilities/compiler_traits.hpp"
+
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <cstdint>     // std::uint32_t
+#include <cstring>     // std::memchr, std::memcmp
+#include <string>      // std::char_traits
+#include <type_traits> // std::integral_constant, std::is_same
+
+#if defined(BIT_PLATFORM_HAS_AVX2)
+# include <immintrin.h>
+#elif defined(BIT_PLATFORM_HAS_SSE2)
+# include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+# include <intrin.h> // _BitScanForward, _BitScanReverse
+#endif
+
+//-----------------------------------------------------------------------------
+// Needles are found with a SIMD filter in the style of memchr: a block of
+// candidate positions is compared against two characters of the needle --
+// the first and the last, unless a precompiled searcher chose others -- and
+// only positions matching both are verified.
+//
+// Verifying a candidate costs up to the length of the needle, so the filter
+// is abandoned in favour of the Two-Way algorithm once verification has cost
+// more than a constant multiple of the characters scanned. This keeps the
+// search linear in the length of the haystack for periodic inputs, while
+// common text is searched at the speed of the filter.
+//
+// Only byte-sized characters compared with std::char_traits take these
+// paths; every other basic_string_view uses the portable constexpr search.
+//-----------------------------------------------------------------------------
+
+namespace bit {
+  namespace core {
+    namespace detail {
+
+      /// \brief Determines whether a basic_string_view<CharT,Traits> can be
+      ///        searched by comparing raw bytes
+      template<typename CharT, typename Traits>
+      struct is_byte_searchable
+        : std::integral_constant<bool,
+            sizeof(CharT) == 1 &&
+            std::is_same<Traits,std::char_traits<CharT>>::value>{};
+
+      constexpr std::size_t string_search_npos() noexcept{ return static_cast<std::size_t>(-1); }
+
+      /// The number of characters verified per character scanned, after
+      /// which the filter gives way to Two-Way
+      constexpr std::size_t string_search_work_factor() noexcept{ return 4u; }
+
+      //-----------------------------------------------------------------------
+      // Portable Search
+      //-----------------------------------------------------------------------
+
+      /// \brief Finds the first start in [first, last) at which the \p m
+      ///        characters of \p x occur in \p h
+      template<typename Traits, typename CharT>
+      inline constexpr std::size_t string_search_naive_find( const CharT* h,
+                                                             std::size_t first,
+                                                             std::size_t last,
+                                                             const CharT* x,
+                                                             std::size_t m )
+        noexcept
+      {
+        for( auto i = first; i < last; ++i ) {
+          auto j = m;
+          for( ; j > 0; --j ) {
+            if( !Traits::eq( x[j - 1], h[i + j - 1] ) ) {
+              break;
+            }
+          }
+          if( j == 0 ) return i;
+        }
+        return string_search_npos();
+      }
+
+      /// \brief Finds the last start in [0, end) at which the \p m
+      ///        characters of \p x occur in \p h
+      template<typename Traits, typename CharT>
+      inline constexpr std::size_t string_search_naive_rfind( const CharT* h,
+                                                              std::size_t end,
+                                                              const CharT* x,
+                                                              std::size_t m )
+        noexcept
+      {
+        for( auto i = end; i > 0; --i ) {
+          auto j = std::size_t{0};
+          for( ; j < m; ++j ) {
+            if( !Traits::eq( x[j], h[i + j - 1] ) ) {
+              break;
+            }
+          }
+          if( j == m ) return i - 1;
+        }
+        return string_search_npos();
+      }
+
+      //-----------------------------------------------------------------------
+      // Bit Scanning
+      //-----------------------------------------------------------------------
+
+      /// \brief Gets the index of the lowest set bit of a non-zero \p mask
+      inline unsigned string_search_lowest_bit( std::uint32_t mask )
+        noexcept
+      {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>( __builtin_ctz( mask ) );
+#elif defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward( &index, mask );
+        return static_cast<unsigned>( index );
+#else
+        auto index = 0u;
+        for( ; (mask & 1u) == 0u; mask >>= 1 ) ++index;
+        return index;
+#endif
+      }
+
+      /// \brief Gets the index of the highest set bit of a non-zero \p mask
+      inline unsigned string_search_highest_bit( std::uint32_t mask )
+        noexcept
+      {
+#if defined(__GNUC__) || defined(__clang__)
+        return 31u - static_cast<unsigned>( __builtin_clz( mask ) );
+#elif defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse( &index, mask );
+        return static_cast<unsigned>( index );
+#else
+        auto index = 31u;
+        for( ; (mask & 0x80000000u) == 0u; mask <<= 1 ) --index;
+        return index;
+#endif
+      }
+
+      //-----------------------------------------------------------------------
+      // Character Pair Filter
+      //-----------------------------------------------------------------------
+
+      /// \brief The offsets within a needle of the two characters compared
+      ///        by the filter
+      ///
+      /// basic_string_view::find uses the first and last characters; a
+      /// precompiled searcher picks the two it expects to be rarest.
+      struct string_search_probes
+      {
+        std::size_t first;
+        std::size_t second;
+      };
+
+#if defined(BIT_PLATFORM_HAS_AVX2)
+      constexpr std::size_t string_search_block_size() noexcept{ return 32u; }
+
+      /// \brief Matches the 32 positions starting at \p p, offset by the
+      ///        probes \p o, against the characters \p a and \p b
+      inline std::uint32_t string_search_block( const char* p,
+                                                string_search_probes o,
+                                                char a,
+                                                char b )
+        noexcept
+      {
+        const auto x = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(p + o.first) );
+        const auto y = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(p + o.second) );
+        const auto eq = _mm256_and_si256( _mm256_cmpeq_epi8( x, _mm256_set1_epi8(a) ),
+                                          _mm256_cmpeq_epi8( y, _mm256_set1_epi8(b) ) );
+
+        return static_cast<std::uint32_t>( _mm256_movemask_epi8( eq ) );
+      }
+#elif defined(BIT_PLATFORM_HAS_SSE2)
+      constexpr std::size_t string_search_block_size() noexcept{ return 16u; }
+
+      /// \brief Matches the 16 positions starting at \p p, offset by the
+      ///        probes \p o, against the characters \p a and \p b
+      inline std::uint32_t string_search_block( const char* p,
+                                                string_search_probes o,
+                                                char a,
+                                                char b )
+        noexcept
+      {
+        const auto x = _mm_loadu_si128( reinterpret_cast<const __m128i*>(p + o.first) );
+        const auto y = _mm_loadu_si128( reinterpret_cast<const __m128i*>(p + o.second) );
+        const auto eq = _mm_and_si128( _mm_cmpeq_epi8( x, _mm_set1_epi8(a) ),
+                                       _mm_cmpeq_epi8( y, _mm_set1_epi8(b) ) );
+
+        return static_cast<std::uint32_t>( _mm_movemask_epi8( eq ) );
+      }
+#else
+      constexpr std::size_t string_search_block_size() noexcept{ return 8u; }
+
+      /// \brief Matches the 8 positions starting at \p p, offset by the
+      ///        probes \p o, against the characters \p a and \p b
+      inline std::uint32_t string_search_block( const char* p,
+                                                string_search_probes o,
+                                                char a,
+                                                char b )
+        noexcept
+      {
+        auto result = std::uint32_t{0};
+        for( auto i = 0u; i < 8u; ++i ) {
+          const auto match = (p[i + o.first] == a) & (p[i + o.second] == b);
+          result |= static_cast<std::uint32_t>(match) << i;
+        }
+        return result;
+      }
+#endif
+
+      /// \brief Determines whether the \p m byte needle \p x occurs at \p p
+      inline bool string_search_verify( const char* p,
+                                        const char* x,
+                                        std::size_t m )
+        noexcept
+      {
+        return std::memcmp( p, x, m ) == 0;
+      }
+
+      /// \brief Finds the first start in [first, last) of the \p m byte
+      ///        needle \p x in \p h, using the filter on the probes \p o
+      ///
+      /// If verifying candidates costs more than \p budget characters plus
+      /// string_search_work_factor() per character scanned, the search stops
+      /// early and \p first is advanced to the first unsearched start.
+      /// Otherwise \p first is set to \p last.
+      inline std::size_t string_search_filter_find( const char* h,
+                                                    std::size_t& first,
+                                                    std::size_t last,
+                                                    const char* x,
+                                                    std::size_t m,
+                                                    string_search_probes o,
+                                                    std::size_t budget )
+        noexcept
+      {
+        constexpr auto block  = string_search_block_size();
+        constexpr auto factor = string_search_work_factor();
+
+        auto i = first;
+        for( ; last - i >= block; i += block ) {
+          auto mask = string_search_block( h + i, o, x[o.first], x[o.second] );
+
+          while( mask != 0u ) {
+            const auto bit = string_search_lowest_bit( mask );
+            if( string_search_verify( h + i + bit, x, m ) ) {
+              return i + bit;
+            }
+            mask &= mask - 1u;
+
+            if( m > budget ) {
+              first = i + bit + 1u;
+              return string_search_npos();
+            }
+            budget -= m;
+          }
+          budget += factor * block;
+        }
+        for( ; i < last; ++i ) {
+          if( h[i + o.first] == x[o.first] && h[i + o.second] == x[o.second] &&
+              string_search_verify( h + i, x, m ) ) {
+            return i;
+          }
+        }
+        first = last;
+        return string_search_npos();
+      }
+
+      /// \brief Finds the last start in [0, end) of the \p m byte needle
+      ///        \p x in \p h, using the filter on the probes \p o
+      ///
+      /// If verifying candidates costs more than \p budget characters plus
+      /// string_search_work_factor() per character scanned, the search stops
+      /// early and \p end is lowered to one past the last unsearched start.
+      /// Otherwise \p end is set to 0.
+      inline std::size_t string_search_filter_rfind( const char* h,
+                                                     std::size_t& end,
+                                                     const char* x,
+                                                     std::size_t m,
+                                                     string_search_probes o,
+                                                     std::size_t budget )
+        noexcept
+      {
+        constexpr auto block  = string_search_block_size();
+        constexpr auto factor = string_search_work_factor();
+
+        auto i = end;
+        for( ; i >= block; i -= block ) {
+          auto mask = string_search_block( h + i - block, o, x[o.first], x[o.second] );
+
+          while( mask != 0u ) {
+            const auto bit = string_search_highest_bit( mask );
+            if( string_search_verify( h + i - block + bit, x, m ) ) {
+              return i - block + bit;
+            }
+            mask &= ~(std::uint32_t{1u} << bit);
+
+            if( m > budget ) {
+              end = i - block + bit;
+              return string_search_npos();
+            }
+            budget -= m;
+          }
+          budget += factor * block;
+        }
+        for( ; i > 0; --i ) {
+          if( h[i - 1 + o.first] == x[o.first] && h[i - 1 + o.second] == x[o.second] &&
+              string_search_verify( h + i - 1, x, m ) ) {
+            return i - 1;
+          }
+        }
+        end = 0u;
+        return string_search_npos();
+      }
+
+      //-----------------------------------------------------------------------
+      // Two-Way
+      //-----------------------------------------------------------------------
+
+      /// \brief Reads characters forwards from \c p
+      struct string_search_forward
+      {
+        const char* p;
+
+        unsigned char operator[]( std::ptrdiff_t i ) const noexcept
+        {
+          return static_cast<unsigned char>( p[i] );
+        }
+      };
+
+      /// \brief Reads characters backwards from \c p
+      struct string_search_reverse
+      {
+        const char* p;
+
+        unsigned char operator[]( std::ptrdiff_t i ) const noexcept
+        {
+          return static_cast<unsigned char>( *(p - i) );
+        }
+      };
+
+      /// \brief Computes the maximal suffix of \p x under the ordering
+      ///        selected by \p invert, storing its period in \p period
+      template<typename Access>
+      inline std::ptrdiff_t two_way_maximal_suffix( Access x,
+                                                    std::ptrdiff_t m,
+                                                    bool invert,
+                                                    std::ptrdiff_t& period )
+        noexcept
+      {
+        auto ms = std::ptrdiff_t{-1};
+        auto j  = std::ptrdiff_t{0};
+        auto k  = std::ptrdiff_t{1};
+        auto p  = std::ptrdiff_t{1};
+
+        while( j + k < m ) {
+          const auto a = x[j + k];
+          const auto b = x[ms + k];
+
+          if( invert ? (a > b) : (a < b) ) {
+            j += k;
+            k = 1;
+            p = j - ms;
+          } else if( a == b ) {
+            if( k != p ) {
+              ++k;
+            } else {
+              j += p;
+              k = 1;
+            }
+          } else {
+            ms = j;
+            j  = ms + 1;
+            k  = p = 1;
+          }
+        }
+        period = p;
+        return ms;
+      }
+
+      /// \brief The critical factorization of a needle, which depends only
+      ///        on the needle and so can be computed once for many searches
+      struct two_way_factorization
+      {
+        std::ptrdiff_t ell;      ///< The end of the left half of the needle
+        std::ptrdiff_t period;   ///< The shift after a full match
+        bool           periodic; ///< Whether the left half repeats in the right
+      };
+
+      /// \brief Computes the critical factorization of the \p m character
+      ///        needle \p x
+      template<typename Access>
+      inline two_way_factorization two_way_factorize( Access x,
+                                                      std::ptrdiff_t m )
+        noexcept
+      {
+        auto p = std::ptrdiff_t{};
+        auto q = std::ptrdiff_t{};
+        const auto i0 = two_way_maximal_suffix( x, m, false, p );
+        const auto j0 = two_way_maximal_suffix( x, m, true, q );
+
+        const auto ell    = (i0 > j0) ? i0 : j0;
+        const auto period = (i0 > j0) ? p : q;
+
+        auto is_periodic = (ell + 1 + period <= m);
+        for( auto i = std::ptrdiff_t{0}; is_periodic && i <= ell; ++i ) {
+          is_periodic = (x[i] == x[i + period]);
+        }
+
+        if( is_periodic ) {
+          return { ell, period, true };
+        }
+        return { ell, ((ell + 1 > m - ell - 1) ? ell + 1 : m - ell - 1) + 1, false };
+      }
+
+      /// \brief Finds the first occurrence of the \p m character needle
+      ///        \p x in the \p n character haystack \p y, with the Two-Way
+      ///        algorithm of Crochemore and Perrin
+      ///
+      /// \param f the factorization of \p x from two_way_factorize
+      template<typename Access>
+      inline std::size_t two_way_search( Access x,
+                                         std::ptrdiff_t m,
+                                         Access y,
+                                         std::ptrdiff_t n,
+                                         const two_way_factorization& f )
+        noexcept
+      {
+        const auto ell    = f.ell;
+        const auto period = f.period;
+
+        if( f.periodic ) {
+          auto memory = std::ptrdiff_t{-1};
+          for( auto j = std::ptrdiff_t{0}; j <= n - m; ) {
+            auto i = ((ell > memory) ? ell : memory) + 1;
+            while( i < m && x[i] == y[i + j] ) ++i;
+
+            if( i >= m ) {
+              i = ell;
+              while( i > memory && x[i] == y[i + j] ) --i;
+              if( i <= memory ) return static_cast<std::size_t>(j);
+
+              j += period;
+              memory = m - period - 1;
+            } else {
+              j += i - ell;
+              memory = -1;
+            }
+          }
+        } else {
+          for( auto j = std::ptrdiff_t{0}; j <= n - m; ) {
+            auto i = ell + 1;
+            while( i < m && x[i] == y[i + j] ) ++i;
+
+            if( i >= m ) {
+              i = ell;
+              while( i >= 0 && x[i] == y[i + j] ) --i;
+              if( i < 0 ) return static_cast<std::size_t>(j);
+
+              j += period;
+            } else {
+              j += i - ell;
+            }
+          }
+        }
+        return string_search_npos();
+      }
+
+      template<typename Access>
+      inline std::size_t two_way_search( Access x,
+                                         std::ptrdiff_t m,
+                                         Access y,
+                                         std::ptrdiff_t n )
+        noexcept
+      {
+        return two_way_search( x, m, y, n, two_way_factorize( x, m ) );
+      }
+
+      //-----------------------------------------------------------------------
+      // Search
+      //-----------------------------------------------------------------------
+
+      /// \brief Finds the first start in [first, last) of the \p m byte
+      ///        needle \p x in \p h
+      ///
+      /// \pre 0 < m, and last + m - 1 <= the length of \p h
+      inline std::size_t string_search_find( const char* h,
+                                             std::size_t first,
+                                             std::size_t last,
+                                             const char* x,
+                                             std::size_t m )
+        noexcept
+      {
+        if( m == 1u ) {
+          const auto* p = static_cast<const char*>( std::memchr( h + first, x[0], last - first ) );
+          return (p == nullptr) ? string_search_npos() : static_cast<std::size_t>(p - h);
+        }
+
+        const auto budget = string_search_work_factor() * m;
+
+        const auto result = string_search_filter_find( h, first, last, x, m, {0u, m - 1u}, budget );
+        if( result != string_search_npos() || first == last ) {
+          return result;
+        }
+
+        const auto n = static_cast<std::ptrdiff_t>(last - first + m - 1u);
+        const auto offset = two_way_search( string_search_forward{x},
+                                            static_cast<std::ptrdiff_t>(m),
+                                            string_search_forward{h + first},
+                                            n );
+        return (offset == string_search_npos()) ? offset : first + offset;
+      }
+
+      /// \brief Finds the last start in [0, end) of the \p m byte needle
+      ///        \p x in \p h
+      ///
+      /// \pre 0 < m, and end + m - 1 <= the length of \p h
+      inline std::size_t string_search_rfind( const char* h,
+                                              std::size_t end,
+                                              const char* x,
+                                              std::size_t m )
+        noexcept
+      {
+        const auto budget = string_search_work_factor() * m;
+
+        const auto result = string_search_filter_rfind( h, end, x, m, {0u, m - 1u}, budget );
+        if( result != string_search_npos() || end == 0u ) {
+          return result;
+        }
+
+        // Searching the reversed haystack for the reversed needle finds the
+        // last occurrence first
+        const auto n = end + m - 1u;
+        const auto offset = two_way_search( string_search_reverse{x + m - 1u},
+                                            static_cast<std::ptrdiff_t>(m),
+                                            string_search_reverse{h + n - 1u},
+                                            static_cast<std::ptrdiff_t>(n) );
+        return (offset == string_search_npos()) ? offset : end - 1u - offset;
+      }
+
+      //-----------------------------------------------------------------------
+
+      template<typename Traits, typename CharT>
+      inline std::size_t string_search_find( const CharT* h,
+                                             std::size_t first,
+                                             std::size_t last,
+                                             const CharT* x,
+                                             std::size_t m,
+                                             std::true_type )
+        noexcept
+      {
+        return string_search_find( reinterpret_cast<const char*>(h), first, last,
+                                   reinterpret_cast<const char*>(x), m );
+      }
+
+      template<typename Traits, typename CharT>
+      inline std::size_t string_search_find( const CharT* h,
+                                             std::size_t first,
+                                             std::size_t last,
+                                             const CharT* x,
+                                             std::size_t m,
+                                             std::false_type )
+        noexcept
+      {
+        return string_search_naive_find<Traits>( h, first, last, x, m );
+      }
+
+      template<typename Traits, typename CharT>
+      inline std::size_t string_search_rfind( const CharT* h,
+                                              std::size_t end,
+                                              const CharT* x,
+                                              std::size_t m,
+                                              std::true_type )
+        noexcept
+      {
+        return string_search_rfind( reinterpret_cast<const char*>(h), end,
+                                    reinterpret_cast<const char*>(x), m );
+      }
+
+      template<typename Traits, typename CharT>
+      inline std::size_t string_search_rfind( const CharT* h,
+                                              std::size_t end,
+                                              const CharT* x,
+                                              std::size_t m,
+                                              std::false_type )
+        noexcept
+      {
+        return string_search_naive_rfind<Traits>( h, end, x, m );
+      }
+
+    } // namespace detail
+  } // namespace core
+} // namespace bit
+
+#endif /* BIT_CORE_CONTAINERS_DETAIL_STRING_SEARCH_HPP */
@@ -0,0 +1,264 @@
+#ifndef BIT_CORE_CONTAINERS_DETAIL_STRING_SEARCHER_INL
+#define BIT_CORE_CONTAINERS_DETAIL_STRING_SEARCHER_INL
+
+namespace bit { namespace core { namespace detail {
+
+  //---------------------------------------------------------------------------
+  // Byte Frequencies
+  //---------------------------------------------------------------------------
+
+  /// \brief Bytes in roughly descending order of frequency in English text
+  ///        and source code
+  constexpr const char* string_searcher_common_bytes() noexcept
+  {
+    return " etaoinsrhldcumfpgwyb.,\n"
+           "vkxjqz0123456789"
+           "ETAOINSRHLDCUMFPGWYBVKXJQZ"
+           "\"'-/:=_()\t;<>{}[]*&+!?#%$@|\\^~`\r";
+  }
+
+  struct string_searcher_rank_data
+  {
+    /// How common each byte is; bytes absent from the list are rank 0
+    unsigned char rank[256];
+  };
+
+  inline constexpr string_searcher_rank_data make_string_searcher_ranks()
+    noexcept
+  {
+    auto result = string_searcher_rank_data{};
+    const auto* bytes = string_searcher_common_bytes();
+
+    auto rank = 255;
+    for( auto i = 0; bytes[i] != '\0'; ++i, --rank ) {
+      result.rank[static_cast<unsigned char>(bytes[i])] = static_cast<unsigned char>(rank);
+    }
+    return result;
+  }
+
+  template<typename = void>
+  struct string_searcher_ranks
+  {
+    static constexpr string_searcher_rank_data value = make_string_searcher_ranks();
+  };
+
+  template<typename T>
+  constexpr string_searcher_rank_data string_searcher_ranks<T>::value;
+
+  /// \brief Chooses the two positions of the \p m byte needle \p x least
+  ///        likely to match by chance, preferring two different bytes
+  inline string_search_probes string_searcher_rare_probes( const char* x,
+                                                           std::size_t m )
+    noexcept
+  {
+    const auto& ranks = string_searcher_ranks<>::value.rank;
+    const auto rank = [&]( std::size_t i ) {
+      return ranks[static_cast<unsigned char>(x[i])];
+    };
+
+    auto first = std::size_t{0};
+    for( auto i = std::size_t{1}; i < m; ++i ) {
+      if( rank(i) < rank(first) ) first = i;
+    }
+
+    // Fall back to the last byte, which at least moves the second probe
+    // away from the first when every byte is the same
+    auto second = (first == m - 1u) ? std::size_t{0} : m - 1u;
+    auto distinct = false;
+    for( auto i = std::size_t{0}; i < m; ++i ) {
+      if( x[i] == x[first] ) continue;
+      if( !distinct || rank(i) < rank(second) ) {
+        second   = i;
+        distinct = true;
+      }
+    }
+
+    if( second < first ) {
+      return { second, first };
+    }
+    return { first, second };
+  }
+
+  /// \brief Gets the index of \p c in a 256-entry table, using its low byte
+  template<typename Traits, typename CharT>
+  inline std::size_t string_searcher_index( CharT c )
+    noexcept
+  {
+    return static_cast<std::size_t>( Traits::to_int_type(c) ) & 0xffu;
+  }
+
+} } } // namespace bit::core::detail
+
+//=============================================================================
+// class : basic_boyer_moore_horspool_searcher
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline bit::core::basic_boyer_moore_horspool_searcher<CharT,Traits>
+  ::basic_boyer_moore_horspool_searcher( basic_string_view<CharT,Traits> needle )
+  noexcept
+  : m_needle(needle),
+    m_skip{}
+{
+  const auto m = needle.size();
+
+  for( auto& skip : m_skip ) {
+    skip = m;
+  }
+
+  // Later characters overwrite earlier ones with a smaller shift, so wide
+  // characters sharing a low byte keep the shift that is safe for all
+  for( auto i = size_type{0}; i + 1u < m; ++i ) {
+    m_skip[detail::string_searcher_index<Traits>( needle[i] )] = m - 1u - i;
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline bit::core::basic_string_view<CharT,Traits>
+  bit::core::basic_boyer_moore_horspool_searcher<CharT,Traits>::needle()
+  const noexcept
+{
+  return m_needle;
+}
+
+//-----------------------------------------------------------------------------
+// Operations
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline typename bit::core::basic_boyer_moore_horspool_searcher<CharT,Traits>::size_type
+  bit::core::basic_boyer_moore_horspool_searcher<CharT,Traits>
+  ::operator()( basic_string_view<CharT,Traits> haystack, size_type pos )
+  const noexcept
+{
+  const auto n = haystack.size();
+  const auto m = m_needle.size();
+
+  if( m == 0u || m > n || pos > n - m ) {
+    return npos;
+  }
+
+  const auto* h = haystack.data();
+  const auto* x = m_needle.data();
+  const auto back = x[m - 1u];
+
+  for( auto i = pos; i <= n - m; ) {
+    const auto c = h[i + m - 1u];
+
+    if( Traits::eq( c, back ) && Traits::compare( h + i, x, m - 1u ) == 0 ) {
+      return i;
+    }
+    i += m_skip[detail::string_searcher_index<Traits>( c )];
+  }
+  return npos;
+}
+
+template<typename CharT, typename Traits>
+template<std::ptrdiff_t Extent>
+inline typename bit::core::basic_boyer_moore_horspool_searcher<CharT,Traits>::size_type
+  bit::core::basic_boyer_moore_horspool_searcher<CharT,Traits>
+  ::operator()( basic_string_span<CharT,Traits,Extent> haystack, size_type pos )
+  const noexcept
+{
+  return (*this)( basic_string_view<CharT,Traits>( haystack.data(), haystack.size() ), pos );
+}
+
+//=============================================================================
+// class : basic_simd_searcher
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline bit::core::basic_simd_searcher<CharT,Traits>
+  ::basic_simd_searcher( basic_string_view<CharT,Traits> needle )
+  noexcept
+  : m_needle(needle),
+    m_probes{0u, 0u},
+    m_factorization{0, 1, false}
+{
+  const auto m = needle.size();
+  const auto* x = reinterpret_cast<const char*>( needle.data() );
+
+  if( m >= 2u ) {
+    m_probes = detail::string_searcher_rare_probes( x, m );
+    m_factorization = detail::two_way_factorize( detail::string_search_forward{x},
+                                                 static_cast<std::ptrdiff_t>(m) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline bit::core::basic_string_view<CharT,Traits>
+  bit::core::basic_simd_searcher<CharT,Traits>::needle()
+  const noexcept
+{
+  return m_needle;
+}
+
+//-----------------------------------------------------------------------------
+// Operations
+//-----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits>
+inline typename bit::core::basic_simd_searcher<CharT,Traits>::size_type
+  bit::core::basic_simd_searcher<CharT,Traits>
+  ::operator()( basic_string_view<CharT,Traits> haystack, size_type pos )
+  const noexcept
+{
+  const auto n = haystack.size();
+  const auto m = m_needle.size();
+
+  if( m == 0u || m > n || pos > n - m ) {
+    return npos;
+  }
+
+  const auto* h = reinterpret_cast<const char*>( haystack.data() );
+  const auto* x = reinterpret_cast<const char*>( m_needle.data() );
+  const auto last = n - m + 1u;
+
+  if( m == 1u ) {
+    const auto* p = static_cast<const char*>( std::memchr( h + pos, x[0], last - pos ) );
+    return (p == nullptr) ? npos : static_cast<size_type>(p - h);
+  }
+
+  auto first = pos;
+  const auto budget = detail::string_search_work_factor() * m;
+  const auto result = detail::string_search_filter_find( h, first, last, x, m,
+                                                         m_probes, budget );
+  if( result != npos || first == last ) {
+    return result;
+  }
+
+  const auto offset = detail::two_way_search( detail::string_search_forward{x},
+                                              static_cast<std::ptrdiff_t>(m),
+                                              detail::string_search_forward{h + first},
+                                              static_cast<std::ptrdiff_t>(last - first + m - 1u),
+                                              m_factorization );
+  return (offset == npos) ? npos : first + offset;
+}
+
+template<typename CharT, typename Traits>
+template<std::ptrdiff_t Extent>
+inline typename bit::core::basic_simd_searcher<CharT,Traits>::size_type
+  bit::core::basic_simd_searcher<CharT,Traits>
+  ::operator()( basic_string_span<CharT,Traits,Extent> haystack, size_type pos )
+  const noexcept
+{
+  return (*this)( basic_string_view<CharT,Traits>( haystack.data(), haystack.size() ), pos );
+}
+
+#endif /* BIT_CORE_CONTAINERS_DETAIL_STRING_SEARCHER_INL */
@@ -283,22 +283,23 @@ inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
                                                    size_type pos )
   const
 {
-  if(v.size()==0 || size()==0) {
+  if(v.size()==0 || v.size() > size()) {
     return npos;
   }
 
   const size_type max_index = m_size - v.size() + 1;
 
-  for( size_type i = pos; i < max_index; ++i ) {
-    size_type j = v.size();
-    for( ; j > 0; --j ) {
-      if( v[j-1] != m_str[i+j-1] ) {
-        break;
-      }
-    }
-    if(j==0) return i;
+  if(pos >= max_index) {
+    return npos;
+  }
+
+  if(!BIT_IS_CONSTANT_EVALUATED()) {
+    return detail::string_search_find<Traits>( m_str, pos, max_index,
+                                               v.data(), v.size(),
+                                               detail::is_byte_searchable<CharT,Traits>{} );
   }
-  return npos;
+  return detail::string_search_naive_find<Traits>( m_str, pos, max_index,
+                                                   v.data(), v.size() );
 }
 
 template<typename CharT, typename Traits>
@@ -329,6 +330,16 @@ inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
   return find(basic_string_view<CharT,Traits>(s), pos);
 }
 
+template<typename CharT, typename Traits>
+template<typename Searcher, typename>
+inline typename bit::core::basic_string_view<CharT,Traits>::size_type
+  bit::core::basic_string_view<CharT,Traits>::find( const Searcher& searcher,
+                                                   size_type pos )
+  const noexcept
+{
+  return searcher( *this, pos );
+}
+
 //----------------------------------------------------------------------------
 
 template<typename CharT, typename Traits>
@@ -337,22 +348,21 @@ inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
                                                     size_type pos )
   const
 {
-  if(v.size()==0 || size()==0) {
+  if(v.size()==0 || v.size() > size()) {
     return npos;
   }
 
+  // Candidate starts are [0, end), the last being pos when it is in range
   const size_type max_index = m_size - v.size()+1;
+  const size_type end       = (pos < max_index) ? pos + 1 : max_index;
 
-  for( size_type i = std::min(max_index,pos); i > 0; --i ) {
-    size_type j = 0;
-    for( ; j < v.size(); ++j ) {
-      if( v[j] != m_str[i+j-1] ) {
-        break;
-      }
-    }
-    if(j==v.size()) return i-1;
+  if(!BIT_IS_CONSTANT_EVALUATED()) {
+    return detail::string_search_rfind<Traits>( m_str, end,
+                                                v.data(), v.size(),
+                                                detail::is_byte_searchable<CharT,Traits>{} );
   }
-  return npos;
+  return detail::string_search_naive_rfind<Traits>( m_str, end,
+                                                    v.data(), v.size() );
 }
 
 template<typename CharT, typename Traits>
@@ -391,19 +401,15 @@ inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
                                                             size_type pos )
   const
 {
-  if(v.size()==0 || size()==0)
-  {
+  if(v.size()==0 || pos >= size()) {
     return npos;
   }
 
-  for( size_type i = pos; i < m_size; ++i ) {
-    for( size_type j = 0; j < v.size(); ++j ) {
-      if( v[j] == m_str[i] ) {
-        return i;
-      }
-    }
+  if(!BIT_IS_CONSTANT_EVALUATED()) {
+    return detail::char_set_find_first<Traits>( m_str, pos, m_size, v.data(), v.size(), true,
+                                                detail::is_byte_searchable<CharT,Traits>{} );
   }
-  return npos;
+  return detail::char_set_naive_find_first<Traits>( m_str, pos, m_size, v.data(), v.size(), true );
 }
 
 template<typename CharT, typename Traits>
@@ -434,6 +440,15 @@ inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
   return find_first_of( basic_string_view<CharT,Traits>(s), pos );
 }
 
+template<typename CharT, typename Traits>
+inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
+  bit::core::basic_string_view<CharT,Traits>::find_first_of( const char_set& set,
+                                                            size_type pos )
+  const noexcept
+{
+  return detail::char_set_find_first( set, m_str, pos, m_size, true );
+}
+
 //----------------------------------------------------------------------------
 
 template<typename CharT, typename Traits>
@@ -442,18 +457,17 @@ inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
                                                            size_type pos )
   const
 {
-  if(v.size()==0 || size()==0) {
+  const size_type end = (pos < m_size) ? pos + 1 : m_size;
+
+  if(v.size()==0 || end == 0) {
     return npos;
   }
 
-  for( size_type i = std::min(m_size,pos); i > 0; --i ) {
-    for( size_type j = 0; j < v.size(); ++j ) {
-      if( v[j] == m_str[i-1] ) {
-        return i-1;
-      }
-    }
+  if(!BIT_IS_CONSTANT_EVALUATED()) {
+    return detail::char_set_find_last<Traits>( m_str, end, v.data(), v.size(), true,
+                                               detail::is_byte_searchable<CharT,Traits>{} );
   }
-  return npos;
+  return detail::char_set_naive_find_last<Traits>( m_str, end, v.data(), v.size(), true );
 }
 
 template<typename CharT, typename Traits>
@@ -484,6 +498,17 @@ inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
   return find_last_of( basic_string_view<CharT,Traits>(s), pos );
 }
 
+template<typename CharT, typename Traits>
+inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
+  bit::core::basic_string_view<CharT,Traits>::find_last_of( const char_set& set,
+                                                           size_type pos )
+  const noexcept
+{
+  const size_type end = (pos < m_size) ? pos + 1 : m_size;
+
+  return detail::char_set_find_last( set, m_str, end, true );
+}
+
 //----------------------------------------------------------------------------
 
 template<typename CharT, typename Traits>
@@ -492,22 +517,15 @@ inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
                                                                 size_type pos )
   const
 {
-  if(v.size()==0 || size()==0) {
+  if(v.size()==0 || pos >= size()) {
     return npos;
   }
 
-  for( size_type i = pos; i < m_size; ++i ) {
-    size_type j = 0;
-    for( ; j < v.size(); ++j ) {
-      if( v[j] == m_str[i] ) {
-        break;
-      }
-    }
-    if( j == v.size() ) {
-      return i;
-    }
+  if(!BIT_IS_CONSTANT_EVALUATED()) {
+    return detail::char_set_find_first<Traits>( m_str, pos, m_size, v.data(), v.size(), false,
+                                                detail::is_byte_searchable<CharT,Traits>{} );
   }
-  return npos;
+  return detail::char_set_naive_find_first<Traits>( m_str, pos, m_size, v.data(), v.size(), false );
 }
 
 template<typename CharT, typename Traits>
@@ -538,6 +556,15 @@ inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
   return find_first_not_of( basic_string_view<CharT,Traits>(s), pos );
 }
 
+template<typename CharT, typename Traits>
+inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
+  bit::core::basic_string_view<CharT,Traits>::find_first_not_of( const char_set& set,
+                                                                size_type pos )
+  const noexcept
+{
+  return detail::char_set_find_first( set, m_str, pos, m_size, false );
+}
+
 //----------------------------------------------------------------------------
 
 template<typename CharT, typename Traits>
@@ -546,22 +573,17 @@ inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
                                                                size_type pos )
   const
 {
-  if(v.size()==0 || size()==0) {
+  const size_type end = (pos < m_size) ? pos + 1 : m_size;
+
+  if(v.size()==0 || end == 0) {
     return npos;
   }
 
-  for( size_type i = std::min(m_size,pos); i > 0; --i ) {
-    size_type j = 0;
-    for( ; j < v.size(); ++j ) {
-      if( v[j] == m_str[i-1] ) {
-        break;
-      }
-    }
-    if( j == v.size() ) {
-      return i-1;
-    }
+  if(!BIT_IS_CONSTANT_EVALUATED()) {
+    return detail::char_set_find_last<Traits>( m_str, end, v.data(), v.size(), false,
+                                               detail::is_byte_searchable<CharT,Traits>{} );
   }
-  return npos;
+  return detail::char_set_naive_find_last<Traits>( m_str, end, v.data(), v.size(), false );
 }
 
 template<typename CharT, typename Traits>
@@ -592,6 +614,17 @@ inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
   return find_last_not_of( basic_string_view<CharT,Traits>(s), pos );
 }
 
+template<typename CharT, typename Traits>
+inline constexpr typename bit::core::basic_string_view<CharT,Traits>::size_type
+  bit::core::basic_string_view<CharT,Traits>::find_last_not_of( const char_set& set,
+                                                               size_type pos )
+  const noexcept
+{
+  const size_type end = (pos < m_size) ? pos + 1 : m_size;
+
+  return detail::char_set_find_last( set, m_str, end, false );
+}
+
 //----------------------------------------------------------------------------
 // Iterator
 //----------------------------------------------------------------------------
@@ -707,6 +740,14 @@ inline constexpr bit::core::hash_t
   return hash_string_segment( str.data(), str.size() );
 }
 
+template<typename CharT>
+inline constexpr bit::core::hash_t
+  bit::core::hash_value( const basic_string_view<CharT,insensitive_char_traits<CharT>>& str )
+  noexcept
+{
+  return hash_insensitive_string_segment( str.data(), str.size() );
+}
+
 //----------------------------------------------------------------------------
 // Public Functions
 //----------------------------------------------------------------------------
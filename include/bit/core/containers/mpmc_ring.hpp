@@ -0,0 +1,451 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains bounded lock-free queues shared by any
+ *        number of producer and consumer threads
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_CONTAINERS_MPMC_RING_HPP
+#define BIT_CORE_CONTAINERS_MPMC_RING_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/assert.hpp"                // BIT_ASSERT_OR_THROW
+#include "../utilities/uninitialized_storage.hpp" // destroy_at
+
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <limits>      // std::numeric_limits
+#include <memory>      // std::allocator, std::allocator_traits
+#include <new>         // placement new
+#include <stdexcept>   // std::length_error
+#include <type_traits> // std::enable_if_t, std::aligned_storage_t, etc
+#include <utility>     // std::forward, std::move
+
+namespace bit {
+  namespace core {
+    namespace detail {
+
+      //=======================================================================
+      // struct : detail::mpmc_slot
+      //=======================================================================
+
+      /// \brief An entry of an MPMC ring, together with the sequence number
+      ///        that tells which turn it is on
+      template<typename T>
+      struct mpmc_slot
+      {
+        std::atomic<std::size_t> sequence;
+        std::aligned_storage_t<sizeof(T),alignof(T)> storage;
+      };
+
+      //=======================================================================
+      // class : detail::mpmc_ring_core
+      //=======================================================================
+
+      /////////////////////////////////////////////////////////////////////////
+      /// \brief The queue operations shared by mpmc_ring and mpmc_ring_array,
+      ///        over slots owned by either
+      ///
+      /// This is Dmitry Vyukov's bounded MPMC queue. Each slot carries a
+      /// sequence number: slot \c i starts at \c i, a producer that claims
+      /// position \c p waits for the sequence to equal \c p, and publishes
+      /// \c p+1 once the entry is constructed; a consumer that claims \c p
+      /// waits for \c p+1, and releases the slot for the next lap with
+      /// \c p+capacity. Positions are claimed with a compare-exchange on the
+      /// enqueue or dequeue counter, so producers only contend with
+      /// producers, and consumers with consumers.
+      /////////////////////////////////////////////////////////////////////////
+      template<typename T>
+      class mpmc_ring_core
+      {
+        static_assert( std::is_nothrow_move_constructible<T>::value &&
+                       std::is_nothrow_move_assignable<T>::value &&
+                       std::is_nothrow_destructible<T>::value,
+                       "MPMC rings require T to be nothrow move constructible, "
+                       "move assignable and destructible" );
+
+        //---------------------------------------------------------------------
+        // Public Member Types
+        //---------------------------------------------------------------------
+      public:
+
+        using slot_type = mpmc_slot<T>;
+        using size_type = std::size_t;
+
+        //---------------------------------------------------------------------
+        // Constructor
+        //---------------------------------------------------------------------
+      public:
+
+        /// \brief Constructs the core over \p capacity uninitialized slots,
+        ///        constructing their sequence numbers
+        ///
+        /// \pre \p capacity is a power of two, and at least 2
+        mpmc_ring_core( slot_type* slots, size_type capacity ) noexcept;
+
+        mpmc_ring_core( const mpmc_ring_core& ) = delete;
+
+        //---------------------------------------------------------------------
+
+        mpmc_ring_core& operator=( const mpmc_ring_core& ) = delete;
+
+        //---------------------------------------------------------------------
+        // Operations
+        //---------------------------------------------------------------------
+      public:
+
+        template<typename...Args>
+        bool try_emplace( Args&&...args );
+
+        bool try_pop( T& value ) noexcept;
+
+        bool empty() const noexcept;
+
+        size_type size() const noexcept;
+
+        size_type capacity() const noexcept;
+
+        slot_type* slots() const noexcept;
+
+        /// \brief Destructs the remaining entries
+        ///
+        /// \note No other thread may be using the ring at this point
+        void destroy_entries() noexcept;
+
+        //---------------------------------------------------------------------
+        // Private Member Functions
+        //---------------------------------------------------------------------
+      private:
+
+        /// \brief Claims a slot to construct into, or returns null if the
+        ///        ring is full
+        slot_type* claim_push( size_type& position ) noexcept;
+
+        /// \brief Constructs an entry from \p args in a claimed slot
+        template<typename...Args>
+        bool emplace( std::true_type, Args&&...args ) noexcept;
+
+        /// \brief Constructs an entry from \p args outside of the ring, and
+        ///        only claims a slot to move it into once that succeeded
+        template<typename...Args>
+        bool emplace( std::false_type, Args&&...args );
+
+        //---------------------------------------------------------------------
+        // Private Members
+        //---------------------------------------------------------------------
+      private:
+
+        static constexpr std::size_t cache_line_size = 64u;
+
+        // Read by every thread, but never written after construction
+        alignas(cache_line_size) slot_type* m_slots;
+        std::size_t m_mask;
+
+        // Written by producers
+        alignas(cache_line_size) std::atomic<std::size_t> m_enqueue;
+
+        // Written by consumers
+        alignas(cache_line_size) std::atomic<std::size_t> m_dequeue;
+      };
+
+    } // namespace detail
+
+    //=========================================================================
+    // class : mpmc_ring
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A bounded lock-free queue for any number of producer and
+    ///        consumer threads, with allocator-provided storage
+    ///
+    /// Every slot carries a sequence number that hands it from producer to
+    /// consumer and back, so each push or pop is one compare-exchange on a
+    /// shared counter plus one release store on the slot. The enqueue and
+    /// dequeue counters are kept on separate cache lines, so producers and
+    /// consumers do not invalidate each other's counter.
+    ///
+    /// Pushes fail rather than overwrite when the ring is full, and pops
+    /// fail when it is empty. \c size and \c empty are only a snapshot when
+    /// other threads are using the ring.
+    ///
+    /// \tparam T the underlying type; it must be nothrow move constructible
+    ///         and move assignable, since \c try_pop is \c noexcept
+    /// \tparam Allocator the allocator type
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T, typename Allocator=std::allocator<T>>
+    class mpmc_ring
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type      = T;
+      using reference       = T&;
+      using const_reference = const T&;
+      using size_type       = std::size_t;
+      using difference_type = std::ptrdiff_t;
+      using allocator_type  = Allocator;
+
+      //-----------------------------------------------------------------------
+      // Constructor / Destructor
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a ring that holds at least \p capacity entries
+      ///
+      /// The capacity is rounded up to a power of two, so that positions
+      /// map to slots with a mask, and to at least 2, since a single slot
+      /// cannot tell a full ring from an empty one
+      ///
+      /// \throws std::length_error if \p capacity is larger than the largest
+      ///         power of two that \c size_type can hold
+      ///
+      /// \param capacity the minimum number of entries
+      /// \param alloc the allocator
+      explicit mpmc_ring( size_type capacity,
+                          const Allocator& alloc = Allocator() );
+
+      mpmc_ring( const mpmc_ring& ) = delete;
+      mpmc_ring( mpmc_ring&& ) = delete;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Destructs this ring, destructing all remaining entries
+      ~mpmc_ring();
+
+      //-----------------------------------------------------------------------
+
+      mpmc_ring& operator=( const mpmc_ring& ) = delete;
+      mpmc_ring& operator=( mpmc_ring&& ) = delete;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Invokes \p T's constructor with the given \p args at the
+      ///        back of the ring, if it is not full
+      ///
+      /// If the constructor may throw, the entry is constructed before a
+      /// slot is claimed, and then moved into it
+      ///
+      /// \param args the arguments to forward to T
+      /// \return \c true if the entry was added
+      template<typename...Args,
+               typename=std::enable_if_t<std::is_constructible<T,Args...>::value>>
+      bool try_emplace( Args&&...args );
+
+      /// \brief Copies \p value to the back of the ring, if it is not full
+      ///
+      /// \param value the value to copy
+      /// \return \c true if the entry was added
+      bool try_push( const T& value );
+
+      /// \brief Moves \p value to the back of the ring, if it is not full
+      ///
+      /// \param value the value to move
+      /// \return \c true if the entry was added
+      bool try_push( T&& value );
+
+      /// \brief Moves the entry at the front of the ring into \p value and
+      ///        removes it, if the ring is not empty
+      ///
+      /// \param value the value to assign to
+      /// \return \c true if an entry was removed
+      bool try_pop( T& value ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Capacity
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns whether this ring is empty
+      ///
+      /// \return \c true if the ring is empty
+      bool empty() const noexcept;
+
+      /// \brief Returns the number of entries in this ring
+      ///
+      /// \return the number of entries
+      size_type size() const noexcept;
+
+      /// \brief Returns the capacity of this ring
+      ///
+      /// \return the number of entries this ring can contain
+      size_type capacity() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the allocator
+      ///
+      /// \return the allocator
+      allocator_type get_allocator() const;
+
+      //-----------------------------------------------------------------------
+      // Private Member Types
+      //-----------------------------------------------------------------------
+    private:
+
+      using core_type      = detail::mpmc_ring_core<T>;
+      using slot_type      = typename core_type::slot_type;
+      using slot_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<slot_type>;
+
+      //-----------------------------------------------------------------------
+      // Private Constructor
+      //-----------------------------------------------------------------------
+    private:
+
+      mpmc_ring( slot_allocator alloc, size_type capacity );
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      core_type      m_core;
+      slot_allocator m_allocator;
+    };
+
+    //=========================================================================
+    // class : mpmc_ring_array
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A bounded lock-free queue for any number of producer and
+    ///        consumer threads, that stores its \p N entries inline
+    ///
+    /// This is the array counterpart of mpmc_ring, as ring_array is to
+    /// ring_deque.
+    ///
+    /// \tparam T the underlying type; it must be nothrow move constructible
+    ///         and move assignable, since \c try_pop is \c noexcept
+    /// \tparam N the number of entries; it must be a power of two, and at
+    ///         least 2
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T, std::size_t N>
+    class mpmc_ring_array
+    {
+      static_assert( N >= 2 && (N & (N - 1)) == 0,
+                     "The capacity of an mpmc_ring_array must be a power of two, "
+                     "and at least 2" );
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type      = T;
+      using reference       = T&;
+      using const_reference = const T&;
+      using size_type       = std::size_t;
+      using difference_type = std::ptrdiff_t;
+
+      //-----------------------------------------------------------------------
+      // Constructor / Destructor
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty ring
+      mpmc_ring_array() noexcept;
+
+      mpmc_ring_array( const mpmc_ring_array& ) = delete;
+      mpmc_ring_array( mpmc_ring_array&& ) = delete;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Destructs this ring, destructing all remaining entries
+      ~mpmc_ring_array();
+
+      //-----------------------------------------------------------------------
+
+      mpmc_ring_array& operator=( const mpmc_ring_array& ) = delete;
+      mpmc_ring_array& operator=( mpmc_ring_array&& ) = delete;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \copydoc mpmc_ring::try_emplace
+      template<typename...Args,
+               typename=std::enable_if_t<std::is_constructible<T,Args...>::value>>
+      bool try_emplace( Args&&...args );
+
+      /// \copydoc mpmc_ring::try_push( const T& )
+      bool try_push( const T& value );
+
+      /// \copydoc mpmc_ring::try_push( T&& )
+      bool try_push( T&& value );
+
+      /// \copydoc mpmc_ring::try_pop
+      bool try_pop( T& value ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Capacity
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \copydoc mpmc_ring::empty
+      bool empty() const noexcept;
+
+      /// \copydoc mpmc_ring::size
+      size_type size() const noexcept;
+
+      /// \copydoc mpmc_ring::capacity
+      size_type capacity() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Member Types
+      //-----------------------------------------------------------------------
+    private:
+
+      using core_type = detail::mpmc_ring_core<T>;
+      using slot_type = typename core_type::slot_type;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      slot_type m_slots[N]; ///< The slots; declared first, as m_core initializes them
+      core_type m_core;
+    };
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/mpmc_ring.inl"
+
+#endif /* BIT_CORE_CONTAINERS_MPMC_RING_HPP */
@@ -0,0 +1,253 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a precompiled searcher that finds any of a
+ *        set of patterns in a single pass over a string
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_CONTAINERS_MULTI_SEARCHER_HPP
+#define BIT_CORE_CONTAINERS_MULTI_SEARCHER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "string_view.hpp"         // string_view
+#include "string_span.hpp"         // basic_string_span
+#include "char_set.hpp"            // BIT_CORE_CHAR_SET_SIMD, detail::char_set_has_simd
+#include "../utilities/assert.hpp" // BIT_ASSERT
+
+#include <algorithm>        // std::sort, std::min, std::max
+#include <cstddef>          // std::size_t, std::ptrdiff_t
+#include <cstdint>          // std::uint8_t, std::uint16_t, std::uint32_t
+#include <cstring>          // std::memcmp
+#include <initializer_list> // std::initializer_list
+#include <string>           // std::string, std::char_traits
+#include <utility>          // std::forward
+#include <vector>           // std::vector
+
+namespace bit {
+  namespace core {
+
+    //=========================================================================
+    // class : multi_searcher
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A precompiled search for any of a set of patterns
+    ///
+    /// Construction compiles the patterns once, so that each search is a
+    /// single pass over the haystack, however many patterns there are.
+    ///
+    /// Large sets are searched with an Aho-Corasick automaton, whose states
+    /// are indexed by the classes of bytes that appear in the patterns to
+    /// keep the table small. Sets of up to 16 patterns are instead searched
+    /// Teddy-style: an SSSE3 \c pshufb lookup on the nibbles of the first
+    /// few bytes of each pattern flags the positions where any pattern may
+    /// start, and only those positions are compared. Both engines report
+    /// the same matches.
+    ///
+    /// The patterns are copied, so they need not outlive the searcher. Empty
+    /// patterns never match, consistent with basic_string_view::find.
+    ///////////////////////////////////////////////////////////////////////////
+    class multi_searcher
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using size_type = std::size_t;
+
+      /// \brief A single occurrence of a pattern
+      struct match
+      {
+        size_type position; ///< The position of the first matched character
+        size_type length;   ///< The length of the matched pattern
+        size_type pattern;  ///< The index of the matched pattern
+      };
+
+      //-----------------------------------------------------------------------
+      // Public Members
+      //-----------------------------------------------------------------------
+    public:
+
+      static constexpr size_type npos = static_cast<size_type>(-1);
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a searcher for the patterns in \p patterns
+      ///
+      /// \pre the patterns total fewer than 2^31 / 257 (about 8.3 million)
+      ///      characters, so that every transition fits in 31 bits
+      /// \param patterns the strings to search for
+      multi_searcher( std::initializer_list<string_view> patterns );
+
+      /// \brief Constructs a searcher for the patterns in [first, last)
+      ///
+      /// \pre the patterns total fewer than 2^31 / 257 (about 8.3 million)
+      ///      characters, so that every transition fits in 31 bits
+      /// \param first the first pattern
+      /// \param last one past the last pattern
+      template<typename InputIt>
+      multi_searcher( InputIt first, InputIt last );
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the number of patterns
+      ///
+      /// \return the number of patterns
+      size_type size() const noexcept;
+
+      /// \brief Gets the pattern at index \p n
+      ///
+      /// \param n the index of the pattern
+      /// \return the pattern
+      string_view pattern( size_type n ) const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Operations
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Finds the leftmost match in \p haystack that starts at or
+      ///        after \p pos
+      ///
+      /// When several patterns match at the same position, the one with the
+      /// lowest index is chosen.
+      ///
+      /// \param haystack the string to search
+      /// \param pos position at which to start the search
+      /// \return the match, or a match whose position is \c npos if no
+      ///         pattern occurs
+      match find_first( string_view haystack, size_type pos = 0 ) const noexcept;
+
+      /// \copydoc find_first( string_view, size_type ) const
+      template<std::ptrdiff_t Extent>
+      match find_first( basic_string_span<char,std::char_traits<char>,Extent> haystack,
+                        size_type pos = 0 ) const noexcept;
+
+      /// \brief Calls \p fn with every match in \p haystack, including
+      ///        overlapping ones
+      ///
+      /// The order in which matches are reported is unspecified.
+      ///
+      /// \param haystack the string to search
+      /// \param fn a function called as \c fn(match) for each match
+      template<typename Fn>
+      void find_all( string_view haystack, Fn&& fn ) const;
+
+      /// \copydoc find_all( string_view, Fn&& ) const
+      template<std::ptrdiff_t Extent, typename Fn>
+      void find_all( basic_string_span<char,std::char_traits<char>,Extent> haystack,
+                     Fn&& fn ) const;
+
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Compiles the patterns in m_storage and m_offsets
+      void compile();
+
+      void compile_automaton();
+
+      void compile_teddy();
+
+      /// \brief Gets the length of the pattern at index \p n
+      size_type pattern_size( size_type n ) const noexcept;
+
+      /// \brief Determines whether the pattern at index \p n occurs in the
+      ///        \p size character haystack \p h at \p i
+      bool matches_at( const char* h,
+                       size_type size,
+                       size_type i,
+                       size_type n ) const noexcept;
+
+      /// \brief Determines whether searches use the Teddy engine
+      bool use_teddy() const noexcept;
+
+      /// \brief Calls \p fn with each position in the \p n character
+      ///        haystack \p h, from \p pos on, at which a pattern in the
+      ///        buckets passed with it may start, until \p fn returns true
+      template<typename Fn>
+      void teddy_candidates( const char* h,
+                             size_type n,
+                             size_type pos,
+                             Fn&& fn ) const;
+
+      /// \brief Finds the lowest index of a pattern in \p buckets that
+      ///        occurs in the \p n character haystack \p h at \p i
+      size_type teddy_match( const char* h,
+                             size_type n,
+                             size_type i,
+                             std::uint32_t buckets ) const noexcept;
+
+      match automaton_find_first( string_view haystack,
+                                  size_type pos ) const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      std::string            m_storage;  ///< The patterns, back to back
+      std::vector<size_type> m_offsets;  ///< The start of each pattern, then the end
+      size_type              m_max_size; ///< The length of the longest pattern
+
+      // Aho-Corasick
+
+      std::uint16_t              m_classes[256];  ///< The class of each byte
+      size_type                  m_class_count;   ///< The number of byte classes
+      std::vector<std::uint32_t> m_transitions;   ///< Row offset of each next state, flagged if it has output
+      std::vector<std::uint32_t> m_output_begin;  ///< The first output of each state
+      std::vector<std::uint32_t> m_outputs;       ///< Pattern indices ending at each state
+      std::vector<std::uint32_t> m_dictionary;    ///< The next state with output on the failure path
+
+      // Teddy
+
+      bool          m_teddy;        ///< Whether the pattern set is small enough
+      size_type     m_teddy_width;  ///< The number of leading bytes compared
+      std::uint8_t  m_low[3][16];   ///< Buckets for each low nibble of each byte
+      std::uint8_t  m_high[3][16];  ///< Buckets for each high nibble of each byte
+      std::uint8_t  m_bucket_begin[9];     ///< The first pattern in each bucket
+      std::uint8_t  m_bucket_patterns[16]; ///< Pattern indices grouped by bucket
+    };
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/multi_searcher.inl"
+
+#endif /* BIT_CORE_CONTAINERS_MULTI_SEARCHER_HPP */
@@ -45,6 +45,14 @@
 
 namespace bit {
   namespace core {
+    namespace detail {
+
+      /// \brief The ring_buffer used by a ring_array of \p N entries, which
+      ///        masks its positions when \p N is a power of two
+      template<typename T, std::size_t N>
+      using ring_array_buffer = ring_buffer<T,(N & (N - 1u)) == 0u>;
+
+    } // namespace detail
 
     //////////////////////////////////////////////////////////////////////////
     /// \brief A circular buffer that uses an array for storage
@@ -69,10 +77,10 @@ namespace bit {
       using size_type       = std::size_t;
       using difference_type = std::ptrdiff_t;
 
-      using iterator       = typename ring_buffer<T>::iterator;
-      using const_iterator = typename ring_buffer<T>::const_iterator;
-      using reverse_iterator       = typename ring_buffer<T>::reverse_iterator;
-      using const_reverse_iterator = typename ring_buffer<T>::const_reverse_iterator;
+      using iterator       = typename detail::ring_array_buffer<T,N>::iterator;
+      using const_iterator = typename detail::ring_array_buffer<T,N>::const_iterator;
+      using reverse_iterator       = typename detail::ring_array_buffer<T,N>::reverse_iterator;
+      using const_reverse_iterator = typename detail::ring_array_buffer<T,N>::const_reverse_iterator;
 
       //-----------------------------------------------------------------------
       // Constructors / Assignment
@@ -245,6 +253,18 @@ namespace bit {
       const_reference back() const noexcept;
       /// \}
 
+      /// \{
+      /// \brief Returns a reference to the \p n'th element of this
+      ///        circular_array, counting from the front
+      ///
+      /// \pre \p n is less than \c size()
+      ///
+      /// \param n the index of the element
+      /// \return reference to the element
+      reference operator[]( size_type n ) noexcept;
+      const_reference operator[]( size_type n ) const noexcept;
+      /// \}
+
       //-----------------------------------------------------------------------
       // Iterators
       //-----------------------------------------------------------------------
@@ -300,8 +320,8 @@ namespace bit {
       //-----------------------------------------------------------------------
     private:
 
-      ring_buffer<T> m_buffer;  ///< The circular buffer
-      storage_type       m_storage; ///< The storage
+      detail::ring_array_buffer<T,N> m_buffer; ///< The circular buffer
+      storage_type                   m_storage; ///< The storage
     };
 
     //-------------------------------------------------------------------------
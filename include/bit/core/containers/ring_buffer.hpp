@@ -37,12 +37,19 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include "span.hpp" // span
 #include "../utilities/uninitialized_storage.hpp" // destroy_at
 #include "../utilities/compiler_traits.hpp" // BIT_COMPILER_EXCEPTIONS_ENABLED
+#include "../utilities/assert.hpp" // BIT_ASSERT
+#include "../traits/composition/conjunction.hpp"
+#include "../traits/concepts/is_contiguous_iterator.hpp"
+#include "../traits/concepts/is_input_iterator.hpp"
 
 #include <iterator>    // std::bidirectional_iterator_tag, std::reverse_iterator
-#include <algorithm>   // std::equal, std::lexicographical_compare
+#include <algorithm>   // std::equal, std::lexicographical_compare, std::min
 #include <cstddef>     // std::size_t
+#include <cstring>     // std::memcpy
+#include <memory>      // std::addressof
 #include <type_traits> // std::add_pointer_t, etc
 
 namespace bit {
@@ -82,7 +89,7 @@ namespace bit {
       public:
 
         ring_buffer_iterator( Container& container,
-                              T* ptr,
+                              size_type position,
                               bool compare_twice );
 
         ring_buffer_iterator( const ring_buffer_iterator& other ) noexcept = default;
@@ -119,7 +126,7 @@ namespace bit {
         //---------------------------------------------------------------------
       private:
 
-        value_type* m_ptr;       ///< Pointer to the location in the buffer
+        size_type   m_position;  ///< The position in the buffer
         Container*  m_container; ///< The underlying container
         bool m_compare_twice; ///< Will this iterator be compared twice? (full buffer)
 
@@ -137,6 +144,9 @@ namespace bit {
       bool operator!=( const ring_buffer_iterator<C,T>& lhs,
                        const ring_buffer_iterator<C,T>& rhs ) noexcept;
 
+      template<typename T, typename Allocator>
+      class ring_buffer_storage;
+
     } // namespace detail
 
     //=========================================================================
@@ -152,8 +162,12 @@ namespace bit {
     /// function is invoked prior to construction of the newly added item.
     ///
     /// \tparam T the underlying type of this buffer
+    /// \tparam PowerOfTwo whether the capacity is always a power of two. If
+    ///         so, the head and tail are monotonically increasing counters
+    ///         that are masked to find their entries; the size is their
+    ///         difference, and indexing is branch-free
     ///////////////////////////////////////////////////////////////////////////
-    template<typename T>
+    template<typename T, bool PowerOfTwo = false>
     class ring_buffer
     {
       //-----------------------------------------------------------------------
@@ -189,6 +203,8 @@ namespace bit {
       /// \brief Constructs a circular buffer from an uninitialized buffer
       ///        that holds \p size \p T entries
       ///
+      /// \pre \p size is a power of two, if \p PowerOfTwo is \c true
+      ///
       /// \param buffer a pointer to the buffer
       /// \param size the size of the buffer
       ring_buffer( void* buffer, size_type size ) noexcept;
@@ -291,9 +307,68 @@ namespace bit {
 
       //-----------------------------------------------------------------------
 
+      /// \brief Copies the entries in the range [\p first, \p last) to the
+      ///        end of the buffer, in order
+      ///
+      /// Trivially copyable entries from a contiguous range are copied with
+      /// at most two calls to \c std::memcpy.
+      ///
+      /// \note As with \c push_back, entries at the \c front of the buffer
+      ///       are destructed to make room if the buffer fills, so only the
+      ///       last \c capacity() entries of the range are kept
+      ///
+      /// \param first the start of the range
+      /// \param last the end of the range
+      template<typename InputIt,
+               typename=std::enable_if_t<is_input_iterator<InputIt>::value>>
+      void push_back( InputIt first, InputIt last );
+
+      /// \brief Appends the first \p n free entries to the back of the
+      ///        buffer, after they have been written in place through
+      ///        \c free_array_one() and \c free_array_two()
+      ///
+      /// This allows filling the buffer directly, such as with a scatter
+      /// read like \c readv, without copying through a staging buffer.
+      ///
+      /// \pre \p n is not greater than \c capacity() - \c size()
+      ///
+      /// \param n the number of entries written
+      template<typename U=T,
+               typename=std::enable_if_t<std::is_trivially_copyable<U>::value>>
+      void commit_back( size_type n ) noexcept;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Replaces the entries of this circular_buffer with the
+      ///        entries in the range [\p first, \p last)
+      ///
+      /// \param first the start of the range
+      /// \param last the end of the range
+      template<typename InputIt,
+               typename=std::enable_if_t<is_input_iterator<InputIt>::value>>
+      void assign( InputIt first, InputIt last );
+
+      /// \brief Replaces the entries of this circular_buffer with \p n
+      ///        copies of \p value
+      ///
+      /// \param n the number of copies, which is limited to the capacity
+      /// \param value the value to copy
+      void assign( size_type n, const T& value );
+
+      //-----------------------------------------------------------------------
+
       /// \brief Pops the entry at the front of the circular_buffer
       void pop_front();
 
+      /// \brief Pops \p n entries from the front of the circular_buffer
+      ///
+      /// This is constant time if \p T is trivially destructible
+      ///
+      /// \pre \p n is not greater than \c size()
+      ///
+      /// \param n the number of entries to pop
+      void pop_front( size_type n );
+
       /// \brief Pops the entry at the back of the circular_buffer
       void pop_back();
 
@@ -365,6 +440,64 @@ namespace bit {
 
       //-----------------------------------------------------------------------
 
+      /// \brief Returns a reference to the \p n'th element of this
+      ///        circular_buffer, counting from the front
+      ///
+      /// \pre \p n is less than \c size()
+      ///
+      /// \param n the index of the element
+      /// \return reference to the element
+      reference operator[]( size_type n ) noexcept;
+
+      /// \copydoc operator[]( size_type )
+      const_reference operator[]( size_type n ) const noexcept;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Gets the entries from the front of the circular_buffer up
+      ///        to the back, or to the end of the storage if they wrap
+      ///        around
+      ///
+      /// Together with \c array_two(), this covers every entry in order
+      /// with at most two contiguous ranges, such as for a gather write
+      /// like \c writev
+      ///
+      /// \return the first contiguous range of entries
+      span<T> array_one() noexcept;
+
+      /// \copydoc array_one()
+      span<const T> array_one() const noexcept;
+
+      /// \brief Gets the entries that wrapped around to the start of the
+      ///        storage, following those in \c array_one()
+      ///
+      /// \return the second contiguous range of entries, which is empty if
+      ///         the entries do not wrap around
+      span<T> array_two() noexcept;
+
+      /// \copydoc array_two()
+      span<const T> array_two() const noexcept;
+
+      /// \brief Gets the free storage following the back of the
+      ///        circular_buffer, up to the front or to the end of the
+      ///        storage if it wraps around
+      ///
+      /// Together with \c free_array_two(), this covers every free entry
+      /// with at most two contiguous ranges. Entries written there are
+      /// appended with \c commit_back
+      ///
+      /// \return the first contiguous range of free entries
+      span<T> free_array_one() noexcept;
+
+      /// \brief Gets the free storage that wrapped around to the start of
+      ///        the storage, following that in \c free_array_one()
+      ///
+      /// \return the second contiguous range of free entries, which is
+      ///         empty if the free storage does not wrap around
+      span<T> free_array_two() noexcept;
+
+      //-----------------------------------------------------------------------
+
       /// \brief Gets a pointer to the underlying buffer
       ///
       /// \return the pointer
@@ -430,22 +563,41 @@ namespace bit {
     private:
 
       T* m_buffer;            ///< Pointer to the underlying buffer
-      T* m_begin;             ///< The beginning pointer
-      T* m_end;               ///< The end pointer
+      std::size_t m_head;     ///< The position of the front entry
+      std::size_t m_tail;     ///< The position past the back entry
       std::size_t m_capacity; ///< The size of the buffer
-      std::size_t m_size;     ///< The total entries in the circular_buffer
+      std::size_t m_size;     ///< The total entries (unused if PowerOfTwo)
 
       template<typename,typename> friend class detail::ring_buffer_iterator;
+      template<typename,typename> friend class detail::ring_buffer_storage;
 
       //-----------------------------------------------------------------------
       // Private Member Functions
       //-----------------------------------------------------------------------
     private:
 
-      T*& increment( T*& iter ) noexcept;
-      const T*& increment( const T*& iter ) const noexcept;
-      T*& decrement( T*& iter ) noexcept;
-      const T*& decrement( const T*& iter ) const noexcept;
+      size_type increment( size_type position ) const noexcept;
+      size_type decrement( size_type position ) const noexcept;
+      size_type advance( size_type position, size_type n ) const noexcept;
+      T* entry( size_type position ) const noexcept;
+
+      /// \brief Points this buffer at \p buffer, whose first \p count
+      ///        entries were relocated there from the current storage
+      ///
+      /// Nothing is constructed or destructed; the current storage is
+      /// treated as empty afterwards
+      void rebind( T* buffer, size_type capacity, size_type count ) noexcept;
+
+      /// \brief Gets the number of entries in \c array_one()
+      size_type array_one_size() const noexcept;
+
+      /// \brief Gets the number of entries in \c free_array_one()
+      size_type free_array_one_size() const noexcept;
+
+      template<typename InputIt>
+      void push_back_range( InputIt first, InputIt last, std::false_type );
+      template<typename InputIt>
+      void push_back_range( InputIt first, InputIt last, std::true_type );
     };
 
     //=========================================================================
@@ -456,31 +608,31 @@ namespace bit {
     // Utilities
     //-------------------------------------------------------------------------
 
-    template<typename T>
-    void swap( ring_buffer<T>& lhs, ring_buffer<T>& rhs ) noexcept;
+    template<typename T, bool P>
+    void swap( ring_buffer<T,P>& lhs, ring_buffer<T,P>& rhs ) noexcept;
 
     //-------------------------------------------------------------------------
     // Comparison
     //-------------------------------------------------------------------------
 
-    template<typename T>
-    bool operator==( const ring_buffer<T>& lhs,
-                     const ring_buffer<T>& rhs ) noexcept;
-    template<typename T>
-    bool operator!=( const ring_buffer<T>& lhs,
-                     const ring_buffer<T>& rhs ) noexcept;
-    template<typename T>
-    bool operator<( const ring_buffer<T>& lhs,
-                    const ring_buffer<T>& rhs ) noexcept;
-    template<typename T>
-    bool operator>( const ring_buffer<T>& lhs,
-                    const ring_buffer<T>& rhs ) noexcept;
-    template<typename T>
-    bool operator<=( const ring_buffer<T>& lhs,
-                     const ring_buffer<T>& rhs ) noexcept;
-    template<typename T>
-    bool operator>=( const ring_buffer<T>& lhs,
-                     const ring_buffer<T>& rhs ) noexcept;
+    template<typename T, bool P>
+    bool operator==( const ring_buffer<T,P>& lhs,
+                     const ring_buffer<T,P>& rhs ) noexcept;
+    template<typename T, bool P>
+    bool operator!=( const ring_buffer<T,P>& lhs,
+                     const ring_buffer<T,P>& rhs ) noexcept;
+    template<typename T, bool P>
+    bool operator<( const ring_buffer<T,P>& lhs,
+                    const ring_buffer<T,P>& rhs ) noexcept;
+    template<typename T, bool P>
+    bool operator>( const ring_buffer<T,P>& lhs,
+                    const ring_buffer<T,P>& rhs ) noexcept;
+    template<typename T, bool P>
+    bool operator<=( const ring_buffer<T,P>& lhs,
+                     const ring_buffer<T,P>& rhs ) noexcept;
+    template<typename T, bool P>
+    bool operator>=( const ring_buffer<T,P>& lhs,
+                     const ring_buffer<T,P>& rhs ) noexcept;
 
   } // namespace core
 } // namespace bit
@@ -38,25 +38,62 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "ring_buffer.hpp"
+#include "span.hpp"
+
+#include "../traits/concepts/is_input_iterator.hpp"
 
 #include "detail/ring_buffer_storage.hpp"
 
-#include <algorithm>   // std::equal
+#include <algorithm>   // std::equal, std::max
+#include <iterator>    // std::distance, std::iterator_traits
 #include <memory>      // std::allocator
-#include <type_traits> // std::is_nothrow_copy_constructible
+#include <type_traits> // std::is_same, std::is_base_of
 
 namespace bit {
   namespace core {
 
+    //=========================================================================
+    // Overflow Policies
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A ring_deque overflow policy that destructs the entry at the
+    ///        opposite end to make room when the deque is full
+    ///
+    /// The capacity only changes through an explicit \c resize.
+    ///////////////////////////////////////////////////////////////////////////
+    struct ring_overwrite_policy{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A ring_deque overflow policy that grows the capacity when the
+    ///        deque is full, so that no entry is ever overwritten
+    ///
+    /// The capacity at least doubles each time, so pushes take amortized
+    /// constant time. Entries are relocated into the new allocation with
+    /// \c std::memcpy if they are trivially relocatable.
+    ///////////////////////////////////////////////////////////////////////////
+    struct ring_grow_policy{};
+
+    //=========================================================================
+    // class : ring_deque
+    //=========================================================================
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief A circular buffer with a deque API
     ///
-    /// Memory is allocated up-front from the specified allocator
+    /// Memory is allocated up-front from the specified allocator. With
+    /// \c ring_grow_policy, the memory is reallocated whenever the deque
+    /// fills, which makes this a replacement for \c std::deque as an
+    /// unbounded FIFO that keeps its entries in one allocation.
     ///
     /// \tparam T the underlying type
     /// \tparam Allocator the allocator type
+    /// \tparam OverflowPolicy either \c ring_overwrite_policy or
+    ///         \c ring_grow_policy
     ///////////////////////////////////////////////////////////////////////////
-    template<typename T, typename Allocator=std::allocator<T>>
+    template<typename T,
+             typename Allocator=std::allocator<T>,
+             typename OverflowPolicy=ring_overwrite_policy>
     class ring_deque
     {
       //-----------------------------------------------------------------------
@@ -169,6 +206,52 @@ namespace bit {
       /// \copydoc back()
       const_reference back() const noexcept;
 
+      /// \brief Returns a reference to the \p n'th element of this
+      ///        circular_queue, counting from the front
+      ///
+      /// \pre \p n is less than \c size()
+      ///
+      /// \param n the index of the element
+      /// \return reference to the element
+      reference operator[]( size_type n ) noexcept;
+
+      /// \copydoc operator[]( size_type )
+      const_reference operator[]( size_type n ) const noexcept;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Gets the entries from the front of the circular_queue up
+      ///        to the back, or to the end of the storage if they wrap
+      ///        around
+      ///
+      /// \return the first contiguous range of entries
+      span<T> array_one() noexcept;
+
+      /// \copydoc array_one()
+      span<const T> array_one() const noexcept;
+
+      /// \brief Gets the entries that wrapped around to the start of the
+      ///        storage, following those in \c array_one()
+      ///
+      /// \return the second contiguous range of entries
+      span<T> array_two() noexcept;
+
+      /// \copydoc array_two()
+      span<const T> array_two() const noexcept;
+
+      /// \brief Gets the free storage following the back of the
+      ///        circular_queue, up to the front or to the end of the
+      ///        storage if it wraps around
+      ///
+      /// \return the first contiguous range of free entries
+      span<T> free_array_one() noexcept;
+
+      /// \brief Gets the free storage that wrapped around to the start of
+      ///        the storage, following that in \c free_array_one()
+      ///
+      /// \return the second contiguous range of free entries
+      span<T> free_array_two() noexcept;
+
       //-----------------------------------------------------------------------
       // Capacity
       //-----------------------------------------------------------------------
@@ -191,7 +274,8 @@ namespace bit {
 
       /// \brief Returns the max size of this buffer
       ///
-      /// \note This result is always the same as capacity
+      /// \note This result is always the same as capacity, unless the deque
+      ///       uses \c ring_grow_policy
       /// \return the max number of elements this circular_buffer can contain
       size_type max_size() const noexcept;
 
@@ -207,6 +291,9 @@ namespace bit {
 
       /// \brief Resizes the size of this circular queue to be at least \p n
       ///
+      /// Trivially relocatable entries are copied into the new allocation
+      /// with at most two calls to \c std::memcpy
+      ///
       /// \param n the size to reallocate to
       void resize( size_type n );
 
@@ -214,7 +301,8 @@ namespace bit {
       ///        the result at the end of the buffer
       ///
       /// \note If the buffer is full, this will destruct the entry currently
-      ///       at the \c front of the buffer before construction
+      ///       at the \c front of the buffer before construction, unless
+      ///       the deque uses \c ring_grow_policy
       ///
       /// \param args the arguments to forward to T
       template<typename...Args, typename = std::enable_if_t<std::is_constructible<T,Args...>::value>>
@@ -224,7 +312,8 @@ namespace bit {
       ///        the result at the beginning of the bugger
       ///
       /// \note If the buffer is full, this will destruct the entry currently
-      ///       at the \c end of the buffer before construction
+      ///       at the \c end of the buffer before construction, unless
+      ///       the deque uses \c ring_grow_policy
       ///
       /// \param args the arguments to forward to T
       template<typename...Args, typename = std::enable_if_t<std::is_constructible<T,Args...>::value>>
@@ -236,7 +325,8 @@ namespace bit {
       ///        storing the result at the end of the buffer
       ///
       /// \note If the buffer is full, this will destruct the entry currently
-      ///       at the \c front of the buffer before construction
+      ///       at the \c front of the buffer before construction, unless
+      ///       the deque uses \c ring_grow_policy
       ///
       /// \param value the value to copy
       template<typename U=T,typename = std::enable_if_t<std::is_copy_constructible<U>::value>>
@@ -246,19 +336,69 @@ namespace bit {
       ///        storing the result at the end of the buffer
       ///
       /// \note If the buffer is full, this will destruct the entry currently
-      ///       at the \c front of the buffer before construction
+      ///       at the \c front of the buffer before construction, unless
+      ///       the deque uses \c ring_grow_policy
       ///
       /// \param value the value to move
       template<typename U=T,typename = std::enable_if_t<std::is_move_constructible<U>::value>>
       void push_back( value_type&& value );
 
+      /// \brief Pushes every entry in the range [\p first, \p last) to the
+      ///        end of the buffer
+      ///
+      /// Trivially copyable entries from a contiguous range are copied with
+      /// at most two calls to \c std::memcpy.
+      ///
+      /// \note If the buffer fills, entries at the \c front of the buffer
+      ///       are destructed to make room, unless the deque uses
+      ///       \c ring_grow_policy
+      ///
+      /// \param first the start of the range
+      /// \param last the end of the range
+      template<typename InputIt,
+               typename=std::enable_if_t<is_input_iterator<InputIt>::value>>
+      void push_back( InputIt first, InputIt last );
+
+      /// \brief Appends the first \p n free entries to the back of the
+      ///        buffer, after they have been written in place through
+      ///        \c free_array_one() and \c free_array_two()
+      ///
+      /// \note This never grows the storage, even with \c ring_grow_policy
+      ///
+      /// \pre \p n is not greater than \c capacity() - \c size()
+      ///
+      /// \param n the number of entries written
+      template<typename U=T,
+               typename=std::enable_if_t<std::is_trivially_copyable<U>::value>>
+      void commit_back( size_type n ) noexcept;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Replaces the entries of this circular_queue with the
+      ///        entries in the range [\p first, \p last)
+      ///
+      /// \param first the start of the range
+      /// \param last the end of the range
+      template<typename InputIt,
+               typename=std::enable_if_t<is_input_iterator<InputIt>::value>>
+      void assign( InputIt first, InputIt last );
+
+      /// \brief Replaces the entries of this circular_queue with \p n
+      ///        copies of \p value
+      ///
+      /// \param n the number of copies, which is limited to the capacity
+      ///          unless the deque uses \c ring_grow_policy
+      /// \param value the value to copy
+      void assign( size_type n, const T& value );
+
       //-----------------------------------------------------------------------
 
       /// \brief Constructs a \p T object by calling the copy-constructor, and
       ///        storing the result at the front of the buffer
       ///
       /// \note If the buffer is full, this will destruct the entry currently
-      ///       at the \c back of the buffer before construction
+      ///       at the \c back of the buffer before construction, unless
+      ///       the deque uses \c ring_grow_policy
       ///
       /// \param value the value to copy
       template<typename U=T,typename = std::enable_if_t<std::is_copy_constructible<U>::value>>
@@ -268,7 +408,8 @@ namespace bit {
       ///        storing the result at the end of the buffer
       ///
       /// \note If the buffer is full, this will destruct the entry currently
-      ///       at the \c back of the buffer before construction
+      ///       at the \c back of the buffer before construction, unless
+      ///       the deque uses \c ring_grow_policy
       ///
       /// \param value the value to copy
       template<typename U=T,typename = std::enable_if_t<std::is_move_constructible<U>::value>>
@@ -279,6 +420,13 @@ namespace bit {
       /// \brief Pops the entry at the front of the circular_buffer
       void pop_front();
 
+      /// \brief Pops \p n entries from the front of the circular_buffer
+      ///
+      /// \pre \p n is not greater than \c size()
+      ///
+      /// \param n the number of entries to pop
+      void pop_front( size_type n );
+
       /// \brief Pops the entry at the back of the circular_buffer
       void pop_back();
 
@@ -357,8 +505,27 @@ namespace bit {
 
       storage_type m_storage; ///< The underlying storage
 
-      void resize( std::true_type, size_type n );
-      void resize( std::false_type, size_type n );
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Whether this deque grows, rather than overwrites, when full
+      using grows = std::is_same<OverflowPolicy,ring_grow_policy>;
+
+      /// \brief Grows the capacity geometrically so that \p count more
+      ///        entries fit without overwriting
+      void grow( size_type count );
+
+      template<typename...Args>
+      reference emplace_back( std::false_type, Args&&...args );
+      template<typename...Args>
+      reference emplace_back( std::true_type, Args&&...args );
+
+      template<typename...Args>
+      reference emplace_front( std::false_type, Args&&...args );
+      template<typename...Args>
+      reference emplace_front( std::true_type, Args&&...args );
     };
 
     //-------------------------------------------------------------------------
@@ -369,20 +536,20 @@ namespace bit {
     ///
     /// \param lhs the left deque
     /// \param rhs the right deque
-    template<typename T, typename Allocator>
-    void swap( ring_deque<T,Allocator>& lhs,
-               ring_deque<T,Allocator>& rhs ) noexcept;
+    template<typename T, typename Allocator, typename OverflowPolicy>
+    void swap( ring_deque<T,Allocator,OverflowPolicy>& lhs,
+               ring_deque<T,Allocator,OverflowPolicy>& rhs ) noexcept;
 
     //-------------------------------------------------------------------------
     // Equality
     //-------------------------------------------------------------------------
 
-    template<typename T, typename Allocator>
-    bool operator==( const ring_deque<T,Allocator>& lhs,
-                     const ring_deque<T,Allocator>& rhs ) noexcept;
-    template<typename T, typename Allocator>
-    bool operator!=( const ring_deque<T,Allocator>& lhs,
-                     const ring_deque<T,Allocator>& rhs ) noexcept;
+    template<typename T, typename Allocator, typename OverflowPolicy>
+    bool operator==( const ring_deque<T,Allocator,OverflowPolicy>& lhs,
+                     const ring_deque<T,Allocator,OverflowPolicy>& rhs ) noexcept;
+    template<typename T, typename Allocator, typename OverflowPolicy>
+    bool operator!=( const ring_deque<T,Allocator,OverflowPolicy>& lhs,
+                     const ring_deque<T,Allocator,OverflowPolicy>& rhs ) noexcept;
 
   } // namespace core
 } // namespace bit
@@ -248,7 +248,10 @@ namespace bit {
       template<typename U>
       using enable_if_container_t = std::enable_if_t<
         is_contiguous_container<std::decay_t<U>>::value &&
-        !is_same_decay<std::decay_t<U>,span>::value
+        !is_same_decay<std::decay_t<U>,span>::value &&
+        detail::is_allowed_element_type_conversion<
+          std::remove_pointer_t<decltype(std::declval<U&>().data())>, T
+        >::value
       >;
 
       /// \brief Constructs a span containing 0 entries
@@ -298,7 +301,7 @@ namespace bit {
                typename = enable_if_container_t<ContiguousContainer>>
       constexpr /* IMPLICIT */ span( ContiguousContainer& container ) noexcept;
       template<typename ContiguousContainer,
-        typename = enable_if_container_t<ContiguousContainer>>
+        typename = enable_if_container_t<const ContiguousContainer>>
       constexpr /* IMPLICIT */ span( const ContiguousContainer& container ) noexcept;
 
       //-----------------------------------------------------------------------
@@ -0,0 +1,251 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a lock-free ring buffer for handing values
+ *        from one producer thread to one consumer thread
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_CONTAINERS_SPSC_RING_HPP
+#define BIT_CORE_CONTAINERS_SPSC_RING_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/scope_guard.hpp"           // on_scope_exit
+#include "../utilities/uninitialized_storage.hpp" // destroy_at
+
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t
+#include <new>         // placement new
+#include <type_traits> // std::enable_if_t, std::is_constructible
+#include <utility>     // std::forward, std::move
+
+namespace bit {
+  namespace core {
+
+    //=========================================================================
+    // class : spsc_ring
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A lock-free, non-owning ring buffer shared by exactly one
+    ///        producer thread and one consumer thread
+    ///
+    /// Like ring_buffer, this wraps caller-provided uninitialized memory for
+    /// \c size entries. Unlike ring_buffer, a push never overwrites: it fails
+    /// when the ring is full.
+    ///
+    /// The producer owns the tail index and the consumer owns the head
+    /// index; each is published with a release store and read with an
+    /// acquire load, and they live on separate cache lines. Each side also
+    /// keeps its own copy of the other side's index, and only reloads it
+    /// when that copy says the ring is full (or empty), so in the steady
+    /// state a push or pop touches no cache line written by the other
+    /// thread other than the entry itself.
+    ///
+    /// The indices run over [0, 2 * capacity), which tells a full ring from
+    /// an empty one without a spare entry and without division.
+    ///
+    /// The producer functions (the \c try_push and \c try_emplace overloads)
+    /// may only be called from one thread at a time, and likewise the
+    /// consumer functions (the \c try_pop overloads). \c size and \c empty
+    /// may be called from either, but are only a snapshot.
+    ///
+    /// \tparam T the underlying type of this ring
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class spsc_ring
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type      = T;
+      using reference       = T&;
+      using const_reference = const T&;
+      using pointer         = T*;
+      using const_pointer   = const T*;
+
+      using size_type       = std::size_t;
+      using difference_type = std::ptrdiff_t;
+
+      //-----------------------------------------------------------------------
+      // Constructor / Destructor
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a ring from an uninitialized buffer that holds
+      ///        \p size \p T entries
+      ///
+      /// \param buffer a pointer to the buffer
+      /// \param size the size of the buffer
+      spsc_ring( void* buffer, size_type size ) noexcept;
+
+      // Deleted copy and move constructors
+      spsc_ring( const spsc_ring& ) = delete;
+      spsc_ring( spsc_ring&& ) = delete;
+
+      //-----------------------------------------------------------------------
+
+      /// \brief Destructs this ring, destructing all remaining entries
+      ///
+      /// \note Neither thread may be using the ring at this point
+      ~spsc_ring();
+
+      //-----------------------------------------------------------------------
+
+      spsc_ring& operator=( const spsc_ring& ) = delete;
+      spsc_ring& operator=( spsc_ring&& ) = delete;
+
+      //-----------------------------------------------------------------------
+      // Producer
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Invokes \p T's constructor with the given \p args at the
+      ///        back of the ring, if it is not full
+      ///
+      /// \param args the arguments to forward to T
+      /// \return \c true if the entry was added
+      template<typename...Args,
+               typename=std::enable_if_t<std::is_constructible<T,Args...>::value>>
+      bool try_emplace( Args&&...args );
+
+      /// \brief Copies \p value to the back of the ring, if it is not full
+      ///
+      /// \param value the value to copy
+      /// \return \c true if the entry was added
+      bool try_push( const T& value );
+
+      /// \brief Moves \p value to the back of the ring, if it is not full
+      ///
+      /// \param value the value to move
+      /// \return \c true if the entry was added
+      bool try_push( T&& value );
+
+      /// \brief Copies up to \p count values from \p first to the back of the
+      ///        ring, publishing them all at once
+      ///
+      /// \param first the iterator to the first value
+      /// \param count the number of values available from \p first
+      /// \return the number of values added, which is less than \p count only
+      ///         if the ring became full
+      template<typename InputIt>
+      size_type try_push( InputIt first, size_type count );
+
+      //-----------------------------------------------------------------------
+      // Consumer
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Moves the entry at the front of the ring into \p value and
+      ///        removes it, if the ring is not empty
+      ///
+      /// \param value the value to assign to
+      /// \return \c true if an entry was removed
+      bool try_pop( T& value );
+
+      /// \brief Moves up to \p count entries from the front of the ring to
+      ///        \p out and removes them, releasing their space all at once
+      ///
+      /// \param out the iterator to assign the entries to
+      /// \param count the maximum number of entries to remove
+      /// \return the number of entries removed
+      template<typename OutputIt>
+      size_type try_pop( OutputIt out, size_type count );
+
+      //-----------------------------------------------------------------------
+      // Capacity
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns whether this ring is empty
+      ///
+      /// \return \c true if the ring is empty
+      bool empty() const noexcept;
+
+      /// \brief Returns the number of entries in this ring
+      ///
+      /// \return the number of entries
+      size_type size() const noexcept;
+
+      /// \brief Returns the capacity of this ring
+      ///
+      /// \return the number of entries this ring can contain
+      size_type capacity() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Gets the number of entries from index \p head to index \p tail
+      size_type distance( size_type head, size_type tail ) const noexcept;
+
+      /// \brief Gets the index \p n entries past \p index
+      size_type advance( size_type index, size_type n ) const noexcept;
+
+      /// \brief Gets the entry at index \p index
+      T* entry( size_type index ) const noexcept;
+
+      /// \brief Gets the number of entries the producer may add, reloading
+      ///        the head index if fewer than \p wanted appear free
+      size_type free_entries( size_type tail, size_type wanted ) noexcept;
+
+      /// \brief Gets the number of entries the consumer may remove,
+      ///        reloading the tail index if fewer than \p wanted appear used
+      size_type used_entries( size_type head, size_type wanted ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      static constexpr std::size_t cache_line_size = 64u;
+
+      // Read by both threads, but never written after construction
+      alignas(cache_line_size) T* m_buffer;
+      std::size_t m_capacity;
+
+      // Written by the producer
+      alignas(cache_line_size) std::atomic<std::size_t> m_tail;
+      std::size_t m_cached_head; ///< The producer's copy of m_head
+
+      // Written by the consumer
+      alignas(cache_line_size) std::atomic<std::size_t> m_head;
+      std::size_t m_cached_tail; ///< The consumer's copy of m_tail
+    };
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/spsc_ring.inl"
+
+#endif /* BIT_CORE_CONTAINERS_SPSC_RING_HPP */
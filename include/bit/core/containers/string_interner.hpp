@@ -0,0 +1,592 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a pool that stores each distinct string once,
+ *        and hands out handles that compare by address
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_CONTAINERS_STRING_INTERNER_HPP
+#define BIT_CORE_CONTAINERS_STRING_INTERNER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "string_view.hpp"           // basic_string_view
+#include "string_span.hpp"           // basic_string_span
+#include "../utilities/hash.hpp"     // hash_t
+#include "../utilities/optional.hpp" // optional
+
+#include <climits> // CHAR_BIT
+#include <cstddef> // std::size_t, std::max_align_t
+#include <memory>  // std::allocator, std::allocator_traits
+#include <mutex>   // std::mutex, std::lock_guard
+#include <new>     // placement new
+#include <string>  // std::char_traits
+#include <utility> // std::index_sequence
+
+namespace bit {
+  namespace core {
+
+    //=========================================================================
+    // class : detail::interned_entry
+    //=========================================================================
+
+    namespace detail {
+
+      /////////////////////////////////////////////////////////////////////////
+      /// \brief The record of one interned string, stored in the arena of
+      ///        the interner just ahead of its characters
+      /////////////////////////////////////////////////////////////////////////
+      template<typename CharT>
+      struct interned_entry
+      {
+        hash_t       hash; ///< The hash of the string
+        std::size_t  size; ///< The number of characters in the string
+        const CharT* data; ///< The null-terminated characters
+      };
+
+      /// \brief The entry shared by every empty interned string, so that
+      ///        default-constructed handles need no interner
+      template<typename CharT, typename Traits>
+      struct interned_empty
+      {
+        static constexpr CharT terminator = CharT();
+        static constexpr interned_entry<CharT> value = {
+          hash_value( basic_string_view<CharT,Traits>() ), 0u, &terminator
+        };
+      };
+
+    } // namespace detail
+
+    //=========================================================================
+    // class : basic_interned_string
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A handle to a string stored in a basic_string_interner
+    ///
+    /// A handle is a single pointer. Since an interner stores each distinct
+    /// string once, two handles from the same interner are equal exactly
+    /// when their strings are, so equality is an address comparison, and
+    /// the hash is computed once on interning and only loaded afterwards.
+    ///
+    /// A handle stays valid for as long as the interner that produced it.
+    /// A default-constructed handle refers to the empty string, and compares
+    /// equal to the empty string interned by any interner.
+    ///
+    /// \tparam CharT the character type
+    /// \tparam Traits the character traits
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename CharT, typename Traits = std::char_traits<CharT>>
+    class basic_interned_string
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using char_type   = CharT;
+      using traits_type = Traits;
+      using size_type   = std::size_t;
+      using view_type   = basic_string_view<CharT,Traits>;
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a handle to the empty string
+      basic_interned_string() noexcept;
+
+      basic_interned_string( const basic_interned_string& other ) noexcept = default;
+
+      //-----------------------------------------------------------------------
+
+      basic_interned_string& operator=( const basic_interned_string& other ) noexcept = default;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the characters of the string
+      ///
+      /// \return pointer to the null-terminated characters
+      const char_type* data() const noexcept;
+
+      /// \brief Gets the characters of the string
+      ///
+      /// \return pointer to the null-terminated characters
+      const char_type* c_str() const noexcept;
+
+      /// \brief Gets the number of characters in the string
+      ///
+      /// \return the number of characters
+      size_type size() const noexcept;
+
+      /// \copydoc size()
+      size_type length() const noexcept;
+
+      /// \brief Determines whether the string is empty
+      ///
+      /// \return \c true if the string has no characters
+      bool empty() const noexcept;
+
+      /// \brief Gets the hash of the string, which is the same as
+      ///        \c hash_value of its view
+      ///
+      /// \return the hash of the string
+      hash_t hash() const noexcept;
+
+      /// \brief Gets a view of the string
+      ///
+      /// \return the view
+      view_type view() const noexcept;
+
+      /// \copydoc view()
+      operator view_type() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Member Types
+      //-----------------------------------------------------------------------
+    private:
+
+      using entry_type = detail::interned_entry<CharT>;
+
+      //-----------------------------------------------------------------------
+      // Private Constructors
+      //-----------------------------------------------------------------------
+    private:
+
+      explicit basic_interned_string( const entry_type* entry ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      const entry_type* m_entry; ///< The entry in the interner's arena
+
+      template<typename, typename, typename> friend class basic_string_interner;
+      template<typename, typename, typename> friend class basic_concurrent_string_interner;
+
+      template<typename C, typename T>
+      friend bool operator==( const basic_interned_string<C,T>& lhs,
+                              const basic_interned_string<C,T>& rhs ) noexcept;
+    };
+
+    //-------------------------------------------------------------------------
+    // Comparisons
+    //-------------------------------------------------------------------------
+
+    template<typename CharT, typename Traits>
+    bool operator==( const basic_interned_string<CharT,Traits>& lhs,
+                     const basic_interned_string<CharT,Traits>& rhs ) noexcept;
+    template<typename CharT, typename Traits>
+    bool operator!=( const basic_interned_string<CharT,Traits>& lhs,
+                     const basic_interned_string<CharT,Traits>& rhs ) noexcept;
+
+    //-------------------------------------------------------------------------
+    // Hashing
+    //-------------------------------------------------------------------------
+
+    /// \brief Retrieves the cached hash of an interned string
+    ///
+    /// \param str the interned string
+    /// \return the hash of the string
+    template<typename CharT, typename Traits>
+    hash_t hash_value( const basic_interned_string<CharT,Traits>& str ) noexcept;
+
+    //-------------------------------------------------------------------------
+    // Type Aliases
+    //-------------------------------------------------------------------------
+
+    using interned_string     = basic_interned_string<char>;
+    using winterned_string    = basic_interned_string<wchar_t>;
+    using u16interned_string  = basic_interned_string<char16_t>;
+    using u32interned_string  = basic_interned_string<char32_t>;
+
+    //=========================================================================
+    // class : basic_string_interner
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A pool that stores each distinct string once
+    ///
+    /// Strings are copied into a bump arena together with their hash, and
+    /// found again through an open-addressing table of (hash, entry) slots,
+    /// so a lookup only touches the arena when the hashes already match.
+    /// Arena blocks double in size up to 1 MiB, so that millions of short
+    /// strings cost a few allocations rather than one each. Strings are
+    /// never removed; memory is released when the interner is destroyed.
+    ///
+    /// The interner is not synchronized; see
+    /// basic_concurrent_string_interner for sharing one between threads.
+    ///
+    /// \tparam CharT the character type
+    /// \tparam Traits the character traits
+    /// \tparam Allocator the allocator used for the arena and the table
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename CharT,
+             typename Traits = std::char_traits<CharT>,
+             typename Allocator = std::allocator<CharT>>
+    class basic_string_interner
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using char_type      = CharT;
+      using traits_type    = Traits;
+      using allocator_type = Allocator;
+      using size_type      = std::size_t;
+      using view_type      = basic_string_view<CharT,Traits>;
+      using handle_type    = basic_interned_string<CharT,Traits>;
+
+      //-----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty interner
+      basic_string_interner();
+
+      /// \brief Constructs an empty interner that allocates with \p alloc
+      ///
+      /// \param alloc the allocator
+      explicit basic_string_interner( const Allocator& alloc );
+
+      /// \brief Moves the strings of \p other into this interner
+      ///
+      /// Handles from \p other remain valid, and refer to this interner
+      ///
+      /// \param other the interner to move
+      basic_string_interner( basic_string_interner&& other ) noexcept;
+
+      basic_string_interner( const basic_string_interner& ) = delete;
+
+      //-----------------------------------------------------------------------
+
+      ~basic_string_interner();
+
+      //-----------------------------------------------------------------------
+
+      basic_string_interner& operator=( const basic_string_interner& ) = delete;
+      basic_string_interner& operator=( basic_string_interner&& ) = delete;
+
+      //-----------------------------------------------------------------------
+      // Capacity
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the number of distinct strings
+      ///
+      /// The empty string is never stored, so it is not counted
+      ///
+      /// \return the number of strings
+      size_type size() const noexcept;
+
+      /// \brief Determines whether no strings have been interned
+      ///
+      /// \return \c true if the interner is empty
+      bool empty() const noexcept;
+
+      /// \brief Gets the number of bytes allocated for the arena and the
+      ///        table
+      ///
+      /// \return the number of bytes
+      size_type memory_usage() const noexcept;
+
+      /// \brief Grows the table so that \p n strings fit without rehashing
+      ///
+      /// \param n the number of strings
+      void reserve( size_type n );
+
+      //-----------------------------------------------------------------------
+      // Interning
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the handle for \p str, copying it into the interner if
+      ///        it is not yet present
+      ///
+      /// \param str the string
+      /// \return the handle
+      handle_type intern( view_type str );
+
+      /// \copydoc intern( view_type )
+      template<std::ptrdiff_t Extent>
+      handle_type intern( basic_string_span<CharT,Traits,Extent> str );
+
+      /// \brief Gets the handle for \p str if it has been interned
+      ///
+      /// \param str the string
+      /// \return the handle, or \c nullopt if \p str is not present
+      optional<handle_type> find( view_type str ) const noexcept;
+
+      /// \brief Determines whether \p str has been interned
+      ///
+      /// \param str the string
+      /// \return \c true if \p str is present
+      bool contains( view_type str ) const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the allocator
+      ///
+      /// \return the allocator
+      allocator_type get_allocator() const;
+
+      //-----------------------------------------------------------------------
+      // Private Member Types
+      //-----------------------------------------------------------------------
+    private:
+
+      using entry_type = detail::interned_entry<CharT>;
+
+      /// \brief A slot of the table; empty slots have a null entry
+      struct slot
+      {
+        hash_t            hash;
+        const entry_type* entry;
+      };
+
+      /// \brief The header of an arena block, followed by its memory
+      struct block
+      {
+        block*    next;
+        size_type units;
+      };
+
+      using unit_type      = std::max_align_t;
+      using unit_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<unit_type>;
+      using slot_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<slot>;
+
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Finds the entry for \p str, whose hash is \p hash
+      const entry_type* find_entry( view_type str, hash_t hash ) const noexcept;
+
+      /// \brief Interns \p str, whose hash is \p hash
+      handle_type intern( view_type str, hash_t hash );
+
+      /// \brief Copies \p str into the arena
+      const entry_type* make_entry( view_type str, hash_t hash );
+
+      /// \brief Allocates \p bytes bytes from the arena, suitably aligned
+      ///        for an entry
+      void* allocate( size_type bytes );
+
+      /// \brief Moves every slot into a table of \p capacity slots
+      void rehash( size_type capacity );
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      Allocator      m_allocator;
+      slot*          m_slots;       ///< The table; its capacity is 0 or a power of 2
+      size_type      m_capacity;    ///< The number of slots
+      size_type      m_size;        ///< The number of occupied slots
+      block*         m_blocks;      ///< The most recent arena block
+      unsigned char* m_cursor;      ///< The next free byte of the block
+      unsigned char* m_limit;       ///< The end of the block
+      size_type      m_arena_units; ///< The total units of every block
+
+      template<typename, typename, typename> friend class basic_concurrent_string_interner;
+    };
+
+    //-------------------------------------------------------------------------
+    // Type Aliases
+    //-------------------------------------------------------------------------
+
+    using string_interner    = basic_string_interner<char>;
+    using wstring_interner   = basic_string_interner<wchar_t>;
+    using u16string_interner = basic_string_interner<char16_t>;
+    using u32string_interner = basic_string_interner<char32_t>;
+
+    //=========================================================================
+    // class : basic_concurrent_string_interner
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A basic_string_interner that may be shared between threads
+    ///
+    /// Strings are spread over 16 shards by the high bits of their hash, and
+    /// each shard is an interner behind its own mutex, so threads interning
+    /// different strings seldom wait on each other. A string always lands in
+    /// the same shard, so its handles still compare by address.
+    ///
+    /// \tparam CharT the character type
+    /// \tparam Traits the character traits
+    /// \tparam Allocator the allocator used for the arenas and the tables
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename CharT,
+             typename Traits = std::char_traits<CharT>,
+             typename Allocator = std::allocator<CharT>>
+    class basic_concurrent_string_interner
+    {
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using char_type      = CharT;
+      using traits_type    = Traits;
+      using allocator_type = Allocator;
+      using size_type      = std::size_t;
+      using view_type      = basic_string_view<CharT,Traits>;
+      using handle_type    = basic_interned_string<CharT,Traits>;
+
+      //-----------------------------------------------------------------------
+      // Public Members
+      //-----------------------------------------------------------------------
+    public:
+
+      static constexpr size_type shard_count = 16u;
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty interner
+      basic_concurrent_string_interner();
+
+      /// \brief Constructs an empty interner that allocates with \p alloc
+      ///
+      /// \param alloc the allocator
+      explicit basic_concurrent_string_interner( const Allocator& alloc );
+
+      basic_concurrent_string_interner( const basic_concurrent_string_interner& ) = delete;
+      basic_concurrent_string_interner( basic_concurrent_string_interner&& ) = delete;
+
+      //-----------------------------------------------------------------------
+
+      basic_concurrent_string_interner& operator=( const basic_concurrent_string_interner& ) = delete;
+      basic_concurrent_string_interner& operator=( basic_concurrent_string_interner&& ) = delete;
+
+      //-----------------------------------------------------------------------
+      // Capacity
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the number of distinct strings
+      ///
+      /// The count is taken one shard at a time, so it is only exact when
+      /// no other thread is interning
+      ///
+      /// \return the number of strings
+      size_type size() const;
+
+      /// \brief Gets the number of bytes allocated for the arenas and the
+      ///        tables
+      ///
+      /// \return the number of bytes
+      size_type memory_usage() const;
+
+      //-----------------------------------------------------------------------
+      // Interning
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \copydoc basic_string_interner::intern( view_type )
+      handle_type intern( view_type str );
+
+      /// \copydoc basic_string_interner::intern( view_type )
+      template<std::ptrdiff_t Extent>
+      handle_type intern( basic_string_span<CharT,Traits,Extent> str );
+
+      /// \copydoc basic_string_interner::find( view_type ) const
+      optional<handle_type> find( view_type str ) const;
+
+      /// \copydoc basic_string_interner::contains( view_type ) const
+      bool contains( view_type str ) const;
+
+      //-----------------------------------------------------------------------
+      // Private Member Types
+      //-----------------------------------------------------------------------
+    private:
+
+      struct shard
+      {
+        shard( const Allocator& alloc );
+
+        std::mutex mutex;
+        basic_string_interner<CharT,Traits,Allocator> interner;
+      };
+
+      //-----------------------------------------------------------------------
+      // Private Constructors
+      //-----------------------------------------------------------------------
+    private:
+
+      template<std::size_t...Idxs>
+      basic_concurrent_string_interner( const Allocator& alloc,
+                                        std::index_sequence<Idxs...> );
+
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Gets the shard that holds strings whose hash is \p hash
+      shard& shard_for( hash_t hash ) const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      mutable shard m_shards[shard_count];
+    };
+
+    //-------------------------------------------------------------------------
+    // Type Aliases
+    //-------------------------------------------------------------------------
+
+    using concurrent_string_interner    = basic_concurrent_string_interner<char>;
+    using concurrent_wstring_interner   = basic_concurrent_string_interner<wchar_t>;
+    using concurrent_u16string_interner = basic_concurrent_string_interner<char16_t>;
+    using concurrent_u32string_interner = basic_concurrent_string_interner<char32_t>;
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/string_interner.inl"
+
+#endif /* BIT_CORE_CONTAINERS_STRING_INTERNER_HPP */
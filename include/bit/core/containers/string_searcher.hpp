@@ -0,0 +1,248 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains precompiled searchers, which find one needle
+ *        in many strings without repeating any per-needle setup
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_CONTAINERS_STRING_SEARCHER_HPP
+#define BIT_CORE_CONTAINERS_STRING_SEARCHER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "string_view.hpp"          // basic_string_view
+#include "string_span.hpp"          // basic_string_span
+#include "detail/string_search.hpp" // detail::two_way_factorization
+
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <cstring>     // std::memchr
+#include <string>      // std::char_traits
+#include <type_traits> // std::is_same
+
+namespace bit {
+  namespace core {
+
+    //=========================================================================
+    // class : basic_boyer_moore_horspool_searcher
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A precompiled search for a single needle, using the
+    ///        Boyer-Moore-Horspool algorithm
+    ///
+    /// Construction builds a table of how far the needle may shift past each
+    /// character, so every search costs only its scan. Shifts of up to the
+    /// length of the needle make this a good fit for long needles drawn from
+    /// a large alphabet.
+    ///
+    /// The searcher refers to the needle without copying it, so the needle
+    /// must outlive the searcher.
+    ///
+    /// \tparam CharT the character type
+    /// \tparam Traits the character traits, which must compare characters
+    ///         exactly
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename CharT, typename Traits>
+    class basic_boyer_moore_horspool_searcher
+    {
+      static_assert( std::is_same<Traits,std::char_traits<CharT>>::value,
+                     "basic_boyer_moore_horspool_searcher requires exact character comparison" );
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type  = CharT;
+      using traits_type = Traits;
+      using size_type   = std::size_t;
+
+      //-----------------------------------------------------------------------
+      // Public Members
+      //-----------------------------------------------------------------------
+    public:
+
+      static constexpr size_type npos = static_cast<size_type>(-1);
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a searcher for \p needle
+      ///
+      /// \param needle the string to search for
+      explicit basic_boyer_moore_horspool_searcher( basic_string_view<CharT,Traits> needle ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the string this searcher searches for
+      ///
+      /// \return the needle
+      basic_string_view<CharT,Traits> needle() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Operations
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Finds the first occurrence of the needle in \p haystack,
+      ///        starting at position \p pos
+      ///
+      /// \param haystack the string to search
+      /// \param pos position at which to start the search
+      /// \return Position of the first character of the found substring, or
+      ///         \c npos if the needle is empty or not found
+      size_type operator()( basic_string_view<CharT,Traits> haystack,
+                            size_type pos = 0 ) const noexcept;
+
+      /// \copydoc operator()( basic_string_view<CharT,Traits>, size_type ) const
+      template<std::ptrdiff_t Extent>
+      size_type operator()( basic_string_span<CharT,Traits,Extent> haystack,
+                            size_type pos = 0 ) const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      basic_string_view<CharT,Traits> m_needle; ///< The string to search for
+      size_type m_skip[256]; ///< The shift for each last character, by low byte
+    };
+
+    using boyer_moore_horspool_searcher    = basic_boyer_moore_horspool_searcher<char>;
+    using wboyer_moore_horspool_searcher   = basic_boyer_moore_horspool_searcher<wchar_t>;
+    using u16boyer_moore_horspool_searcher = basic_boyer_moore_horspool_searcher<char16_t>;
+    using u32boyer_moore_horspool_searcher = basic_boyer_moore_horspool_searcher<char32_t>;
+
+    //=========================================================================
+    // class : basic_simd_searcher
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A precompiled search for a single needle, using a SIMD filter
+    ///        on two characters of the needle
+    ///
+    /// This is the search used by basic_string_view::find, with its setup
+    /// moved to construction: the filter compares the two needle characters
+    /// that are expected to be rarest in text, rather than the first and
+    /// last, and the Two-Way factorization used for inputs that defeat the
+    /// filter is computed up front.
+    ///
+    /// The searcher refers to the needle without copying it, so the needle
+    /// must outlive the searcher.
+    ///
+    /// \tparam CharT the character type, which must be byte-sized
+    /// \tparam Traits the character traits, which must compare characters
+    ///         exactly
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename CharT, typename Traits>
+    class basic_simd_searcher
+    {
+      static_assert( detail::is_byte_searchable<CharT,Traits>::value,
+                     "basic_simd_searcher requires byte-sized characters compared exactly" );
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using value_type  = CharT;
+      using traits_type = Traits;
+      using size_type   = std::size_t;
+
+      //-----------------------------------------------------------------------
+      // Public Members
+      //-----------------------------------------------------------------------
+    public:
+
+      static constexpr size_type npos = static_cast<size_type>(-1);
+
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a searcher for \p needle
+      ///
+      /// \param needle the string to search for
+      explicit basic_simd_searcher( basic_string_view<CharT,Traits> needle ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the string this searcher searches for
+      ///
+      /// \return the needle
+      basic_string_view<CharT,Traits> needle() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Operations
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Finds the first occurrence of the needle in \p haystack,
+      ///        starting at position \p pos
+      ///
+      /// \param haystack the string to search
+      /// \param pos position at which to start the search
+      /// \return Position of the first character of the found substring, or
+      ///         \c npos if the needle is empty or not found
+      size_type operator()( basic_string_view<CharT,Traits> haystack,
+                            size_type pos = 0 ) const noexcept;
+
+      /// \copydoc operator()( basic_string_view<CharT,Traits>, size_type ) const
+      template<std::ptrdiff_t Extent>
+      size_type operator()( basic_string_span<CharT,Traits,Extent> haystack,
+                            size_type pos = 0 ) const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      basic_string_view<CharT,Traits> m_needle;        ///< The string to search for
+      detail::string_search_probes    m_probes;        ///< The characters to filter on
+      detail::two_way_factorization   m_factorization; ///< The fallback for periodic input
+    };
+
+    using simd_searcher = basic_simd_searcher<char>;
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/string_searcher.inl"
+
+#endif /* BIT_CORE_CONTAINERS_STRING_SEARCHER_HPP */
@@ -38,9 +38,11 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "string.hpp"
+#include "char_set.hpp"                     // char_set
 #include "../utilities/compiler_traits.hpp"
 #include "../utilities/hash.hpp"            // hash_t
 #include "../iterators/tagged_iterator.hpp" // tagged_iterator
+#include "detail/string_search.hpp"         // detail::string_search_find
 
 #include <algorithm>
 #include <string>
@@ -51,6 +53,27 @@
 namespace bit {
   namespace core {
 
+    template<typename CharT, typename Traits = std::char_traits<CharT>>
+    class basic_boyer_moore_horspool_searcher;
+
+    template<typename CharT, typename Traits = std::char_traits<CharT>>
+    class basic_simd_searcher;
+
+    namespace detail {
+
+      /// \brief Determines whether \p Searcher is a precompiled searcher for
+      ///        basic_string_view<CharT,Traits>
+      ///
+      /// This only names the searcher types, so that checking it does not
+      /// instantiate a searcher the view's characters cannot support
+      template<typename Searcher, typename CharT, typename Traits>
+      struct is_string_searcher
+        : std::integral_constant<bool,
+            std::is_same<Searcher,basic_boyer_moore_horspool_searcher<CharT,Traits>>::value ||
+            std::is_same<Searcher,basic_simd_searcher<CharT,Traits>>::value>{};
+
+    } // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     /// \brief A wrapper around non-owned strings.
     ///
@@ -364,15 +387,32 @@ namespace bit {
       ///         \c npos if no such substring is found
       constexpr size_type find( const value_type* s, size_type pos = 0 ) const;
 
+      /// \brief Finds the first occurrence of a precompiled needle
+      ///
+      /// Equivalent to \code searcher(*this, pos) \endcode
+      ///
+      /// This only participates in overload resolution for searchers of this
+      /// view's character type and traits
+      ///
+      /// \tparam Searcher either basic_boyer_moore_horspool_searcher or
+      ///         basic_simd_searcher
+      /// \param searcher the searcher for the needle to search for
+      /// \param pos      position at which to start the search
+      /// \return Position of the first character of the found substring, or
+      ///         \c npos if no such substring is found
+      template<typename Searcher,
+               typename = std::enable_if_t<detail::is_string_searcher<Searcher,CharT,Traits>::value>>
+      size_type find( const Searcher& searcher, size_type pos = 0 ) const noexcept;
+
       //-----------------------------------------------------------------------
 
       /// \brief Finds the last substring equal to the given character sequence
       ///
-      /// Finds the last occurence of \p v in this view, starting at position
-      /// \p pos
+      /// Finds the last occurence of \p v in this view that starts at or
+      /// before position \p pos
       ///
       /// \param v   view to search for
-      /// \param pos position at which to start the search
+      /// \param pos the last position at which a match may start
       /// \return Position of the first character of the found substring or
       ///         \c npos if no such substring is found
       constexpr size_type rfind( basic_string_view v, size_type pos = npos ) const;
@@ -456,16 +496,28 @@ namespace bit {
       ///         or \c npos if no such character is found.
       constexpr size_type find_first_of( const value_type* s, size_type pos = 0 ) const;
 
+      /// \brief Finds the first character that is in \p set
+      ///
+      /// The set is built once and may be reused across searches. This
+      /// overload is only available for byte-sized characters, which are
+      /// compared exactly.
+      ///
+      /// \param set the set of characters to search for
+      /// \param pos position at which to start the search
+      /// \return Position of the first character in \p set, or \c npos if no such
+      ///         character is found
+      constexpr size_type find_first_of( const char_set& set, size_type pos = 0 ) const noexcept;
+
       //-----------------------------------------------------------------------
 
       /// \brief Finds the last character equal to any of the characters in the
       ///        given character sequence
       ///
       /// Finds the last occurence of any of the characters of \p v in this view,
-      /// starting at position \p pos
+      /// at or before position \p pos
       ///
       /// \param v   view to search for
-      /// \param pos position at which to start the search
+      /// \param pos the last position to consider
       /// \return Position of the last occurrence of any character of the substring,
       ///         or \c npos if no such character is found.
       constexpr size_type find_last_of( basic_string_view v, size_type pos = npos ) const;
@@ -505,6 +557,18 @@ namespace bit {
       ///         or \c npos if no such character is found.
       constexpr size_type find_last_of( const value_type* s, size_type pos = npos ) const;
 
+      /// \brief Finds the last character that is in \p set
+      ///
+      /// The set is built once and may be reused across searches. This
+      /// overload is only available for byte-sized characters, which are
+      /// compared exactly.
+      ///
+      /// \param set the set of characters to search for
+      /// \param pos position at which to start the search
+      /// \return Position of the last character in \p set, or \c npos if no such
+      ///         character is found
+      constexpr size_type find_last_of( const char_set& set, size_type pos = npos ) const noexcept;
+
       //-----------------------------------------------------------------------
 
       /// \brief Finds the first character not equal to any of the characters in
@@ -553,16 +617,28 @@ namespace bit {
       ///         in the given string, or npos if no such character is found
       constexpr size_type find_first_not_of( const value_type* s, size_type pos = 0 ) const;
 
+      /// \brief Finds the first character that is not in \p set
+      ///
+      /// The set is built once and may be reused across searches. This
+      /// overload is only available for byte-sized characters, which are
+      /// compared exactly.
+      ///
+      /// \param set the set of characters to search for
+      /// \param pos position at which to start the search
+      /// \return Position of the first character not in \p set, or \c npos if no such
+      ///         character is found
+      constexpr size_type find_first_not_of( const char_set& set, size_type pos = 0 ) const noexcept;
+
       //-----------------------------------------------------------------------
 
       /// \brief Finds the last character not equal to any of the characters in
       ///        the given character sequence
       ///
       /// Finds the last character not equal to any of the characters of \p v
-      /// in this view, starting at position \p pos
+      /// in this view, at or before position \p pos
       ///
       /// \param v   view to search for
-      /// \param pos position at which to start the search
+      /// \param pos the last position to consider
       /// \return Position of the last character not equal to any of the characters
       ///         in the given string, or npos if no such character is found
       constexpr size_type find_last_not_of( basic_string_view v, size_type pos = npos ) const;
@@ -601,6 +677,18 @@ namespace bit {
       ///         in the given string, or npos if no such character is found
       constexpr size_type find_last_not_of( const value_type* s, size_type pos = npos ) const;
 
+      /// \brief Finds the last character that is not in \p set
+      ///
+      /// The set is built once and may be reused across searches. This
+      /// overload is only available for byte-sized characters, which are
+      /// compared exactly.
+      ///
+      /// \param set the set of characters to search for
+      /// \param pos position at which to start the search
+      /// \return Position of the last character not in \p set, or \c npos if no such
+      ///         character is found
+      constexpr size_type find_last_not_of( const char_set& set, size_type pos = npos ) const noexcept;
+
       //-----------------------------------------------------------------------
       // Iterators
       //-----------------------------------------------------------------------
@@ -783,6 +871,18 @@ namespace bit {
     constexpr hash_t hash_value( const basic_string_view<CharT,Traits>& str )
       noexcept;
 
+    /// \brief Retrieves the hash from a given case-insensitive
+    ///        basic_string_view
+    ///
+    /// Views that compare equal hash equally, whatever the case of their
+    /// ASCII letters.
+    ///
+    /// \param str the basic_string_view to retrieve the hash from
+    /// \return the hash of the string
+    template<typename CharT>
+    constexpr hash_t hash_value( const basic_string_view<CharT,insensitive_char_traits<CharT>>& str )
+      noexcept;
+
     //-------------------------------------------------------------------------
     // Public Functions
     //-------------------------------------------------------------------------
@@ -0,0 +1,185 @@
+#ifndef BIT_CORE_ITERATORS_DETAIL_SPLIT_ITERATOR_INL
+#define BIT_CORE_ITERATORS_DETAIL_SPLIT_ITERATOR_INL
+
+namespace bit { namespace core { namespace detail {
+
+  /// \brief The position and length of a delimiter found in a string
+  struct split_delimiter_match
+  {
+    std::size_t position;
+    std::size_t length;
+  };
+
+  template<typename CharT, typename Traits>
+  inline constexpr split_delimiter_match
+    split_find( basic_string_view<CharT,Traits> str, std::size_t pos, CharT delimiter )
+    noexcept
+  {
+    return { str.find( delimiter, pos ), 1u };
+  }
+
+  template<typename CharT, typename Traits>
+  inline constexpr split_delimiter_match
+    split_find( basic_string_view<CharT,Traits> str,
+                std::size_t pos,
+                basic_string_view<CharT,Traits> delimiter )
+    noexcept
+  {
+    // An empty delimiter would match everywhere without making progress
+    if( delimiter.empty() ) {
+      return { basic_string_view<CharT,Traits>::npos, 0u };
+    }
+    return { str.find( delimiter, pos ), delimiter.size() };
+  }
+
+  template<typename Traits>
+  inline constexpr split_delimiter_match
+    split_find( basic_string_view<char,Traits> str,
+                std::size_t pos,
+                const char_set& delimiter )
+    noexcept
+  {
+    return { str.find_first_of( delimiter, pos ), 1u };
+  }
+
+} } } // namespace bit::core::detail
+
+//============================================================================
+// split_iterator
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Delimiter>
+inline constexpr bit::core::split_iterator<CharT,Traits,Delimiter>::split_iterator()
+  noexcept
+  : m_str{},
+    m_delimiter{},
+    m_piece{},
+    m_next{value_type::npos},
+    m_splits{0},
+    m_skip_empty{false},
+    m_done{true}
+{
+
+}
+
+template<typename CharT, typename Traits, typename Delimiter>
+inline constexpr bit::core::split_iterator<CharT,Traits,Delimiter>
+  ::split_iterator( value_type str, Delimiter delimiter, split_options options )
+  noexcept
+  : m_str{str},
+    m_delimiter{delimiter},
+    m_piece{},
+    m_next{0},
+    m_splits{options.max_splits},
+    m_skip_empty{options.skip_empty},
+    m_done{false}
+{
+  advance();
+}
+
+//----------------------------------------------------------------------------
+// Iteration
+//----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Delimiter>
+inline constexpr bit::core::split_iterator<CharT,Traits,Delimiter>&
+  bit::core::split_iterator<CharT,Traits,Delimiter>::operator++()
+  noexcept
+{
+  advance();
+  return (*this);
+}
+
+template<typename CharT, typename Traits, typename Delimiter>
+inline constexpr bit::core::split_iterator<CharT,Traits,Delimiter>
+  bit::core::split_iterator<CharT,Traits,Delimiter>::operator++(int)
+  noexcept
+{
+  auto result = (*this);
+  ++(*this);
+
+  return result;
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Delimiter>
+inline constexpr typename bit::core::split_iterator<CharT,Traits,Delimiter>::reference
+  bit::core::split_iterator<CharT,Traits,Delimiter>::operator*()
+  const noexcept
+{
+  return m_piece;
+}
+
+template<typename CharT, typename Traits, typename Delimiter>
+inline constexpr typename bit::core::split_iterator<CharT,Traits,Delimiter>::pointer
+  bit::core::split_iterator<CharT,Traits,Delimiter>::operator->()
+  const noexcept
+{
+  return &m_piece;
+}
+
+//----------------------------------------------------------------------------
+// Comparison
+//----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Delimiter>
+inline constexpr bool
+  bit::core::split_iterator<CharT,Traits,Delimiter>::operator==( const split_iterator& rhs )
+  const noexcept
+{
+  if( m_done || rhs.m_done ) {
+    return m_done == rhs.m_done;
+  }
+  return m_piece.data() == rhs.m_piece.data() &&
+         m_piece.size() == rhs.m_piece.size() &&
+         m_next == rhs.m_next;
+}
+
+template<typename CharT, typename Traits, typename Delimiter>
+inline constexpr bool
+  bit::core::split_iterator<CharT,Traits,Delimiter>::operator!=( const split_iterator& rhs )
+  const noexcept
+{
+  return !(*this == rhs);
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename CharT, typename Traits, typename Delimiter>
+inline constexpr void bit::core::split_iterator<CharT,Traits,Delimiter>::advance()
+  noexcept
+{
+  constexpr auto npos = value_type::npos;
+
+  while( m_next != npos ) {
+    const auto start = m_next;
+    const auto match = (m_splits == 0u)
+                     ? detail::split_delimiter_match{ npos, 0u }
+                     : detail::split_find( m_str, start, m_delimiter );
+
+    if( match.position == npos ) {
+      m_piece = value_type{ m_str.data() + start, m_str.size() - start };
+      m_next  = npos;
+    } else {
+      m_piece = value_type{ m_str.data() + start, match.position - start };
+      m_next  = match.position + match.length;
+    }
+
+    if( !(m_skip_empty && m_piece.empty()) ) {
+      if( match.position != npos ) --m_splits;
+      return;
+    }
+  }
+  m_done = true;
+}
+
+#endif /* BIT_CORE_ITERATORS_DETAIL_SPLIT_ITERATOR_INL */
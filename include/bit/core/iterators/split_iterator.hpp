@@ -0,0 +1,174 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains an iterator over the pieces of a string
+ *        between delimiters
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_ITERATORS_SPLIT_ITERATOR_HPP
+#define BIT_CORE_ITERATORS_SPLIT_ITERATOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../containers/string_view.hpp" // basic_string_view
+#include "../containers/char_set.hpp"    // char_set
+
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#include <iterator> // std::forward_iterator_tag
+
+namespace bit {
+  namespace core {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Options that control how a string is split
+    //////////////////////////////////////////////////////////////////////////
+    struct split_options
+    {
+      /// The most pieces to end at a delimiter; the piece after the last
+      /// such split holds the rest of the string. Splits that end a skipped
+      /// empty piece are not counted.
+      std::size_t max_splits = static_cast<std::size_t>(-1);
+
+      /// Whether to skip pieces that are empty
+      bool skip_empty = false;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief An iterator over the pieces of a string between delimiters
+    ///
+    /// Each piece is a view into the original string, so nothing is copied
+    /// or allocated. Delimiters are found with the vectorized searches of
+    /// basic_string_view: a single character, a substring, or any character
+    /// of a char_set.
+    ///
+    /// A string with no delimiters is a single piece, and an empty string is
+    /// a single empty piece. A default-constructed iterator is the end of
+    /// every split.
+    ///
+    /// \tparam CharT the character type
+    /// \tparam Traits the character traits
+    /// \tparam Delimiter the delimiter type; one of \c CharT,
+    ///         \c basic_string_view<CharT,Traits>, or \c char_set
+    //////////////////////////////////////////////////////////////////////////
+    template<typename CharT, typename Traits, typename Delimiter>
+    class split_iterator
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using iterator_category = std::forward_iterator_tag;
+      using value_type        = basic_string_view<CharT,Traits>;
+      using reference         = const value_type&;
+      using pointer           = const value_type*;
+      using difference_type   = std::ptrdiff_t;
+      using size_type         = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an iterator past the last piece of any split
+      constexpr split_iterator() noexcept;
+
+      /// \brief Constructs an iterator to the first piece of \p str
+      ///
+      /// \param str the string to split
+      /// \param delimiter the delimiter to split at
+      /// \param options the options for the split
+      constexpr split_iterator( value_type str,
+                                Delimiter delimiter,
+                                split_options options ) noexcept;
+
+      /// \brief Copy constructs a split_iterator from another iterator
+      ///
+      /// \param other the other iterator to copy
+      constexpr split_iterator( const split_iterator& other ) = default;
+
+      /// \brief Copy assigns a split_iterator from another iterator
+      ///
+      /// \param other the other iterator to copy
+      /// \return reference to \c (*this)
+      split_iterator& operator=( const split_iterator& other ) = default;
+
+      //----------------------------------------------------------------------
+      // Iteration
+      //----------------------------------------------------------------------
+    public:
+
+      constexpr split_iterator& operator++() noexcept;
+      constexpr split_iterator operator++(int) noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      constexpr reference operator*() const noexcept;
+      constexpr pointer operator->() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Comparison
+      //----------------------------------------------------------------------
+    public:
+
+      constexpr bool operator==( const split_iterator& rhs ) const noexcept;
+      constexpr bool operator!=( const split_iterator& rhs ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Moves to the next piece that is not skipped
+      constexpr void advance() noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      value_type m_str;        ///< The string being split
+      Delimiter  m_delimiter;  ///< The delimiter to split at
+      value_type m_piece;      ///< The current piece
+      size_type  m_next;       ///< The start of the next piece, or npos
+      size_type  m_splits;     ///< The splits that remain
+      bool       m_skip_empty; ///< Whether empty pieces are skipped
+      bool       m_done;       ///< Whether this is past the last piece
+    };
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/split_iterator.inl"
+
+#endif /* BIT_CORE_ITERATORS_SPLIT_ITERATOR_HPP */
@@ -38,6 +38,8 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include "../traits/concepts/is_contiguous_iterator.hpp"
+
 #include <memory> // std::pointer_traits
 #include <iterator> // std::random_access_iterator_tag
 
@@ -171,6 +173,15 @@ namespace bit {
       operator-( const tagged_iterator<Iterator,U>& lhs,
                  typename tagged_iterator<Iterator,U>::difference_type rhs ) noexcept;
 
+    //-------------------------------------------------------------------------
+    // Traits
+    //-------------------------------------------------------------------------
+
+    /// \brief A tagged_iterator is contiguous if the iterator it wraps is
+    template<typename Iterator, typename U>
+    struct is_contiguous_iterator<tagged_iterator<Iterator,U>>
+      : is_contiguous_iterator<Iterator>{};
+
   } // namespace core
 } // namespace bit
 
@@ -0,0 +1,50 @@
+#ifndef BIT_CORE_RANGES_DETAIL_SPLIT_RANGE_INL
+#define BIT_CORE_RANGES_DETAIL_SPLIT_RANGE_INL
+
+template<typename CharT, typename Traits>
+inline constexpr bit::core::split_range<CharT,Traits,CharT>
+  bit::core::split( basic_string_view<CharT,Traits> str,
+                    CharT delimiter,
+                    split_options options )
+  noexcept
+{
+  using iterator = split_iterator<CharT,Traits,CharT>;
+
+  return { iterator{ str, delimiter, options }, iterator{} };
+}
+
+template<typename CharT, typename Traits>
+inline constexpr bit::core::split_range<CharT,Traits,bit::core::basic_string_view<CharT,Traits>>
+  bit::core::split( basic_string_view<CharT,Traits> str,
+                    basic_string_view<CharT,Traits> delimiter,
+                    split_options options )
+  noexcept
+{
+  using iterator = split_iterator<CharT,Traits,basic_string_view<CharT,Traits>>;
+
+  return { iterator{ str, delimiter, options }, iterator{} };
+}
+
+template<typename CharT, typename Traits>
+inline constexpr bit::core::split_range<CharT,Traits,bit::core::basic_string_view<CharT,Traits>>
+  bit::core::split( basic_string_view<CharT,Traits> str,
+                    const CharT* delimiter,
+                    split_options options )
+  noexcept
+{
+  return split( str, basic_string_view<CharT,Traits>{ delimiter }, options );
+}
+
+template<typename Traits>
+inline constexpr bit::core::split_range<char,Traits,bit::core::char_set>
+  bit::core::split( basic_string_view<char,Traits> str,
+                    const char_set& delimiters,
+                    split_options options )
+  noexcept
+{
+  using iterator = split_iterator<char,Traits,char_set>;
+
+  return { iterator{ str, delimiters, options }, iterator{} };
+}
+
+#endif /* BIT_CORE_RANGES_DETAIL_SPLIT_RANGE_INL */
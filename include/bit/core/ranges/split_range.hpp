@@ -0,0 +1,110 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a lazy range over the pieces of a string
+ *        between delimiters
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_RANGES_SPLIT_RANGE_HPP
+#define BIT_CORE_RANGES_SPLIT_RANGE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "range.hpp"                        // range
+#include "../iterators/split_iterator.hpp"  // split_iterator, split_options
+#include "../containers/string_view.hpp"    // basic_string_view
+#include "../containers/char_set.hpp"       // char_set
+
+namespace bit {
+  namespace core {
+
+    template<typename CharT, typename Traits, typename Delimiter>
+    using split_range = range<split_iterator<CharT,Traits,Delimiter>>;
+
+    //-------------------------------------------------------------------------
+
+    /// \brief Lazily splits \p str at each occurrence of \p delimiter
+    ///
+    /// The pieces are views into \p str, and are only found as the range is
+    /// iterated.
+    ///
+    /// \code
+    /// for( auto field : bit::core::split( line, ',' ) ) { ... }
+    /// \endcode
+    ///
+    /// \param str the string to split
+    /// \param delimiter the character to split at
+    /// \param options the options for the split
+    /// \return the range of pieces
+    template<typename CharT, typename Traits>
+    constexpr split_range<CharT,Traits,CharT>
+      split( basic_string_view<CharT,Traits> str,
+             CharT delimiter,
+             split_options options = {} ) noexcept;
+
+    /// \brief Lazily splits \p str at each occurrence of \p delimiter
+    ///
+    /// An empty \p delimiter never matches, so \p str is a single piece.
+    ///
+    /// \param str the string to split
+    /// \param delimiter the substring to split at
+    /// \param options the options for the split
+    /// \return the range of pieces
+    template<typename CharT, typename Traits>
+    constexpr split_range<CharT,Traits,basic_string_view<CharT,Traits>>
+      split( basic_string_view<CharT,Traits> str,
+             basic_string_view<CharT,Traits> delimiter,
+             split_options options = {} ) noexcept;
+
+    /// \copydoc split( basic_string_view<CharT,Traits>, basic_string_view<CharT,Traits>, split_options )
+    template<typename CharT, typename Traits>
+    constexpr split_range<CharT,Traits,basic_string_view<CharT,Traits>>
+      split( basic_string_view<CharT,Traits> str,
+             const CharT* delimiter,
+             split_options options = {} ) noexcept;
+
+    /// \brief Lazily splits \p str at each character in \p delimiters
+    ///
+    /// \param str the string to split
+    /// \param delimiters the set of characters to split at
+    /// \param options the options for the split
+    /// \return the range of pieces
+    template<typename Traits>
+    constexpr split_range<char,Traits,char_set>
+      split( basic_string_view<char,Traits> str,
+             const char_set& delimiters,
+             split_options options = {} ) noexcept;
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/split_range.inl"
+
+#endif /* BIT_CORE_RANGES_SPLIT_RANGE_HPP */
@@ -0,0 +1,118 @@
+/*****************************************************************************
+ * \file
+ * \brief This header defines a type trait for detecting iterators over
+ *        contiguous storage
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_TRAITS_CONCEPTS_CONTIGUOUS_ITERATOR_HPP
+#define BIT_CORE_TRAITS_CONCEPTS_CONTIGUOUS_ITERATOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../composition/bool_constant.hpp"
+#include "../composition/conjunction.hpp"
+#include "../composition/disjunction.hpp"
+
+#include <type_traits> // std::is_pointer, std::is_same, std::is_object
+#include <iterator>    // std::iterator_traits
+#include <vector>      // std::vector
+#include <string>      // std::basic_string
+
+namespace bit {
+  namespace core {
+    namespace detail {
+
+      template<typename It, typename T, typename = void>
+      struct is_vector_iterator : false_type{};
+
+      // std::vector<bool> is not contiguous
+      template<typename It, typename T>
+      struct is_vector_iterator<It,T,std::enable_if_t<std::is_object<T>::value &&
+                                                      !std::is_same<T,bool>::value>>
+        : disjunction<std::is_same<It,typename std::vector<T>::iterator>,
+                      std::is_same<It,typename std::vector<T>::const_iterator>>{};
+
+      template<typename It, typename T>
+      struct is_string_iterator
+        : disjunction<std::is_same<It,typename std::basic_string<T>::iterator>,
+                      std::is_same<It,typename std::basic_string<T>::const_iterator>>{};
+
+      template<typename It, typename T>
+      struct is_contiguous_iterator_impl : is_vector_iterator<It,T>{};
+
+      template<typename It>
+      struct is_contiguous_iterator_impl<It,char>
+        : disjunction<is_vector_iterator<It,char>,is_string_iterator<It,char>>{};
+      template<typename It>
+      struct is_contiguous_iterator_impl<It,wchar_t>
+        : disjunction<is_vector_iterator<It,wchar_t>,is_string_iterator<It,wchar_t>>{};
+      template<typename It>
+      struct is_contiguous_iterator_impl<It,char16_t>
+        : disjunction<is_vector_iterator<It,char16_t>,is_string_iterator<It,char16_t>>{};
+      template<typename It>
+      struct is_contiguous_iterator_impl<It,char32_t>
+        : disjunction<is_vector_iterator<It,char32_t>,is_string_iterator<It,char32_t>>{};
+
+    } // namespace detail
+
+    /// \brief Type trait to determine if a given type is an iterator whose
+    ///        elements are stored contiguously in memory
+    ///
+    /// This is \c true for pointers, and for the iterators of
+    /// \c std::vector and \c std::basic_string. Other iterator types may
+    /// opt-in by specializing this trait.
+    ///
+    /// The result is aliased as \c ::value
+    template<typename T>
+    struct is_contiguous_iterator
+      : detail::is_contiguous_iterator_impl<
+          T,
+          typename std::iterator_traits<T>::value_type
+        >{};
+
+    template<typename T>
+    struct is_contiguous_iterator<T*> : std::is_object<T>{};
+
+    /// \brief Helper utility to extract is_contiguous_iterator::value
+    template<typename T>
+    constexpr bool is_contiguous_iterator_v = is_contiguous_iterator<T>::value;
+
+    /// \brief Type trait to determine if a series of \c Types are all
+    ///        contiguous iterators
+    ///
+    /// \The result is stored in \c ::value
+    template<typename...Types>
+    struct are_contiguous_iterators : conjunction<is_contiguous_iterator<Types>...>{};
+
+  } // namespace core
+} // namespace bit
+
+#endif /* BIT_CORE_TRAITS_CONCEPTS_CONTIGUOUS_ITERATOR_HPP */
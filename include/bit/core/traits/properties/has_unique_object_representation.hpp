@@ -0,0 +1,104 @@
+/*****************************************************************************
+ * \file
+ * \brief This header defines a type trait for checking whether equal values
+ *        of a type always share the same object representation
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_TRAITS_PROPERTIES_HAS_UNIQUE_OBJECT_REPRESENTATION_HPP
+#define BIT_CORE_TRAITS_PROPERTIES_HAS_UNIQUE_OBJECT_REPRESENTATION_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../composition/bool_constant.hpp"
+#include "../composition/conjunction.hpp"
+#include "../composition/disjunction.hpp"
+
+#include <type_traits> // std::is_integral, std::is_enum, std::is_pointer
+
+namespace bit {
+  namespace core {
+
+    /// \brief Type trait for determining if two objects of type \p T compare
+    ///        equal if and only if their bytes are identical
+    ///
+    /// Ranges of such types may be hashed as a single block of memory. This
+    /// is \c true for integral, enum, and pointer types. Floating-point types
+    /// are excluded, since \c 0.0 and \c -0.0 compare equal.
+    ///
+    /// Unlike \c std::has_unique_object_representations, this is never
+    /// deduced for class types: a class without padding may still define an
+    /// equality that ignores some of its members. Such types may opt-in by
+    /// specializing this trait, provided that their \c hash_value is
+    /// consistent with their equality.
+    ///
+    /// The result is aliased as \c ::value
+    template<typename T>
+    struct has_unique_object_representation
+      : disjunction<std::is_integral<T>,
+                    std::is_enum<T>,
+                    std::is_pointer<T>>{};
+
+    template<typename T>
+    struct has_unique_object_representation<const T>
+      : has_unique_object_representation<T>{};
+
+    template<typename T>
+    struct has_unique_object_representation<volatile T>
+      : has_unique_object_representation<T>{};
+
+    template<typename T>
+    struct has_unique_object_representation<const volatile T>
+      : has_unique_object_representation<T>{};
+
+    /// \brief Helper utility to extract has_unique_object_representation::value
+    template<typename T>
+    constexpr bool has_unique_object_representation_v
+      = has_unique_object_representation<T>::value;
+
+    //-------------------------------------------------------------------------
+
+    /// \brief Type trait for determining if a set of types all have unique
+    ///        object representations
+    ///
+    /// The result is aliased as \c ::value
+    template<typename...Ts>
+    struct have_unique_object_representations
+      : conjunction<has_unique_object_representation<Ts>...>{};
+
+    /// \brief Helper utility to extract have_unique_object_representations::value
+    template<typename...Ts>
+    constexpr bool have_unique_object_representations_v
+      = have_unique_object_representations<Ts...>::value;
+
+  } // namespace core
+} // namespace bit
+
+#endif /* BIT_CORE_TRAITS_PROPERTIES_HAS_UNIQUE_OBJECT_REPRESENTATION_HPP */
@@ -0,0 +1,84 @@
+/*****************************************************************************
+ * \file
+ * \brief This header defines a type trait for checking whether objects of a
+ *        type may be relocated by copying their bytes
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_TRAITS_PROPERTIES_IS_TRIVIALLY_RELOCATABLE_HPP
+#define BIT_CORE_TRAITS_PROPERTIES_IS_TRIVIALLY_RELOCATABLE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <type_traits> // std::is_trivially_copyable
+
+namespace bit {
+  namespace core {
+
+    /// \brief Type trait for determining if moving an object of type \p T to
+    ///        new storage, and destructing the original, is equivalent to
+    ///        copying its bytes
+    ///
+    /// Containers may relocate ranges of such types with \c std::memcpy
+    /// rather than moving and destructing each entry. This is \c true for
+    /// trivially copyable types.
+    ///
+    /// Many class types that own their resources through a pointer, such as
+    /// \c std::unique_ptr, are also trivially relocatable but cannot be
+    /// detected as such. Being \c nothrow move constructible is not enough:
+    /// a type may hold a pointer into itself. Such types may opt-in by
+    /// specializing this trait.
+    ///
+    /// The result is aliased as \c ::value
+    template<typename T>
+    struct is_trivially_relocatable
+      : std::is_trivially_copyable<T>{};
+
+    template<typename T>
+    struct is_trivially_relocatable<const T>
+      : is_trivially_relocatable<T>{};
+
+    template<typename T>
+    struct is_trivially_relocatable<volatile T>
+      : is_trivially_relocatable<T>{};
+
+    template<typename T>
+    struct is_trivially_relocatable<const volatile T>
+      : is_trivially_relocatable<T>{};
+
+    /// \brief Helper utility to extract is_trivially_relocatable::value
+    template<typename T>
+    constexpr bool is_trivially_relocatable_v
+      = is_trivially_relocatable<T>::value;
+
+  } // namespace core
+} // namespace bit
+
+#endif /* BIT_CORE_TRAITS_PROPERTIES_IS_TRIVIALLY_RELOCATABLE_HPP */
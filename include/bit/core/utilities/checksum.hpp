@@ -0,0 +1,169 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains the CRC32C checksum, for detecting corruption
+ *        of stored or transmitted data
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_UTILITIES_CHECKSUM_HPP
+#define BIT_CORE_UTILITIES_CHECKSUM_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../containers/span.hpp" // span
+#include "byte.hpp"               // byte
+#include "compiler_traits.hpp"    // BIT_PROCESSOR_X86, BIT_PLATFORM_HAS_SSE4_2
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <cstring> // std::memcpy
+
+//! \def BIT_CORE_CRC32C_HARDWARE
+//!
+//! \brief Defined as 1 if the SSE4.2 \c crc32 instruction is always used
+//!        for CRC32C, as 2 if it is used only after detecting support at
+//!        runtime, and left undefined if it is never used
+#if defined(BIT_PROCESSOR_X86_64) || defined(BIT_PROCESSOR_X86)
+# if defined(BIT_PLATFORM_HAS_SSE4_2)
+#   define BIT_CORE_CRC32C_HARDWARE 1
+# elif defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+#   define BIT_CORE_CRC32C_HARDWARE 2
+# endif
+#endif
+
+#if defined(BIT_CORE_CRC32C_HARDWARE)
+# include <nmmintrin.h> // _mm_crc32_u8, _mm_crc32_u32, _mm_crc32_u64
+# if defined(_MSC_VER)
+#   include <intrin.h>  // __cpuid
+# endif
+#endif
+
+namespace bit {
+  namespace core {
+
+    //=========================================================================
+    // CRC32C
+    //=========================================================================
+
+    /// \brief Computes the CRC32C (Castagnoli) checksum of \p bytes
+    ///
+    /// This uses the SSE4.2 \c crc32 instruction when the processor supports
+    /// it, and a slicing-by-8 table lookup otherwise; both produce the same
+    /// result.
+    ///
+    /// \param bytes the bytes to checksum
+    /// \return the checksum
+    std::uint32_t crc32c( span<const byte> bytes ) noexcept;
+
+    /// \brief Extends the CRC32C checksum \p crc of previous data with the
+    ///        checksum of \p bytes
+    ///
+    /// \code
+    /// crc32c( crc32c( a ), b ) == crc32c( a + b )
+    /// \endcode
+    ///
+    /// \param crc the checksum of the preceding bytes
+    /// \param bytes the bytes to checksum
+    /// \return the checksum of the preceding bytes followed by \p bytes
+    std::uint32_t crc32c( std::uint32_t crc, span<const byte> bytes ) noexcept;
+
+    /// \brief Combines the CRC32C checksums of two adjacent blocks into the
+    ///        checksum of the concatenated block
+    ///
+    /// This allows blocks to be checksummed independently, for example in
+    /// parallel, and merged afterwards. The cost is logarithmic in
+    /// \p length2 and does not depend on the data.
+    ///
+    /// \param crc1 the checksum of the first block
+    /// \param crc2 the checksum of the second block
+    /// \param length2 the length of the second block, in bytes
+    /// \return the checksum of the first block followed by the second
+    std::uint32_t crc32c_combine( std::uint32_t crc1,
+                                  std::uint32_t crc2,
+                                  std::size_t length2 ) noexcept;
+
+    //=========================================================================
+    // class : crc32c_checksum
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A CRC32C checksum of data that arrives in pieces
+    ///
+    /// Feeding bytes to \c update in any number of pieces and then calling
+    /// \c finalize yields the same value as \c crc32c on the concatenated
+    /// bytes.
+    ///////////////////////////////////////////////////////////////////////////
+    class crc32c_checksum
+    {
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a checksum that has not yet consumed any input
+      constexpr crc32c_checksum() noexcept;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Consumes the bytes in \p bytes
+      ///
+      /// \param bytes the bytes to checksum
+      void update( span<const byte> bytes ) noexcept;
+
+      /// \brief Discards all consumed input
+      void reset() noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns the checksum of all bytes consumed so far
+      ///
+      /// \return the checksum of the consumed bytes
+      constexpr std::uint32_t finalize() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      std::uint32_t m_crc; ///< The checksum of the consumed bytes
+    };
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/checksum.inl"
+
+#endif /* BIT_CORE_UTILITIES_CHECKSUM_HPP */
@@ -0,0 +1,266 @@
+#ifndef BIT_CORE_UTILITIES_DETAIL_CHECKSUM_INL
+#define BIT_CORE_UTILITIES_DETAIL_CHECKSUM_INL
+
+namespace bit { namespace core { namespace detail {
+
+  /// \brief The reflected Castagnoli polynomial
+  constexpr std::uint32_t crc32c_polynomial() noexcept{ return 0x82f63b78u; }
+
+  //---------------------------------------------------------------------------
+  // Tables
+  //---------------------------------------------------------------------------
+
+  struct crc32c_table_data
+  {
+    /// The contribution of a byte followed by 0 to 7 zero bytes
+    std::uint32_t slices[8][256];
+
+    /// x^(8 * 2^k) modulo the polynomial, used to shift a checksum over
+    /// 2^k zero bytes; this covers every bit of a 64-bit length
+    std::uint32_t powers[64];
+  };
+
+  /// \brief Multiplies \p a and \p b modulo the polynomial
+  inline constexpr std::uint32_t crc32c_multiply( std::uint32_t a,
+                                                  std::uint32_t b )
+    noexcept
+  {
+    auto result = std::uint32_t{0};
+
+    for( auto m = std::uint32_t{1u} << 31; m != 0; m >>= 1 ) {
+      if( a & m ) {
+        result ^= b;
+      }
+      b = (b & 1u) ? ((b >> 1) ^ crc32c_polynomial()) : (b >> 1);
+    }
+    return result;
+  }
+
+  inline constexpr crc32c_table_data make_crc32c_tables()
+    noexcept
+  {
+    auto result = crc32c_table_data{};
+
+    for( auto i = std::uint32_t{0}; i < 256u; ++i ) {
+      auto crc = i;
+      for( auto k = 0; k < 8; ++k ) {
+        crc = (crc & 1u) ? ((crc >> 1) ^ crc32c_polynomial()) : (crc >> 1);
+      }
+      result.slices[0][i] = crc;
+    }
+    for( auto i = 0; i < 256; ++i ) {
+      for( auto t = 1; t < 8; ++t ) {
+        const auto previous = result.slices[t - 1][i];
+        result.slices[t][i] = (previous >> 8) ^ result.slices[0][previous & 0xffu];
+      }
+    }
+
+    // In the reflected representation, the top bit is x^0, so x^8 is the
+    // bit eight places below it. x^(2^32) is not x for this polynomial, so
+    // the powers never repeat and each one is squared from the last
+    result.powers[0] = std::uint32_t{1u} << 23;
+    for( auto k = 1; k < 64; ++k ) {
+      result.powers[k] = crc32c_multiply( result.powers[k - 1], result.powers[k - 1] );
+    }
+    return result;
+  }
+
+  template<typename = void>
+  struct crc32c_tables
+  {
+    static constexpr crc32c_table_data value = make_crc32c_tables();
+  };
+
+  template<typename T>
+  constexpr crc32c_table_data crc32c_tables<T>::value;
+
+  //---------------------------------------------------------------------------
+  // Software
+  //---------------------------------------------------------------------------
+
+  /// \brief Updates the raw (uninverted) checksum \p crc with \p n bytes
+  ///        using slicing-by-8
+  inline std::uint32_t crc32c_software( std::uint32_t crc,
+                                        const unsigned char* p,
+                                        std::size_t n )
+    noexcept
+  {
+    const auto& table = crc32c_tables<>::value.slices;
+
+#if !defined(BIT_BIG_ENDIAN)
+    for( ; n >= 8u; p += 8, n -= 8u ) {
+      auto lo = std::uint32_t{};
+      auto hi = std::uint32_t{};
+      std::memcpy( &lo, p, 4u );
+      std::memcpy( &hi, p + 4, 4u );
+
+      lo ^= crc;
+      crc = table[7][lo & 0xffu] ^ table[6][(lo >> 8) & 0xffu] ^
+            table[5][(lo >> 16) & 0xffu] ^ table[4][lo >> 24] ^
+            table[3][hi & 0xffu] ^ table[2][(hi >> 8) & 0xffu] ^
+            table[1][(hi >> 16) & 0xffu] ^ table[0][hi >> 24];
+    }
+#endif
+
+    for( ; n != 0u; ++p, --n ) {
+      crc = (crc >> 8) ^ table[0][(crc ^ *p) & 0xffu];
+    }
+    return crc;
+  }
+
+  //---------------------------------------------------------------------------
+  // Hardware
+  //---------------------------------------------------------------------------
+
+#if defined(BIT_CORE_CRC32C_HARDWARE)
+
+  /// \brief Determines whether the processor has the SSE4.2 \c crc32
+  ///        instruction
+  inline bool crc32c_has_hardware()
+    noexcept
+  {
+# if BIT_CORE_CRC32C_HARDWARE == 1
+    return true;
+# elif defined(_MSC_VER)
+    static const bool result = []{
+      int info[4];
+      __cpuid( info, 1 );
+      return (info[2] & (1 << 20)) != 0;
+    }();
+    return result;
+# else
+    static const bool result = (__builtin_cpu_init(),
+                                __builtin_cpu_supports("sse4.2") != 0);
+    return result;
+# endif
+  }
+
+  /// \brief Updates the raw (uninverted) checksum \p crc with \p n bytes
+  ///        using the SSE4.2 \c crc32 instruction
+# if defined(__GNUC__) || defined(__clang__)
+  __attribute__((target("sse4.2")))
+# endif
+  inline std::uint32_t crc32c_hardware( std::uint32_t crc,
+                                        const unsigned char* p,
+                                        std::size_t n )
+    noexcept
+  {
+# if defined(BIT_ARCHITECTURE_64)
+    auto wide = std::uint64_t{crc};
+    for( ; n >= 8u; p += 8, n -= 8u ) {
+      auto word = std::uint64_t{};
+      std::memcpy( &word, p, 8u );
+      wide = _mm_crc32_u64( wide, word );
+    }
+    crc = static_cast<std::uint32_t>(wide);
+# endif
+
+    for( ; n >= 4u; p += 4, n -= 4u ) {
+      auto word = std::uint32_t{};
+      std::memcpy( &word, p, 4u );
+      crc = _mm_crc32_u32( crc, word );
+    }
+    for( ; n != 0u; ++p, --n ) {
+      crc = _mm_crc32_u8( crc, *p );
+    }
+    return crc;
+  }
+
+#endif
+
+  //---------------------------------------------------------------------------
+
+  inline std::uint32_t crc32c_update( std::uint32_t crc,
+                                      const unsigned char* p,
+                                      std::size_t n )
+    noexcept
+  {
+#if defined(BIT_CORE_CRC32C_HARDWARE)
+    if( crc32c_has_hardware() ) {
+      return crc32c_hardware( crc, p, n );
+    }
+#endif
+    return crc32c_software( crc, p, n );
+  }
+
+} } } // namespace bit::core::detail
+
+//=============================================================================
+// CRC32C
+//=============================================================================
+
+inline std::uint32_t bit::core::crc32c( span<const byte> bytes )
+  noexcept
+{
+  return crc32c( 0u, bytes );
+}
+
+inline std::uint32_t bit::core::crc32c( std::uint32_t crc,
+                                        span<const byte> bytes )
+  noexcept
+{
+  const auto* p = reinterpret_cast<const unsigned char*>( bytes.data() );
+
+  return ~detail::crc32c_update( ~crc, p, static_cast<std::size_t>(bytes.size()) );
+}
+
+inline std::uint32_t bit::core::crc32c_combine( std::uint32_t crc1,
+                                                std::uint32_t crc2,
+                                                std::size_t length2 )
+  noexcept
+{
+  const auto& powers = detail::crc32c_tables<>::value.powers;
+
+  // Compute x^(8 * length2), shifting crc1 past the bytes of the second block
+  auto shift = std::uint32_t{1u} << 31;
+  for( auto k = 0u; length2 != 0u; length2 >>= 1, ++k ) {
+    if( length2 & 1u ) {
+      shift = detail::crc32c_multiply( powers[k], shift );
+    }
+  }
+
+  return detail::crc32c_multiply( shift, crc1 ) ^ crc2;
+}
+
+//=============================================================================
+// class : crc32c_checksum
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+inline constexpr bit::core::crc32c_checksum::crc32c_checksum()
+  noexcept
+  : m_crc(0u)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+inline void bit::core::crc32c_checksum::update( span<const byte> bytes )
+  noexcept
+{
+  m_crc = crc32c( m_crc, bytes );
+}
+
+inline void bit::core::crc32c_checksum::reset()
+  noexcept
+{
+  m_crc = 0u;
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+inline constexpr std::uint32_t bit::core::crc32c_checksum::finalize()
+  const noexcept
+{
+  return m_crc;
+}
+
+#endif /* BIT_CORE_UTILITIES_DETAIL_CHECKSUM_INL */
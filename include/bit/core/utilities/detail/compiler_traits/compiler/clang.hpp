@@ -202,6 +202,9 @@
 #if defined(__SSE3__)
 #  define BIT_PLATFORM_HAS_SSE3   1
 #endif
+#if defined(__SSSE3__)
+#  define BIT_PLATFORM_HAS_SSSE3  1
+#endif
 #if defined(__SSE4_1__)
 #  define BIT_PLATFORM_HAS_SSE4_1 1
 #endif
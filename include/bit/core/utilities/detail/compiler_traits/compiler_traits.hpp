@@ -385,6 +385,57 @@
 #endif
 
 
+//! \def BIT_PREFETCH(address)
+//!
+//! \brief Hints to the processor that the memory at \a address will be read
+//!        soon
+//!
+//! This never faults, so it is safe to use on any address.
+//!
+//! Example Usage:
+//! \code
+//! for( auto i = 0; i < n; ++i ) {
+//!   BIT_PREFETCH( nodes[i + 8] );
+//!   visit( *nodes[i] );
+//! }
+//! \endcode
+#if defined(__GNUC__) || defined(__clang__)
+# define BIT_PREFETCH(address) __builtin_prefetch(address)
+#else
+# define BIT_PREFETCH(address) ((void)(address))
+#endif
+
+
+//! \def BIT_IS_CONSTANT_EVALUATED()
+//!
+//! \brief Evaluates to \c true if the enclosing \c constexpr function is
+//!        being evaluated as part of a constant expression
+//!
+//! This allows a \c constexpr function to dispatch to a faster runtime
+//! implementation (such as one using intrinsics) without losing the ability
+//! to be evaluated at compile-time. Both branches must produce the same
+//! result.
+//!
+//! On compilers without support for detecting constant evaluation, this
+//! always expands to \c true so that the portable path is always selected.
+//!
+//! Example Usage:
+//! \code
+//! constexpr int foo( int x ) {
+//!   if( !BIT_IS_CONSTANT_EVALUATED() ) return runtime_foo(x);
+//!   return portable_foo(x);
+//! }
+//! \endcode
+#if __has_builtin(__builtin_is_constant_evaluated) || \
+    (defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 9)) || \
+    (defined(_MSC_VER) && (_MSC_VER >= 1925))
+# define BIT_COMPILER_HAS_CONSTANT_EVALUATION_CHECK 1
+# define BIT_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+# define BIT_IS_CONSTANT_EVALUATED() true
+#endif
+
+
 //! \def BIT_INIT_PRIORITY(x)
 //!
 //! \brief Constrol the construction order of elements
@@ -0,0 +1,330 @@
+#ifndef BIT_CORE_UTILITIES_DETAIL_FORMAT_INL
+#define BIT_CORE_UTILITIES_DETAIL_FORMAT_INL
+
+namespace bit { namespace core { namespace detail {
+
+  //--------------------------------------------------------------------------
+  // Digits
+  //--------------------------------------------------------------------------
+
+  /// \brief The two digit strings "00" through "99"
+  template<typename = void>
+  struct format_digit_pairs
+  {
+    static const char value[201];
+  };
+
+  template<typename T>
+  const char format_digit_pairs<T>::value[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+  /// \brief The powers of ten that fit in 64 bits
+  template<typename = void>
+  struct format_powers_of_ten
+  {
+    static const std::uint64_t value[20];
+  };
+
+  template<typename T>
+  const std::uint64_t format_powers_of_ten<T>::value[20] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+    100000000ull, 1000000000ull, 10000000000ull, 100000000000ull,
+    1000000000000ull, 10000000000000ull, 100000000000000ull,
+    1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+    1000000000000000000ull, 10000000000000000000ull
+  };
+
+  /// \brief Counts the decimal digits of \p value
+  inline std::size_t format_digit_count( std::uint64_t value )
+    noexcept
+  {
+    // 1233 / 4096 approximates log10(2); the estimate from the bit width
+    // is either exact or one too many
+    value |= 1u;
+
+    const auto bits  = 64 - parse_float_leading_zeros( value );
+    const auto log10 = static_cast<std::size_t>( (bits * 1233) >> 12 );
+
+    return log10 + 1u - (value < format_powers_of_ten<>::value[log10]);
+  }
+
+  /// \brief Writes the digits of \p value, ending at \p last
+  inline void format_digits( char* last, std::uint64_t value )
+    noexcept
+  {
+    const auto* pairs = format_digit_pairs<>::value;
+
+    while( value >= 100u ) {
+      const auto pair = static_cast<std::size_t>( value % 100u ) * 2u;
+      value /= 100u;
+      last -= 2;
+      std::memcpy( last, pairs + pair, 2u );
+    }
+    if( value >= 10u ) {
+      last -= 2;
+      std::memcpy( last, pairs + value * 2u, 2u );
+    } else {
+      *--last = static_cast<char>( '0' + value );
+    }
+  }
+
+  //--------------------------------------------------------------------------
+  // Integers
+  //--------------------------------------------------------------------------
+
+  template<typename T>
+  inline string_view format_integer( span<char> buffer, T value )
+    noexcept
+  {
+    const auto negative  = value < T{0};
+    const auto magnitude = negative
+      ? static_cast<std::uint64_t>( -(static_cast<std::int64_t>( value ) + 1) ) + 1u
+      : static_cast<std::uint64_t>( value );
+
+    const auto size = format_digit_count( magnitude ) + negative;
+    if( size > static_cast<std::size_t>( buffer.size() ) ) {
+      return {};
+    }
+
+    auto* const first = buffer.data();
+    if( negative ) *first = '-';
+    format_digits( first + size, magnitude );
+
+    return { first, size };
+  }
+
+  //--------------------------------------------------------------------------
+  // Floating Point
+  //--------------------------------------------------------------------------
+
+  /// \brief Copies \p count characters of \p str, prefixed by \c '-' if
+  ///        \p negative, into \p buffer
+  inline string_view format_literal( span<char> buffer,
+                                     bool negative,
+                                     const char* str,
+                                     std::size_t count )
+    noexcept
+  {
+    const auto size = count + negative;
+    if( size > static_cast<std::size_t>( buffer.size() ) ) {
+      return {};
+    }
+
+    auto* const first = buffer.data();
+    if( negative ) *first = '-';
+    std::memcpy( first + negative, str, count );
+
+    return { first, size };
+  }
+
+  /// \brief Writes the integer \p c * 2^\p q, which has fewer than 28
+  ///        digits, ending at \p last
+  inline void format_exact_integer( char* last, std::uint64_t c, int q )
+    noexcept
+  {
+    // The value as four 32-bit limbs, most significant first
+    std::uint32_t limbs[4] = {};
+    const auto low  = (q < 64) ? (c << q) : std::uint64_t{0};
+    const auto high = (q == 0) ? std::uint64_t{0}
+                    : (q < 64) ? (c >> (64 - q)) : (c << (q - 64));
+    limbs[0] = static_cast<std::uint32_t>( high >> 32 );
+    limbs[1] = static_cast<std::uint32_t>( high );
+    limbs[2] = static_cast<std::uint32_t>( low >> 32 );
+    limbs[3] = static_cast<std::uint32_t>( low );
+
+    // Divide by 10^9 until the quotient fits in 9 digits
+    for( ;; ) {
+      auto remainder = std::uint64_t{0};
+      auto zero      = true;
+      for( auto& limb : limbs ) {
+        const auto n = (remainder << 32) | limb;
+        limb      = static_cast<std::uint32_t>( n / 1000000000u );
+        remainder = n % 1000000000u;
+        zero      = zero && (limb == 0u);
+      }
+      if( zero ) {
+        format_digits( last, remainder );
+        return;
+      }
+      for( auto i = 0; i < 9; ++i ) {
+        *--last = static_cast<char>( '0' + remainder % 10u );
+        remainder /= 10u;
+      }
+    }
+  }
+
+  /// \brief Writes the decimal \p digits * 10^\p exponent, in the shorter of
+  ///        fixed and scientific notation
+  ///
+  /// Fixed notation of a value beyond the precision of its type prints the
+  /// exact integer \p c * 2^\p q instead of padding \p digits with zeros.
+  inline string_view format_decimal( span<char> buffer,
+                                     bool negative,
+                                     std::uint64_t digits,
+                                     int exponent,
+                                     std::uint64_t c,
+                                     int q )
+    noexcept
+  {
+    // Trailing zeros are folded into the exponent
+    while( digits % 100000000u == 0u ) {
+      digits /= 100000000u;
+      exponent += 8;
+    }
+    if( digits % 10000u == 0u ) {
+      digits /= 10000u;
+      exponent += 4;
+    }
+    if( digits % 100u == 0u ) {
+      digits /= 100u;
+      exponent += 2;
+    }
+    if( digits % 10u == 0u ) {
+      digits /= 10u;
+      exponent += 1;
+    }
+
+    const auto count      = static_cast<int>( format_digit_count( digits ) );
+    const auto scientific = exponent + count - 1;
+
+    // d[.ddd]e+XX, and the fixed forms ddd000, ddd.ddd and 0.000ddd
+    const auto scientific_exponent = (scientific < 0) ? -scientific : scientific;
+    const auto scientific_size = count + (count > 1) + 2 + ((scientific_exponent >= 100) ? 3 : 2);
+    const auto fixed_size      = (exponent >= 0)  ? count + exponent
+                               : (scientific >= 0) ? count + 1
+                                                   : count + 1 - scientific;
+
+    const auto size = static_cast<std::size_t>(
+      ((fixed_size <= scientific_size) ? fixed_size : scientific_size) + negative
+    );
+    if( size > static_cast<std::size_t>( buffer.size() ) ) {
+      return {};
+    }
+
+    auto* const first = buffer.data();
+    auto* p = first;
+    if( negative ) *p++ = '-';
+
+    if( fixed_size <= scientific_size ) {
+      if( q > 0 ) {
+        format_exact_integer( p + count + exponent, c, q );
+      } else if( exponent >= 0 ) {
+        format_digits( p + count, digits );
+        std::memset( p + count, '0', static_cast<std::size_t>( exponent ) );
+      } else if( scientific >= 0 ) {
+        // Write the digits one place to the right, then move the integer
+        // part back over the gap
+        const auto integer = scientific + 1;
+        format_digits( p + count + 1, digits );
+        std::memmove( p, p + 1, static_cast<std::size_t>( integer ) );
+        p[integer] = '.';
+      } else {
+        const auto zeros = -scientific - 1;
+        p[0] = '0';
+        p[1] = '.';
+        std::memset( p + 2, '0', static_cast<std::size_t>( zeros ) );
+        format_digits( p + 2 + zeros + count, digits );
+      }
+    } else {
+      // Write all digits after the first place, then lift the first digit
+      // in front of the decimal point
+      format_digits( p + 1 + count, digits );
+      p[0] = p[1];
+      if( count > 1 ) {
+        p[1] = '.';
+        p += count + 1;
+      } else {
+        p += 1;
+      }
+      *p++ = 'e';
+      *p++ = (scientific < 0) ? '-' : '+';
+      if( scientific_exponent >= 100 ) {
+        *p++ = static_cast<char>( '0' + scientific_exponent / 100 );
+      }
+      std::memcpy( p, format_digit_pairs<>::value + (scientific_exponent % 100) * 2, 2u );
+    }
+
+    return { first, size };
+  }
+
+  template<typename T>
+  inline string_view format_float( span<char> buffer, T value )
+    noexcept
+  {
+    using format    = format_float_format<T>;
+    using bits_type = typename format::bits_type;
+
+    constexpr auto mantissa_bits = format::precision - 1;
+    constexpr auto sign_bit      = bits_type{1} << (sizeof(T) * 8u - 1u);
+    constexpr auto exponent_mask = ((bits_type{1} << format::exponent_bits) - 1u) << mantissa_bits;
+
+    auto bits = bits_type{};
+    std::memcpy( &bits, &value, sizeof(T) );
+
+    const auto negative = (bits & sign_bit) != 0u;
+    bits &= ~sign_bit;
+
+    if( (bits & exponent_mask) == exponent_mask ) {
+      return (bits == exponent_mask) ? format_literal( buffer, negative, "inf", 3u )
+                                     : format_literal( buffer, negative, "nan", 3u );
+    }
+    if( bits == 0u ) {
+      return format_literal( buffer, negative, "0", 1u );
+    }
+
+    // The value as c * 2^q
+    const auto be = static_cast<int>( bits >> mantissa_bits );
+    const auto t  = static_cast<std::uint64_t>( bits & ((bits_type{1} << mantissa_bits) - 1u) );
+    const auto c  = (be != 0) ? (t | (std::uint64_t{1} << mantissa_bits)) : t;
+    const auto q  = ((be != 0) ? be - 1 : 0) + format::min_exponent;
+
+    const auto decimal = format_float_to_decimal<T>( bits );
+    return format_decimal( buffer, negative, decimal.significand, decimal.exponent, c, q );
+  }
+
+  //--------------------------------------------------------------------------
+
+  template<typename T>
+  inline string_view format_to( span<char> buffer, T value, std::true_type )
+    noexcept
+  {
+    return format_integer( buffer, value );
+  }
+
+  template<typename T>
+  inline string_view format_to( span<char> buffer, T value, std::false_type )
+    noexcept
+  {
+    return format_float( buffer, value );
+  }
+
+} } } // namespace bit::core::detail
+
+//----------------------------------------------------------------------------
+// format_to
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::core::string_view
+  bit::core::format_to( span<char> buffer, T value )
+  noexcept
+{
+  static_assert( std::is_integral<T>::value || std::is_same<T,float>::value ||
+                 std::is_same<T,double>::value,
+                 "format_to only supports integral types, float and double" );
+  static_assert( !std::is_same<T,bool>::value,
+                 "format_to does not support bool" );
+
+  return detail::format_to( buffer, value, std::is_integral<T>{} );
+}
+
+#endif /* BIT_CORE_UTILITIES_DETAIL_FORMAT_INL */
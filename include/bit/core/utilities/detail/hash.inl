@@ -338,17 +338,163 @@ inline constexpr bit::core::hash_t bit::core::hash_combine( hash_t seed,
 }
 
 //-----------------------------------------------------------------------------
+// Mixing Functions
+//-----------------------------------------------------------------------------
+
+namespace bit { namespace core { namespace detail {
+
+  // The 64-bit mix is the SplitMix64 finalizer; the 32-bit mix is the
+  // MurmurHash3 finalizer. Sizes are selected in the same manner as the
+  // fnv1 constants.
+  template<std::size_t> struct hash_mixer;
+
+  template<>
+  struct hash_mixer<4>
+  {
+    static constexpr std::size_t golden_ratio(){ return 0x9e3779b9ul; }
+
+    static constexpr std::size_t mix( std::size_t h )
+    {
+      h ^= h >> 16;
+      h *= 0x85ebca6bul;
+      h ^= h >> 13;
+      h *= 0xc2b2ae35ul;
+      h ^= h >> 16;
+      return h;
+    }
+  };
+
+  template<>
+  struct hash_mixer<8>
+  {
+    static constexpr std::size_t golden_ratio(){ return static_cast<std::size_t>(0x9e3779b97f4a7c15ull); }
+
+    static constexpr std::size_t mix( std::size_t h )
+    {
+      h ^= h >> 30;
+      h *= static_cast<std::size_t>(0xbf58476d1ce4e5b9ull);
+      h ^= h >> 27;
+      h *= static_cast<std::size_t>(0x94d049bb133111ebull);
+      h ^= h >> 31;
+      return h;
+    }
+  };
+
+} } } // namespace bit::core::detail
+
+inline constexpr bit::core::hash_t bit::core::hash_mix( hash_t hash )
+  noexcept
+{
+  using mixer = detail::hash_mixer<sizeof(std::size_t)>;
+
+  return static_cast<hash_t>( mixer::mix( static_cast<std::size_t>(hash) ) );
+}
+
+inline constexpr bit::core::hash_t bit::core::hash_combine_mixed( hash_t seed,
+                                                                hash_t hash )
+  noexcept
+{
+  using mixer = detail::hash_mixer<sizeof(std::size_t)>;
+
+  // Multiplying by an odd constant is a bijection that moves the seed into
+  // the high bits, so that small seeds and hashes cannot cancel each other
+  return hash_mix( seed * static_cast<hash_t>(mixer::golden_ratio()) + hash );
+}
+
+template<typename...Hashes, typename>
+inline constexpr bit::core::hash_t bit::core::hash_combine_mixed( hash_t seed,
+                                                                hash_t hash0,
+                                                                Hashes...hashes )
+  noexcept
+{
+  return hash_combine_mixed( hash_combine_mixed(seed,hash0), hashes... );
+}
+
+//-----------------------------------------------------------------------------
+
+namespace bit { namespace core { namespace detail {
+
+  template<typename T>
+  struct is_constexpr_block_hashable
+    : bool_constant<(std::is_integral<T>::value && !std::is_same<T,bool>::value) ||
+                    std::is_enum<T>::value>{};
+
+  // Integral and enum types can be decomposed into bytes in constant
+  // expressions
+  template<typename T, typename ContiguousIterator>
+  inline constexpr ::bit::core::hash_t
+    hash_contiguous_range( ContiguousIterator first,
+                           std::size_t count,
+                           std::true_type )
+    noexcept
+  {
+    const T* const p = (count == 0) ? nullptr : &*first;
+
+    return static_cast<::bit::core::hash_t>(
+      static_cast<std::size_t>( wide_hash_chars( p, count, 0u ) )
+    );
+  }
+
+  template<typename T, typename ContiguousIterator>
+  inline ::bit::core::hash_t
+    hash_contiguous_range( ContiguousIterator first,
+                           std::size_t count,
+                           std::false_type )
+    noexcept
+  {
+    const T* const p = (count == 0) ? nullptr : std::addressof(*first);
+
+    return static_cast<::bit::core::hash_t>(
+      static_cast<std::size_t>( wide_hash_bytes( p, count * sizeof(T), 0u ) )
+    );
+  }
+
+  template<typename ContiguousIterator>
+  inline constexpr ::bit::core::hash_t
+    hash_range_impl( ContiguousIterator first,
+                     ContiguousIterator last,
+                     std::true_type )
+    noexcept
+  {
+    using value_type = typename std::iterator_traits<ContiguousIterator>::value_type;
+
+    return hash_contiguous_range<value_type>(
+      first,
+      static_cast<std::size_t>(last - first),
+      is_constexpr_block_hashable<value_type>{}
+    );
+  }
+
+  template<typename InputIterator>
+  inline constexpr ::bit::core::hash_t
+    hash_range_impl( InputIterator first,
+                     InputIterator last,
+                     std::false_type )
+    noexcept( ::bit::core::is_nothrow_hashable<typename std::iterator_traits<InputIterator>::value_type>::value )
+  {
+    using ::bit::core::hash_value;
+
+    auto seed = static_cast<::bit::core::hash_t>(0);
+    for(; first != last; ++first ) {
+      seed = hash_combine( seed, hash_value(*first) );
+    }
+    return seed;
+  }
+
+} } } // namespace bit::core::detail
 
 template<typename InputIterator>
 inline constexpr bit::core::hash_t bit::core::hash_range( InputIterator first,
                                                         InputIterator last )
   noexcept( is_nothrow_hashable<typename std::iterator_traits<InputIterator>::value_type>::value )
 {
-  auto seed = static_cast<hash_t>(0);
-  for(; first != last; ++first ) {
-    seed = hash_combine( seed, hash_value(*first) );
-  }
-  return seed;
+  using value_type = typename std::iterator_traits<InputIterator>::value_type;
+  using is_block_hashable = conjunction<
+    has_unique_object_representation<value_type>,
+    is_contiguous_iterator<InputIterator>
+  >;
+
+  return detail::hash_range_impl( first, last, is_block_hashable{} );
 }
 
 //-----------------------------------------------------------------------------
@@ -394,15 +540,44 @@ namespace bit { namespace core { namespace detail {
       template<> constexpr std::size_t fnv1_offset<4>(){ return 2166136261ul; }
       template<> constexpr std::size_t fnv1_offset<8>(){ return 14695981039346656037ull; }
 
-      template<typename CharT>
-      constexpr hash_t string_hash( const CharT* str, std::size_t count ) noexcept;
-
 } } } // namespace bit::core::detail
 
 template<typename CharT>
 inline constexpr bit::core::hash_t
   bit::core::hash_string_segment( const CharT* str, std::size_t count )
   noexcept
+{
+  return default_hash_policy{}( str, count );
+}
+
+template<typename CharT, typename HashPolicy>
+inline constexpr bit::core::hash_t
+  bit::core::hash_string_segment( const CharT* str,
+                                  std::size_t count,
+                                  const HashPolicy& policy )
+  noexcept
+{
+  return policy( str, count );
+}
+
+template<typename T>
+inline bit::core::hash_t bit::core::hash_raw( const T& data )
+  noexcept
+{
+  using byte_t = unsigned char;
+  auto ptr = reinterpret_cast<const byte_t*>(&data);
+
+  return hash_string_segment( ptr, sizeof(T) );
+}
+
+//=============================================================================
+// Hash Policies
+//=============================================================================
+
+template<typename CharT>
+inline constexpr bit::core::hash_t
+  bit::core::fnv1_hash_policy::operator()( const CharT* str, std::size_t count )
+  const noexcept
 {
   constexpr auto offset = detail::fnv1_offset<sizeof(std::size_t)>();
   constexpr auto prime  = detail::fnv1_prime<sizeof(std::size_t)>();
@@ -417,14 +592,50 @@ inline constexpr bit::core::hash_t
   return static_cast<hash_t>(result);
 }
 
-template<typename T>
-inline bit::core::hash_t bit::core::hash_raw( const T& data )
+template<typename CharT>
+inline constexpr bit::core::hash_t
+  bit::core::wide_hash_policy::operator()( const CharT* str, std::size_t count )
+  const noexcept
+{
+  return static_cast<hash_t>(
+    static_cast<std::size_t>( detail::wide_hash_chars( str, count, 0u ) )
+  );
+}
+
+//=============================================================================
+// Literals
+//=============================================================================
+
+inline constexpr bit::core::hash_t
+  bit::core::literals::hash_literals::operator "" _hash( const char* str,
+                                                        std::size_t len )
   noexcept
 {
-  using byte_t = unsigned char;
-  auto ptr = reinterpret_cast<const byte_t*>(data);
+  return hash_string_segment( str, len );
+}
 
-  return hash_string_segment( ptr, sizeof(T) );
+inline constexpr bit::core::hash_t
+  bit::core::literals::hash_literals::operator "" _hash( const wchar_t* str,
+                                                        std::size_t len )
+  noexcept
+{
+  return hash_string_segment( str, len );
+}
+
+inline constexpr bit::core::hash_t
+  bit::core::literals::hash_literals::operator "" _hash( const char16_t* str,
+                                                        std::size_t len )
+  noexcept
+{
+  return hash_string_segment( str, len );
+}
+
+inline constexpr bit::core::hash_t
+  bit::core::literals::hash_literals::operator "" _hash( const char32_t* str,
+                                                        std::size_t len )
+  noexcept
+{
+  return hash_string_segment( str, len );
 }
 
 //=============================================================================
@@ -438,4 +649,16 @@ inline constexpr bit::core::hash_t
   return hash_value( val );
 }
 
+//=============================================================================
+// class mixed_hash
+//=============================================================================
+
+template<typename Key>
+inline constexpr bit::core::hash_t
+  bit::core::mixed_hash<Key>::operator()( const Key& val )
+  const noexcept( is_nothrow_hashable<Key>::value )
+{
+  return hash_mix( hash_value( val ) );
+}
+
 #endif /* BIT_CORE_UTILITIES_DETAIL_HASH_INL */
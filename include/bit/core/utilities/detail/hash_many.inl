@@ -0,0 +1,199 @@
+#ifndef BIT_CORE_UTILITIES_DETAIL_HASH_MANY_INL
+#define BIT_CORE_UTILITIES_DETAIL_HASH_MANY_INL
+
+namespace bit { namespace core { namespace detail {
+
+  /// \brief The number of keys that are hashed together
+  constexpr std::size_t hash_many_lanes() noexcept{ return 4u; }
+
+  /// \brief How many keys ahead of the current key to prefetch
+  constexpr std::size_t hash_many_prefetch_distance() noexcept{ return 16u; }
+
+  //---------------------------------------------------------------------------
+
+  /// \brief Hashes strings with the wide hash
+  ///
+  /// The wide hash of a key of up to 32 bytes is a few independent loads and
+  /// a short chain of multiplications, so the processor already overlaps
+  /// consecutive keys in a plain loop; interleaving keys by hand measured no
+  /// faster. The loop only prefetches the characters of keys further ahead,
+  /// which are otherwise likely cache misses in large key sets.
+  template<typename CharT, typename Traits>
+  inline void hash_many_strings( const basic_string_view<CharT,Traits>* keys,
+                                 std::size_t n,
+                                 hash_t* hashes,
+                                 const wide_hash_policy& policy )
+    noexcept
+  {
+    constexpr auto distance = hash_many_prefetch_distance();
+
+    auto i = std::size_t{0};
+    for( ; i + distance < n; ++i ) {
+      BIT_PREFETCH( keys[i + distance].data() );
+      hashes[i] = policy( keys[i].data(), keys[i].size() );
+    }
+    for( ; i < n; ++i ) {
+      hashes[i] = policy( keys[i].data(), keys[i].size() );
+    }
+  }
+
+  /// \brief Hashes strings with FNV-1
+  ///
+  /// Every character of an FNV-1 hash depends on the previous one, so each
+  /// lane holds a different key and all lanes advance together. Whenever a
+  /// lane finishes its key, its hash is stored and the lane is refilled with
+  /// the next key.
+  template<typename CharT, typename Traits>
+  inline void hash_many_strings( const basic_string_view<CharT,Traits>* keys,
+                                 std::size_t n,
+                                 hash_t* hashes,
+                                 const fnv1_hash_policy& policy )
+    noexcept
+  {
+    constexpr auto lanes  = hash_many_lanes();
+    constexpr auto offset = fnv1_offset<sizeof(std::size_t)>();
+    constexpr auto prime  = fnv1_prime<sizeof(std::size_t)>();
+
+    if( n < lanes ) {
+      for( auto i = std::size_t{0}; i < n; ++i ) {
+        hashes[i] = policy( keys[i].data(), keys[i].size() );
+      }
+      return;
+    }
+
+    const CharT* str[lanes]       = {};
+    std::size_t  remaining[lanes] = {};
+    std::size_t  state[lanes]     = {};
+    std::size_t  index[lanes]     = {};
+
+    auto next = std::size_t{0};
+    for( ; next < lanes; ++next ) {
+      str[next]       = keys[next].data();
+      remaining[next] = keys[next].size();
+      state[next]     = offset;
+      index[next]     = next;
+    }
+
+    while( true ) {
+      auto steps = remaining[0];
+      for( auto j = std::size_t{1}; j < lanes; ++j ) {
+        steps = (remaining[j] < steps) ? remaining[j] : steps;
+      }
+
+      for( auto k = std::size_t{0}; k < steps; ++k ) {
+        for( auto j = std::size_t{0}; j < lanes; ++j ) {
+          state[j] = (state[j] ^ static_cast<std::size_t>(str[j][k])) * prime;
+        }
+      }
+
+      for( auto j = std::size_t{0}; j < lanes; ++j ) {
+        str[j]       += steps;
+        remaining[j] -= steps;
+      }
+
+      for( auto j = std::size_t{0}; j < lanes; ++j ) {
+        if( remaining[j] != 0 ) continue;
+
+        hashes[index[j]] = static_cast<hash_t>(state[j]);
+
+        if( next == n ) {
+          // No keys are left to refill this lane; finish the others serially
+          for( auto l = std::size_t{0}; l < lanes; ++l ) {
+            if( l == j ) continue;
+
+            for( auto k = std::size_t{0}; k < remaining[l]; ++k ) {
+              state[l] = (state[l] ^ static_cast<std::size_t>(str[l][k])) * prime;
+            }
+            hashes[index[l]] = static_cast<hash_t>(state[l]);
+          }
+          return;
+        }
+
+        if( next + hash_many_prefetch_distance() < n ) {
+          BIT_PREFETCH( keys[next + hash_many_prefetch_distance()].data() );
+        }
+
+        str[j]       = keys[next].data();
+        remaining[j] = keys[next].size();
+        state[j]     = offset;
+        index[j]     = next;
+        ++next;
+      }
+    }
+  }
+
+  template<typename CharT, typename Traits>
+  inline void hash_many_strings( span<const basic_string_view<CharT,Traits>> keys,
+                                 span<hash_t> hashes )
+    noexcept
+  {
+    BIT_ASSERT( hashes.size() >= keys.size(),
+                "hash_many: too few hashes for the number of keys" );
+
+    hash_many_strings( keys.data(),
+                       static_cast<std::size_t>(keys.size()),
+                       hashes.data(),
+                       default_hash_policy{} );
+  }
+
+} } } // namespace bit::core::detail
+
+//-----------------------------------------------------------------------------
+// Batch Hashing Functions
+//-----------------------------------------------------------------------------
+
+inline void bit::core::hash_many( span<const string_view> keys,
+                                  span<hash_t> hashes )
+  noexcept
+{
+  detail::hash_many_strings( keys, hashes );
+}
+
+inline void bit::core::hash_many( span<const wstring_view> keys,
+                                  span<hash_t> hashes )
+  noexcept
+{
+  detail::hash_many_strings( keys, hashes );
+}
+
+inline void bit::core::hash_many( span<const u16string_view> keys,
+                                  span<hash_t> hashes )
+  noexcept
+{
+  detail::hash_many_strings( keys, hashes );
+}
+
+inline void bit::core::hash_many( span<const u32string_view> keys,
+                                  span<hash_t> hashes )
+  noexcept
+{
+  detail::hash_many_strings( keys, hashes );
+}
+
+//-----------------------------------------------------------------------------
+
+template<typename T, typename Hasher>
+inline void bit::core::hash_many( span<const T> keys,
+                                  span<hash_t> hashes,
+                                  Hasher hasher )
+{
+  BIT_ASSERT( hashes.size() >= keys.size(),
+              "hash_many: too few hashes for the number of keys" );
+
+  const auto n   = static_cast<std::size_t>(keys.size());
+  const auto* in = keys.data();
+  auto* out      = hashes.data();
+
+  for( auto i = std::size_t{0}; i < n; ++i ) {
+    out[i] = hasher( in[i] );
+  }
+}
+
+template<typename T, typename>
+inline void bit::core::hash_many( span<const T> keys, span<hash_t> hashes )
+  noexcept
+{
+  hash_many( keys, hashes, hash<T>{} );
+}
+
+#endif /* BIT_CORE_UTILITIES_DETAIL_HASH_MANY_INL */
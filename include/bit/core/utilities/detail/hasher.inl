@@ -0,0 +1,234 @@
+#ifndef BIT_CORE_UTILITIES_DETAIL_HASHER_INL
+#define BIT_CORE_UTILITIES_DETAIL_HASHER_INL
+
+//=============================================================================
+// basic_hasher<fnv1_hash_policy>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+inline constexpr bit::core::basic_hasher<bit::core::fnv1_hash_policy>
+  ::basic_hasher()
+  noexcept
+  : m_state(detail::fnv1_offset<sizeof(std::size_t)>())
+{
+
+}
+
+inline constexpr bit::core::basic_hasher<bit::core::fnv1_hash_policy>
+  ::basic_hasher( const fnv1_hash_policy& )
+  noexcept
+  : basic_hasher()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+inline void bit::core::basic_hasher<bit::core::fnv1_hash_policy>
+  ::update( span<const byte> bytes )
+  noexcept
+{
+  update( bytes.data(), static_cast<std::size_t>(bytes.size()) );
+}
+
+template<typename CharT>
+inline void bit::core::basic_hasher<bit::core::fnv1_hash_policy>
+  ::update( const CharT* str, std::size_t count )
+  noexcept
+{
+  constexpr auto prime = detail::fnv1_prime<sizeof(std::size_t)>();
+
+  // Each character is converted exactly as fnv1_hash_policy does, which
+  // sign-extends a signed char and consumes wide characters whole
+  for( ; count != 0u; --count, ++str ) {
+    m_state ^= static_cast<std::size_t>(*str);
+    m_state *= prime;
+  }
+}
+
+inline void bit::core::basic_hasher<bit::core::fnv1_hash_policy>::reset()
+  noexcept
+{
+  m_state = detail::fnv1_offset<sizeof(std::size_t)>();
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+inline bit::core::hash_t
+  bit::core::basic_hasher<bit::core::fnv1_hash_policy>::finalize()
+  const noexcept
+{
+  return static_cast<hash_t>(m_state);
+}
+
+//=============================================================================
+// basic_hasher<wide_hash_policy>
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+inline bit::core::basic_hasher<bit::core::wide_hash_policy>::basic_hasher()
+  noexcept
+{
+  reset();
+}
+
+inline bit::core::basic_hasher<bit::core::wide_hash_policy>
+  ::basic_hasher( const wide_hash_policy& )
+  noexcept
+  : basic_hasher()
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+inline void bit::core::basic_hasher<bit::core::wide_hash_policy>
+  ::update( span<const byte> bytes )
+  noexcept
+{
+  constexpr auto stripe_size = detail::wide_hash_stripe_size();
+
+  // Note: byte is only ever read through unsigned char, which may alias
+  //       any object
+  auto p = reinterpret_cast<const unsigned char*>(bytes.data());
+  auto n = static_cast<std::size_t>(bytes.size());
+
+  m_length += n;
+
+  // The stripe containing the final byte must never be accumulated as a
+  // complete stripe, so input is only consumed once more bytes follow it
+  if( m_buffered + n <= stripe_size ) {
+    if( n != 0 ) {
+      std::memcpy( m_buffer + m_buffered, p, n );
+      m_buffered += n;
+    }
+    return;
+  }
+
+  if( m_buffered != 0 ) {
+    const auto fill = stripe_size - m_buffered;
+
+    std::memcpy( m_buffer + m_buffered, p, fill );
+    p += fill;
+    n -= fill;
+
+    accumulate( m_buffer, 1 );
+    m_buffered = 0;
+  }
+
+  // At least one byte always remains to be buffered
+  const auto stripes = (n - 1) / stripe_size;
+  if( stripes != 0 ) {
+    accumulate( p, stripes );
+    p += stripes * stripe_size;
+    n -= stripes * stripe_size;
+  }
+
+  std::memcpy( m_buffer, p, n );
+  m_buffered = n;
+}
+
+template<typename CharT>
+inline void bit::core::basic_hasher<bit::core::wide_hash_policy>
+  ::update( const CharT* str, std::size_t count )
+  noexcept
+{
+  // wide_hash_policy hashes characters as their little-endian bytes
+#if defined(BIT_BIG_ENDIAN)
+  byte bytes[64 * sizeof(CharT)];
+
+  while( count != 0u ) {
+    const auto n = std::min( count, std::size_t{64} );
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      for( auto j = std::size_t{0}; j < sizeof(CharT); ++j ) {
+        const auto value = static_cast<std::uint64_t>(str[i]);
+        bytes[i * sizeof(CharT) + j] = static_cast<byte>(value >> (8u * j));
+      }
+    }
+    update( span<const byte>( bytes, static_cast<std::ptrdiff_t>(n * sizeof(CharT)) ) );
+    str   += n;
+    count -= n;
+  }
+#else
+  const auto* p = reinterpret_cast<const byte*>(str);
+
+  update( span<const byte>( p, static_cast<std::ptrdiff_t>(count * sizeof(CharT)) ) );
+#endif
+}
+
+inline void bit::core::basic_hasher<bit::core::wide_hash_policy>::reset()
+  noexcept
+{
+  m_state    = detail::make_wide_hash_state( 0u );
+  m_length   = 0u;
+  m_stripes  = 0u;
+  m_buffered = 0u;
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+inline bit::core::hash_t
+  bit::core::basic_hasher<bit::core::wide_hash_policy>::finalize()
+  const noexcept
+{
+  constexpr auto stripe_size = detail::wide_hash_stripe_size();
+
+  if( m_length <= stripe_size ) {
+    const auto reader = detail::wide_hash_memory_reader{m_buffer};
+    const auto result = detail::wide_hash_short( reader, m_length, 0u );
+
+    return static_cast<hash_t>(static_cast<std::size_t>(result));
+  }
+
+  // The final stripe is the last 32 bytes of input, which may begin in the
+  // previously accumulated stripe
+  const auto carried = stripe_size - m_buffered;
+
+  stripe_type last;
+  std::memcpy( last, m_previous + m_buffered, carried );
+  std::memcpy( last + carried, m_buffer, m_buffered );
+
+  auto state = m_state;
+  detail::wide_hash_accumulate_memory( state, last, 0, m_stripes, last );
+
+  const auto result = detail::wide_hash_finalize( state, m_length );
+
+  return static_cast<hash_t>(static_cast<std::size_t>(result));
+}
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+inline void bit::core::basic_hasher<bit::core::wide_hash_policy>
+  ::accumulate( const unsigned char* p, std::size_t stripes )
+  noexcept
+{
+  constexpr auto stripe_size = detail::wide_hash_stripe_size();
+
+  detail::wide_hash_accumulate_memory( m_state, p, stripes, m_stripes, nullptr );
+  m_stripes += stripes;
+
+  // Copied bytewise, since GCC cannot prove that p holds a complete stripe
+  // and a fixed 32-byte memcpy from a short input trips -Warray-bounds
+  const auto* last = p + (stripes - 1) * stripe_size;
+  for( auto i = std::size_t{0}; i < stripe_size; ++i ) {
+    m_previous[i] = last[i];
+  }
+}
+
+#endif /* BIT_CORE_UTILITIES_DETAIL_HASHER_INL */
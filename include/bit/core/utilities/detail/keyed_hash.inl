@@ -0,0 +1,325 @@
+#ifndef BIT_CORE_UTILITIES_DETAIL_KEYED_HASH_INL
+#define BIT_CORE_UTILITIES_DETAIL_KEYED_HASH_INL
+
+namespace bit { namespace core { namespace detail {
+
+  //---------------------------------------------------------------------------
+  // SipHash
+  //---------------------------------------------------------------------------
+
+  struct siphash_state
+  {
+    std::uint64_t v0;
+    std::uint64_t v1;
+    std::uint64_t v2;
+    std::uint64_t v3;
+  };
+
+  inline constexpr std::uint64_t siphash_rotate( std::uint64_t x, int bits )
+    noexcept
+  {
+    return (x << bits) | (x >> (64 - bits));
+  }
+
+  inline void siphash_round( siphash_state& s )
+    noexcept
+  {
+    s.v0 += s.v1; s.v1 = siphash_rotate( s.v1, 13 ); s.v1 ^= s.v0;
+    s.v0 = siphash_rotate( s.v0, 32 );
+    s.v2 += s.v3; s.v3 = siphash_rotate( s.v3, 16 ); s.v3 ^= s.v2;
+    s.v0 += s.v3; s.v3 = siphash_rotate( s.v3, 21 ); s.v3 ^= s.v0;
+    s.v2 += s.v1; s.v1 = siphash_rotate( s.v1, 17 ); s.v1 ^= s.v2;
+    s.v2 = siphash_rotate( s.v2, 32 );
+  }
+
+  /// \brief Reads 8 bytes as a little-endian word
+  inline std::uint64_t siphash_load( const unsigned char* p )
+    noexcept
+  {
+    auto result = std::uint64_t{0};
+    for( auto i = 0; i < 8; ++i ) {
+      result |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+    }
+    return result;
+  }
+
+  inline siphash_state siphash_init( const hash_key& key )
+    noexcept
+  {
+    return siphash_state{
+      key.k0 ^ 0x736f6d6570736575ull,
+      key.k1 ^ 0x646f72616e646f6dull,
+      key.k0 ^ 0x6c7967656e657261ull,
+      key.k1 ^ 0x7465646279746573ull
+    };
+  }
+
+  template<int CRounds>
+  inline void siphash_compress( siphash_state& s, std::uint64_t m )
+    noexcept
+  {
+    s.v3 ^= m;
+    for( auto i = 0; i < CRounds; ++i ) siphash_round( s );
+    s.v0 ^= m;
+  }
+
+  /// \brief Compresses the final word, which holds the \p size & 7
+  ///        remaining bytes at \p p and the length in its top byte, and
+  ///        finalizes the hash
+  template<int CRounds, int DRounds>
+  inline std::uint64_t siphash_finish( siphash_state& s,
+                                       const unsigned char* p,
+                                       std::size_t size )
+    noexcept
+  {
+    auto last = static_cast<std::uint64_t>(size) << 56;
+    for( auto i = std::size_t{0}; i < (size & 7u); ++i ) {
+      last |= static_cast<std::uint64_t>(p[i]) << (8u * i);
+    }
+    siphash_compress<CRounds>( s, last );
+
+    s.v2 ^= 0xffu;
+    for( auto i = 0; i < DRounds; ++i ) siphash_round( s );
+
+    return s.v0 ^ s.v1 ^ s.v2 ^ s.v3;
+  }
+
+  /// \brief Computes SipHash-c-d of \p size bytes at \p data
+  ///
+  /// \tparam CRounds the number of rounds per 8-byte word
+  /// \tparam DRounds the number of finalization rounds
+  template<int CRounds, int DRounds>
+  inline std::uint64_t siphash( const hash_key& key,
+                                const void* data,
+                                std::size_t size )
+    noexcept
+  {
+    const auto* p = static_cast<const unsigned char*>(data);
+    auto s = siphash_init( key );
+
+    const auto* const end = p + (size & ~std::size_t{7});
+    for( ; p != end; p += 8 ) {
+      siphash_compress<CRounds>( s, siphash_load( p ) );
+    }
+
+    return siphash_finish<CRounds,DRounds>( s, p, size );
+  }
+
+  /// \brief Computes SipHash-c-d of the \p count characters at \p str, as
+  ///        if every ASCII letter had been lowered first
+  ///
+  /// This is the same hash as \c siphash of the lowered string, so strings
+  /// that are equal under insensitive_char_traits hash equally. Each word
+  /// is lowered on the stack, so no lowered copy of the string is made.
+  template<int CRounds, int DRounds, typename CharT>
+  inline std::uint64_t siphash_lowered( const hash_key& key,
+                                        const CharT* str,
+                                        std::size_t count )
+    noexcept
+  {
+    static_assert( 8u % sizeof(CharT) == 0u,
+                   "Characters must evenly divide a 64-bit word" );
+
+    constexpr auto per_word = 8u / sizeof(CharT);
+    const auto size = count * sizeof(CharT);
+
+    CharT lowered[per_word];
+    unsigned char bytes[8];
+    auto s = siphash_init( key );
+
+    for( ; count >= per_word; count -= per_word, str += per_word ) {
+      for( auto i = std::size_t{0}; i < per_word; ++i ) {
+        lowered[i] = insensitive_char_traits<CharT>::to_lower( str[i] );
+      }
+      std::memcpy( bytes, lowered, 8u );
+      siphash_compress<CRounds>( s, siphash_load( bytes ) );
+    }
+
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      lowered[i] = insensitive_char_traits<CharT>::to_lower( str[i] );
+    }
+    std::memcpy( bytes, lowered, count * sizeof(CharT) );
+
+    return siphash_finish<CRounds,DRounds>( s, bytes, size );
+  }
+
+  //---------------------------------------------------------------------------
+  // Keyed Hash Dispatch
+  //---------------------------------------------------------------------------
+
+  template<typename T>
+  inline hash_t keyed_hash_object( const hash_key& key,
+                                   const T& val,
+                                   std::true_type )
+    noexcept
+  {
+    return hash_bytes_keyed( key, std::addressof(val), sizeof(T) );
+  }
+
+  template<typename T>
+  inline hash_t keyed_hash_object( const hash_key& key,
+                                   const T& val,
+                                   std::false_type )
+    noexcept( is_nothrow_hashable<T>::value )
+  {
+    const auto h = static_cast<std::uint64_t>( hash_value( val ) );
+
+    return hash_bytes_keyed( key, &h, sizeof(h) );
+  }
+
+  template<typename T>
+  inline hash_t keyed_hash_value( const hash_key& key, const T& val )
+    noexcept( has_unique_object_representation<T>::value ||
+              is_nothrow_hashable<T>::value )
+  {
+    return keyed_hash_object( key, val, has_unique_object_representation<T>{} );
+  }
+
+  template<typename CharT, typename Traits>
+  inline hash_t keyed_hash_value( const hash_key& key,
+                                  const basic_string_view<CharT,Traits>& str )
+    noexcept
+  {
+    return keyed_hash_policy{key}( str.data(), str.size() );
+  }
+
+  template<typename CharT, typename Traits, typename Allocator>
+  inline hash_t keyed_hash_value( const hash_key& key,
+                                  const std::basic_string<CharT,Traits,Allocator>& str )
+    noexcept
+  {
+    return keyed_hash_policy{key}( str.data(), str.size() );
+  }
+
+  // Case-insensitive strings must hash equally whenever they compare equal
+
+  template<typename CharT>
+  inline hash_t keyed_hash_value( const hash_key& key,
+                                  const basic_string_view<CharT,insensitive_char_traits<CharT>>& str )
+    noexcept
+  {
+    return static_cast<hash_t>( siphash_lowered<1,3>( key, str.data(), str.size() ) );
+  }
+
+  template<typename CharT, typename Allocator>
+  inline hash_t keyed_hash_value( const hash_key& key,
+                                  const std::basic_string<CharT,insensitive_char_traits<CharT>,Allocator>& str )
+    noexcept
+  {
+    return static_cast<hash_t>( siphash_lowered<1,3>( key, str.data(), str.size() ) );
+  }
+
+} } } // namespace bit::core::detail
+
+//=============================================================================
+// struct : hash_key
+//=============================================================================
+
+inline bit::core::hash_key bit::core::make_random_hash_key()
+{
+  std::random_device device;
+
+  const auto next = [&device]{
+    const auto hi = static_cast<std::uint64_t>( device() );
+    const auto lo = static_cast<std::uint64_t>( device() );
+    return (hi << 32) ^ lo;
+  };
+
+  const auto k0 = next();
+  const auto k1 = next();
+  return hash_key{ k0, k1 };
+}
+
+inline const bit::core::hash_key& bit::core::process_hash_key()
+{
+  static const auto key = make_random_hash_key();
+
+  return key;
+}
+
+//=============================================================================
+// Keyed Hashing Functions
+//=============================================================================
+
+inline bit::core::hash_t bit::core::hash_bytes_keyed( const hash_key& key,
+                                                      const void* data,
+                                                      std::size_t size )
+  noexcept
+{
+  return static_cast<hash_t>( detail::siphash<1,3>( key, data, size ) );
+}
+
+inline bit::core::hash_t bit::core::hash_combine_keyed( const hash_key& key,
+                                                        hash_t seed,
+                                                        hash_t hash )
+  noexcept
+{
+  const std::uint64_t words[2] = {
+    static_cast<std::uint64_t>(seed),
+    static_cast<std::uint64_t>(hash)
+  };
+
+  return hash_bytes_keyed( key, words, sizeof(words) );
+}
+
+//=============================================================================
+// struct : keyed_hash_policy
+//=============================================================================
+
+template<typename CharT>
+inline bit::core::hash_t
+  bit::core::keyed_hash_policy::operator()( const CharT* str,
+                                            std::size_t count )
+  const noexcept
+{
+  return hash_bytes_keyed( key, str, count * sizeof(CharT) );
+}
+
+//=============================================================================
+// class : keyed_hash
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template<typename Key>
+inline bit::core::keyed_hash<Key>::keyed_hash()
+  : m_key(process_hash_key())
+{
+
+}
+
+template<typename Key>
+inline bit::core::keyed_hash<Key>::keyed_hash( const hash_key& key )
+  noexcept
+  : m_key(key)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Hashing
+//-----------------------------------------------------------------------------
+
+template<typename Key>
+inline bit::core::hash_t
+  bit::core::keyed_hash<Key>::operator()( const Key& val )
+  const noexcept( has_unique_object_representation<Key>::value ||
+                  is_nothrow_hashable<Key>::value )
+{
+  return detail::keyed_hash_value( m_key, val );
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename Key>
+inline const bit::core::hash_key& bit::core::keyed_hash<Key>::key()
+  const noexcept
+{
+  return m_key;
+}
+
+#endif /* BIT_CORE_UTILITIES_DETAIL_KEYED_HASH_INL */
@@ -0,0 +1,411 @@
+#ifndef BIT_CORE_UTILITIES_DETAIL_PARSE_INL
+#define BIT_CORE_UTILITIES_DETAIL_PARSE_INL
+
+namespace bit { namespace core { namespace detail {
+
+  //--------------------------------------------------------------------------
+  // Digits
+  //--------------------------------------------------------------------------
+
+  /// \brief The powers of ten that fit in 8 digits
+  template<typename = void>
+  struct parse_digit_powers
+  {
+    static const std::uint64_t value[9];
+  };
+
+  template<typename T>
+  const std::uint64_t parse_digit_powers<T>::value[9] = {
+    1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u
+  };
+
+  inline constexpr bool parse_is_digit( char c )
+    noexcept
+  {
+    return static_cast<unsigned char>(c - '0') < 10u;
+  }
+
+  /// \brief Loads the 8 characters at \p p, so that the first character is
+  ///        the least significant byte
+  inline std::uint64_t parse_load_word( const char* p )
+    noexcept
+  {
+#if defined(BIT_LITTLE_ENDIAN)
+    auto word = std::uint64_t{};
+    std::memcpy( &word, p, sizeof(word) );
+    return word;
+#else
+    auto word = std::uint64_t{};
+    for( auto i = 0; i < 8; ++i ) {
+      word |= std::uint64_t{static_cast<unsigned char>(p[i])} << (8 * i);
+    }
+    return word;
+#endif
+  }
+
+  /// \brief Counts the digits at the start of a loaded \p word
+  inline unsigned parse_digit_count( std::uint64_t word )
+    noexcept
+  {
+    // A byte is a digit if its high nibble is 3, and adding 6 does not
+    // change that. A carry out of a non-digit byte can only disturb the
+    // bytes after it, which are not counted.
+    const auto t = ((word & 0xf0f0f0f0f0f0f0f0ull) ^ 0x3030303030303030ull) |
+                   (((word + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) ^ 0x3030303030303030ull);
+
+    if( t == 0u ) return 8u;
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>( __builtin_ctzll( t ) ) / 8u;
+#else
+    auto count = 0u;
+    for( auto m = t; (m & 0xffu) == 0u; m >>= 8 ) ++count;
+    return count;
+#endif
+  }
+
+  /// \brief Converts the first \p count digits of a loaded \p word to
+  ///        their value, with a few multiplications instead of one per digit
+  ///
+  /// \pre 0 < count <= 8
+  inline std::uint64_t parse_eight_digits( std::uint64_t word, unsigned count )
+    noexcept
+  {
+    // Move the digits to the top of the word and pad with leading '0's
+    if( count < 8u ) {
+      word = (word << (64u - 8u * count)) | (0x3030303030303030ull >> (8u * count));
+    }
+    word -= 0x3030303030303030ull;
+    word  = (word * 10u) + (word >> 8);
+    word  = (((word & 0x000000ff000000ffull) * 0x000f424000000064ull) +
+             (((word >> 16) & 0x000000ff000000ffull) * 0x0000271000000001ull)) >> 32;
+    return word & 0xffffffffu;
+  }
+
+  /// \brief Parses the digits at \p p into \p value, wrapping on overflow
+  ///
+  /// \return the end of the digits
+  inline const char* parse_digits_wrapping( const char* p,
+                                            const char* last,
+                                            std::uint64_t& value )
+    noexcept
+  {
+    const auto& powers = parse_digit_powers<>::value;
+
+    while( last - p >= 8 ) {
+      const auto word  = parse_load_word( p );
+      const auto count = parse_digit_count( word );
+      if( count == 0u ) return p;
+
+      value = value * powers[count] + parse_eight_digits( word, count );
+      p += count;
+      if( count != 8u ) return p;
+    }
+    for( ; p != last && parse_is_digit( *p ); ++p ) {
+      value = value * 10u + static_cast<unsigned>( *p - '0' );
+    }
+    return p;
+  }
+
+  //--------------------------------------------------------------------------
+  // Integers
+  //--------------------------------------------------------------------------
+
+  /// \brief Parses the digits at \p p into \p value
+  ///
+  /// \return the end of the digits
+  inline const char* parse_digits_checked( const char* p,
+                                           const char* last,
+                                           std::uint64_t& value,
+                                           bool& overflow )
+    noexcept
+  {
+    const auto& powers = parse_digit_powers<>::value;
+
+    while( p != last && *p == '0' ) ++p;
+
+    // Up to 19 digits always fit, and may be taken 8 at a time
+    auto count = 0u;
+    while( last - p >= 8 ) {
+      const auto word   = parse_load_word( p );
+      const auto digits = parse_digit_count( word );
+      if( digits == 0u || count + digits > 19u ) break;
+
+      value = value * powers[digits] + parse_eight_digits( word, digits );
+      p     += digits;
+      count += digits;
+      if( digits != 8u ) return p;
+    }
+
+    constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+    for( ; p != last && parse_is_digit( *p ); ++p ) {
+      const auto d = static_cast<unsigned>( *p - '0' );
+      if( overflow || value > (max - d) / 10u ) {
+        overflow = true;
+      } else {
+        value = value * 10u + d;
+      }
+    }
+    return p;
+  }
+
+  template<typename T>
+  inline expected<T,parse_error> parse_integer( const char* first,
+                                                const char* last,
+                                                std::size_t& length )
+    noexcept
+  {
+    auto p = first;
+    const auto negative = std::is_signed<T>::value && p != last && *p == '-';
+    if( negative ) ++p;
+
+    if( p == last || !parse_is_digit( *p ) ) {
+      length = 0u;
+      return make_unexpected<parse_error>( parse_error::invalid_argument );
+    }
+
+    auto magnitude = std::uint64_t{0};
+    auto overflow  = false;
+    p = parse_digits_checked( p, last, magnitude, overflow );
+    length = static_cast<std::size_t>( p - first );
+
+    const auto limit = negative
+      ? static_cast<std::uint64_t>( -(std::numeric_limits<T>::min() + 1) ) + 1u
+      : static_cast<std::uint64_t>( std::numeric_limits<T>::max() );
+
+    if( overflow || magnitude > limit ) {
+      return make_unexpected<parse_error>( parse_error::out_of_range );
+    }
+    if( negative ) {
+      return static_cast<T>( -static_cast<std::int64_t>( magnitude - 1u ) - 1 );
+    }
+    return static_cast<T>( magnitude );
+  }
+
+  //--------------------------------------------------------------------------
+  // Floating Point
+  //--------------------------------------------------------------------------
+
+  /// \brief Matches the lowercase \p word at \p p, ignoring case
+  ///
+  /// \return the length of \p word if it matched, otherwise 0
+  inline std::size_t parse_match_word( const char* p,
+                                       const char* last,
+                                       const char* word )
+    noexcept
+  {
+    auto count = std::size_t{0};
+    for( ; word[count] != '\0'; ++count ) {
+      if( p + count == last || (p[count] | 0x20) != word[count] ) {
+        return 0u;
+      }
+    }
+    return count;
+  }
+
+  /// \brief Parses "inf", "infinity", "nan" or "nan(chars)" at \p p
+  ///
+  /// \return the end of the match, or \p p if there is none
+  template<typename T>
+  inline const char* parse_float_special( const char* p,
+                                          const char* last,
+                                          T& value )
+    noexcept
+  {
+    if( const auto n = parse_match_word( p, last, "infinity" ) ) {
+      value = std::numeric_limits<T>::infinity();
+      return p + n;
+    }
+    if( const auto n = parse_match_word( p, last, "inf" ) ) {
+      value = std::numeric_limits<T>::infinity();
+      return p + n;
+    }
+    if( const auto n = parse_match_word( p, last, "nan" ) ) {
+      value = std::numeric_limits<T>::quiet_NaN();
+      p += n;
+
+      // The optional n-char-sequence is only consumed when it is closed
+      if( p != last && *p == '(' ) {
+        auto q = p + 1;
+        for( ; q != last; ++q ) {
+          const auto c = *q;
+          const auto alpha = static_cast<unsigned char>((c | 0x20) - 'a') < 26u;
+          if( !(alpha || parse_is_digit( c ) || c == '_') ) break;
+        }
+        if( q != last && *q == ')' ) {
+          p = q + 1;
+        }
+      }
+      return p;
+    }
+    return p;
+  }
+
+  template<typename T>
+  inline expected<T,parse_error> parse_float( const char* first,
+                                              const char* last,
+                                              std::size_t& length )
+    noexcept
+  {
+    auto p = first;
+    const auto negative = (p != last && *p == '-');
+    if( negative ) ++p;
+
+    if( p != last && !parse_is_digit( *p ) && *p != '.' ) {
+      auto value = T{};
+      const auto end = parse_float_special( p, last, value );
+      if( end == p ) {
+        length = 0u;
+        return make_unexpected<parse_error>( parse_error::invalid_argument );
+      }
+      length = static_cast<std::size_t>( end - first );
+      return negative ? -value : value;
+    }
+
+    // Significand
+    auto w = std::uint64_t{0};
+    auto digits = parse_float_digits{ p, p, p, p };
+    p = parse_digits_wrapping( p, last, w );
+    digits.integer_last = p;
+    digits.fraction_first = p;
+    digits.fraction_last  = p;
+    if( p != last && *p == '.' ) {
+      digits.fraction_first = p + 1;
+      p = parse_digits_wrapping( p + 1, last, w );
+      digits.fraction_last = p;
+    }
+
+    const auto integer_count  = static_cast<std::size_t>( digits.integer_last - digits.integer_first );
+    const auto fraction_count = static_cast<std::size_t>( digits.fraction_last - digits.fraction_first );
+    if( integer_count + fraction_count == 0u ) {
+      length = 0u;
+      return make_unexpected<parse_error>( parse_error::invalid_argument );
+    }
+
+    // Exponent; a malformed exponent is not part of the number
+    auto exponent = std::int64_t{0};
+    if( p != last && (*p | 0x20) == 'e' ) {
+      auto e = p + 1;
+      const auto exponent_negative = (e != last && *e == '-');
+      if( e != last && (*e == '-' || *e == '+') ) ++e;
+      if( e != last && parse_is_digit( *e ) ) {
+        for( ; e != last && parse_is_digit( *e ); ++e ) {
+          if( exponent < 0x10000000 ) {
+            exponent = exponent * 10 + (*e - '0');
+          }
+        }
+        if( exponent_negative ) exponent = -exponent;
+        p = e;
+      }
+    }
+    length = static_cast<std::size_t>( p - first );
+
+    auto q = exponent - static_cast<std::int64_t>( fraction_count );
+
+    // With more than 19 significant digits, w has wrapped; it is rebuilt
+    // from the leading 19 digits
+    auto truncated = false;
+    if( integer_count + fraction_count > 19u ) {
+      auto* i = digits.integer_first;
+      while( i != digits.integer_last && *i == '0' ) ++i;
+      auto* f = digits.fraction_first;
+      if( i == digits.integer_last ) {
+        while( f != digits.fraction_last && *f == '0' ) ++f;
+      }
+      digits.integer_first  = i;
+      digits.fraction_first = f;
+
+      const auto significant = static_cast<std::size_t>( (digits.integer_last - i) + (digits.fraction_last - f) );
+      if( significant > 19u ) {
+        truncated = true;
+        w = 0u;
+        auto taken = 0u;
+        for( ; i != digits.integer_last && taken < 19u; ++i, ++taken ) {
+          w = w * 10u + static_cast<unsigned>( *i - '0' );
+        }
+        for( ; f != digits.fraction_last && taken < 19u; ++f, ++taken ) {
+          w = w * 10u + static_cast<unsigned>( *f - '0' );
+        }
+        q += static_cast<std::int64_t>( significant - 19u );
+      }
+    }
+
+    auto value = T{};
+    if( !truncated && parse_float_fast_path<T>( q, w, value ) ) {
+      return negative ? -value : value;
+    }
+
+    auto result = parse_float_compute<T>( q, w );
+    if( truncated ) {
+      const auto upper = parse_float_compute<T>( q, w + 1u );
+      if( upper != result ) {
+        const auto significant_exponent = q - static_cast<std::int64_t>(
+          (digits.integer_last - digits.integer_first) +
+          (digits.fraction_last - digits.fraction_first) - 19
+        );
+        result = parse_float_round_digits<T>( digits, significant_exponent, result );
+      }
+    }
+
+    if( result.power2 == parse_float_format<T>::infinite_power ) {
+      return make_unexpected<parse_error>( parse_error::out_of_range );
+    }
+    return parse_float_to_value<T>( result, negative );
+  }
+
+  //--------------------------------------------------------------------------
+
+  template<typename T>
+  inline expected<T,parse_error> parse( const char* first,
+                                        const char* last,
+                                        std::size_t& length,
+                                        std::true_type )
+    noexcept
+  {
+    return parse_integer<T>( first, last, length );
+  }
+
+  template<typename T>
+  inline expected<T,parse_error> parse( const char* first,
+                                        const char* last,
+                                        std::size_t& length,
+                                        std::false_type )
+    noexcept
+  {
+    return parse_float<T>( first, last, length );
+  }
+
+} } } // namespace bit::core::detail
+
+//----------------------------------------------------------------------------
+// parse
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::core::expected<T,bit::core::parse_error>
+  bit::core::parse( string_view str, std::size_t& length )
+  noexcept
+{
+  static_assert( std::is_integral<T>::value || std::is_same<T,float>::value ||
+                 std::is_same<T,double>::value,
+                 "parse only supports integral types, float and double" );
+  static_assert( !std::is_same<T,bool>::value,
+                 "parse does not support bool" );
+
+  return detail::parse<T>( str.data(), str.data() + str.size(), length,
+                           std::is_integral<T>{} );
+}
+
+template<typename T>
+inline bit::core::expected<T,bit::core::parse_error>
+  bit::core::parse( string_view str )
+  noexcept
+{
+  auto length = std::size_t{};
+  auto result = parse<T>( str, length );
+  if( result && length != str.size() ) {
+    return make_unexpected<parse_error>( parse_error::invalid_argument );
+  }
+  return result;
+}
+
+#endif /* BIT_CORE_UTILITIES_DETAIL_PARSE_INL */
@@ -0,0 +1,226 @@
+#ifndef BIT_CORE_UTILITIES_DETAIL_PERFECT_HASH_INL
+#define BIT_CORE_UTILITIES_DETAIL_PERFECT_HASH_INL
+
+//=============================================================================
+// class : basic_perfect_hash
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Static Members
+//-----------------------------------------------------------------------------
+
+template<typename CharT, std::size_t N, typename Traits>
+constexpr typename bit::core::basic_perfect_hash<CharT,N,Traits>::size_type
+  bit::core::basic_perfect_hash<CharT,N,Traits>::npos;
+
+template<typename CharT, std::size_t N, typename Traits>
+constexpr typename bit::core::basic_perfect_hash<CharT,N,Traits>::size_type
+  bit::core::basic_perfect_hash<CharT,N,Traits>::bucket_count;
+
+template<typename CharT, std::size_t N, typename Traits>
+constexpr typename bit::core::basic_perfect_hash<CharT,N,Traits>::size_type
+  bit::core::basic_perfect_hash<CharT,N,Traits>::slot_count;
+
+template<typename CharT, std::size_t N, typename Traits>
+constexpr typename bit::core::basic_perfect_hash<CharT,N,Traits>::index_type
+  bit::core::basic_perfect_hash<CharT,N,Traits>::empty_slot;
+
+//-----------------------------------------------------------------------------
+// Constructor
+//-----------------------------------------------------------------------------
+
+template<typename CharT, std::size_t N, typename Traits>
+inline constexpr bit::core::basic_perfect_hash<CharT,N,Traits>
+  ::basic_perfect_hash( const view_type (&keys)[N] )
+  : m_keys{},
+    m_hashes{},
+    m_seeds{},
+    m_slots{}
+{
+  for( auto i = size_type{0}; i < N; ++i ) {
+    m_keys[i]   = keys[i];
+    m_hashes[i] = hash_value( keys[i] );
+
+    for( auto j = size_type{0}; j < i; ++j ) {
+      BIT_ASSERT_OR_THROW( !equal( m_keys[i], m_keys[j] ),
+                           std::invalid_argument,
+                           "basic_perfect_hash: duplicate key" );
+
+      // Keys are placed by their hash alone, so distinct keys whose hashes
+      // collide can never be told apart
+      BIT_ASSERT_OR_THROW( m_hashes[i] != m_hashes[j],
+                           std::logic_error,
+                           "basic_perfect_hash: keys have colliding hashes" );
+    }
+  }
+  for( auto& slot : m_slots ) {
+    slot = empty_slot;
+  }
+
+  // Order the buckets from largest to smallest, since the largest buckets
+  // are the hardest to place
+  size_type sizes[bucket_count] = {};
+  size_type order[bucket_count] = {};
+  for( auto i = size_type{0}; i < N; ++i ) {
+    ++sizes[bucket_of( m_hashes[i] )];
+  }
+  for( auto i = size_type{0}; i < bucket_count; ++i ) {
+    auto j = i;
+    for( ; j > 0 && sizes[order[j - 1]] < sizes[i]; --j ) {
+      order[j] = order[j - 1];
+    }
+    order[j] = i;
+  }
+
+  for( auto b : order ) {
+    if( sizes[b] == 0 ) break;
+
+    for( auto seed = seed_type{0}; ; ++seed ) {
+      BIT_ASSERT_OR_THROW( seed != static_cast<seed_type>(-1),
+                           std::logic_error,
+                           "basic_perfect_hash: unable to find a perfect hash" );
+
+      // Tentatively place every key of the bucket, undoing the placements on
+      // the first collision
+      auto placed = size_type{0};
+      auto i      = size_type{0};
+      for( ; i < N; ++i ) {
+        if( bucket_of( m_hashes[i] ) != b ) continue;
+
+        const auto slot = slot_of( m_hashes[i], seed );
+        if( m_slots[slot] != empty_slot ) break;
+
+        m_slots[slot] = static_cast<index_type>(i);
+        ++placed;
+      }
+
+      if( placed == sizes[b] ) {
+        m_seeds[b] = seed;
+        break;
+      }
+
+      for( auto j = size_type{0}; j < i; ++j ) {
+        if( bucket_of( m_hashes[j] ) != b ) continue;
+
+        m_slots[slot_of( m_hashes[j], seed )] = empty_slot;
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Lookup
+//-----------------------------------------------------------------------------
+
+template<typename CharT, std::size_t N, typename Traits>
+inline constexpr typename bit::core::basic_perfect_hash<CharT,N,Traits>::size_type
+  bit::core::basic_perfect_hash<CharT,N,Traits>::find( view_type key )
+  const noexcept
+{
+  return find( key, hash_value( key ) );
+}
+
+template<typename CharT, std::size_t N, typename Traits>
+inline constexpr typename bit::core::basic_perfect_hash<CharT,N,Traits>::size_type
+  bit::core::basic_perfect_hash<CharT,N,Traits>::find( view_type key,
+                                                       hash_t hash )
+  const noexcept
+{
+  const auto seed  = m_seeds[bucket_of( hash )];
+  const auto index = m_slots[slot_of( hash, seed )];
+
+  if( index == empty_slot || m_hashes[index] != hash ) {
+    return npos;
+  }
+  return equal( m_keys[index], key ) ? static_cast<size_type>(index) : npos;
+}
+
+template<typename CharT, std::size_t N, typename Traits>
+inline constexpr bool
+  bit::core::basic_perfect_hash<CharT,N,Traits>::contains( view_type key )
+  const noexcept
+{
+  return find( key ) != npos;
+}
+
+//-----------------------------------------------------------------------------
+// Observers
+//-----------------------------------------------------------------------------
+
+template<typename CharT, std::size_t N, typename Traits>
+inline constexpr typename bit::core::basic_perfect_hash<CharT,N,Traits>::size_type
+  bit::core::basic_perfect_hash<CharT,N,Traits>::size()
+  const noexcept
+{
+  return N;
+}
+
+template<typename CharT, std::size_t N, typename Traits>
+inline constexpr typename bit::core::basic_perfect_hash<CharT,N,Traits>::view_type
+  bit::core::basic_perfect_hash<CharT,N,Traits>::operator[]( size_type index )
+  const noexcept
+{
+  return m_keys[index];
+}
+
+//-----------------------------------------------------------------------------
+// Private Static Member Functions
+//-----------------------------------------------------------------------------
+
+template<typename CharT, std::size_t N, typename Traits>
+inline constexpr typename bit::core::basic_perfect_hash<CharT,N,Traits>::size_type
+  bit::core::basic_perfect_hash<CharT,N,Traits>::bucket_of( hash_t hash )
+  noexcept
+{
+  return static_cast<size_type>(hash) & (bucket_count - 1u);
+}
+
+template<typename CharT, std::size_t N, typename Traits>
+inline constexpr typename bit::core::basic_perfect_hash<CharT,N,Traits>::size_type
+  bit::core::basic_perfect_hash<CharT,N,Traits>::slot_of( hash_t hash,
+                                                          seed_type seed )
+  noexcept
+{
+  return static_cast<size_type>( hash_mix( hash ^ static_cast<hash_t>(seed) ) ) & (slot_count - 1u);
+}
+
+template<typename CharT, std::size_t N, typename Traits>
+inline constexpr bool
+  bit::core::basic_perfect_hash<CharT,N,Traits>::equal( view_type lhs,
+                                                        view_type rhs )
+  noexcept
+{
+  if( lhs.size() != rhs.size() ) {
+    return false;
+  }
+  if( !BIT_IS_CONSTANT_EVALUATED() ) {
+    return Traits::compare( lhs.data(), rhs.data(), lhs.size() ) == 0;
+  }
+  for( auto i = size_type{0}; i < lhs.size(); ++i ) {
+    if( !Traits::eq( lhs[i], rhs[i] ) ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+//=============================================================================
+// non-member functions : class : basic_perfect_hash
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Utilities
+//-----------------------------------------------------------------------------
+
+template<typename CharT, std::size_t...Ns>
+inline constexpr bit::core::basic_perfect_hash<CharT,sizeof...(Ns)>
+  bit::core::make_perfect_hash( const CharT (&...keys)[Ns] )
+{
+  const basic_string_view<CharT> views[] = {
+    basic_string_view<CharT>( keys, Ns - 1 )...
+  };
+
+  return basic_perfect_hash<CharT,sizeof...(Ns)>( views );
+}
+
+#endif /* BIT_CORE_UTILITIES_DETAIL_PERFECT_HASH_INL */
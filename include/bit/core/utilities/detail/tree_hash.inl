@@ -0,0 +1,94 @@
+#ifndef BIT_CORE_UTILITIES_DETAIL_TREE_HASH_INL
+#define BIT_CORE_UTILITIES_DETAIL_TREE_HASH_INL
+
+//=============================================================================
+// Tree Hashing
+//=============================================================================
+
+inline constexpr std::size_t bit::core::tree_hash_chunk_size()
+  noexcept
+{
+  return std::size_t{1} << 18;
+}
+
+namespace bit { namespace core { namespace detail {
+
+  /// \brief Hashes the chunks of \p data whose indices are taken from
+  ///        \p next, until every chunk has been taken
+  inline void tree_hash_leaves( const unsigned char* data,
+                                std::size_t size,
+                                std::uint64_t* leaves,
+                                std::size_t count,
+                                std::atomic<std::size_t>& next )
+    noexcept
+  {
+    constexpr auto chunk_size = tree_hash_chunk_size();
+
+    for( auto i = next.fetch_add( 1u, std::memory_order_relaxed );
+         i < count;
+         i = next.fetch_add( 1u, std::memory_order_relaxed ) ) {
+      const auto offset = i * chunk_size;
+
+      leaves[i] = wide_hash_bytes( data + offset,
+                                   (std::min)( chunk_size, size - offset ),
+                                   i );
+    }
+  }
+
+} } } // namespace bit::core::detail
+
+//-----------------------------------------------------------------------------
+
+inline bit::core::hash_t bit::core::tree_hash( span<const byte> bytes,
+                                               std::size_t threads )
+{
+  constexpr auto chunk_size = tree_hash_chunk_size();
+
+  const auto* data = reinterpret_cast<const unsigned char*>( bytes.data() );
+  const auto size  = static_cast<std::size_t>( bytes.size() );
+  const auto count = (size + chunk_size - 1u) / chunk_size;
+
+  auto leaves = std::vector<std::uint64_t>( count );
+  std::atomic<std::size_t> next{0u};
+
+  if( threads == 0u ) {
+    threads = std::thread::hardware_concurrency();
+  }
+  threads = (std::min)( threads, count );
+
+  auto workers = std::vector<std::thread>{};
+  if( threads > 1u ) {
+    workers.reserve( threads - 1u );
+  }
+
+  for( auto t = std::size_t{1}; t < threads; ++t ) {
+#if BIT_COMPILER_EXCEPTIONS_ENABLED
+    try {
+#endif
+      workers.emplace_back( [&]{
+        detail::tree_hash_leaves( data, size, leaves.data(), count, next );
+      });
+#if BIT_COMPILER_EXCEPTIONS_ENABLED
+    } catch( const std::system_error& ) {
+      // The chunks this thread would have hashed are taken by the others
+      break;
+    }
+#endif
+  }
+
+  detail::tree_hash_leaves( data, size, leaves.data(), count, next );
+
+  for( auto& worker : workers ) {
+    worker.join();
+  }
+
+  // The chunk hashes are read as little-endian words, so that the root does
+  // not depend on the byte order of the platform
+  return static_cast<hash_t>(
+    detail::wide_hash_chars( leaves.data(),
+                             count,
+                             static_cast<std::uint64_t>(size) )
+  );
+}
+
+#endif /* BIT_CORE_UTILITIES_DETAIL_TREE_HASH_INL */
@@ -0,0 +1,739 @@
+#ifndef BIT_CORE_UTILITIES_DETAIL_UNICODE_INL
+#define BIT_CORE_UTILITIES_DETAIL_UNICODE_INL
+
+namespace bit { namespace core { namespace detail {
+
+  //--------------------------------------------------------------------------
+  // Decoding
+  //--------------------------------------------------------------------------
+
+  /// \brief Decodes the code point at the start of the \p n bytes of UTF-8
+  ///        at \p p into \p c
+  ///
+  /// \return the length of the sequence, or 0 if it is invalid
+  inline std::size_t unicode_decode( const unsigned char* p,
+                                     std::size_t n,
+                                     char32_t& c )
+    noexcept
+  {
+    const auto b0 = static_cast<std::uint32_t>(p[0]);
+
+    if( b0 < 0x80u ) {
+      c = b0;
+      return 1u;
+    }
+    // Continuations, and leads of overlong two byte sequences
+    if( b0 < 0xc2u ) return 0u;
+
+    if( b0 < 0xe0u ) {
+      if( n < 2u || (p[1] & 0xc0u) != 0x80u ) return 0u;
+
+      c = ((b0 & 0x1fu) << 6) | (p[1] & 0x3fu);
+      return 2u;
+    }
+    if( b0 < 0xf0u ) {
+      // E0 must not be overlong, and ED must not encode a surrogate
+      const auto low  = (b0 == 0xe0u) ? 0xa0u : 0x80u;
+      const auto high = (b0 == 0xedu) ? 0x9fu : 0xbfu;
+      if( n < 3u || p[1] < low || p[1] > high || (p[2] & 0xc0u) != 0x80u ) {
+        return 0u;
+      }
+
+      c = ((b0 & 0x0fu) << 12) | ((p[1] & 0x3fu) << 6) | (p[2] & 0x3fu);
+      return 3u;
+    }
+    if( b0 < 0xf5u ) {
+      // F0 must not be overlong, and F4 must not exceed U+10FFFF
+      const auto low  = (b0 == 0xf0u) ? 0x90u : 0x80u;
+      const auto high = (b0 == 0xf4u) ? 0x8fu : 0xbfu;
+      if( n < 4u || p[1] < low || p[1] > high ||
+          (p[2] & 0xc0u) != 0x80u || (p[3] & 0xc0u) != 0x80u ) {
+        return 0u;
+      }
+
+      c = ((b0 & 0x07u) << 18) | ((p[1] & 0x3fu) << 12) |
+          ((p[2] & 0x3fu) << 6) | (p[3] & 0x3fu);
+      return 4u;
+    }
+    return 0u;
+  }
+
+  /// \copydoc unicode_decode( const unsigned char*, std::size_t, char32_t& )
+  inline std::size_t unicode_decode( const char16_t* p,
+                                     std::size_t n,
+                                     char32_t& c )
+    noexcept
+  {
+    const auto u0 = static_cast<std::uint32_t>(p[0]);
+
+    if( (u0 & 0xf800u) != 0xd800u ) {
+      c = u0;
+      return 1u;
+    }
+    if( u0 >= 0xdc00u || n < 2u ) return 0u;
+
+    const auto u1 = static_cast<std::uint32_t>(p[1]);
+    if( (u1 & 0xfc00u) != 0xdc00u ) return 0u;
+
+    c = 0x10000u + ((u0 - 0xd800u) << 10) + (u1 - 0xdc00u);
+    return 2u;
+  }
+
+  /// \copydoc unicode_decode( const unsigned char*, std::size_t, char32_t& )
+  inline std::size_t unicode_decode( const char32_t* p,
+                                     std::size_t,
+                                     char32_t& c )
+    noexcept
+  {
+    const auto u0 = static_cast<std::uint32_t>(p[0]);
+
+    if( u0 > 0x10ffffu || (u0 & 0xfffff800u) == 0xd800u ) return 0u;
+
+    c = u0;
+    return 1u;
+  }
+
+  //--------------------------------------------------------------------------
+  // Encoding
+  //--------------------------------------------------------------------------
+
+  /// \brief Encodes the code point \p c into the \p n code units at \p p
+  ///
+  /// \return the number of code units written, or 0 if they do not fit
+  inline std::size_t unicode_encode( char32_t c, char* p, std::size_t n )
+    noexcept
+  {
+    const auto u = static_cast<std::uint32_t>(c);
+
+    if( u < 0x80u ) {
+      if( n < 1u ) return 0u;
+      p[0] = static_cast<char>(u);
+      return 1u;
+    }
+    if( u < 0x800u ) {
+      if( n < 2u ) return 0u;
+      p[0] = static_cast<char>(0xc0u | (u >> 6));
+      p[1] = static_cast<char>(0x80u | (u & 0x3fu));
+      return 2u;
+    }
+    if( u < 0x10000u ) {
+      if( n < 3u ) return 0u;
+      p[0] = static_cast<char>(0xe0u | (u >> 12));
+      p[1] = static_cast<char>(0x80u | ((u >> 6) & 0x3fu));
+      p[2] = static_cast<char>(0x80u | (u & 0x3fu));
+      return 3u;
+    }
+    if( n < 4u ) return 0u;
+    p[0] = static_cast<char>(0xf0u | (u >> 18));
+    p[1] = static_cast<char>(0x80u | ((u >> 12) & 0x3fu));
+    p[2] = static_cast<char>(0x80u | ((u >> 6) & 0x3fu));
+    p[3] = static_cast<char>(0x80u | (u & 0x3fu));
+    return 4u;
+  }
+
+  /// \copydoc unicode_encode( char32_t, char*, std::size_t )
+  inline std::size_t unicode_encode( char32_t c, char16_t* p, std::size_t n )
+    noexcept
+  {
+    const auto u = static_cast<std::uint32_t>(c);
+
+    if( u < 0x10000u ) {
+      if( n < 1u ) return 0u;
+      p[0] = static_cast<char16_t>(u);
+      return 1u;
+    }
+    if( n < 2u ) return 0u;
+    p[0] = static_cast<char16_t>(0xd800u + ((u - 0x10000u) >> 10));
+    p[1] = static_cast<char16_t>(0xdc00u + ((u - 0x10000u) & 0x3ffu));
+    return 2u;
+  }
+
+  /// \copydoc unicode_encode( char32_t, char*, std::size_t )
+  inline std::size_t unicode_encode( char32_t c, char32_t* p, std::size_t n )
+    noexcept
+  {
+    if( n < 1u ) return 0u;
+    p[0] = c;
+    return 1u;
+  }
+
+  //--------------------------------------------------------------------------
+  // Blocks
+  //--------------------------------------------------------------------------
+
+  // Runs of code units that convert one to one -- ASCII, or code points
+  // below U+10000 between UTF-16 and UTF-32 -- are checked 8 units at a time
+  // with word loads, and copied without decoding.
+
+  /// \brief Determines whether the 8 bytes at \p p are ASCII
+  inline bool unicode_is_ascii_8( const unsigned char* p )
+    noexcept
+  {
+    auto word = std::uint64_t{};
+    std::memcpy( &word, p, sizeof(word) );
+
+    return (word & 0x8080808080808080u) == 0u;
+  }
+
+  /// \brief Determines whether the 8 code units at \p p are ASCII
+  inline bool unicode_is_ascii_8( const char16_t* p )
+    noexcept
+  {
+    // Indexed rather than copied with a 16-byte memcpy, which GCC flags
+    // with -Warray-bounds when inlined for inputs shorter than 8 units
+    auto bits = 0u;
+    for( auto i = 0; i < 8; ++i ) {
+      bits |= p[i];
+    }
+    return (bits & 0xff80u) == 0u;
+  }
+
+  /// \brief Determines whether the 8 code units at \p p are ASCII
+  inline bool unicode_is_ascii_8( const char32_t* p )
+    noexcept
+  {
+    std::uint64_t words[4];
+    std::memcpy( words, p, sizeof(words) );
+
+    return ((words[0] | words[1] | words[2] | words[3]) & 0xffffff80ffffff80u) == 0u;
+  }
+
+  /// \brief Determines whether the 8 code units at \p p contain a surrogate
+  inline bool unicode_has_surrogate_8( const char16_t* p )
+    noexcept
+  {
+    auto result = false;
+    for( auto i = 0; i < 8; ++i ) {
+      result |= (p[i] & 0xf800u) == 0xd800u;
+    }
+    return result;
+  }
+
+  /// \brief Determines whether each of the 8 code units at \p p is a code
+  ///        point that a single UTF-16 code unit encodes
+  inline bool unicode_is_single_utf16_8( const char32_t* p )
+    noexcept
+  {
+    auto result = true;
+    for( auto i = 0; i < 8; ++i ) {
+      result &= (p[i] < 0x10000u) & ((p[i] & 0xf800u) != 0xd800u);
+    }
+    return result;
+  }
+
+  template<typename CharT>
+  inline bool unicode_is_direct_8( const unsigned char* p, CharT* )
+    noexcept
+  {
+    return unicode_is_ascii_8( p );
+  }
+
+  inline bool unicode_is_direct_8( const char16_t* p, char* )
+    noexcept
+  {
+    return unicode_is_ascii_8( p );
+  }
+
+  inline bool unicode_is_direct_8( const char16_t* p, char32_t* )
+    noexcept
+  {
+    return !unicode_has_surrogate_8( p );
+  }
+
+  inline bool unicode_is_direct_8( const char32_t* p, char* )
+    noexcept
+  {
+    return unicode_is_ascii_8( p );
+  }
+
+  inline bool unicode_is_direct_8( const char32_t* p, char16_t* )
+    noexcept
+  {
+    return unicode_is_single_utf16_8( p );
+  }
+
+  /// \brief Converts blocks of 8 code units from \p in, starting from \p i,
+  ///        into \p out, starting from \p o, without decoding them one at a
+  ///        time, where the target can do so
+  ///
+  /// Stops at the first block that cannot be converted this way.
+  template<typename From, typename To>
+  inline void unicode_convert_blocks( const From*, std::size_t,
+                                      To*, std::size_t,
+                                      std::size_t&, std::size_t& )
+    noexcept
+  {
+
+  }
+
+#if defined(BIT_CORE_UNICODE_HAS_SIMD_UTF8)
+  template<typename From>
+  inline void unicode_convert_blocks( const From* in, std::size_t n,
+                                      char* out, std::size_t capacity,
+                                      std::size_t& i, std::size_t& o )
+    noexcept
+  {
+    // The positions are kept in locals, since stores through char* could
+    // otherwise alias them
+    auto read  = i;
+    auto write = o;
+
+    // Blocks are only encoded with room for 32 bytes of stores
+    while( n - read >= 8u && capacity - write >= 32u ) {
+      const auto written = unicode_utf8_encode_8( in + read, out + write );
+      if( written == 0u ) break;
+
+      read  += 8u;
+      write += written;
+    }
+    i = read;
+    o = write;
+  }
+#endif
+
+  //--------------------------------------------------------------------------
+  // Validation
+  //--------------------------------------------------------------------------
+
+  inline bool unicode_validate( const unsigned char* p, std::size_t n )
+    noexcept
+  {
+#if defined(BIT_CORE_UNICODE_HAS_SIMD_UTF8)
+    return unicode_utf8_validate( p, n );
+#else
+    auto i = std::size_t{0};
+    while( i < n ) {
+      if( n - i >= 8u && unicode_is_ascii_8( p + i ) ) {
+        i += 8u;
+        continue;
+      }
+      char32_t c;
+      const auto length = unicode_decode( p + i, n - i, c );
+      if( length == 0u ) return false;
+      i += length;
+    }
+    return true;
+#endif
+  }
+
+  inline bool unicode_validate( const char16_t* p, std::size_t n )
+    noexcept
+  {
+    auto i = std::size_t{0};
+    while( i < n ) {
+      if( n - i >= 8u && !unicode_has_surrogate_8( p + i ) ) {
+        i += 8u;
+        continue;
+      }
+      char32_t c;
+      const auto length = unicode_decode( p + i, n - i, c );
+      if( length == 0u ) return false;
+      i += length;
+    }
+    return true;
+  }
+
+  inline bool unicode_validate( const char32_t* p, std::size_t n )
+    noexcept
+  {
+    // Branch-free, so that the whole string is checked in vectors
+    auto error = false;
+    for( auto i = std::size_t{0}; i < n; ++i ) {
+      const auto u = static_cast<std::uint32_t>(p[i]);
+      error |= (u > 0x10ffffu) | ((u - 0xd800u) < 0x800u);
+    }
+    return !error;
+  }
+
+  //--------------------------------------------------------------------------
+  // Lengths
+  //--------------------------------------------------------------------------
+
+  /// \brief Counts the continuation bytes and the four byte leads in the
+  ///        \p n bytes at \p p
+  inline void unicode_count_utf8( const unsigned char* p,
+                                  std::size_t n,
+                                  std::size_t& continuations,
+                                  std::size_t& fours )
+    noexcept
+  {
+    constexpr auto ones = std::uint64_t{0x0101010101010101u};
+
+    continuations = 0u;
+    fours = 0u;
+
+    auto i = std::size_t{0};
+    for( ; n - i >= 8u; i += 8u ) {
+      auto word = std::uint64_t{};
+      std::memcpy( &word, p + i, sizeof(word) );
+
+      // Sum the per-byte flags with a multiplication into the top byte
+      const auto continuation = (word >> 7) & ~(word >> 6) & ones;
+      const auto four = (word >> 7) & (word >> 6) & (word >> 5) & (word >> 4) & ones;
+
+      continuations += static_cast<std::size_t>( (continuation * ones) >> 56 );
+      fours         += static_cast<std::size_t>( (four * ones) >> 56 );
+    }
+    for( ; i < n; ++i ) {
+      continuations += (p[i] & 0xc0u) == 0x80u;
+      fours         += p[i] >= 0xf0u;
+    }
+  }
+
+  //--------------------------------------------------------------------------
+  // Conversion
+  //--------------------------------------------------------------------------
+
+  /// \brief Converts the \p n code units at \p in, starting from \p i, into
+  ///        the \p capacity code units at \p out, starting from \p o
+  ///
+  /// \return the number of code units written
+  template<typename From, typename To>
+  inline expected<std::size_t,unicode_error>
+    unicode_convert( const From* in, std::size_t n,
+                     To* out, std::size_t capacity,
+                     std::size_t i = 0u, std::size_t o = 0u )
+    noexcept
+  {
+    while( i < n ) {
+      unicode_convert_blocks( in, n, out, capacity, i, o );
+
+      while( n - i >= 8u && capacity - o >= 8u && unicode_is_direct_8( in + i, out ) ) {
+        for( auto j = 0; j < 8; ++j ) {
+          out[o + j] = static_cast<To>(in[i + j]);
+        }
+        i += 8u;
+        o += 8u;
+      }
+
+      // A block's worth of code units is decoded one at a time before the
+      // blocks are tried again
+      const auto stop = i + ((n - i < 8u) ? n - i : 8u);
+      while( i < stop ) {
+        char32_t c;
+        const auto length = unicode_decode( in + i, n - i, c );
+        if( length == 0u ) {
+          return make_unexpected<unicode_error>( unicode_error::invalid_encoding );
+        }
+        const auto written = unicode_encode( c, out + o, capacity - o );
+        if( written == 0u ) {
+          return make_unexpected<unicode_error>( unicode_error::buffer_too_small );
+        }
+        i += length;
+        o += written;
+      }
+    }
+    return o;
+  }
+
+  /// \brief Converts the \p n bytes of UTF-8 at \p in into the \p capacity
+  ///        code units at \p out
+  ///
+  /// \return the number of code units written
+  template<typename CharT>
+  inline expected<std::size_t,unicode_error>
+    unicode_convert_utf8( const unsigned char* in, std::size_t n,
+                          CharT* out, std::size_t capacity )
+    noexcept
+  {
+    auto i = std::size_t{0};
+    auto o = std::size_t{0};
+
+#if defined(BIT_CORE_UNICODE_HAS_SIMD_UTF8)
+    // Each block is validated on its own before decoding, and decoding
+    // stops at the last code point that ends within the block, so that the
+    // next block starts on a code point. Decoding reads 16 bytes from, and
+    // writes up to 16 units from, a position in the first 52 bytes of the
+    // block, which the margins on the input and output cover; anything the
+    // blocks cannot
+    // decode is left to the scalar conversion, which also pinpoints errors.
+    constexpr auto block = unicode_block_size();
+    constexpr auto last_start = block - 12u;
+
+    while( n - i >= block + 16u && capacity - o >= block + 8u ) {
+      auto ascii = false;
+      auto ends  = std::uint64_t{};
+      if( !unicode_utf8_check_chunk( in + i, ascii, ends ) ) break;
+
+      if( ascii ) {
+        unicode_widen_block( in + i, out + o );
+        i += block;
+        o += block;
+        continue;
+      }
+
+      auto* cursor = out + o;
+      auto position = std::size_t{0};
+      while( position < last_start ) {
+        const auto consumed = unicode_utf8_decode( in + i + position, ends >> position, cursor );
+        if( consumed == 0u ) break;
+        position += consumed;
+      }
+      if( position == 0u ) break;
+
+      i += position;
+      o = static_cast<std::size_t>( cursor - out );
+    }
+#endif
+
+    return unicode_convert( in, n, out, capacity, i, o );
+  }
+
+  /// \brief Makes the result of a conversion into \p buffer from the number
+  ///        of code units written
+  template<typename CharT>
+  inline expected<basic_string_view<CharT>,unicode_error>
+    unicode_result( const expected<std::size_t,unicode_error>& written,
+                    span<CharT> buffer )
+    noexcept
+  {
+    if( !written ) {
+      return make_unexpected<unicode_error>( written.error() );
+    }
+    return basic_string_view<CharT>( buffer.data(), *written );
+  }
+
+  template<typename CharT>
+  inline std::size_t unicode_capacity( span<CharT> buffer )
+    noexcept
+  {
+    return static_cast<std::size_t>( buffer.size() );
+  }
+
+  inline const unsigned char* unicode_bytes( string_view str )
+    noexcept
+  {
+    return reinterpret_cast<const unsigned char*>( str.data() );
+  }
+
+} } } // namespace bit::core::detail
+
+//----------------------------------------------------------------------------
+// Validation
+//----------------------------------------------------------------------------
+
+inline bool bit::core::is_valid_utf8( string_view str )
+  noexcept
+{
+  return detail::unicode_validate( detail::unicode_bytes( str ), str.size() );
+}
+
+template<std::ptrdiff_t Extent>
+inline bool bit::core::is_valid_utf8( string_span<Extent> str )
+  noexcept
+{
+  return is_valid_utf8( string_view( str.data(), str.size() ) );
+}
+
+inline bool bit::core::is_valid_utf16( u16string_view str )
+  noexcept
+{
+  return detail::unicode_validate( str.data(), str.size() );
+}
+
+template<std::ptrdiff_t Extent>
+inline bool bit::core::is_valid_utf16( u16string_span<Extent> str )
+  noexcept
+{
+  return is_valid_utf16( u16string_view( str.data(), str.size() ) );
+}
+
+inline bool bit::core::is_valid_utf32( u32string_view str )
+  noexcept
+{
+  return detail::unicode_validate( str.data(), str.size() );
+}
+
+template<std::ptrdiff_t Extent>
+inline bool bit::core::is_valid_utf32( u32string_span<Extent> str )
+  noexcept
+{
+  return is_valid_utf32( u32string_view( str.data(), str.size() ) );
+}
+
+//----------------------------------------------------------------------------
+// Lengths
+//----------------------------------------------------------------------------
+
+inline std::size_t bit::core::utf8_length( u16string_view str )
+  noexcept
+{
+  // Surrogates count for 2 bytes each, and 4 bytes as a pair
+  auto result = str.size();
+  for( auto c : str ) {
+    const auto u = static_cast<std::uint32_t>(c);
+    result += (u >= 0x80u) + (u >= 0x800u) - ((u & 0xf800u) == 0xd800u);
+  }
+  return result;
+}
+
+inline std::size_t bit::core::utf8_length( u32string_view str )
+  noexcept
+{
+  auto result = str.size();
+  for( auto c : str ) {
+    const auto u = static_cast<std::uint32_t>(c);
+    result += (u >= 0x80u) + (u >= 0x800u) + (u >= 0x10000u);
+  }
+  return result;
+}
+
+inline std::size_t bit::core::utf16_length( string_view str )
+  noexcept
+{
+  auto continuations = std::size_t{};
+  auto fours = std::size_t{};
+  detail::unicode_count_utf8( detail::unicode_bytes( str ), str.size(), continuations, fours );
+
+  return str.size() - continuations + fours;
+}
+
+inline std::size_t bit::core::utf16_length( u32string_view str )
+  noexcept
+{
+  auto result = str.size();
+  for( auto c : str ) {
+    result += static_cast<std::uint32_t>(c) >= 0x10000u;
+  }
+  return result;
+}
+
+inline std::size_t bit::core::utf32_length( string_view str )
+  noexcept
+{
+  auto continuations = std::size_t{};
+  auto fours = std::size_t{};
+  detail::unicode_count_utf8( detail::unicode_bytes( str ), str.size(), continuations, fours );
+
+  return str.size() - continuations;
+}
+
+inline std::size_t bit::core::utf32_length( u16string_view str )
+  noexcept
+{
+  auto result = str.size();
+  for( auto c : str ) {
+    result -= (static_cast<std::uint32_t>(c) & 0xfc00u) == 0xdc00u;
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+// Conversion
+//----------------------------------------------------------------------------
+
+inline bit::core::expected<bit::core::u16string_view,bit::core::unicode_error>
+  bit::core::utf8_to_utf16( string_view str, span<char16_t> buffer )
+  noexcept
+{
+  return detail::unicode_result(
+    detail::unicode_convert_utf8( detail::unicode_bytes( str ), str.size(),
+                                  buffer.data(), detail::unicode_capacity( buffer ) ),
+    buffer
+  );
+}
+
+template<std::ptrdiff_t Extent>
+inline bit::core::expected<bit::core::u16string_view,bit::core::unicode_error>
+  bit::core::utf8_to_utf16( string_span<Extent> str, span<char16_t> buffer )
+  noexcept
+{
+  return utf8_to_utf16( string_view( str.data(), str.size() ), buffer );
+}
+
+inline bit::core::expected<bit::core::u32string_view,bit::core::unicode_error>
+  bit::core::utf8_to_utf32( string_view str, span<char32_t> buffer )
+  noexcept
+{
+  return detail::unicode_result(
+    detail::unicode_convert_utf8( detail::unicode_bytes( str ), str.size(),
+                                  buffer.data(), detail::unicode_capacity( buffer ) ),
+    buffer
+  );
+}
+
+template<std::ptrdiff_t Extent>
+inline bit::core::expected<bit::core::u32string_view,bit::core::unicode_error>
+  bit::core::utf8_to_utf32( string_span<Extent> str, span<char32_t> buffer )
+  noexcept
+{
+  return utf8_to_utf32( string_view( str.data(), str.size() ), buffer );
+}
+
+inline bit::core::expected<bit::core::string_view,bit::core::unicode_error>
+  bit::core::utf16_to_utf8( u16string_view str, span<char> buffer )
+  noexcept
+{
+  return detail::unicode_result(
+    detail::unicode_convert( str.data(), str.size(),
+                             buffer.data(), detail::unicode_capacity( buffer ) ),
+    buffer
+  );
+}
+
+template<std::ptrdiff_t Extent>
+inline bit::core::expected<bit::core::string_view,bit::core::unicode_error>
+  bit::core::utf16_to_utf8( u16string_span<Extent> str, span<char> buffer )
+  noexcept
+{
+  return utf16_to_utf8( u16string_view( str.data(), str.size() ), buffer );
+}
+
+inline bit::core::expected<bit::core::u32string_view,bit::core::unicode_error>
+  bit::core::utf16_to_utf32( u16string_view str, span<char32_t> buffer )
+  noexcept
+{
+  return detail::unicode_result(
+    detail::unicode_convert( str.data(), str.size(),
+                             buffer.data(), detail::unicode_capacity( buffer ) ),
+    buffer
+  );
+}
+
+template<std::ptrdiff_t Extent>
+inline bit::core::expected<bit::core::u32string_view,bit::core::unicode_error>
+  bit::core::utf16_to_utf32( u16string_span<Extent> str, span<char32_t> buffer )
+  noexcept
+{
+  return utf16_to_utf32( u16string_view( str.data(), str.size() ), buffer );
+}
+
+inline bit::core::expected<bit::core::string_view,bit::core::unicode_error>
+  bit::core::utf32_to_utf8( u32string_view str, span<char> buffer )
+  noexcept
+{
+  return detail::unicode_result(
+    detail::unicode_convert( str.data(), str.size(),
+                             buffer.data(), detail::unicode_capacity( buffer ) ),
+    buffer
+  );
+}
+
+template<std::ptrdiff_t Extent>
+inline bit::core::expected<bit::core::string_view,bit::core::unicode_error>
+  bit::core::utf32_to_utf8( u32string_span<Extent> str, span<char> buffer )
+  noexcept
+{
+  return utf32_to_utf8( u32string_view( str.data(), str.size() ), buffer );
+}
+
+inline bit::core::expected<bit::core::u16string_view,bit::core::unicode_error>
+  bit::core::utf32_to_utf16( u32string_view str, span<char16_t> buffer )
+  noexcept
+{
+  return detail::unicode_result(
+    detail::unicode_convert( str.data(), str.size(),
+                             buffer.data(), detail::unicode_capacity( buffer ) ),
+    buffer
+  );
+}
+
+template<std::ptrdiff_t Extent>
+inline bit::core::expected<bit::core::u16string_view,bit::core::unicode_error>
+  bit::core::utf32_to_utf16( u32string_span<Extent> str, span<char16_t> buffer )
+  noexcept
+{
+  return utf32_to_utf16( u32string_view( str.data(), str.size() ), buffer );
+}
+
+#endif /* BIT_CORE_UTILITIES_DETAIL_UNICODE_INL */
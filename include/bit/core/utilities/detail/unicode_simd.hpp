@@ -0,0 +1,1815 @@
+/*****************************************************************************
+ * \file
+ * \brief This internal header contains the vectorized UTF-8 validation and
+ *        decoding used by the unicode utilities
+ *
+ * \note This is an internal header file, included by other library headers.
+ *       Do not attempt to use it directly.
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_UTILITIES_DETAIL_UNICODE_SIMD_HPP
+#define BIT_CORE_UTILITIES_DETAIL_UNICODE_SIMD_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../compiler_traits.hpp"
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint8_t, std::uint32_t, std::uint64_t
+
+#if defined(BIT_PLATFORM_HAS_AVX2)
+# include <immintrin.h>
+#elif defined(BIT_PLATFORM_HAS_SSSE3)
+# include <tmmintrin.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// UTF-8 is validated with the lookup algorithm of Keiser and Lemire
+// ("Validating UTF-8 In Less Than One Instruction Per Byte", 2021). Each byte
+// is classified together with the byte before it by three 16-entry table
+// lookups, on the high nibble of the previous byte, the low nibble of the
+// previous byte and the high nibble of the current byte; the AND of the
+// three results is non-zero exactly where the pair is an illegal sequence.
+// The only errors a pair cannot see -- a missing or a superfluous third or
+// fourth byte -- are caught by comparing the bytes two and three positions
+// back against 0xE0 and 0xF0.
+//
+// Validated UTF-8 is decoded 12 bytes at a time. A mask of the bytes that end
+// a code point selects, from a precomputed table, a byte shuffle that moves
+// the next 6 one or two byte code points into 16-bit lanes, the next 4 code
+// points of up to three bytes into 32-bit lanes, or the next 3 code points of
+// any length into 32-bit lanes, after which the payload bits are combined
+// with shifts and masks.
+//
+// These paths need SSSE3 for the byte shuffle, and use 32-byte vectors for
+// validation when AVX2 is available; other targets use the scalar decoder.
+//-----------------------------------------------------------------------------
+
+#if defined(BIT_PLATFORM_HAS_SSSE3)
+# define BIT_CORE_UNICODE_HAS_SIMD_UTF8 1
+#endif
+
+#if defined(BIT_CORE_UNICODE_HAS_SIMD_UTF8)
+
+namespace bit {
+  namespace core {
+    namespace detail {
+
+      //-----------------------------------------------------------------------
+      // Tables
+      //-----------------------------------------------------------------------
+
+      // Error bits set by the pair classification
+      constexpr std::uint8_t unicode_too_short   = 1u << 0; // 11______ 0_______
+                                                            // 11______ 11______
+      constexpr std::uint8_t unicode_too_long    = 1u << 1; // 0_______ 10______
+      constexpr std::uint8_t unicode_overlong_3  = 1u << 2; // 11100000 100_____
+      constexpr std::uint8_t unicode_too_large   = 1u << 3; // 11110100 1001____
+                                                            // 11110100 101_____
+                                                            // 11110101 ________
+      constexpr std::uint8_t unicode_surrogate   = 1u << 4; // 11101101 101_____
+      constexpr std::uint8_t unicode_overlong_2  = 1u << 5; // 1100000_ 10______
+      constexpr std::uint8_t unicode_overlong_4  = 1u << 6; // 11110000 1000____
+      constexpr std::uint8_t unicode_too_large_1000 = 1u << 6; // 11110101 1000____
+      constexpr std::uint8_t unicode_two_conts   = 1u << 7; // 10______ 10______
+
+      constexpr std::uint8_t unicode_carry = unicode_too_short | unicode_too_long | unicode_two_conts;
+
+      /// \brief The classification tables, indexed by the high nibble of the
+      ///        previous byte, the low nibble of the previous byte, and the
+      ///        high nibble of the current byte
+      template<typename = void>
+      struct unicode_utf8_classes
+      {
+        static const std::uint8_t byte_1_high[16];
+        static const std::uint8_t byte_1_low[16];
+        static const std::uint8_t byte_2_high[16];
+      };
+
+      template<typename T>
+      const std::uint8_t unicode_utf8_classes<T>::byte_1_high[16] = {
+        // 0_______ ________ <ASCII in byte 1>
+        unicode_too_long, unicode_too_long, unicode_too_long, unicode_too_long,
+        unicode_too_long, unicode_too_long, unicode_too_long, unicode_too_long,
+        // 10______ ________ <continuation in byte 1>
+        unicode_two_conts, unicode_two_conts, unicode_two_conts, unicode_two_conts,
+        // 1100____ ________ <two byte lead in byte 1>
+        unicode_too_short | unicode_overlong_2,
+        // 1101____ ________ <two byte lead in byte 1>
+        unicode_too_short,
+        // 1110____ ________ <three byte lead in byte 1>
+        unicode_too_short | unicode_overlong_3 | unicode_surrogate,
+        // 1111____ ________ <four+ byte lead in byte 1>
+        unicode_too_short | unicode_too_large | unicode_too_large_1000 | unicode_overlong_4
+      };
+
+      template<typename T>
+      const std::uint8_t unicode_utf8_classes<T>::byte_1_low[16] = {
+        // ____0000 ________
+        unicode_carry | unicode_overlong_3 | unicode_overlong_2 | unicode_overlong_4,
+        // ____0001 ________
+        unicode_carry | unicode_overlong_2,
+        // ____001_ ________
+        unicode_carry,
+        unicode_carry,
+        // ____0100 ________
+        unicode_carry | unicode_too_large,
+        // ____0101 ________
+        unicode_carry | unicode_too_large | unicode_too_large_1000,
+        // ____011_ ________
+        unicode_carry | unicode_too_large | unicode_too_large_1000,
+        unicode_carry | unicode_too_large | unicode_too_large_1000,
+        // ____1___ ________
+        unicode_carry | unicode_too_large | unicode_too_large_1000,
+        unicode_carry | unicode_too_large | unicode_too_large_1000,
+        unicode_carry | unicode_too_large | unicode_too_large_1000,
+        unicode_carry | unicode_too_large | unicode_too_large_1000,
+        unicode_carry | unicode_too_large | unicode_too_large_1000,
+        // ____1101 ________
+        unicode_carry | unicode_too_large | unicode_too_large_1000 | unicode_surrogate,
+        unicode_carry | unicode_too_large | unicode_too_large_1000,
+        unicode_carry | unicode_too_large | unicode_too_large_1000
+      };
+
+      template<typename T>
+      const std::uint8_t unicode_utf8_classes<T>::byte_2_high[16] = {
+        // ________ 0_______ <ASCII in byte 2>
+        unicode_too_short, unicode_too_short, unicode_too_short, unicode_too_short,
+        unicode_too_short, unicode_too_short, unicode_too_short, unicode_too_short,
+        // ________ 1000____
+        unicode_too_long | unicode_overlong_2 | unicode_two_conts | unicode_overlong_3 | unicode_too_large_1000 | unicode_overlong_4,
+        // ________ 1001____
+        unicode_too_long | unicode_overlong_2 | unicode_two_conts | unicode_overlong_3 | unicode_too_large,
+        // ________ 101_____
+        unicode_too_long | unicode_overlong_2 | unicode_two_conts | unicode_surrogate | unicode_too_large,
+        unicode_too_long | unicode_overlong_2 | unicode_two_conts | unicode_surrogate | unicode_too_large,
+        // ________ 11______ <lead in byte 2>
+        unicode_too_short, unicode_too_short, unicode_too_short, unicode_too_short
+      };
+
+      /// \brief The largest values of the last three bytes of a block that
+      ///        do not start an incomplete sequence
+      template<typename = void>
+      struct unicode_utf8_incomplete
+      {
+        static const std::uint8_t value[32];
+      };
+
+      template<typename T>
+      const std::uint8_t unicode_utf8_incomplete<T>::value[32] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1
+      };
+
+      /// \brief The shuffles that gather 12 bytes of UTF-8 into lanes, and
+      ///        the shuffle and length to use for each end-of-code-point mask
+      ///
+      /// Shuffles [0, 64) gather 6 code points into 16-bit lanes, [64, 145)
+      /// gather 4 code points into 32-bit lanes, and [145, 209) gather 3
+      /// code points into 32-bit lanes. Masks that no valid input produces
+      /// map to shuffle 209 and length 0.
+      template<typename = void>
+      struct unicode_utf8_shuffles
+      {
+        static const std::uint8_t index[4096][2];
+        static const std::uint8_t value[209][16];
+      };
+
+      template<typename T>
+      const std::uint8_t unicode_utf8_shuffles<T>::index[4096][2] = {
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {209,0}, {209,0}, {147,5}, {209,0}, {150,5}, {162,5}, {65,5},
+        {209,0}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {209,0}, {148,6}, {209,0}, {151,6}, {163,6}, {66,6},
+        {209,0}, {154,6}, {166,6}, {68,6}, {178,6}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {169,6}, {70,6}, {181,6}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {152,7}, {164,7}, {145,3},
+        {209,0}, {155,7}, {167,7}, {69,7}, {179,7}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {170,7}, {71,7}, {182,7}, {77,7}, {95,7}, {65,5},
+        {194,7}, {83,7}, {101,7}, {67,5}, {119,7}, {73,5}, {91,5}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {185,7}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {68,6}, {121,7}, {74,6}, {92,6}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {76,6}, {94,6}, {4,7},
+        {193,6}, {82,6}, {100,6}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {171,8}, {72,8}, {183,8}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {186,8}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {104,8}, {68,6}, {122,8}, {74,6}, {92,6}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {76,6}, {94,6}, {5,8},
+        {193,6}, {82,6}, {100,6}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {77,7}, {95,7}, {6,8},
+        {194,7}, {83,7}, {101,7}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {160,9}, {172,9}, {147,5}, {184,9}, {150,5}, {162,5}, {65,5},
+        {196,9}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {175,9}, {148,6}, {187,9}, {81,9}, {99,9}, {66,6},
+        {199,9}, {87,9}, {105,9}, {68,6}, {123,9}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {111,9}, {70,6}, {129,9}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {190,9}, {152,7}, {164,7}, {145,3},
+        {202,9}, {89,9}, {107,9}, {69,7}, {125,9}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {113,9}, {71,7}, {131,9}, {77,7}, {95,7}, {7,9},
+        {194,7}, {83,7}, {101,7}, {11,9}, {119,7}, {19,9}, {35,9}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {137,9}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {13,9}, {121,7}, {21,9}, {37,9}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {25,9}, {41,9}, {4,7},
+        {193,6}, {82,6}, {49,9}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {205,9}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {115,9}, {72,8}, {133,9}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {139,9}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {104,8}, {14,9}, {122,8}, {22,9}, {38,9}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {26,9}, {42,9}, {5,8},
+        {193,6}, {82,6}, {50,9}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {28,9}, {44,9}, {6,8},
+        {194,7}, {83,7}, {52,9}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {56,9}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {209,0}, {209,0}, {147,5}, {209,0}, {150,5}, {162,5}, {65,5},
+        {209,0}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {176,10}, {148,6}, {188,10}, {151,6}, {163,6}, {66,6},
+        {200,10}, {154,6}, {166,6}, {68,6}, {178,6}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {169,6}, {70,6}, {181,6}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {191,10}, {152,7}, {164,7}, {145,3},
+        {203,10}, {90,10}, {108,10}, {69,7}, {126,10}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {114,10}, {71,7}, {132,10}, {77,7}, {95,7}, {65,5},
+        {194,7}, {83,7}, {101,7}, {67,5}, {119,7}, {73,5}, {91,5}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {138,10}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {68,6}, {121,7}, {74,6}, {92,6}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {76,6}, {94,6}, {4,7},
+        {193,6}, {82,6}, {100,6}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {206,10}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {116,10}, {72,8}, {134,10}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {140,10}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {104,8}, {15,10}, {122,8}, {23,10}, {39,10}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {27,10}, {43,10}, {5,8},
+        {193,6}, {82,6}, {51,10}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {29,10}, {45,10}, {6,8},
+        {194,7}, {83,7}, {53,10}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {57,10}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {160,9}, {172,9}, {147,5}, {184,9}, {150,5}, {162,5}, {65,5},
+        {196,9}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {175,9}, {148,6}, {142,10}, {81,9}, {99,9}, {66,6},
+        {199,9}, {87,9}, {105,9}, {68,6}, {123,9}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {111,9}, {70,6}, {129,9}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {190,9}, {152,7}, {164,7}, {145,3},
+        {202,9}, {89,9}, {107,9}, {69,7}, {125,9}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {113,9}, {71,7}, {131,9}, {30,10}, {46,10}, {7,9},
+        {194,7}, {83,7}, {54,10}, {11,9}, {119,7}, {19,9}, {35,9}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {137,9}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {58,10}, {13,9}, {121,7}, {21,9}, {37,9}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {25,9}, {41,9}, {4,7},
+        {193,6}, {82,6}, {49,9}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {205,9}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {115,9}, {72,8}, {133,9}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {139,9}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {60,10}, {14,9}, {122,8}, {22,9}, {38,9}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {26,9}, {42,9}, {5,8},
+        {193,6}, {82,6}, {50,9}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {28,9}, {44,9}, {6,8},
+        {194,7}, {83,7}, {52,9}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {56,9}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {209,0}, {209,0}, {147,5}, {209,0}, {150,5}, {162,5}, {65,5},
+        {209,0}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {209,0}, {148,6}, {209,0}, {151,6}, {163,6}, {66,6},
+        {209,0}, {154,6}, {166,6}, {68,6}, {178,6}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {169,6}, {70,6}, {181,6}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {192,11}, {152,7}, {164,7}, {145,3},
+        {204,11}, {155,7}, {167,7}, {69,7}, {179,7}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {170,7}, {71,7}, {182,7}, {77,7}, {95,7}, {65,5},
+        {194,7}, {83,7}, {101,7}, {67,5}, {119,7}, {73,5}, {91,5}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {185,7}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {68,6}, {121,7}, {74,6}, {92,6}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {76,6}, {94,6}, {4,7},
+        {193,6}, {82,6}, {100,6}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {207,11}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {117,11}, {72,8}, {135,11}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {141,11}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {104,8}, {68,6}, {122,8}, {74,6}, {92,6}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {76,6}, {94,6}, {5,8},
+        {193,6}, {82,6}, {100,6}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {77,7}, {95,7}, {6,8},
+        {194,7}, {83,7}, {101,7}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {160,9}, {172,9}, {147,5}, {184,9}, {150,5}, {162,5}, {65,5},
+        {196,9}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {175,9}, {148,6}, {143,11}, {81,9}, {99,9}, {66,6},
+        {199,9}, {87,9}, {105,9}, {68,6}, {123,9}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {111,9}, {70,6}, {129,9}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {190,9}, {152,7}, {164,7}, {145,3},
+        {202,9}, {89,9}, {107,9}, {69,7}, {125,9}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {113,9}, {71,7}, {131,9}, {31,11}, {47,11}, {7,9},
+        {194,7}, {83,7}, {55,11}, {11,9}, {119,7}, {19,9}, {35,9}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {137,9}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {59,11}, {13,9}, {121,7}, {21,9}, {37,9}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {25,9}, {41,9}, {4,7},
+        {193,6}, {82,6}, {49,9}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {205,9}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {115,9}, {72,8}, {133,9}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {139,9}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {61,11}, {14,9}, {122,8}, {22,9}, {38,9}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {26,9}, {42,9}, {5,8},
+        {193,6}, {82,6}, {50,9}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {28,9}, {44,9}, {6,8},
+        {194,7}, {83,7}, {52,9}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {56,9}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {209,0}, {209,0}, {147,5}, {209,0}, {150,5}, {162,5}, {65,5},
+        {209,0}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {176,10}, {148,6}, {188,10}, {151,6}, {163,6}, {66,6},
+        {200,10}, {154,6}, {166,6}, {68,6}, {178,6}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {169,6}, {70,6}, {181,6}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {191,10}, {152,7}, {164,7}, {145,3},
+        {203,10}, {90,10}, {108,10}, {69,7}, {126,10}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {114,10}, {71,7}, {132,10}, {77,7}, {95,7}, {65,5},
+        {194,7}, {83,7}, {101,7}, {67,5}, {119,7}, {73,5}, {91,5}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {138,10}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {68,6}, {121,7}, {74,6}, {92,6}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {76,6}, {94,6}, {4,7},
+        {193,6}, {82,6}, {100,6}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {206,10}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {116,10}, {72,8}, {134,10}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {140,10}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {62,11}, {15,10}, {122,8}, {23,10}, {39,10}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {27,10}, {43,10}, {5,8},
+        {193,6}, {82,6}, {51,10}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {29,10}, {45,10}, {6,8},
+        {194,7}, {83,7}, {53,10}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {57,10}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {160,9}, {172,9}, {147,5}, {184,9}, {150,5}, {162,5}, {65,5},
+        {196,9}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {175,9}, {148,6}, {142,10}, {81,9}, {99,9}, {66,6},
+        {199,9}, {87,9}, {105,9}, {68,6}, {123,9}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {111,9}, {70,6}, {129,9}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {190,9}, {152,7}, {164,7}, {145,3},
+        {202,9}, {89,9}, {107,9}, {69,7}, {125,9}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {113,9}, {71,7}, {131,9}, {30,10}, {46,10}, {7,9},
+        {194,7}, {83,7}, {54,10}, {11,9}, {119,7}, {19,9}, {35,9}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {137,9}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {58,10}, {13,9}, {121,7}, {21,9}, {37,9}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {25,9}, {41,9}, {4,7},
+        {193,6}, {82,6}, {49,9}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {205,9}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {115,9}, {72,8}, {133,9}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {139,9}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {60,10}, {14,9}, {122,8}, {22,9}, {38,9}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {26,9}, {42,9}, {5,8},
+        {193,6}, {82,6}, {50,9}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {28,9}, {44,9}, {6,8},
+        {194,7}, {83,7}, {52,9}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {56,9}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {209,0}, {209,0}, {147,5}, {209,0}, {150,5}, {162,5}, {65,5},
+        {209,0}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {209,0}, {148,6}, {209,0}, {151,6}, {163,6}, {66,6},
+        {209,0}, {154,6}, {166,6}, {68,6}, {178,6}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {169,6}, {70,6}, {181,6}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {152,7}, {164,7}, {145,3},
+        {209,0}, {155,7}, {167,7}, {69,7}, {179,7}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {170,7}, {71,7}, {182,7}, {77,7}, {95,7}, {65,5},
+        {194,7}, {83,7}, {101,7}, {67,5}, {119,7}, {73,5}, {91,5}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {185,7}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {68,6}, {121,7}, {74,6}, {92,6}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {76,6}, {94,6}, {4,7},
+        {193,6}, {82,6}, {100,6}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {208,12}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {171,8}, {72,8}, {183,8}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {186,8}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {104,8}, {68,6}, {122,8}, {74,6}, {92,6}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {76,6}, {94,6}, {5,8},
+        {193,6}, {82,6}, {100,6}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {77,7}, {95,7}, {6,8},
+        {194,7}, {83,7}, {101,7}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {160,9}, {172,9}, {147,5}, {184,9}, {150,5}, {162,5}, {65,5},
+        {196,9}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {175,9}, {148,6}, {144,12}, {81,9}, {99,9}, {66,6},
+        {199,9}, {87,9}, {105,9}, {68,6}, {123,9}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {111,9}, {70,6}, {129,9}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {190,9}, {152,7}, {164,7}, {145,3},
+        {202,9}, {89,9}, {107,9}, {69,7}, {125,9}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {113,9}, {71,7}, {131,9}, {77,7}, {95,7}, {7,9},
+        {194,7}, {83,7}, {101,7}, {11,9}, {119,7}, {19,9}, {35,9}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {137,9}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {13,9}, {121,7}, {21,9}, {37,9}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {25,9}, {41,9}, {4,7},
+        {193,6}, {82,6}, {49,9}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {205,9}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {115,9}, {72,8}, {133,9}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {139,9}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {104,8}, {14,9}, {122,8}, {22,9}, {38,9}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {26,9}, {42,9}, {5,8},
+        {193,6}, {82,6}, {50,9}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {28,9}, {44,9}, {6,8},
+        {194,7}, {83,7}, {52,9}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {56,9}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {209,0}, {209,0}, {147,5}, {209,0}, {150,5}, {162,5}, {65,5},
+        {209,0}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {176,10}, {148,6}, {188,10}, {151,6}, {163,6}, {66,6},
+        {200,10}, {154,6}, {166,6}, {68,6}, {178,6}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {169,6}, {70,6}, {181,6}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {191,10}, {152,7}, {164,7}, {145,3},
+        {203,10}, {90,10}, {108,10}, {69,7}, {126,10}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {114,10}, {71,7}, {132,10}, {77,7}, {95,7}, {65,5},
+        {194,7}, {83,7}, {101,7}, {67,5}, {119,7}, {73,5}, {91,5}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {138,10}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {68,6}, {121,7}, {74,6}, {92,6}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {76,6}, {94,6}, {4,7},
+        {193,6}, {82,6}, {100,6}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {206,10}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {116,10}, {72,8}, {134,10}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {140,10}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {63,12}, {15,10}, {122,8}, {23,10}, {39,10}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {27,10}, {43,10}, {5,8},
+        {193,6}, {82,6}, {51,10}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {29,10}, {45,10}, {6,8},
+        {194,7}, {83,7}, {53,10}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {57,10}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {160,9}, {172,9}, {147,5}, {184,9}, {150,5}, {162,5}, {65,5},
+        {196,9}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {175,9}, {148,6}, {142,10}, {81,9}, {99,9}, {66,6},
+        {199,9}, {87,9}, {105,9}, {68,6}, {123,9}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {111,9}, {70,6}, {129,9}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {190,9}, {152,7}, {164,7}, {145,3},
+        {202,9}, {89,9}, {107,9}, {69,7}, {125,9}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {113,9}, {71,7}, {131,9}, {30,10}, {46,10}, {7,9},
+        {194,7}, {83,7}, {54,10}, {11,9}, {119,7}, {19,9}, {35,9}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {137,9}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {58,10}, {13,9}, {121,7}, {21,9}, {37,9}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {25,9}, {41,9}, {4,7},
+        {193,6}, {82,6}, {49,9}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {205,9}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {115,9}, {72,8}, {133,9}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {139,9}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {60,10}, {14,9}, {122,8}, {22,9}, {38,9}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {26,9}, {42,9}, {5,8},
+        {193,6}, {82,6}, {50,9}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {28,9}, {44,9}, {6,8},
+        {194,7}, {83,7}, {52,9}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {56,9}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {209,0}, {209,0}, {147,5}, {209,0}, {150,5}, {162,5}, {65,5},
+        {209,0}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {209,0}, {148,6}, {209,0}, {151,6}, {163,6}, {66,6},
+        {209,0}, {154,6}, {166,6}, {68,6}, {178,6}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {169,6}, {70,6}, {181,6}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {192,11}, {152,7}, {164,7}, {145,3},
+        {204,11}, {155,7}, {167,7}, {69,7}, {179,7}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {170,7}, {71,7}, {182,7}, {77,7}, {95,7}, {65,5},
+        {194,7}, {83,7}, {101,7}, {67,5}, {119,7}, {73,5}, {91,5}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {185,7}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {68,6}, {121,7}, {74,6}, {92,6}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {76,6}, {94,6}, {4,7},
+        {193,6}, {82,6}, {100,6}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {207,11}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {117,11}, {72,8}, {135,11}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {141,11}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {104,8}, {68,6}, {122,8}, {74,6}, {92,6}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {76,6}, {94,6}, {5,8},
+        {193,6}, {82,6}, {100,6}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {77,7}, {95,7}, {6,8},
+        {194,7}, {83,7}, {101,7}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {160,9}, {172,9}, {147,5}, {184,9}, {150,5}, {162,5}, {65,5},
+        {196,9}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {175,9}, {148,6}, {143,11}, {81,9}, {99,9}, {66,6},
+        {199,9}, {87,9}, {105,9}, {68,6}, {123,9}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {111,9}, {70,6}, {129,9}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {190,9}, {152,7}, {164,7}, {145,3},
+        {202,9}, {89,9}, {107,9}, {69,7}, {125,9}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {113,9}, {71,7}, {131,9}, {31,11}, {47,11}, {7,9},
+        {194,7}, {83,7}, {55,11}, {11,9}, {119,7}, {19,9}, {35,9}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {137,9}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {59,11}, {13,9}, {121,7}, {21,9}, {37,9}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {25,9}, {41,9}, {4,7},
+        {193,6}, {82,6}, {49,9}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {205,9}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {115,9}, {72,8}, {133,9}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {139,9}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {61,11}, {14,9}, {122,8}, {22,9}, {38,9}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {26,9}, {42,9}, {5,8},
+        {193,6}, {82,6}, {50,9}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {28,9}, {44,9}, {6,8},
+        {194,7}, {83,7}, {52,9}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {56,9}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {209,0}, {209,0}, {147,5}, {209,0}, {150,5}, {162,5}, {65,5},
+        {209,0}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {176,10}, {148,6}, {188,10}, {151,6}, {163,6}, {66,6},
+        {200,10}, {154,6}, {166,6}, {68,6}, {178,6}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {169,6}, {70,6}, {181,6}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {191,10}, {152,7}, {164,7}, {145,3},
+        {203,10}, {90,10}, {108,10}, {69,7}, {126,10}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {114,10}, {71,7}, {132,10}, {77,7}, {95,7}, {65,5},
+        {194,7}, {83,7}, {101,7}, {67,5}, {119,7}, {73,5}, {91,5}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {138,10}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {103,7}, {68,6}, {121,7}, {74,6}, {92,6}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {76,6}, {94,6}, {4,7},
+        {193,6}, {82,6}, {100,6}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {206,10}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {116,10}, {72,8}, {134,10}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {140,10}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {62,11}, {15,10}, {122,8}, {23,10}, {39,10}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {27,10}, {43,10}, {5,8},
+        {193,6}, {82,6}, {51,10}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {29,10}, {45,10}, {6,8},
+        {194,7}, {83,7}, {53,10}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {57,10}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {209,0}, {209,0}, {209,0}, {146,4}, {209,0}, {149,4}, {161,4}, {64,4},
+        {209,0}, {160,9}, {172,9}, {147,5}, {184,9}, {150,5}, {162,5}, {65,5},
+        {196,9}, {153,5}, {165,5}, {67,5}, {177,5}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {175,9}, {148,6}, {142,10}, {81,9}, {99,9}, {66,6},
+        {199,9}, {87,9}, {105,9}, {68,6}, {123,9}, {74,6}, {92,6}, {64,4},
+        {209,0}, {157,6}, {111,9}, {70,6}, {129,9}, {76,6}, {94,6}, {65,5},
+        {193,6}, {82,6}, {100,6}, {67,5}, {118,6}, {73,5}, {91,5}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {190,9}, {152,7}, {164,7}, {145,3},
+        {202,9}, {89,9}, {107,9}, {69,7}, {125,9}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {113,9}, {71,7}, {131,9}, {30,10}, {46,10}, {7,9},
+        {194,7}, {83,7}, {54,10}, {11,9}, {119,7}, {19,9}, {35,9}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {137,9}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {58,10}, {13,9}, {121,7}, {21,9}, {37,9}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {25,9}, {41,9}, {4,7},
+        {193,6}, {82,6}, {49,9}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {209,0}, {145,3},
+        {205,9}, {156,8}, {168,8}, {146,4}, {180,8}, {149,4}, {161,4}, {64,4},
+        {209,0}, {159,8}, {115,9}, {72,8}, {133,9}, {78,8}, {96,8}, {65,5},
+        {195,8}, {84,8}, {102,8}, {67,5}, {120,8}, {73,5}, {91,5}, {64,4},
+        {209,0}, {209,0}, {174,8}, {148,6}, {139,9}, {80,8}, {98,8}, {66,6},
+        {198,8}, {86,8}, {60,10}, {14,9}, {122,8}, {22,9}, {38,9}, {3,8},
+        {209,0}, {157,6}, {110,8}, {70,6}, {128,8}, {26,9}, {42,9}, {5,8},
+        {193,6}, {82,6}, {50,9}, {9,8}, {118,6}, {17,8}, {33,8}, {0,6},
+        {209,0}, {209,0}, {209,0}, {209,0}, {189,8}, {152,7}, {164,7}, {145,3},
+        {201,8}, {88,8}, {106,8}, {69,7}, {124,8}, {75,7}, {93,7}, {64,4},
+        {209,0}, {158,7}, {112,8}, {71,7}, {130,8}, {28,9}, {44,9}, {6,8},
+        {194,7}, {83,7}, {52,9}, {10,8}, {119,7}, {18,8}, {34,8}, {1,7},
+        {209,0}, {209,0}, {173,7}, {148,6}, {136,8}, {79,7}, {97,7}, {66,6},
+        {197,7}, {85,7}, {56,9}, {12,8}, {121,7}, {20,8}, {36,8}, {2,7},
+        {209,0}, {157,6}, {109,7}, {70,6}, {127,7}, {24,8}, {40,8}, {4,7},
+        {193,6}, {82,6}, {48,8}, {8,7}, {118,6}, {16,7}, {32,7}, {0,6}
+      };
+
+      template<typename T>
+      const std::uint8_t unicode_utf8_shuffles<T>::value[209][16] = {
+        {0x00,0x80,0x01,0x80,0x02,0x80,0x03,0x80,0x04,0x80,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x02,0x80,0x03,0x80,0x04,0x80,0x06,0x05,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x02,0x80,0x03,0x80,0x05,0x04,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x02,0x80,0x03,0x80,0x05,0x04,0x07,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x02,0x80,0x04,0x03,0x05,0x80,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x02,0x80,0x04,0x03,0x05,0x80,0x07,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x02,0x80,0x04,0x03,0x06,0x05,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x02,0x80,0x04,0x03,0x06,0x05,0x08,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x03,0x02,0x04,0x80,0x05,0x80,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x03,0x02,0x04,0x80,0x05,0x80,0x07,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x03,0x02,0x04,0x80,0x06,0x05,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x03,0x02,0x04,0x80,0x06,0x05,0x08,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x03,0x02,0x05,0x04,0x06,0x80,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x03,0x02,0x05,0x04,0x06,0x80,0x08,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x03,0x02,0x05,0x04,0x07,0x06,0x08,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x03,0x02,0x05,0x04,0x07,0x06,0x09,0x08,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x03,0x80,0x04,0x80,0x05,0x80,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x03,0x80,0x04,0x80,0x05,0x80,0x07,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x03,0x80,0x04,0x80,0x06,0x05,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x03,0x80,0x04,0x80,0x06,0x05,0x08,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x03,0x80,0x05,0x04,0x06,0x80,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x03,0x80,0x05,0x04,0x06,0x80,0x08,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x03,0x80,0x05,0x04,0x07,0x06,0x08,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x03,0x80,0x05,0x04,0x07,0x06,0x09,0x08,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x04,0x03,0x05,0x80,0x06,0x80,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x04,0x03,0x05,0x80,0x06,0x80,0x08,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x04,0x03,0x05,0x80,0x07,0x06,0x08,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x04,0x03,0x05,0x80,0x07,0x06,0x09,0x08,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x04,0x03,0x06,0x05,0x07,0x80,0x08,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x04,0x03,0x06,0x05,0x07,0x80,0x09,0x08,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x04,0x03,0x06,0x05,0x08,0x07,0x09,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x02,0x01,0x04,0x03,0x06,0x05,0x08,0x07,0x0a,0x09,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x03,0x80,0x04,0x80,0x05,0x80,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x03,0x80,0x04,0x80,0x05,0x80,0x07,0x06,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x03,0x80,0x04,0x80,0x06,0x05,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x03,0x80,0x04,0x80,0x06,0x05,0x08,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x03,0x80,0x05,0x04,0x06,0x80,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x03,0x80,0x05,0x04,0x06,0x80,0x08,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x03,0x80,0x05,0x04,0x07,0x06,0x08,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x03,0x80,0x05,0x04,0x07,0x06,0x09,0x08,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x04,0x03,0x05,0x80,0x06,0x80,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x04,0x03,0x05,0x80,0x06,0x80,0x08,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x04,0x03,0x05,0x80,0x07,0x06,0x08,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x04,0x03,0x05,0x80,0x07,0x06,0x09,0x08,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x04,0x03,0x06,0x05,0x07,0x80,0x08,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x04,0x03,0x06,0x05,0x07,0x80,0x09,0x08,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x04,0x03,0x06,0x05,0x08,0x07,0x09,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x02,0x80,0x04,0x03,0x06,0x05,0x08,0x07,0x0a,0x09,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x04,0x80,0x05,0x80,0x06,0x80,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x04,0x80,0x05,0x80,0x06,0x80,0x08,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x04,0x80,0x05,0x80,0x07,0x06,0x08,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x04,0x80,0x05,0x80,0x07,0x06,0x09,0x08,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x04,0x80,0x06,0x05,0x07,0x80,0x08,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x04,0x80,0x06,0x05,0x07,0x80,0x09,0x08,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x04,0x80,0x06,0x05,0x08,0x07,0x09,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x04,0x80,0x06,0x05,0x08,0x07,0x0a,0x09,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x05,0x04,0x06,0x80,0x07,0x80,0x08,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x05,0x04,0x06,0x80,0x07,0x80,0x09,0x08,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x05,0x04,0x06,0x80,0x08,0x07,0x09,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x05,0x04,0x06,0x80,0x08,0x07,0x0a,0x09,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x05,0x04,0x07,0x06,0x08,0x80,0x09,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x05,0x04,0x07,0x06,0x08,0x80,0x0a,0x09,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x05,0x04,0x07,0x06,0x09,0x08,0x0a,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x03,0x02,0x05,0x04,0x07,0x06,0x09,0x08,0x0b,0x0a,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x02,0x80,0x80,0x80,0x03,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x02,0x80,0x80,0x80,0x04,0x03,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x02,0x80,0x80,0x80,0x05,0x04,0x03,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x03,0x02,0x80,0x80,0x04,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x03,0x02,0x80,0x80,0x05,0x04,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x03,0x02,0x80,0x80,0x06,0x05,0x04,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x04,0x03,0x02,0x80,0x05,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x04,0x03,0x02,0x80,0x06,0x05,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x04,0x03,0x02,0x80,0x07,0x06,0x05,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x03,0x80,0x80,0x80,0x04,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x03,0x80,0x80,0x80,0x05,0x04,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x03,0x80,0x80,0x80,0x06,0x05,0x04,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x04,0x03,0x80,0x80,0x05,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x04,0x03,0x80,0x80,0x06,0x05,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x04,0x03,0x80,0x80,0x07,0x06,0x05,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x05,0x04,0x03,0x80,0x06,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x05,0x04,0x03,0x80,0x07,0x06,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x05,0x04,0x03,0x80,0x08,0x07,0x06,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x04,0x80,0x80,0x80,0x05,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x04,0x80,0x80,0x80,0x06,0x05,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x04,0x80,0x80,0x80,0x07,0x06,0x05,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x05,0x04,0x80,0x80,0x06,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x05,0x04,0x80,0x80,0x07,0x06,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x05,0x04,0x80,0x80,0x08,0x07,0x06,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x06,0x05,0x04,0x80,0x07,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x06,0x05,0x04,0x80,0x08,0x07,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x06,0x05,0x04,0x80,0x09,0x08,0x07,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x03,0x80,0x80,0x80,0x04,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x03,0x80,0x80,0x80,0x05,0x04,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x03,0x80,0x80,0x80,0x06,0x05,0x04,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x04,0x03,0x80,0x80,0x05,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x04,0x03,0x80,0x80,0x06,0x05,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x04,0x03,0x80,0x80,0x07,0x06,0x05,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x05,0x04,0x03,0x80,0x06,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x05,0x04,0x03,0x80,0x07,0x06,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x05,0x04,0x03,0x80,0x08,0x07,0x06,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x04,0x80,0x80,0x80,0x05,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x04,0x80,0x80,0x80,0x06,0x05,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x04,0x80,0x80,0x80,0x07,0x06,0x05,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x05,0x04,0x80,0x80,0x06,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x05,0x04,0x80,0x80,0x07,0x06,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x05,0x04,0x80,0x80,0x08,0x07,0x06,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x06,0x05,0x04,0x80,0x07,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x06,0x05,0x04,0x80,0x08,0x07,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x06,0x05,0x04,0x80,0x09,0x08,0x07,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x05,0x80,0x80,0x80,0x06,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x05,0x80,0x80,0x80,0x07,0x06,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x05,0x80,0x80,0x80,0x08,0x07,0x06,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x06,0x05,0x80,0x80,0x07,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x06,0x05,0x80,0x80,0x08,0x07,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x06,0x05,0x80,0x80,0x09,0x08,0x07,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x07,0x06,0x05,0x80,0x08,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x07,0x06,0x05,0x80,0x09,0x08,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x07,0x06,0x05,0x80,0x0a,0x09,0x08,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x04,0x80,0x80,0x80,0x05,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x04,0x80,0x80,0x80,0x06,0x05,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x04,0x80,0x80,0x80,0x07,0x06,0x05,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x05,0x04,0x80,0x80,0x06,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x05,0x04,0x80,0x80,0x07,0x06,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x05,0x04,0x80,0x80,0x08,0x07,0x06,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x06,0x05,0x04,0x80,0x07,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x06,0x05,0x04,0x80,0x08,0x07,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x06,0x05,0x04,0x80,0x09,0x08,0x07,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x05,0x80,0x80,0x80,0x06,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x05,0x80,0x80,0x80,0x07,0x06,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x05,0x80,0x80,0x80,0x08,0x07,0x06,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x06,0x05,0x80,0x80,0x07,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x06,0x05,0x80,0x80,0x08,0x07,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x06,0x05,0x80,0x80,0x09,0x08,0x07,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x07,0x06,0x05,0x80,0x08,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x07,0x06,0x05,0x80,0x09,0x08,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x07,0x06,0x05,0x80,0x0a,0x09,0x08,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x06,0x80,0x80,0x80,0x07,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x06,0x80,0x80,0x80,0x08,0x07,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x06,0x80,0x80,0x80,0x09,0x08,0x07,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x07,0x06,0x80,0x80,0x08,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x07,0x06,0x80,0x80,0x09,0x08,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x07,0x06,0x80,0x80,0x0a,0x09,0x08,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x08,0x07,0x06,0x80,0x09,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x08,0x07,0x06,0x80,0x0a,0x09,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x08,0x07,0x06,0x80,0x0b,0x0a,0x09,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x02,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x03,0x02,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x04,0x03,0x02,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80,0x05,0x04,0x03,0x02,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x03,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x04,0x03,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x05,0x04,0x03,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x02,0x01,0x80,0x80,0x06,0x05,0x04,0x03,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x04,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x05,0x04,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x06,0x05,0x04,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x03,0x02,0x01,0x80,0x07,0x06,0x05,0x04,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x04,0x03,0x02,0x01,0x05,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x04,0x03,0x02,0x01,0x06,0x05,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x04,0x03,0x02,0x01,0x07,0x06,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x04,0x03,0x02,0x01,0x08,0x07,0x06,0x05,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x03,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x04,0x03,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x05,0x04,0x03,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x02,0x80,0x80,0x80,0x06,0x05,0x04,0x03,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x04,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x05,0x04,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x06,0x05,0x04,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x03,0x02,0x80,0x80,0x07,0x06,0x05,0x04,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x05,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x06,0x05,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x07,0x06,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x04,0x03,0x02,0x80,0x08,0x07,0x06,0x05,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x05,0x04,0x03,0x02,0x06,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x05,0x04,0x03,0x02,0x07,0x06,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x05,0x04,0x03,0x02,0x08,0x07,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x00,0x80,0x80,0x05,0x04,0x03,0x02,0x09,0x08,0x07,0x06,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x04,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x05,0x04,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x06,0x05,0x04,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x03,0x80,0x80,0x80,0x07,0x06,0x05,0x04,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x05,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x06,0x05,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x07,0x06,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x04,0x03,0x80,0x80,0x08,0x07,0x06,0x05,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x06,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x07,0x06,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x08,0x07,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x05,0x04,0x03,0x80,0x09,0x08,0x07,0x06,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x06,0x05,0x04,0x03,0x07,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x06,0x05,0x04,0x03,0x08,0x07,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x06,0x05,0x04,0x03,0x09,0x08,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x01,0x00,0x80,0x06,0x05,0x04,0x03,0x0a,0x09,0x08,0x07,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x04,0x80,0x80,0x80,0x05,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x04,0x80,0x80,0x80,0x06,0x05,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x04,0x80,0x80,0x80,0x07,0x06,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x04,0x80,0x80,0x80,0x08,0x07,0x06,0x05,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x05,0x04,0x80,0x80,0x06,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x05,0x04,0x80,0x80,0x07,0x06,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x05,0x04,0x80,0x80,0x08,0x07,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x05,0x04,0x80,0x80,0x09,0x08,0x07,0x06,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x06,0x05,0x04,0x80,0x07,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x06,0x05,0x04,0x80,0x08,0x07,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x06,0x05,0x04,0x80,0x09,0x08,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x06,0x05,0x04,0x80,0x0a,0x09,0x08,0x07,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x07,0x06,0x05,0x04,0x08,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x07,0x06,0x05,0x04,0x09,0x08,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x07,0x06,0x05,0x04,0x0a,0x09,0x08,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x02,0x01,0x00,0x07,0x06,0x05,0x04,0x0b,0x0a,0x09,0x08,0x80,0x80,0x80,0x80}
+      };
+
+      /// \brief The shuffles that compact the UTF-16 of 3 code points in
+      ///        32-bit lanes, for each mask of the lanes that hold a pair
+      template<typename = void>
+      struct unicode_utf16_shuffles
+      {
+        static const std::uint8_t value[8][16];
+      };
+
+      template<typename T>
+      const std::uint8_t unicode_utf16_shuffles<T>::value[8][16] = {
+        {0x00,0x01,0x04,0x05,0x08,0x09,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x08,0x09,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x07,0x08,0x09,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x08,0x09,0x0a,0x0b,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x08,0x09,0x0a,0x0b,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x80,0x80,0x80,0x80}
+      };
+
+      /// \brief The shuffles that compact the UTF-8 of 4 code points in
+      ///        32-bit lanes, and the number of bytes kept
+      ///
+      /// The index has a bit for each lane of at least U+0080 in its low
+      /// nibble, and for each lane of at least U+0800 in its high nibble.
+      template<typename = void>
+      struct unicode_utf8_packs
+      {
+        static const std::uint8_t length[256];
+        static const std::uint8_t value[256][16];
+      };
+
+      template<typename T>
+      const std::uint8_t unicode_utf8_packs<T>::length[256] = {
+         4,  5,  5,  6,  5,  6,  6,  7,  5,  6,  6,  7,  6,  7,  7,  8,
+         0,  6,  0,  7,  0,  7,  0,  8,  0,  7,  0,  8,  0,  8,  0,  9,
+         0,  0,  6,  7,  0,  0,  7,  8,  0,  0,  7,  8,  0,  0,  8,  9,
+         0,  0,  0,  8,  0,  0,  0,  9,  0,  0,  0,  9,  0,  0,  0, 10,
+         0,  0,  0,  0,  6,  7,  7,  8,  0,  0,  0,  0,  7,  8,  8,  9,
+         0,  0,  0,  0,  0,  8,  0,  9,  0,  0,  0,  0,  0,  9,  0, 10,
+         0,  0,  0,  0,  0,  0,  8,  9,  0,  0,  0,  0,  0,  0,  9, 10,
+         0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0,  0,  0,  0,  0, 11,
+         0,  0,  0,  0,  0,  0,  0,  0,  6,  7,  7,  8,  7,  8,  8,  9,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  0,  9,  0,  9,  0, 10,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  9,  0,  0,  9, 10,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,  0,  0, 11,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  8,  9,  9, 10,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0, 11,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10, 11,
+         0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 12
+      };
+
+      template<typename T>
+      const std::uint8_t unicode_utf8_packs<T>::value[256][16] = {
+        {0x00,0x04,0x08,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x08,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x08,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x08,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x08,0x09,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x08,0x09,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x08,0x09,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x08,0x09,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x08,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x08,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x08,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x08,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x08,0x09,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x08,0x09,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x08,0x09,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x08,0x09,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x08,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x08,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x08,0x09,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x08,0x09,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x08,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x08,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x08,0x09,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x08,0x09,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x06,0x08,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x08,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x06,0x08,0x09,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x08,0x09,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x06,0x08,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x08,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x06,0x08,0x09,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x08,0x09,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x06,0x08,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x06,0x08,0x09,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x06,0x08,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x06,0x08,0x09,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x08,0x09,0x0a,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x08,0x09,0x0a,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x08,0x09,0x0a,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x08,0x09,0x0a,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x08,0x09,0x0a,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x08,0x09,0x0a,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x08,0x09,0x0a,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x08,0x09,0x0a,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x08,0x09,0x0a,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x08,0x09,0x0a,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x08,0x09,0x0a,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x08,0x09,0x0a,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x06,0x08,0x09,0x0a,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x08,0x09,0x0a,0x0c,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x06,0x08,0x09,0x0a,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x08,0x09,0x0a,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x06,0x08,0x09,0x0a,0x0c,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x06,0x08,0x09,0x0a,0x0c,0x0d,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x08,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x08,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x08,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x08,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x08,0x09,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x08,0x09,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x08,0x09,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x08,0x09,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x08,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x08,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x08,0x09,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x08,0x09,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x06,0x08,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x08,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x06,0x08,0x09,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x08,0x09,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x06,0x08,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x06,0x08,0x09,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x08,0x09,0x0a,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x08,0x09,0x0a,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x08,0x09,0x0a,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x08,0x09,0x0a,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x08,0x09,0x0a,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x08,0x09,0x0a,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x06,0x08,0x09,0x0a,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x08,0x09,0x0a,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x06,0x08,0x09,0x0a,0x0c,0x0d,0x0e,0x80,0x80,0x80,0x80}
+      };
+
+      //-----------------------------------------------------------------------
+      // Vectors
+      //-----------------------------------------------------------------------
+
+#if defined(BIT_PLATFORM_HAS_AVX2)
+      using unicode_vector = __m256i;
+
+      constexpr std::size_t unicode_vector_size() noexcept{ return 32u; }
+
+      inline unicode_vector unicode_load( const unsigned char* p )
+        noexcept
+      {
+        return _mm256_loadu_si256( reinterpret_cast<const __m256i*>(p) );
+      }
+
+      inline unicode_vector unicode_load_table( const std::uint8_t* p )
+        noexcept
+      {
+        return _mm256_broadcastsi128_si256( _mm_loadu_si128( reinterpret_cast<const __m128i*>(p) ) );
+      }
+
+      inline unicode_vector unicode_zero() noexcept{ return _mm256_setzero_si256(); }
+      inline unicode_vector unicode_or( unicode_vector a, unicode_vector b ) noexcept{ return _mm256_or_si256( a, b ); }
+      inline unicode_vector unicode_and( unicode_vector a, unicode_vector b ) noexcept{ return _mm256_and_si256( a, b ); }
+      inline unicode_vector unicode_xor( unicode_vector a, unicode_vector b ) noexcept{ return _mm256_xor_si256( a, b ); }
+      inline unicode_vector unicode_subs( unicode_vector a, unicode_vector b ) noexcept{ return _mm256_subs_epu8( a, b ); }
+      inline unicode_vector unicode_set1( std::uint8_t x ) noexcept{ return _mm256_set1_epi8( static_cast<char>(x) ); }
+      inline unicode_vector unicode_lookup( unicode_vector table, unicode_vector i ) noexcept{ return _mm256_shuffle_epi8( table, i ); }
+
+      inline unicode_vector unicode_high_nibbles( unicode_vector x )
+        noexcept
+      {
+        return _mm256_and_si256( _mm256_srli_epi16( x, 4 ), _mm256_set1_epi8( 0x0f ) );
+      }
+
+      /// \brief Gets the vector of the bytes \p N positions before each byte
+      ///        of \p x, where \p prev is the vector before \p x
+      template<int N>
+      inline unicode_vector unicode_prev( unicode_vector x, unicode_vector prev )
+        noexcept
+      {
+        return _mm256_alignr_epi8( x, _mm256_permute2x128_si256( prev, x, 0x21 ), 16 - N );
+      }
+
+      /// \brief Gets a mask of the bytes of \p x that have the high bit set
+      inline std::uint64_t unicode_high_bits( unicode_vector x )
+        noexcept
+      {
+        return static_cast<std::uint32_t>( _mm256_movemask_epi8( x ) );
+      }
+
+      /// \brief Gets a mask of the bytes of \p x that are continuations
+      inline std::uint64_t unicode_continuations( unicode_vector x )
+        noexcept
+      {
+        // Continuations are the signed bytes below -64 (0xC0)
+        return unicode_high_bits( _mm256_cmpgt_epi8( _mm256_set1_epi8( -64 ), x ) );
+      }
+
+      inline bool unicode_any( unicode_vector x )
+        noexcept
+      {
+        return !_mm256_testz_si256( x, x );
+      }
+#else
+      using unicode_vector = __m128i;
+
+      constexpr std::size_t unicode_vector_size() noexcept{ return 16u; }
+
+      inline unicode_vector unicode_load( const unsigned char* p )
+        noexcept
+      {
+        return _mm_loadu_si128( reinterpret_cast<const __m128i*>(p) );
+      }
+
+      inline unicode_vector unicode_load_table( const std::uint8_t* p )
+        noexcept
+      {
+        return _mm_loadu_si128( reinterpret_cast<const __m128i*>(p) );
+      }
+
+      inline unicode_vector unicode_zero() noexcept{ return _mm_setzero_si128(); }
+      inline unicode_vector unicode_or( unicode_vector a, unicode_vector b ) noexcept{ return _mm_or_si128( a, b ); }
+      inline unicode_vector unicode_and( unicode_vector a, unicode_vector b ) noexcept{ return _mm_and_si128( a, b ); }
+      inline unicode_vector unicode_xor( unicode_vector a, unicode_vector b ) noexcept{ return _mm_xor_si128( a, b ); }
+      inline unicode_vector unicode_subs( unicode_vector a, unicode_vector b ) noexcept{ return _mm_subs_epu8( a, b ); }
+      inline unicode_vector unicode_set1( std::uint8_t x ) noexcept{ return _mm_set1_epi8( static_cast<char>(x) ); }
+      inline unicode_vector unicode_lookup( unicode_vector table, unicode_vector i ) noexcept{ return _mm_shuffle_epi8( table, i ); }
+
+      inline unicode_vector unicode_high_nibbles( unicode_vector x )
+        noexcept
+      {
+        return _mm_and_si128( _mm_srli_epi16( x, 4 ), _mm_set1_epi8( 0x0f ) );
+      }
+
+      /// \brief Gets the vector of the bytes \p N positions before each byte
+      ///        of \p x, where \p prev is the vector before \p x
+      template<int N>
+      inline unicode_vector unicode_prev( unicode_vector x, unicode_vector prev )
+        noexcept
+      {
+        return _mm_alignr_epi8( x, prev, 16 - N );
+      }
+
+      /// \brief Gets a mask of the bytes of \p x that have the high bit set
+      inline std::uint64_t unicode_high_bits( unicode_vector x )
+        noexcept
+      {
+        return static_cast<std::uint32_t>( _mm_movemask_epi8( x ) );
+      }
+
+      /// \brief Gets a mask of the bytes of \p x that are continuations
+      inline std::uint64_t unicode_continuations( unicode_vector x )
+        noexcept
+      {
+        // Continuations are the signed bytes below -64 (0xC0)
+        return unicode_high_bits( _mm_cmpgt_epi8( _mm_set1_epi8( -64 ), x ) );
+      }
+
+      inline bool unicode_any( unicode_vector x )
+        noexcept
+      {
+        return _mm_movemask_epi8( _mm_cmpeq_epi8( x, _mm_setzero_si128() ) ) != 0xffff;
+      }
+#endif
+
+      /// The number of bytes validated at a time
+      constexpr std::size_t unicode_block_size() noexcept{ return 64u; }
+
+      /// The number of vectors in a block
+      constexpr std::size_t unicode_block_vectors() noexcept{ return unicode_block_size() / unicode_vector_size(); }
+
+      //-----------------------------------------------------------------------
+      // Validation
+      //-----------------------------------------------------------------------
+
+      /// \brief Classifies each byte of \p input with the byte before it,
+      ///        \p prev1
+      inline unicode_vector unicode_utf8_special_cases( unicode_vector input,
+                                                        unicode_vector prev1 )
+        noexcept
+      {
+        using classes = unicode_utf8_classes<>;
+
+        const auto byte_1_high = unicode_lookup( unicode_load_table( classes::byte_1_high ),
+                                                 unicode_high_nibbles( prev1 ) );
+        const auto byte_1_low  = unicode_lookup( unicode_load_table( classes::byte_1_low ),
+                                                 unicode_and( prev1, unicode_set1( 0x0f ) ) );
+        const auto byte_2_high = unicode_lookup( unicode_load_table( classes::byte_2_high ),
+                                                 unicode_high_nibbles( input ) );
+
+        return unicode_and( unicode_and( byte_1_high, byte_1_low ), byte_2_high );
+      }
+
+      /// \brief Gets the errors in \p input, where \p prev is the vector of
+      ///        bytes before it
+      inline unicode_vector unicode_utf8_errors( unicode_vector input,
+                                                 unicode_vector prev )
+        noexcept
+      {
+        const auto prev1 = unicode_prev<1>( input, prev );
+        const auto prev2 = unicode_prev<2>( input, prev );
+        const auto prev3 = unicode_prev<3>( input, prev );
+
+        const auto special_cases = unicode_utf8_special_cases( input, prev1 );
+
+        // Only 111_____ two bytes back, or 1111____ three bytes back, have
+        // their high bit set after the saturating subtraction; these bytes
+        // must be the continuations that the pair classification flagged as
+        // unicode_two_conts
+        const auto is_third  = unicode_subs( prev2, unicode_set1( 0xe0 - 0x80 ) );
+        const auto is_fourth = unicode_subs( prev3, unicode_set1( 0xf0 - 0x80 ) );
+        const auto must_be_continuation = unicode_and( unicode_or( is_third, is_fourth ),
+                                                       unicode_set1( 0x80 ) );
+
+        return unicode_xor( must_be_continuation, special_cases );
+      }
+
+      /// \brief Gets the bytes of \p input that start a sequence that the
+      ///        end of \p input cuts short
+      inline unicode_vector unicode_utf8_incomplete_at_end( unicode_vector input )
+        noexcept
+      {
+        const auto* max = unicode_utf8_incomplete<>::value + (32u - unicode_vector_size());
+
+        return unicode_subs( input, unicode_load( max ) );
+      }
+
+      /// \brief Accumulates the errors of consecutive blocks of UTF-8
+      struct unicode_utf8_checker
+      {
+        unicode_vector error;
+        unicode_vector prev_input;
+        unicode_vector prev_incomplete;
+      };
+
+      inline unicode_utf8_checker unicode_utf8_make_checker()
+        noexcept
+      {
+        return { unicode_zero(), unicode_zero(), unicode_zero() };
+      }
+
+      /// \brief Checks the unicode_block_size() bytes at \p p
+      inline void unicode_utf8_check_block( unicode_utf8_checker& checker,
+                                            const unsigned char* p )
+        noexcept
+      {
+        unicode_vector input[unicode_block_vectors()];
+        auto any = unicode_zero();
+        for( auto i = 0u; i < unicode_block_vectors(); ++i ) {
+          input[i] = unicode_load( p + i * unicode_vector_size() );
+          any = unicode_or( any, input[i] );
+        }
+
+        // A block of ASCII is only in error if the previous block was cut short
+        if( unicode_high_bits( any ) == 0u ) {
+          checker.error = unicode_or( checker.error, checker.prev_incomplete );
+          return;
+        }
+
+        auto prev = checker.prev_input;
+        for( auto i = 0u; i < unicode_block_vectors(); ++i ) {
+          checker.error = unicode_or( checker.error, unicode_utf8_errors( input[i], prev ) );
+          prev = input[i];
+        }
+        checker.prev_input      = prev;
+        checker.prev_incomplete = unicode_utf8_incomplete_at_end( prev );
+      }
+
+      /// \brief Determines whether the \p n bytes at \p p are valid UTF-8
+      inline bool unicode_utf8_validate( const unsigned char* p, std::size_t n )
+        noexcept
+      {
+        auto checker = unicode_utf8_make_checker();
+
+        auto i = std::size_t{0};
+        for( ; n - i >= unicode_block_size(); i += unicode_block_size() ) {
+          unicode_utf8_check_block( checker, p + i );
+        }
+
+        // The last block is padded with ASCII, which both completes the check
+        // of the final full block and flags a sequence cut short by the end
+        unsigned char last[unicode_block_size()] = {};
+        for( auto j = std::size_t{0}; i + j < n; ++j ) {
+          last[j] = p[i + j];
+        }
+        unicode_utf8_check_block( checker, last );
+
+        return !unicode_any( checker.error );
+      }
+
+      //-----------------------------------------------------------------------
+      // Decoding
+      //-----------------------------------------------------------------------
+
+      /// \brief Checks the unicode_block_size() bytes at \p p, which start a
+      ///        code point, as UTF-8 on their own
+      ///
+      /// A sequence cut short by the end of the block is not an error, since
+      /// decoding stops before it.
+      ///
+      /// \param ascii receives whether the block is entirely ASCII
+      /// \param ends receives a mask of the bytes that end a code point; the
+      ///        last byte is never marked
+      /// \return \c true if no error was found
+      BIT_FORCE_INLINE bool unicode_utf8_check_chunk( const unsigned char* p,
+                                            bool& ascii,
+                                            std::uint64_t& ends )
+        noexcept
+      {
+        unicode_vector input[unicode_block_vectors()];
+        auto any = unicode_zero();
+        for( auto i = 0u; i < unicode_block_vectors(); ++i ) {
+          input[i] = unicode_load( p + i * unicode_vector_size() );
+          any = unicode_or( any, input[i] );
+        }
+
+        ascii = unicode_high_bits( any ) == 0u;
+        if( ascii ) return true;
+
+        auto error         = unicode_zero();
+        auto prev          = unicode_zero();
+        auto continuations = std::uint64_t{0};
+        for( auto i = 0u; i < unicode_block_vectors(); ++i ) {
+          error = unicode_or( error, unicode_utf8_errors( input[i], prev ) );
+          prev  = input[i];
+          continuations |= unicode_continuations( input[i] ) << (i * unicode_vector_size());
+        }
+
+        // A byte ends a code point if the byte after it is not a continuation
+        ends = ~continuations >> 1;
+
+        return !unicode_any( error );
+      }
+
+      /// \brief Combines the bytes gathered into 16-bit lanes from one or two
+      ///        byte sequences
+      inline __m128i unicode_utf8_combine_2( __m128i perm )
+        noexcept
+      {
+        const auto ascii    = _mm_and_si128( perm, _mm_set1_epi16( 0x7f ) );
+        const auto highbyte = _mm_and_si128( perm, _mm_set1_epi16( 0x1f00 ) );
+
+        return _mm_or_si128( ascii, _mm_srli_epi16( highbyte, 2 ) );
+      }
+
+      /// \brief Combines the bytes gathered into 32-bit lanes from sequences
+      ///        of up to three bytes
+      inline __m128i unicode_utf8_combine_3( __m128i perm )
+        noexcept
+      {
+        const auto ascii      = _mm_and_si128( perm, _mm_set1_epi32( 0x7f ) );
+        const auto middlebyte = _mm_and_si128( perm, _mm_set1_epi32( 0x3f00 ) );
+        const auto highbyte   = _mm_and_si128( perm, _mm_set1_epi32( 0x0f0000 ) );
+
+        return _mm_or_si128( _mm_or_si128( ascii, _mm_srli_epi32( middlebyte, 2 ) ),
+                             _mm_srli_epi32( highbyte, 4 ) );
+      }
+
+      /// \brief Combines the bytes gathered into 32-bit lanes from sequences
+      ///        of up to four bytes
+      inline __m128i unicode_utf8_combine_4( __m128i perm )
+        noexcept
+      {
+        const auto ascii      = _mm_and_si128( perm, _mm_set1_epi32( 0x7f ) );
+        const auto middlebyte = _mm_and_si128( perm, _mm_set1_epi32( 0x3f00 ) );
+        auto middlehighbyte   = _mm_and_si128( perm, _mm_set1_epi32( 0x3f0000 ) );
+        const auto highbyte   = _mm_and_si128( perm, _mm_set1_epi32( 0x07000000 ) );
+
+        // The lead of a three byte sequence leaves a stray bit in the third
+        // lane byte, which bit 6 of that byte identifies
+        const auto correct = _mm_srli_epi32( _mm_and_si128( perm, _mm_set1_epi32( 0x400000 ) ), 1 );
+        middlehighbyte = _mm_xor_si128( correct, middlehighbyte );
+
+        return _mm_or_si128( _mm_or_si128( ascii, _mm_srli_epi32( middlebyte, 2 ) ),
+                             _mm_or_si128( _mm_srli_epi32( middlehighbyte, 4 ),
+                                           _mm_srli_epi32( highbyte, 6 ) ) );
+      }
+
+      /// \brief Decodes the code points starting at \p p that end within the
+      ///        next 12 bytes, as marked in \p ends, into \p out
+      ///
+      /// Reads 16 bytes, and writes at most 16 units from \p out.
+      ///
+      /// \return the number of bytes decoded, which is 0 only for a mask that
+      ///         no valid input produces
+      BIT_FORCE_INLINE std::size_t unicode_utf8_decode( const unsigned char* p,
+                                              std::uint64_t ends,
+                                              char16_t*& out )
+        noexcept
+      {
+        const auto in = _mm_loadu_si128( reinterpret_cast<const __m128i*>(p) );
+
+        if( (ends & 0xffffu) == 0xffffu ) {
+          _mm_storeu_si128( reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8( in, _mm_setzero_si128() ) );
+          _mm_storeu_si128( reinterpret_cast<__m128i*>(out + 8), _mm_unpackhi_epi8( in, _mm_setzero_si128() ) );
+          out += 16;
+          return 16u;
+        }
+
+        using shuffles = unicode_utf8_shuffles<>;
+
+        const auto entry    = shuffles::index[ends & 0xfffu];
+        const auto index    = entry[0];
+        const auto consumed = entry[1];
+        if( index == 209u ) return 0u;
+
+        const auto shuffle = _mm_loadu_si128( reinterpret_cast<const __m128i*>(shuffles::value[index]) );
+        const auto perm    = _mm_shuffle_epi8( in, shuffle );
+
+        if( index < 64u ) {
+          _mm_storeu_si128( reinterpret_cast<__m128i*>(out), unicode_utf8_combine_2( perm ) );
+          out += 6;
+        } else if( index < 145u ) {
+          // Every value fits in 16 bits; gather the low halves of the lanes
+          const auto pack = _mm_setr_epi8( 0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1 );
+          const auto composed = _mm_shuffle_epi8( unicode_utf8_combine_3( perm ), pack );
+          _mm_storel_epi64( reinterpret_cast<__m128i*>(out), composed );
+          out += 4;
+        } else {
+          // Code points above U+FFFF become a high surrogate in the low half
+          // of their lane and a low surrogate in the high half, after which
+          // the upper halves of the other lanes are dropped
+          const auto values = unicode_utf8_combine_4( perm );
+          const auto offset = _mm_sub_epi32( values, _mm_set1_epi32( 0x10000 ) );
+          const auto high   = _mm_add_epi32( _mm_srli_epi32( offset, 10 ), _mm_set1_epi32( 0xd800 ) );
+          const auto low    = _mm_add_epi32( _mm_and_si128( values, _mm_set1_epi32( 0x3ff ) ), _mm_set1_epi32( 0xdc00 ) );
+          const auto pair   = _mm_or_si128( _mm_and_si128( high, _mm_set1_epi32( 0xffff ) ),
+                                            _mm_slli_epi32( low, 16 ) );
+          const auto large  = _mm_cmpgt_epi32( values, _mm_set1_epi32( 0xffff ) );
+          const auto units  = _mm_or_si128( _mm_and_si128( large, pair ),
+                                            _mm_andnot_si128( large, values ) );
+
+          const auto mask = static_cast<unsigned>( _mm_movemask_ps( _mm_castsi128_ps( large ) ) ) & 7u;
+          const auto shuffle = _mm_loadu_si128( reinterpret_cast<const __m128i*>(unicode_utf16_shuffles<>::value[mask]) );
+          _mm_storeu_si128( reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8( units, shuffle ) );
+          out += 3u + (mask & 1u) + ((mask >> 1) & 1u) + (mask >> 2);
+        }
+        return consumed;
+      }
+
+      /// \copydoc unicode_utf8_decode( const unsigned char*, std::uint64_t, char16_t*& )
+      BIT_FORCE_INLINE std::size_t unicode_utf8_decode( const unsigned char* p,
+                                              std::uint64_t ends,
+                                              char32_t*& out )
+        noexcept
+      {
+        const auto in = _mm_loadu_si128( reinterpret_cast<const __m128i*>(p) );
+        const auto zero = _mm_setzero_si128();
+
+        if( (ends & 0xffffu) == 0xffffu ) {
+          const auto low  = _mm_unpacklo_epi8( in, zero );
+          const auto high = _mm_unpackhi_epi8( in, zero );
+          _mm_storeu_si128( reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16( low, zero ) );
+          _mm_storeu_si128( reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16( low, zero ) );
+          _mm_storeu_si128( reinterpret_cast<__m128i*>(out + 8), _mm_unpacklo_epi16( high, zero ) );
+          _mm_storeu_si128( reinterpret_cast<__m128i*>(out + 12), _mm_unpackhi_epi16( high, zero ) );
+          out += 16;
+          return 16u;
+        }
+
+        using shuffles = unicode_utf8_shuffles<>;
+
+        const auto entry    = shuffles::index[ends & 0xfffu];
+        const auto index    = entry[0];
+        const auto consumed = entry[1];
+        if( index == 209u ) return 0u;
+
+        const auto shuffle = _mm_loadu_si128( reinterpret_cast<const __m128i*>(shuffles::value[index]) );
+        const auto perm    = _mm_shuffle_epi8( in, shuffle );
+
+        if( index < 64u ) {
+          const auto composed = unicode_utf8_combine_2( perm );
+          _mm_storeu_si128( reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16( composed, zero ) );
+          _mm_storeu_si128( reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16( composed, zero ) );
+          out += 6;
+        } else if( index < 145u ) {
+          _mm_storeu_si128( reinterpret_cast<__m128i*>(out), unicode_utf8_combine_3( perm ) );
+          out += 4;
+        } else {
+          _mm_storeu_si128( reinterpret_cast<__m128i*>(out), unicode_utf8_combine_4( perm ) );
+          out += 3;
+        }
+        return consumed;
+      }
+
+      /// \brief Widens the unicode_block_size() ASCII bytes at \p p into
+      ///        \p out
+      template<typename CharT>
+      inline void unicode_widen_block( const unsigned char* p, CharT* out )
+        noexcept
+      {
+        for( auto i = 0u; i < unicode_block_size(); ++i ) {
+          out[i] = static_cast<CharT>(p[i]);
+        }
+      }
+
+      //-----------------------------------------------------------------------
+      // Encoding
+      //-----------------------------------------------------------------------
+
+      /// \brief Encodes the 4 code points below U+10000 in the 32-bit lanes
+      ///        of \p c as UTF-8 at \p out
+      ///
+      /// Writes 16 bytes from \p out.
+      ///
+      /// \return the number of bytes encoded
+      inline std::size_t unicode_utf8_encode_4( __m128i c, char* out )
+        noexcept
+      {
+        const auto at_least_80  = _mm_cmpgt_epi32( c, _mm_set1_epi32( 0x7f ) );
+        const auto at_least_800 = _mm_cmpgt_epi32( c, _mm_set1_epi32( 0x7ff ) );
+
+        // Each lane holds the bytes of its sequence in memory order
+        const auto continuation_6  = _mm_or_si128( _mm_and_si128( c, _mm_set1_epi32( 0x3f ) ),
+                                                   _mm_set1_epi32( 0x80 ) );
+        const auto continuation_12 = _mm_or_si128( _mm_and_si128( _mm_srli_epi32( c, 6 ), _mm_set1_epi32( 0x3f ) ),
+                                                   _mm_set1_epi32( 0x80 ) );
+        const auto two   = _mm_or_si128( _mm_or_si128( _mm_srli_epi32( c, 6 ), _mm_set1_epi32( 0xc0 ) ),
+                                         _mm_slli_epi32( continuation_6, 8 ) );
+        const auto three = _mm_or_si128( _mm_or_si128( _mm_srli_epi32( c, 12 ), _mm_set1_epi32( 0xe0 ) ),
+                                         _mm_or_si128( _mm_slli_epi32( continuation_12, 8 ),
+                                                       _mm_slli_epi32( continuation_6, 16 ) ) );
+
+        auto lanes = _mm_or_si128( _mm_and_si128( at_least_80, two ),
+                                   _mm_andnot_si128( at_least_80, c ) );
+        lanes = _mm_or_si128( _mm_and_si128( at_least_800, three ),
+                              _mm_andnot_si128( at_least_800, lanes ) );
+
+        const auto index = static_cast<unsigned>( _mm_movemask_ps( _mm_castsi128_ps( at_least_80 ) ) ) |
+                           static_cast<unsigned>( _mm_movemask_ps( _mm_castsi128_ps( at_least_800 ) ) ) << 4;
+
+        using packs = unicode_utf8_packs<>;
+
+        const auto shuffle = _mm_loadu_si128( reinterpret_cast<const __m128i*>(packs::value[index]) );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8( lanes, shuffle ) );
+
+        return packs::length[index];
+      }
+
+      /// \brief Encodes the 8 code units at \p in as UTF-8 at \p out, if
+      ///        none of them is a surrogate
+      ///
+      /// Writes up to 32 bytes from \p out.
+      ///
+      /// \return the number of bytes encoded, or 0 if there is a surrogate
+      inline std::size_t unicode_utf8_encode_8( const char16_t* in, char* out )
+        noexcept
+      {
+        const auto x = _mm_loadu_si128( reinterpret_cast<const __m128i*>(in) );
+        const auto surrogates = _mm_cmpeq_epi16( _mm_and_si128( x, _mm_set1_epi16( static_cast<short>(0xf800) ) ),
+                                                 _mm_set1_epi16( static_cast<short>(0xd800) ) );
+        if( _mm_movemask_epi8( surrogates ) != 0 ) return 0u;
+
+        const auto zero = _mm_setzero_si128();
+        const auto ascii = _mm_cmpeq_epi16( _mm_and_si128( x, _mm_set1_epi16( static_cast<short>(0xff80) ) ), zero );
+        if( _mm_movemask_epi8( ascii ) == 0xffff ) {
+          _mm_storel_epi64( reinterpret_cast<__m128i*>(out), _mm_packus_epi16( x, x ) );
+          return 8u;
+        }
+
+        const auto n = unicode_utf8_encode_4( _mm_unpacklo_epi16( x, zero ), out );
+
+        return n + unicode_utf8_encode_4( _mm_unpackhi_epi16( x, zero ), out + n );
+      }
+
+      /// \brief Encodes the 8 code units at \p in as UTF-8 at \p out, if
+      ///        all of them are below U+10000 and none is a surrogate
+      ///
+      /// Writes up to 32 bytes from \p out.
+      ///
+      /// \return the number of bytes encoded, or 0 if a code unit is not
+      ///         below U+10000 or is a surrogate
+      inline std::size_t unicode_utf8_encode_8( const char32_t* in, char* out )
+        noexcept
+      {
+        const auto a = _mm_loadu_si128( reinterpret_cast<const __m128i*>(in) );
+        const auto b = _mm_loadu_si128( reinterpret_cast<const __m128i*>(in + 4) );
+
+        const auto surrogate = _mm_set1_epi32( 0xd800 );
+        const auto mask      = _mm_set1_epi32( static_cast<int>(0xfffff800u) );
+        const auto rejected  = _mm_or_si128(
+          _mm_or_si128( _mm_cmpeq_epi32( _mm_and_si128( a, mask ), surrogate ),
+                        _mm_cmpeq_epi32( _mm_and_si128( b, mask ), surrogate ) ),
+          _mm_cmpgt_epi32( _mm_srli_epi32( _mm_or_si128( a, b ), 16 ), _mm_setzero_si128() )
+        );
+        if( _mm_movemask_epi8( rejected ) != 0 ) return 0u;
+
+        const auto ascii = _mm_cmpeq_epi32( _mm_srli_epi32( _mm_or_si128( a, b ), 7 ), _mm_setzero_si128() );
+        if( _mm_movemask_epi8( ascii ) == 0xffff ) {
+          const auto packed = _mm_packs_epi32( a, b );
+          _mm_storel_epi64( reinterpret_cast<__m128i*>(out), _mm_packus_epi16( packed, packed ) );
+          return 8u;
+        }
+
+        const auto n = unicode_utf8_encode_4( a, out );
+
+        return n + unicode_utf8_encode_4( b, out + n );
+      }
+
+    } // namespace detail
+  } // namespace core
+} // namespace bit
+
+#endif /* defined(BIT_CORE_UNICODE_HAS_SIMD_UTF8) */
+
+#endif /* BIT_CORE_UTILITIES_DETAIL_UNICODE_SIMD_HPP */
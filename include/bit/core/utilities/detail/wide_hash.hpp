@@ -0,0 +1,628 @@
+/*****************************************************************************
+ * \file
+ * \brief This internal header contains the word-at-a-time hashing engine used
+ *        by bit::core::wide_hash_policy
+ *
+ * \note This is an internal header file, included by other library headers.
+ *       Do not attempt to use it directly.
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_UTILITIES_DETAIL_WIDE_HASH_HPP
+#define BIT_CORE_UTILITIES_DETAIL_WIDE_HASH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../compiler_traits.hpp"
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <cstring>     // std::memcpy
+#include <type_traits> // std::make_unsigned_t
+
+#if defined(BIT_PLATFORM_HAS_AVX2)
+# include <immintrin.h>
+#elif defined(BIT_PLATFORM_HAS_SSE2)
+# include <emmintrin.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// The "wide" hash is a word-at-a-time hash in the style of wyhash and xxh3.
+//
+// Inputs of up to 32 bytes are consumed as (at most) four overlapping 64-bit
+// words, which are then folded with a 64x64->128 bit multiply.
+//
+// Longer inputs are consumed in 32-byte stripes across four independent
+// 64-bit accumulator lanes, so that there is no serial dependency between
+// consecutive words. Every 16 stripes the lanes are scrambled to keep the
+// accumulators well-distributed. The final stripe is always read from the
+// last 32 bytes of input, and the length is folded into the result.
+//
+// The algorithm is defined in terms of little-endian byte sequences, so that
+// the constexpr and runtime (intrinsic) implementations produce identical
+// results.
+//-----------------------------------------------------------------------------
+
+namespace bit {
+  namespace core {
+    namespace detail {
+
+      //-----------------------------------------------------------------------
+      // Constants
+      //-----------------------------------------------------------------------
+
+      constexpr std::uint64_t wide_hash_secret0() noexcept{ return 0xa0761d6478bd642full; }
+      constexpr std::uint64_t wide_hash_secret1() noexcept{ return 0xe7037ed1a0b428dbull; }
+      constexpr std::uint64_t wide_hash_secret2() noexcept{ return 0x8ebc6af09c88c6e3ull; }
+      constexpr std::uint64_t wide_hash_secret3() noexcept{ return 0x589965cc75374cc3ull; }
+
+      constexpr std::uint64_t wide_hash_prime1() noexcept{ return 0x9e3779b185ebca87ull; }
+      constexpr std::uint64_t wide_hash_prime2() noexcept{ return 0xc2b2ae3d27d4eb4full; }
+      constexpr std::uint64_t wide_hash_prime3() noexcept{ return 0x165667b19e3779f9ull; }
+      constexpr std::uint64_t wide_hash_prime4() noexcept{ return 0x85ebca77c2b2ae63ull; }
+      constexpr std::uint64_t wide_hash_prime32() noexcept{ return 0x9e3779b1ull; }
+
+      /// The number of bytes consumed per accumulation step
+      constexpr std::size_t wide_hash_stripe_size() noexcept{ return 32u; }
+
+      /// The number of stripes accumulated between each scramble
+      constexpr std::size_t wide_hash_block_stripes() noexcept{ return 16u; }
+
+      //-----------------------------------------------------------------------
+      // Mixing
+      //-----------------------------------------------------------------------
+
+#if defined(BIT_COMPILER_HAS_INT128)
+      __extension__ typedef unsigned __int128 wide_hash_uint128;
+#endif
+
+      /// \brief Computes the 128-bit product of \p a and \p b, storing the
+      ///        low 64 bits into \p a and the high 64 bits into \p b
+      ///
+      /// \param a the first operand; receives the low bits
+      /// \param b the second operand; receives the high bits
+      inline constexpr void wide_hash_multiply( std::uint64_t& a,
+                                                std::uint64_t& b )
+        noexcept
+      {
+#if defined(BIT_COMPILER_HAS_INT128)
+        auto r = static_cast<wide_hash_uint128>(a);
+        r *= b;
+        a = static_cast<std::uint64_t>(r);
+        b = static_cast<std::uint64_t>(r >> 64);
+#else
+        const auto ha = a >> 32, hb = b >> 32;
+        const auto la = a & 0xffffffffull, lb = b & 0xffffffffull;
+        const auto rh  = ha * hb;
+        const auto rm0 = ha * lb;
+        const auto rm1 = hb * la;
+        const auto rl  = la * lb;
+        const auto t   = rl + (rm0 << 32);
+        auto       c   = static_cast<std::uint64_t>(t < rl);
+        const auto lo  = t + (rm1 << 32);
+        c += static_cast<std::uint64_t>(lo < t);
+        a = lo;
+        b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+      }
+
+      /// \brief Folds the 128-bit product of \p a and \p b into 64 bits
+      inline constexpr std::uint64_t wide_hash_mix( std::uint64_t a,
+                                                    std::uint64_t b )
+        noexcept
+      {
+        wide_hash_multiply( a, b );
+        return a ^ b;
+      }
+
+      /// \brief Final avalanche step so that every input bit affects every
+      ///        output bit
+      inline constexpr std::uint64_t wide_hash_avalanche( std::uint64_t h )
+        noexcept
+      {
+        h ^= h >> 37;
+        h *= 0x165667919e3779f9ull;
+        h ^= h >> 32;
+        return h;
+      }
+
+      //-----------------------------------------------------------------------
+      // Stripe State
+      //-----------------------------------------------------------------------
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief The accumulator state used for inputs longer than a single
+      ///        stripe
+      ////////////////////////////////////////////////////////////////////////
+      struct wide_hash_state
+      {
+        std::uint64_t acc[4];
+        std::uint64_t key[4];
+      };
+
+      inline constexpr wide_hash_state make_wide_hash_state( std::uint64_t seed )
+        noexcept
+      {
+        return wide_hash_state{
+          {
+            wide_hash_prime1(), wide_hash_prime2(),
+            wide_hash_prime3(), wide_hash_prime4()
+          },
+          {
+            wide_hash_secret0() + seed, wide_hash_secret1() - seed,
+            wide_hash_secret2() + seed, wide_hash_secret3() - seed
+          }
+        };
+      }
+
+      /// \brief Accumulates a single stripe, represented as four
+      ///        little-endian words, into the state
+      inline constexpr void wide_hash_accumulate_words( wide_hash_state& state,
+                                                        const std::uint64_t (&words)[4] )
+        noexcept
+      {
+        for( auto i = 0u; i < 4u; ++i ) {
+          const auto d  = words[i];
+          const auto dk = d ^ state.key[i];
+          state.acc[i ^ 1u] += d;
+          state.acc[i]      += (dk & 0xffffffffull) * (dk >> 32);
+        }
+      }
+
+      /// \brief Scrambles the accumulators; applied after every block
+      inline constexpr void wide_hash_scramble( wide_hash_state& state )
+        noexcept
+      {
+        for( auto i = 0u; i < 4u; ++i ) {
+          auto a = state.acc[i];
+          a ^= a >> 47;
+          a ^= state.key[i];
+          a *= wide_hash_prime32();
+          state.acc[i] = a;
+        }
+      }
+
+      /// \brief Determines whether the accumulators are scrambled after the
+      ///        stripe at \p index
+      inline constexpr bool wide_hash_is_block_end( std::size_t index )
+        noexcept
+      {
+        return ((index + 1) % wide_hash_block_stripes()) == 0;
+      }
+
+      /// \brief Merges the accumulators into the final hash value
+      inline constexpr std::uint64_t wide_hash_finalize( const wide_hash_state& state,
+                                                         std::uint64_t length )
+        noexcept
+      {
+        auto h = length * wide_hash_prime1();
+        h += wide_hash_mix( state.acc[0] ^ state.key[2], state.acc[1] ^ state.key[3] );
+        h += wide_hash_mix( state.acc[2] ^ state.key[0], state.acc[3] ^ state.key[1] );
+        return wide_hash_avalanche( h );
+      }
+
+      //-----------------------------------------------------------------------
+      // Byte Readers
+      //-----------------------------------------------------------------------
+
+      /// \brief Reads each character unchanged
+      struct wide_hash_identity
+      {
+        template<typename CharT>
+        constexpr CharT operator()( CharT c ) const noexcept{ return c; }
+      };
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A reader that decomposes a sequence of \p CharT into its
+      ///        little-endian bytes, entirely in constant expressions
+      ///
+      /// Each character is first passed through \p Transform, so that a
+      /// hash may treat distinct characters as equal.
+      ////////////////////////////////////////////////////////////////////////
+      template<typename CharT, typename Transform = wide_hash_identity>
+      class wide_hash_constexpr_reader
+      {
+      public:
+
+        constexpr explicit wide_hash_constexpr_reader( const CharT* str )
+          noexcept
+          : m_str(str)
+        {
+
+        }
+
+        constexpr std::uint64_t byte( std::size_t i )
+          const noexcept
+        {
+          using unsigned_type = std::make_unsigned_t<CharT>;
+
+          const auto c = static_cast<std::uint64_t>(
+            static_cast<unsigned_type>(Transform{}( m_str[i / sizeof(CharT)] ))
+          );
+          return (c >> (8u * (i % sizeof(CharT)))) & 0xffu;
+        }
+
+        constexpr std::uint64_t read( std::size_t i, std::size_t n )
+          const noexcept
+        {
+          auto result = std::uint64_t{0};
+          for( auto j = std::size_t{0}; j < n; ++j ) {
+            result |= byte(i + j) << (8u * j);
+          }
+          return result;
+        }
+
+        constexpr std::uint64_t read32( std::size_t i ) const noexcept{ return read(i,4); }
+        constexpr std::uint64_t read64( std::size_t i ) const noexcept{ return read(i,8); }
+
+        /// \copydoc wide_hash_accumulate_memory
+        constexpr void accumulate( wide_hash_state& state,
+                                   std::size_t i,
+                                   std::size_t stripes,
+                                   std::size_t index,
+                                   std::size_t last )
+          const noexcept
+        {
+          for( ; stripes != 0; --stripes, ++index, i += wide_hash_stripe_size() ) {
+            accumulate_stripe( state, i );
+            if( wide_hash_is_block_end(index) ) {
+              wide_hash_scramble( state );
+            }
+          }
+          accumulate_stripe( state, last );
+        }
+
+      private:
+
+        constexpr void accumulate_stripe( wide_hash_state& state,
+                                          std::size_t i )
+          const noexcept
+        {
+          const std::uint64_t words[4] = {
+            read64(i), read64(i + 8), read64(i + 16), read64(i + 24)
+          };
+          wide_hash_accumulate_words( state, words );
+        }
+
+        const CharT* m_str;
+      };
+
+      //-----------------------------------------------------------------------
+
+#if defined(BIT_PLATFORM_HAS_AVX2)
+      inline __m256i wide_hash_accumulate_avx2( __m256i acc,
+                                                __m256i key,
+                                                const unsigned char* p )
+        noexcept
+      {
+        const auto d       = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(p) );
+        const auto dk      = _mm256_xor_si256( d, key );
+        const auto product = _mm256_mul_epu32( dk, _mm256_srli_epi64( dk, 32 ) );
+        const auto swapped = _mm256_shuffle_epi32( d, _MM_SHUFFLE(1,0,3,2) );
+        return _mm256_add_epi64( acc, _mm256_add_epi64( product, swapped ) );
+      }
+
+      inline __m256i wide_hash_scramble_avx2( __m256i acc, __m256i key )
+        noexcept
+      {
+        const auto prime = _mm256_set1_epi32( static_cast<int>(wide_hash_prime32()) );
+
+        acc = _mm256_xor_si256( acc, _mm256_srli_epi64( acc, 47 ) );
+        acc = _mm256_xor_si256( acc, key );
+
+        const auto lo = _mm256_mul_epu32( acc, prime );
+        const auto hi = _mm256_mul_epu32( _mm256_srli_epi64( acc, 32 ), prime );
+        return _mm256_add_epi64( lo, _mm256_slli_epi64( hi, 32 ) );
+      }
+#elif defined(BIT_PLATFORM_HAS_SSE2)
+      inline __m128i wide_hash_accumulate_sse2( __m128i acc,
+                                                __m128i key,
+                                                const unsigned char* p )
+        noexcept
+      {
+        const auto d       = _mm_loadu_si128( reinterpret_cast<const __m128i*>(p) );
+        const auto dk      = _mm_xor_si128( d, key );
+        const auto product = _mm_mul_epu32( dk, _mm_srli_epi64( dk, 32 ) );
+        const auto swapped = _mm_shuffle_epi32( d, _MM_SHUFFLE(1,0,3,2) );
+        return _mm_add_epi64( acc, _mm_add_epi64( product, swapped ) );
+      }
+
+      inline __m128i wide_hash_scramble_sse2( __m128i acc, __m128i key )
+        noexcept
+      {
+        const auto prime = _mm_set1_epi32( static_cast<int>(wide_hash_prime32()) );
+
+        acc = _mm_xor_si128( acc, _mm_srli_epi64( acc, 47 ) );
+        acc = _mm_xor_si128( acc, key );
+
+        const auto lo = _mm_mul_epu32( acc, prime );
+        const auto hi = _mm_mul_epu32( _mm_srli_epi64( acc, 32 ), prime );
+        return _mm_add_epi64( lo, _mm_slli_epi64( hi, 32 ) );
+      }
+#endif
+
+      /// \brief Accumulates \p stripes consecutive stripes followed by an
+      ///        optional final stripe into \p state
+      ///
+      /// The accumulators are scrambled after every block of stripes; the
+      /// final stripe is never followed by a scramble.
+      ///
+      /// \param state the state to accumulate into
+      /// \param p pointer to the first stripe
+      /// \param stripes the number of consecutive stripes to accumulate
+      /// \param index the index of the first stripe since the start of input
+      /// \param last pointer to the final stripe, or \c nullptr
+      inline void wide_hash_accumulate_memory( wide_hash_state& state,
+                                               const unsigned char* p,
+                                               std::size_t stripes,
+                                               std::size_t index,
+                                               const unsigned char* last )
+        noexcept
+      {
+        constexpr auto stripe_size = wide_hash_stripe_size();
+
+#if defined(BIT_PLATFORM_HAS_AVX2)
+        // Note: constructing these from the words, rather than loading them,
+        //       avoids store-forwarding stalls for short inputs
+        auto acc = _mm256_set_epi64x( static_cast<long long>(state.acc[3]),
+                                      static_cast<long long>(state.acc[2]),
+                                      static_cast<long long>(state.acc[1]),
+                                      static_cast<long long>(state.acc[0]) );
+        const auto key = _mm256_set_epi64x( static_cast<long long>(state.key[3]),
+                                            static_cast<long long>(state.key[2]),
+                                            static_cast<long long>(state.key[1]),
+                                            static_cast<long long>(state.key[0]) );
+
+        for( ; stripes != 0; --stripes, ++index, p += stripe_size ) {
+          acc = wide_hash_accumulate_avx2( acc, key, p );
+          if( wide_hash_is_block_end(index) ) {
+            acc = wide_hash_scramble_avx2( acc, key );
+          }
+        }
+        if( last != nullptr ) {
+          acc = wide_hash_accumulate_avx2( acc, key, last );
+        }
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>(state.acc), acc );
+#elif defined(BIT_PLATFORM_HAS_SSE2)
+        // Note: constructing these from the words, rather than loading them,
+        //       avoids store-forwarding stalls for short inputs
+        auto acc0 = _mm_set_epi64x( static_cast<long long>(state.acc[1]),
+                                    static_cast<long long>(state.acc[0]) );
+        auto acc1 = _mm_set_epi64x( static_cast<long long>(state.acc[3]),
+                                    static_cast<long long>(state.acc[2]) );
+        const auto key0 = _mm_set_epi64x( static_cast<long long>(state.key[1]),
+                                          static_cast<long long>(state.key[0]) );
+        const auto key1 = _mm_set_epi64x( static_cast<long long>(state.key[3]),
+                                          static_cast<long long>(state.key[2]) );
+
+        for( ; stripes != 0; --stripes, ++index, p += stripe_size ) {
+          acc0 = wide_hash_accumulate_sse2( acc0, key0, p );
+          acc1 = wide_hash_accumulate_sse2( acc1, key1, p + 16 );
+          if( wide_hash_is_block_end(index) ) {
+            acc0 = wide_hash_scramble_sse2( acc0, key0 );
+            acc1 = wide_hash_scramble_sse2( acc1, key1 );
+          }
+        }
+        if( last != nullptr ) {
+          acc0 = wide_hash_accumulate_sse2( acc0, key0, last );
+          acc1 = wide_hash_accumulate_sse2( acc1, key1, last + 16 );
+        }
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>(state.acc), acc0 );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>(state.acc + 2), acc1 );
+#else
+        std::uint64_t words[4] = {};
+
+        for( ; stripes != 0; --stripes, ++index, p += stripe_size ) {
+          std::memcpy( words, p, sizeof(words) );
+          wide_hash_accumulate_words( state, words );
+          if( wide_hash_is_block_end(index) ) {
+            wide_hash_scramble( state );
+          }
+        }
+        if( last != nullptr ) {
+          std::memcpy( words, last, sizeof(words) );
+          wide_hash_accumulate_words( state, words );
+        }
+#endif
+      }
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A reader that loads words directly from (little-endian)
+      ///        memory
+      ////////////////////////////////////////////////////////////////////////
+      class wide_hash_memory_reader
+      {
+      public:
+
+        explicit wide_hash_memory_reader( const void* p )
+          noexcept
+          : m_data(static_cast<const unsigned char*>(p))
+        {
+
+        }
+
+        std::uint64_t byte( std::size_t i )
+          const noexcept
+        {
+          return m_data[i];
+        }
+
+        std::uint64_t read32( std::size_t i )
+          const noexcept
+        {
+          auto result = std::uint32_t{0};
+          std::memcpy( &result, m_data + i, sizeof(result) );
+          return result;
+        }
+
+        std::uint64_t read64( std::size_t i )
+          const noexcept
+        {
+          auto result = std::uint64_t{0};
+          std::memcpy( &result, m_data + i, sizeof(result) );
+          return result;
+        }
+
+        /// \copydoc wide_hash_accumulate_memory
+        void accumulate( wide_hash_state& state,
+                         std::size_t i,
+                         std::size_t stripes,
+                         std::size_t index,
+                         std::size_t last )
+          const noexcept
+        {
+          wide_hash_accumulate_memory( state, m_data + i, stripes, index, m_data + last );
+        }
+
+      private:
+
+        const unsigned char* m_data;
+      };
+
+      //-----------------------------------------------------------------------
+      // Algorithm
+      //-----------------------------------------------------------------------
+
+      /// \brief Pre-mixes the user-supplied seed
+      inline constexpr std::uint64_t wide_hash_mix_seed( std::uint64_t seed )
+        noexcept
+      {
+        return seed ^ wide_hash_mix( seed ^ wide_hash_secret0(), wide_hash_secret1() );
+      }
+
+      /// \brief Hashes inputs of at most one stripe
+      template<typename Reader>
+      inline constexpr std::uint64_t wide_hash_short( const Reader& r,
+                                                      std::size_t length,
+                                                      std::uint64_t seed )
+        noexcept
+      {
+        seed = wide_hash_mix_seed( seed );
+
+        auto a = std::uint64_t{0};
+        auto b = std::uint64_t{0};
+
+        if( length <= 16 ) {
+          if( length >= 4 ) {
+            const auto offset = (length >> 3) << 2;
+            a = (r.read32(0) << 32) | r.read32(offset);
+            b = (r.read32(length - 4) << 32) | r.read32(length - 4 - offset);
+          } else if( length > 0 ) {
+            a = (r.byte(0) << 16) | (r.byte(length >> 1) << 8) | r.byte(length - 1);
+          }
+        } else {
+          seed = wide_hash_mix( r.read64(0) ^ wide_hash_secret1(), r.read64(8) ^ seed );
+          a = r.read64(length - 16);
+          b = r.read64(length - 8);
+        }
+
+        a ^= wide_hash_secret1();
+        b ^= seed;
+        wide_hash_multiply( a, b );
+        return wide_hash_mix( a ^ wide_hash_secret0() ^ length, b ^ wide_hash_secret1() );
+      }
+
+      /// \brief Hashes inputs longer than a single stripe
+      ///
+      /// All complete stripes, except for the one containing the final byte,
+      /// are accumulated in order; the final stripe is then read from the
+      /// last 32 bytes of the input (overlapping the previous stripe if the
+      /// length is not a multiple of the stripe size).
+      template<typename Reader>
+      inline constexpr std::uint64_t wide_hash_long( const Reader& r,
+                                                     std::size_t length,
+                                                     std::uint64_t seed )
+        noexcept
+      {
+        constexpr auto stripe_size = wide_hash_stripe_size();
+
+        auto state = make_wide_hash_state( seed );
+
+        r.accumulate( state, 0, (length - 1) / stripe_size, 0, length - stripe_size );
+
+        return wide_hash_finalize( state, length );
+      }
+
+      /// \brief Hashes \p length bytes accessible from the reader \p r
+      template<typename Reader>
+      inline constexpr std::uint64_t wide_hash( const Reader& r,
+                                                std::size_t length,
+                                                std::uint64_t seed )
+        noexcept
+      {
+        return (length <= wide_hash_stripe_size())
+               ? wide_hash_short( r, length, seed )
+               : wide_hash_long( r, length, seed );
+      }
+
+      /// \brief Hashes \p length bytes of raw memory at runtime
+      ///
+      /// \param data pointer to the memory to hash
+      /// \param length the number of bytes to hash
+      /// \param seed the seed of the hash
+      /// \return the hash of the memory
+      inline std::uint64_t wide_hash_bytes( const void* data,
+                                            std::size_t length,
+                                            std::uint64_t seed )
+        noexcept
+      {
+        return wide_hash( wide_hash_memory_reader{data}, length, seed );
+      }
+
+      /// \brief Hashes \p count characters, dispatching to the runtime
+      ///        implementation when not evaluated in a constant expression
+      ///
+      /// \param str pointer to the characters to hash
+      /// \param count the number of characters to hash
+      /// \param seed the seed of the hash
+      /// \return the hash of the characters
+      template<typename CharT>
+      inline constexpr std::uint64_t wide_hash_chars( const CharT* str,
+                                                      std::size_t count,
+                                                      std::uint64_t seed )
+        noexcept
+      {
+#if !defined(BIT_BIG_ENDIAN)
+        if( !BIT_IS_CONSTANT_EVALUATED() ) {
+          return wide_hash_bytes( str, count * sizeof(CharT), seed );
+        }
+#endif
+        return wide_hash( wide_hash_constexpr_reader<CharT>{str},
+                          count * sizeof(CharT),
+                          seed );
+      }
+
+    } // namespace detail
+  } // namespace core
+} // namespace bit
+
+#endif /* BIT_CORE_UTILITIES_DETAIL_WIDE_HASH_HPP */
@@ -0,0 +1,118 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains locale-independent, allocation-free
+ *        formatting of numbers into caller-provided buffers
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_UTILITIES_FORMAT_HPP
+#define BIT_CORE_UTILITIES_FORMAT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../containers/span.hpp"                  // span
+#include "../containers/string_view.hpp"           // string_view
+#include "../traits/composition/size_constant.hpp" // size_constant
+#include "detail/format_float.hpp"                 // detail::format_float_to_decimal
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <cstring>     // std::memcpy
+#include <limits>      // std::numeric_limits
+#include <type_traits> // std::is_integral, std::is_signed
+
+namespace bit {
+  namespace core {
+
+    //=========================================================================
+    // trait : max_formatted_size
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The most characters that format_to writes for a value of type
+    ///        \p T
+    ///
+    /// A buffer of this size never fails to hold a formatted value.
+    ///
+    /// \code
+    /// char buffer[bit::core::max_formatted_size_v<double>];
+    /// \endcode
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    struct max_formatted_size
+      : size_constant<std::numeric_limits<T>::digits10 + 1 + std::is_signed<T>::value>{};
+
+    template<>
+    struct max_formatted_size<float> : size_constant<15>{}; // -1.2345678e-38
+
+    template<>
+    struct max_formatted_size<double> : size_constant<24>{}; // -1.2345678901234567e-308
+
+    template<typename T>
+    constexpr std::size_t max_formatted_size_v = max_formatted_size<T>::value;
+
+    //=========================================================================
+    // format_to
+    //=========================================================================
+
+    /// \brief Formats \p value into \p buffer
+    ///
+    /// Formatting follows the rules of \c std::to_chars without a format
+    /// argument, and does not depend on the current locale or allocate:
+    ///
+    /// - Integers are written in decimal, with a \c '-' if negative.
+    /// - Floating point values are written with the fewest digits that
+    ///   parse back to the same value, in fixed or scientific notation,
+    ///   whichever is shorter; fixed if both are the same length. Infinity
+    ///   and NaN are written as \c "inf" and \c "nan", with a \c '-' if the
+    ///   sign bit is set.
+    ///
+    /// Nothing is written past the end of \p buffer.
+    ///
+    /// \code
+    /// char buffer[32];
+    /// auto text = bit::core::format_to( buffer, 0.3 ); // "0.3"
+    /// \endcode
+    ///
+    /// \tparam T the arithmetic type to format; not \c bool or
+    ///         \c long double
+    /// \param buffer the buffer to write to
+    /// \param value the value to format
+    /// \return a view of the characters written at the start of \p buffer,
+    ///         or an empty view if \p buffer is too small
+    template<typename T>
+    string_view format_to( span<char> buffer, T value ) noexcept;
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/format.inl"
+
+#endif /* BIT_CORE_UTILITIES_FORMAT_HPP */
@@ -39,9 +39,13 @@
 #include "../traits/composition/void_t.hpp"
 #include "../traits/composition/bool_constant.hpp"
 #include "../traits/composition/conjunction.hpp"
+#include "../traits/concepts/is_contiguous_iterator.hpp"
+#include "../traits/properties/has_unique_object_representation.hpp"
+#include "detail/wide_hash.hpp"
 
 #include <cstddef>     // std::size_t
 #include <iterator>    // std::iterator_traits
+#include <memory>      // std::addressof
 #include <type_traits> // std::underlying_type_t, std::enable_if, etc
 #include <utility>     // std::forward
 
@@ -356,17 +360,64 @@ namespace bit {
     /// \param hashes the rest of the hashes to combine with the combined seed/hashes
     /// \return the result of the combinations
     template<typename...Hashes,
-             typename=std::enable_if<(sizeof...(Hashes)>0) &&
-                                     conjunction<std::is_same<Hashes,hash_t>...>::value>>
+             typename=std::enable_if_t<(sizeof...(Hashes)>0) &&
+                                       conjunction<std::is_same<Hashes,hash_t>...>::value>>
     constexpr hash_t hash_combine( hash_t seed,
                                    hash_t hash0,
                                    Hashes...hashes ) noexcept;
 
+    //-------------------------------------------------------------------------
+    // Mixing Functions
+    //-------------------------------------------------------------------------
+
+    /// \brief Scrambles the bits of \p hash so that every input bit affects
+    ///        every output bit
+    ///
+    /// The \c hash_value overloads for integers and pointers return their
+    /// input unchanged, so sequential ids and aligned addresses only differ in
+    /// a few bits. Mixing the result spreads them evenly over power-of-two
+    /// bucket counts. This is a bijection, so it never introduces collisions.
+    ///
+    /// \param hash the hash to mix
+    /// \return the mixed hash
+    constexpr hash_t hash_mix( hash_t hash ) noexcept;
+
+    /// \brief Combines two hash values, mixing the result
+    ///
+    /// Unlike \c hash_combine, this uses a constant sized for \c hash_t and
+    /// mixes the combination with \c hash_mix, so the result is well
+    /// distributed even when the inputs are small integers.
+    ///
+    /// \param seed the seed to combine
+    /// \param hash the hash to combine with the seed
+    /// \return the result of the combination
+    constexpr hash_t hash_combine_mixed( hash_t seed, hash_t hash ) noexcept;
+
+    /// \brief Combines n hash values, mixing each intermediate result
+    ///
+    /// \param seed the seed to begin combination with
+    /// \param hash0 the first hash to combine with the seed
+    /// \param hashes the rest of the hashes to combine with the combined seed/hashes
+    /// \return the result of the combinations
+    template<typename...Hashes,
+             typename=std::enable_if_t<(sizeof...(Hashes)>0) &&
+                                       conjunction<std::is_same<Hashes,hash_t>...>::value>>
+    constexpr hash_t hash_combine_mixed( hash_t seed,
+                                         hash_t hash0,
+                                         Hashes...hashes ) noexcept;
+
     //-------------------------------------------------------------------------
 
     /// \brief Hashes a range of entries, returning the result
     ///
-    /// This is equivalent to combining hashes of all entries within the range
+    /// This is equivalent to combining hashes of all entries within the range.
+    ///
+    /// If \p InputIterator is a contiguous iterator over a type with a unique
+    /// object representation, the range is instead hashed as a single block
+    /// of memory. This produces a different value than the element-wise
+    /// combination, but is consistent for all contiguous ranges of the same
+    /// type. Ranges of integral and enum types hashed this way remain usable
+    /// in constant expressions.
     ///
     /// \param first The beginning of the range to hash
     /// \param last The end of the range to hash
@@ -387,9 +438,68 @@ namespace bit {
     template<typename...Args>
     constexpr hash_t hash_values( Args&&...args );
 
+    //=========================================================================
+    // Hash Policies
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A string hashing policy that uses the FNV-1 hash, consuming one
+    ///        character at a time
+    ///
+    /// This was the original string hash used by this library, and is kept so
+    /// that previously persisted hashes can still be reproduced.
+    ///////////////////////////////////////////////////////////////////////////
+    struct fnv1_hash_policy
+    {
+      /// \brief Hashes \p count characters starting at \p str
+      ///
+      /// \param str the pointer to the start of the string
+      /// \param count the length of the string
+      /// \return the hash of the string segment
+      template<typename CharT>
+      constexpr hash_t operator()( const CharT* str,
+                                   std::size_t count ) const noexcept;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A string hashing policy that consumes 8 to 32 bytes at a time
+    ///
+    /// Short inputs are hashed as a few overlapping 64-bit words; longer
+    /// inputs are hashed in 32-byte stripes over four independent lanes,
+    /// using SSE2 or AVX2 when available.
+    ///
+    /// Characters wider than a byte are hashed as their little-endian byte
+    /// representation. The result is identical whether it is computed at
+    /// compile-time or at runtime.
+    ///////////////////////////////////////////////////////////////////////////
+    struct wide_hash_policy
+    {
+      /// \brief Hashes \p count characters starting at \p str
+      ///
+      /// \param str the pointer to the start of the string
+      /// \param count the length of the string
+      /// \return the hash of the string segment
+      template<typename CharT>
+      constexpr hash_t operator()( const CharT* str,
+                                   std::size_t count ) const noexcept;
+    };
+
+    /// \brief The policy used by \c hash_string_segment when no policy is
+    ///        specified.
+    ///
+    /// Defining \c BIT_CORE_USE_FNV1_STRING_HASH selects \c fnv1_hash_policy
+    /// as the default, which reproduces the hashes of earlier versions of this
+    /// library.
+#if defined(BIT_CORE_USE_FNV1_STRING_HASH)
+    using default_hash_policy = fnv1_hash_policy;
+#else
+    using default_hash_policy = wide_hash_policy;
+#endif
+
     //-------------------------------------------------------------------------
 
-    /// \brief Hashes a segment of a given string
+    /// \brief Hashes a segment of a given string using the
+    ///        \c default_hash_policy
     ///
     /// \param str the pointer to the start of the string
     /// \param count the length of the string
@@ -398,6 +508,18 @@ namespace bit {
     constexpr hash_t hash_string_segment( const CharT* str,
                                           std::size_t count ) noexcept;
 
+    /// \brief Hashes a segment of a given string using the specified
+    ///        \p policy
+    ///
+    /// \param str the pointer to the start of the string
+    /// \param count the length of the string
+    /// \param policy the hashing policy to use
+    /// \return the hash of the string segment
+    template<typename CharT, typename HashPolicy>
+    constexpr hash_t hash_string_segment( const CharT* str,
+                                          std::size_t count,
+                                          const HashPolicy& policy ) noexcept;
+
     /// \brief Hashes the raw memory from a given type
     ///
     /// \param data the data to hash
@@ -405,6 +527,31 @@ namespace bit {
     template<typename T>
     hash_t hash_raw( const T& data ) noexcept;
 
+    //-------------------------------------------------------------------------
+    // Literals
+    //-------------------------------------------------------------------------
+
+    inline namespace literals {
+      inline namespace hash_literals {
+
+        /// \{
+        /// \brief Hashes a string literal with \c hash_string_segment
+        ///
+        /// The result is a constant expression, and so may be used as a
+        /// \c case label when dispatching on the hash of a string.
+        ///
+        /// \param str the string literal
+        /// \param len the length of the string literal
+        /// \return the hash of the string literal
+        constexpr hash_t operator "" _hash( const char* str, std::size_t len ) noexcept;
+        constexpr hash_t operator "" _hash( const wchar_t* str, std::size_t len ) noexcept;
+        constexpr hash_t operator "" _hash( const char16_t* str, std::size_t len ) noexcept;
+        constexpr hash_t operator "" _hash( const char32_t* str, std::size_t len ) noexcept;
+        /// \}
+
+      } // inline namespace hash_literals
+    } // inline namespace literals
+
     //=========================================================================
     // struct : hash
     //=========================================================================
@@ -424,7 +571,33 @@ namespace bit {
       constexpr hash_t operator()( const Key& val );
     };
 
+    //=========================================================================
+    // struct : mixed_hash
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Hash struct that satisfies the requirements of \c std::hash,
+    ///        and mixes the result of \c hash_value with \c hash_mix
+    ///
+    /// This is intended for tables with power-of-two bucket counts keyed on
+    /// integers or pointers, whose \c hash_value is the identity.
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename Key>
+    struct mixed_hash
+    {
+      /// \brief Functor that hashes all key types
+      ///
+      /// \param val the value to hash
+      /// \return the mixed hash of the \p val
+      constexpr hash_t operator()( const Key& val ) const
+        noexcept( is_nothrow_hashable<Key>::value );
+    };
+
   } // namespace core
+
+  inline namespace literals {
+    using namespace core::literals;
+  } // inline namespace literals
 } // namespace bit
 
 #include "detail/hash.inl"
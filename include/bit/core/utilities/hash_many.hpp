@@ -0,0 +1,118 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains utilities for hashing many keys at once
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_UTILITIES_HASH_MANY_HPP
+#define BIT_CORE_UTILITIES_HASH_MANY_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../containers/span.hpp"        // span
+#include "../containers/string_view.hpp" // basic_string_view
+#include "assert.hpp"                    // BIT_ASSERT
+#include "compiler_traits.hpp"           // BIT_PREFETCH
+#include "hash.hpp"                      // hash_t, hash, default_hash_policy
+
+#include <cstddef>     // std::size_t
+#include <type_traits> // std::enable_if_t, std::is_integral, std::is_enum
+
+namespace bit {
+  namespace core {
+
+    //-------------------------------------------------------------------------
+    // Batch Hashing Functions
+    //-------------------------------------------------------------------------
+
+    /// \{
+    /// \brief Hashes every string in \p keys, storing the result in the
+    ///        matching entry of \p hashes
+    ///
+    /// Each result is identical to \c hash_value of the same key. The
+    /// characters of upcoming keys are prefetched, which pays off for large
+    /// key sets that are not in cache; small sets hash at the speed of a
+    /// loop over \c hash_value. When the default hash is FNV-1, several keys
+    /// are also hashed in lockstep, since each of its characters depends on
+    /// the previous one.
+    ///
+    /// \pre \c hashes.size() is at least \c keys.size()
+    ///
+    /// \param keys the strings to hash
+    /// \param hashes the destination of the hashes
+    void hash_many( span<const string_view> keys,
+                    span<hash_t> hashes ) noexcept;
+    void hash_many( span<const wstring_view> keys,
+                    span<hash_t> hashes ) noexcept;
+    void hash_many( span<const u16string_view> keys,
+                    span<hash_t> hashes ) noexcept;
+    void hash_many( span<const u32string_view> keys,
+                    span<hash_t> hashes ) noexcept;
+    /// \}
+
+    /// \brief Hashes every entry in \p keys with \p hasher, storing the
+    ///        result in the matching entry of \p hashes
+    ///
+    /// For integral keys with a \p Hasher of \c hash or \c mixed_hash, this
+    /// loop has no dependencies between keys and is vectorized by the
+    /// compiler.
+    ///
+    /// \pre \c hashes.size() is at least \c keys.size()
+    ///
+    /// \param keys the keys to hash
+    /// \param hashes the destination of the hashes
+    /// \param hasher the function object used to hash each key
+    template<typename T, typename Hasher>
+    void hash_many( span<const T> keys,
+                    span<hash_t> hashes,
+                    Hasher hasher );
+
+    /// \brief Hashes every integral or enum key in \p keys, storing the
+    ///        result of \c hash_value in the matching entry of \p hashes
+    ///
+    /// \pre \c hashes.size() is at least \c keys.size()
+    ///
+    /// \param keys the keys to hash
+    /// \param hashes the destination of the hashes
+#ifndef BIT_DOXYGEN_BUILD
+    template<typename T,
+             typename = std::enable_if_t<std::is_integral<T>::value ||
+                                         std::is_enum<T>::value>>
+#else
+    template<typename T>
+#endif
+    void hash_many( span<const T> keys, span<hash_t> hashes ) noexcept;
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/hash_many.inl"
+
+#endif /* BIT_CORE_UTILITIES_HASH_MANY_HPP */
@@ -0,0 +1,229 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains an incremental hasher for hashing data that
+ *        arrives in pieces
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_UTILITIES_HASHER_HPP
+#define BIT_CORE_UTILITIES_HASHER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../containers/span.hpp" // span
+#include "byte.hpp"               // byte
+#include "compiler_traits.hpp"    // BIT_BIG_ENDIAN
+#include "hash.hpp"               // hash_t, fnv1_hash_policy, wide_hash_policy
+#include "detail/wide_hash.hpp"
+
+#include <algorithm> // std::min
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <cstring>   // std::memcpy
+
+namespace bit {
+  namespace core {
+
+    //=========================================================================
+    // class : basic_hasher
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief An incremental hasher that produces the same result as hashing
+    ///        all of its input at once with the \p HashPolicy
+    ///
+    /// Feeding the characters of a string to \c update in any number of
+    /// pieces and then calling \c finalize yields the same value as
+    /// \c hash_string_segment on the concatenated characters with the same
+    /// policy. Spans of bytes hash as a string of \c byte.
+    ///
+    /// This is only specialized for \c fnv1_hash_policy and
+    /// \c wide_hash_policy.
+    ///
+    /// \tparam HashPolicy the hashing policy to reproduce
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename HashPolicy>
+    class basic_hasher;
+
+    //=========================================================================
+    // class : basic_hasher<fnv1_hash_policy>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief An incremental hasher for the \c fnv1_hash_policy
+    ///////////////////////////////////////////////////////////////////////////
+    template<>
+    class basic_hasher<fnv1_hash_policy>
+    {
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a hasher that has not yet consumed any input
+      constexpr basic_hasher() noexcept;
+
+      /// \brief Constructs a hasher that has not yet consumed any input
+      constexpr basic_hasher( const fnv1_hash_policy& ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Consumes the bytes in \p bytes
+      ///
+      /// \param bytes the bytes to hash
+      void update( span<const byte> bytes ) noexcept;
+
+      /// \brief Consumes the \p count characters starting at \p str
+      ///
+      /// \param str the pointer to the start of the characters
+      /// \param count the number of characters to hash
+      template<typename CharT>
+      void update( const CharT* str, std::size_t count ) noexcept;
+
+      /// \brief Discards all consumed input
+      void reset() noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Computes the hash of all bytes consumed so far
+      ///
+      /// The hasher is left unchanged, and may continue to be updated.
+      ///
+      /// \return the hash of the consumed bytes
+      hash_t finalize() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      std::size_t m_state; ///< The running FNV-1 hash
+    };
+
+    //=========================================================================
+    // class : basic_hasher<wide_hash_policy>
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief An incremental hasher for the \c wide_hash_policy
+    ///
+    /// Complete stripes are accumulated directly from the caller's input;
+    /// only a partial stripe, along with a copy of the most recently
+    /// accumulated stripe, is buffered between calls.
+    ///////////////////////////////////////////////////////////////////////////
+    template<>
+    class basic_hasher<wide_hash_policy>
+    {
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a hasher that has not yet consumed any input
+      basic_hasher() noexcept;
+
+      /// \brief Constructs a hasher that has not yet consumed any input
+      basic_hasher( const wide_hash_policy& ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Modifiers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Consumes the bytes in \p bytes
+      ///
+      /// \param bytes the bytes to hash
+      void update( span<const byte> bytes ) noexcept;
+
+      /// \brief Consumes the \p count characters starting at \p str
+      ///
+      /// \param str the pointer to the start of the characters
+      /// \param count the number of characters to hash
+      template<typename CharT>
+      void update( const CharT* str, std::size_t count ) noexcept;
+
+      /// \brief Discards all consumed input
+      void reset() noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Computes the hash of all bytes consumed so far
+      ///
+      /// The hasher is left unchanged, and may continue to be updated.
+      ///
+      /// \return the hash of the consumed bytes
+      hash_t finalize() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Accumulates \p stripes complete stripes starting at \p p
+      ///
+      /// \param p pointer to the first stripe
+      /// \param stripes the number of stripes to accumulate
+      void accumulate( const unsigned char* p, std::size_t stripes ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      using stripe_type = unsigned char[detail::wide_hash_stripe_size()];
+
+      detail::wide_hash_state m_state;    ///< The accumulators
+      std::size_t             m_length;   ///< Total number of bytes consumed
+      std::size_t             m_stripes;  ///< Number of stripes accumulated
+      std::size_t             m_buffered; ///< Number of bytes in m_buffer
+      stripe_type             m_buffer;   ///< Bytes not yet accumulated
+      stripe_type             m_previous; ///< The last accumulated stripe
+    };
+
+    //-------------------------------------------------------------------------
+
+    /// \brief The incremental hasher for the \c default_hash_policy
+    using hasher = basic_hasher<default_hash_policy>;
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/hasher.inl"
+
+#endif /* BIT_CORE_UTILITIES_HASHER_HPP */
@@ -0,0 +1,209 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a keyed hash for tables whose keys may be
+ *        chosen by an attacker
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_UTILITIES_KEYED_HASH_HPP
+#define BIT_CORE_UTILITIES_KEYED_HASH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../containers/string.hpp"      // insensitive_char_traits
+#include "../containers/string_view.hpp" // basic_string_view
+#include "../traits/properties/has_unique_object_representation.hpp"
+#include "hash.hpp"                      // hash_t, hash_value
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <cstring>     // std::memcpy
+#include <memory>      // std::addressof
+#include <random>      // std::random_device
+#include <string>      // std::basic_string
+#include <type_traits> // std::integral_constant
+
+namespace bit {
+  namespace core {
+
+    //=========================================================================
+    // struct : hash_key
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The secret 128-bit key of a keyed hash
+    ///////////////////////////////////////////////////////////////////////////
+    struct hash_key
+    {
+      std::uint64_t k0;
+      std::uint64_t k1;
+    };
+
+    /// \brief Generates a new random key from \c std::random_device
+    ///
+    /// \return the generated key
+    hash_key make_random_hash_key();
+
+    /// \brief Gets the key shared by every \c keyed_hash in this process
+    ///
+    /// The key is generated with \c make_random_hash_key on first use, so
+    /// hashes differ between runs of the program.
+    ///
+    /// \return the key of this process
+    const hash_key& process_hash_key();
+
+    //=========================================================================
+    // Keyed Hashing Functions
+    //=========================================================================
+
+    /// \brief Hashes \p size bytes at \p data with SipHash-1-3 under \p key
+    ///
+    /// Without the key, an attacker can neither predict the result nor
+    /// construct inputs that collide.
+    ///
+    /// \param key the secret key
+    /// \param data pointer to the bytes to hash
+    /// \param size the number of bytes to hash
+    /// \return the hash of the bytes
+    hash_t hash_bytes_keyed( const hash_key& key,
+                             const void* data,
+                             std::size_t size ) noexcept;
+
+    /// \brief Combines two hash values under \p key
+    ///
+    /// Unlike \c hash_combine, the result can not be predicted without the
+    /// key. Note that keys whose \c hash_value already collide still
+    /// collide after combining.
+    ///
+    /// \param key the secret key
+    /// \param seed the seed to combine
+    /// \param hash the hash to combine with the seed
+    /// \return the result of the combination
+    hash_t hash_combine_keyed( const hash_key& key,
+                               hash_t seed,
+                               hash_t hash ) noexcept;
+
+    //=========================================================================
+    // struct : keyed_hash_policy
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A string hashing policy that uses SipHash-1-3 under a secret
+    ///        key, for use with \c hash_string_segment
+    ///
+    /// Characters are hashed as their in-memory representation. Keyed hashes
+    /// are not meant to be persisted, so this does not need to agree across
+    /// platforms.
+    ///////////////////////////////////////////////////////////////////////////
+    struct keyed_hash_policy
+    {
+      hash_key key; ///< The secret key
+
+      /// \brief Hashes \p count characters starting at \p str
+      ///
+      /// \param str the pointer to the start of the string
+      /// \param count the length of the string
+      /// \return the hash of the string segment
+      template<typename CharT>
+      hash_t operator()( const CharT* str, std::size_t count ) const noexcept;
+    };
+
+    //=========================================================================
+    // class : keyed_hash
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Hash struct that satisfies the requirements of \c std::hash,
+    ///        and whose results can not be predicted without its key
+    ///
+    /// This is intended for tables keyed on untrusted input, where
+    /// predictable hashes allow an attacker to force every key into one
+    /// bucket.
+    ///
+    /// Strings and types with a unique object representation, such as
+    /// integers, enums and pointers, are hashed directly with SipHash-1-3.
+    /// Strings with \c insensitive_char_traits are hashed as if lowered, so
+    /// that keys which compare equal also hash equally.
+    /// Any other type hashes the result of \c hash_value, which randomizes
+    /// its bucket but can not separate keys whose \c hash_value collide.
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename Key>
+    class keyed_hash
+    {
+      //-----------------------------------------------------------------------
+      // Constructors
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a keyed hash using \c process_hash_key
+      keyed_hash();
+
+      /// \brief Constructs a keyed hash using \p key
+      ///
+      /// \param key the secret key
+      explicit keyed_hash( const hash_key& key ) noexcept;
+
+      //-----------------------------------------------------------------------
+      // Hashing
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Hashes \p val under the key
+      ///
+      /// \param val the value to hash
+      /// \return the keyed hash of \p val
+      hash_t operator()( const Key& val ) const
+        noexcept( has_unique_object_representation<Key>::value ||
+                  is_nothrow_hashable<Key>::value );
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the key of this hash
+      ///
+      /// \return the key
+      const hash_key& key() const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      hash_key m_key;
+    };
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/keyed_hash.inl"
+
+#endif /* BIT_CORE_UTILITIES_KEYED_HASH_HPP */
@@ -0,0 +1,115 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains locale-independent, allocation-free parsing
+ *        of numbers from strings
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_UTILITIES_PARSE_HPP
+#define BIT_CORE_UTILITIES_PARSE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../containers/string_view.hpp" // string_view
+#include "expected.hpp"                  // expected
+#include "compiler_traits.hpp"           // BIT_LITTLE_ENDIAN
+#include "detail/parse_float.hpp"        // detail::parse_float_compute
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t, std::int64_t
+#include <cstring>     // std::memcpy
+#include <limits>      // std::numeric_limits
+#include <type_traits> // std::is_integral, std::is_floating_point
+
+namespace bit {
+  namespace core {
+
+    //=========================================================================
+    // enum class : parse_error
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The reasons that parsing a number may fail
+    ///////////////////////////////////////////////////////////////////////////
+    enum class parse_error
+    {
+      invalid_argument = 1, ///< The string does not start with a number
+      out_of_range     = 2, ///< The number does not fit in the result type
+    };
+
+    //=========================================================================
+    // parse
+    //=========================================================================
+
+    /// \brief Parses the number at the start of \p str
+    ///
+    /// Parsing follows the rules of \c std::from_chars, and does not depend
+    /// on the current locale or allocate:
+    ///
+    /// - Integers are a sequence of decimal digits, preceded by a \c '-'
+    ///   only if \p T is signed.
+    /// - Floating point values are an optional \c '-' followed by decimal
+    ///   digits with an optional \c '.' and an optional exponent, or by
+    ///   \c "inf", \c "infinity", \c "nan" or \c "nan(chars)", in any case.
+    ///   Results are correctly rounded to nearest, ties to even; a finite
+    ///   value that rounds to infinity is out of range.
+    ///
+    /// Neither leading whitespace nor a leading \c '+' is accepted.
+    ///
+    /// \code
+    /// auto length = std::size_t{};
+    /// auto port   = bit::core::parse<int>( "8080/tcp", length ); // 8080, length 4
+    /// \endcode
+    ///
+    /// \tparam T the arithmetic type to parse; not \c bool or \c long double
+    /// \param str the string to parse
+    /// \param length receives the number of characters consumed, which is 0
+    ///        for an invalid argument, and covers the whole number for a
+    ///        number out of range
+    /// \return the parsed value on success
+    template<typename T>
+    expected<T,parse_error> parse( string_view str, std::size_t& length ) noexcept;
+
+    /// \brief Parses \p str as a number, requiring the whole string to be
+    ///        consumed
+    ///
+    /// \tparam T the arithmetic type to parse; not \c bool or \c long double
+    /// \param str the string to parse
+    /// \return the parsed value on success, or parse_error::invalid_argument
+    ///         if \p str has trailing characters
+    template<typename T>
+    expected<T,parse_error> parse( string_view str ) noexcept;
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/parse.inl"
+
+#endif /* BIT_CORE_UTILITIES_PARSE_HPP */
@@ -0,0 +1,269 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a compile-time perfect hash table for
+ *        dispatching on a fixed set of strings
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_UTILITIES_PERFECT_HASH_HPP
+#define BIT_CORE_UTILITIES_PERFECT_HASH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../containers/string_view.hpp" // basic_string_view, hash_value
+#include "assert.hpp"                    // BIT_ASSERT_OR_THROW
+#include "compiler_traits.hpp"           // BIT_IS_CONSTANT_EVALUATED
+#include "hash.hpp"                      // hash_t, hash_mix
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint8_t, std::uint16_t, std::uint32_t
+#include <stdexcept>   // std::invalid_argument, std::logic_error
+#include <string>      // std::char_traits
+#include <type_traits> // std::conditional_t
+
+namespace bit {
+  namespace core {
+    namespace detail {
+
+      /// \brief The smallest unsigned type able to index \p N keys, with one
+      ///        value left over to mark empty slots
+      template<std::size_t N>
+      using perfect_hash_index_t =
+        std::conditional_t<(N < 0xffu), std::uint8_t,
+          std::conditional_t<(N < 0xffffu), std::uint16_t, std::uint32_t>>;
+
+      /// \brief Computes the smallest power of two not less than \p n
+      constexpr std::size_t perfect_hash_pow2( std::size_t n )
+        noexcept
+      {
+        return (n <= 1u) ? 1u : 2u * perfect_hash_pow2( (n + 1u) / 2u );
+      }
+
+    } // namespace detail
+
+    //=========================================================================
+    // class : basic_perfect_hash
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A collision-free lookup table over a fixed set of \p N strings
+    ///
+    /// The table is built in a constant expression from the list of keys,
+    /// and maps each key to its index in that list. Looking up a string costs
+    /// a single call to \c hash_value, two table reads, and a single
+    /// comparison against the only key that it could be equal to.
+    ///
+    /// Keys are hashed and compared through \p Traits, so a table using
+    /// \c insensitive_char_traits finds its keys regardless of case.
+    ///
+    /// The keys are first split into buckets by their hash. A displacement
+    /// seed is then searched for each bucket, largest bucket first, such
+    /// that mixing the hashes of its keys with the seed places each one in
+    /// a distinct, unused slot (the "hash and displace" algorithm).
+    ///
+    /// Example use:
+    /// \code
+    /// constexpr auto methods = bit::core::make_perfect_hash( "GET", "PUT", "POST" );
+    ///
+    /// switch( methods.find( method ) ) {
+    ///   case 0: return handle_get();
+    ///   case 1: return handle_put();
+    ///   case 2: return handle_post();
+    ///   default: return handle_unknown();
+    /// }
+    /// \endcode
+    ///
+    /// \note The referenced keys must outlive the table. This is always the
+    ///       case for string literals.
+    ///
+    /// \tparam CharT the character type of the keys
+    /// \tparam N the number of keys
+    /// \tparam Traits the character traits used to compare keys
+    ///////////////////////////////////////////////////////////////////////////
+    template<typename CharT, std::size_t N, typename Traits = std::char_traits<CharT>>
+    class basic_perfect_hash
+    {
+      static_assert( N > 0, "basic_perfect_hash requires at least one key" );
+
+      //-----------------------------------------------------------------------
+      // Public Member Types
+      //-----------------------------------------------------------------------
+    public:
+
+      using char_type   = CharT;
+      using traits_type = Traits;
+      using view_type   = basic_string_view<CharT,Traits>;
+      using size_type   = std::size_t;
+
+      //-----------------------------------------------------------------------
+      // Public Members
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief The value returned by \c find when a string is not a key
+      static constexpr size_type npos = static_cast<size_type>(-1);
+
+      //-----------------------------------------------------------------------
+      // Constructor
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs the table from the list of \p keys
+      ///
+      /// \throws std::invalid_argument if \p keys contains duplicates, and
+      ///         std::logic_error if two distinct keys have the same hash.
+      ///         When evaluated in a constant expression, this is a compile
+      ///         error
+      ///
+      /// \param keys the keys of the table
+      constexpr explicit basic_perfect_hash( const view_type (&keys)[N] );
+
+      //-----------------------------------------------------------------------
+      // Lookup
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Finds the index of the key equal to \p key
+      ///
+      /// \param key the string to look up
+      /// \return the index of \p key in the list the table was constructed
+      ///         from, or \c npos if it is not a key
+      constexpr size_type find( view_type key ) const noexcept;
+
+      /// \brief Finds the index of the key equal to \p key, given its
+      ///        precomputed \p hash
+      ///
+      /// This allows a hash that was already computed with \c hash_value to
+      /// be reused. For the default traits, this is the same hash as
+      /// \c hash_string_segment and the \c _hash literal.
+      ///
+      /// \param key the string to look up
+      /// \param hash the hash of \p key
+      /// \return the index of \p key in the list the table was constructed
+      ///         from, or \c npos if it is not a key
+      constexpr size_type find( view_type key, hash_t hash ) const noexcept;
+
+      /// \brief Checks whether \p key is a key of this table
+      ///
+      /// \param key the string to look up
+      /// \return \c true if \p key is a key of this table
+      constexpr bool contains( view_type key ) const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Observers
+      //-----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the number of keys in this table
+      ///
+      /// \return the number of keys
+      constexpr size_type size() const noexcept;
+
+      /// \brief Gets the key at \p index
+      ///
+      /// \param index the index of the key
+      /// \return the key
+      constexpr view_type operator[]( size_type index ) const noexcept;
+
+      //-----------------------------------------------------------------------
+      // Private Member Types
+      //-----------------------------------------------------------------------
+    private:
+
+      using index_type = detail::perfect_hash_index_t<N>;
+      using seed_type  = std::uint16_t;
+
+      //-----------------------------------------------------------------------
+      // Private Members
+      //-----------------------------------------------------------------------
+    private:
+
+      static constexpr size_type bucket_count = detail::perfect_hash_pow2( (N + 1u) / 2u );
+      static constexpr size_type slot_count   = detail::perfect_hash_pow2( 2u * N );
+      static constexpr index_type empty_slot  = static_cast<index_type>(-1);
+
+      view_type  m_keys[N];              ///< The keys, in their original order
+      hash_t     m_hashes[N];            ///< The hash of each key
+      seed_type  m_seeds[bucket_count];  ///< The displacement of each bucket
+      index_type m_slots[slot_count];    ///< The key index of each slot
+
+      //-----------------------------------------------------------------------
+      // Private Static Member Functions
+      //-----------------------------------------------------------------------
+    private:
+
+      /// \brief Gets the bucket of the key with the given \p hash
+      static constexpr size_type bucket_of( hash_t hash ) noexcept;
+
+      /// \brief Gets the slot of the key with the given \p hash, displaced
+      ///        by \p seed
+      static constexpr size_type slot_of( hash_t hash, seed_type seed ) noexcept;
+
+      /// \brief Compares two strings for equality
+      static constexpr bool equal( view_type lhs, view_type rhs ) noexcept;
+    };
+
+    //-------------------------------------------------------------------------
+    // Type Aliases
+    //-------------------------------------------------------------------------
+
+    template<std::size_t N>
+    using perfect_hash = basic_perfect_hash<char,N>;
+    template<std::size_t N>
+    using wperfect_hash = basic_perfect_hash<wchar_t,N>;
+    template<std::size_t N>
+    using u16perfect_hash = basic_perfect_hash<char16_t,N>;
+    template<std::size_t N>
+    using u32perfect_hash = basic_perfect_hash<char32_t,N>;
+
+    //=========================================================================
+    // non-member functions : class : basic_perfect_hash
+    //=========================================================================
+
+    //-------------------------------------------------------------------------
+    // Utilities
+    //-------------------------------------------------------------------------
+
+    /// \brief Makes a perfect hash table from a list of string literals
+    ///
+    /// The index of each key is its position in the argument list.
+    ///
+    /// \param keys the string literals to use as keys
+    /// \return the perfect hash table
+    template<typename CharT, std::size_t...Ns>
+    constexpr basic_perfect_hash<CharT,sizeof...(Ns)>
+      make_perfect_hash( const CharT (&...keys)[Ns] );
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/perfect_hash.inl"
+
+#endif /* BIT_CORE_UTILITIES_PERFECT_HASH_HPP */
@@ -0,0 +1,95 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains a tree hash for hashing very large buffers on
+ *        several threads
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_UTILITIES_TREE_HASH_HPP
+#define BIT_CORE_UTILITIES_TREE_HASH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../containers/span.hpp" // span
+#include "byte.hpp"               // byte
+#include "compiler_traits.hpp"    // BIT_COMPILER_EXCEPTIONS_ENABLED
+#include "hash.hpp"               // hash_t
+#include "detail/wide_hash.hpp"   // detail::wide_hash_bytes, detail::wide_hash_chars
+
+#include <algorithm>    // std::min
+#include <atomic>       // std::atomic
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+#include <system_error> // std::system_error
+#include <thread>       // std::thread
+#include <vector>       // std::vector
+
+namespace bit {
+  namespace core {
+
+    //=========================================================================
+    // Tree Hashing
+    //=========================================================================
+
+    /// \brief The number of bytes hashed as one leaf of a \c tree_hash
+    constexpr std::size_t tree_hash_chunk_size() noexcept;
+
+    /// \brief Hashes \p bytes as a two-level tree, using up to \p threads
+    ///        threads
+    ///
+    /// \p bytes is split into chunks of \c tree_hash_chunk_size() bytes,
+    /// each chunk is hashed with its index as the seed, and the root is
+    /// the hash of all chunk hashes in order, as little-endian words, seeded
+    /// with the total length.
+    /// Chunks are handed out to threads as they become free, but the
+    /// result only depends on the bytes, never on \p threads.
+    ///
+    /// If a thread can not be started, its share of the work is done by the
+    /// calling thread instead.
+    ///
+    /// \note This is a different function than \c hash_string_segment, and
+    ///       the two do not produce the same value for the same bytes.
+    ///
+    /// \note This function starts threads with \c std::thread, so programs
+    ///       that use it must link the platform's thread library (with CMake,
+    ///       \c Threads::Threads). The rest of the library does not need it.
+    ///
+    /// \param bytes the bytes to hash
+    /// \param threads the maximum number of threads to use, including the
+    ///        calling thread. 0 uses \c std::thread::hardware_concurrency
+    /// \return the hash of the bytes
+    hash_t tree_hash( span<const byte> bytes, std::size_t threads = 0u );
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/tree_hash.inl"
+
+#endif /* BIT_CORE_UTILITIES_TREE_HASH_HPP */
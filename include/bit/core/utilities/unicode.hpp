@@ -0,0 +1,269 @@
+/*****************************************************************************
+ * \file
+ * \brief This header contains validation of, and conversion between, the
+ *        UTF-8, UTF-16 and UTF-32 encodings of strings
+ *****************************************************************************/
+
+/*
+  The MIT License (MIT)
+
+  CppBits Core Library.
+  https://github.com/cppbits/Core
+
+  Copyright (c) 2018 Matthew Rodusek
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BIT_CORE_UTILITIES_UNICODE_HPP
+#define BIT_CORE_UTILITIES_UNICODE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../containers/span.hpp"        // span
+#include "../containers/string_span.hpp" // string_span, u16string_span, ...
+#include "../containers/string_view.hpp" // string_view, u16string_view, ...
+#include "expected.hpp"                  // expected
+#include "compiler_traits.hpp"           // BIT_LITTLE_ENDIAN
+#include "detail/unicode_simd.hpp"       // detail::unicode_utf8_validate
+
+#include <cstddef> // std::size_t, std::ptrdiff_t
+#include <cstdint> // std::uint32_t, std::uint64_t
+#include <cstring> // std::memcpy
+
+namespace bit {
+  namespace core {
+
+    //=========================================================================
+    // enum class : unicode_error
+    //=========================================================================
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The reasons that converting between encodings may fail
+    ///////////////////////////////////////////////////////////////////////////
+    enum class unicode_error
+    {
+      invalid_encoding = 1, ///< The input is not valid in its encoding
+      buffer_too_small = 2, ///< The output does not fit in the buffer
+    };
+
+    //=========================================================================
+    // Validation
+    //=========================================================================
+
+    /// \brief Determines whether \p str is valid UTF-8
+    ///
+    /// Valid UTF-8 has no overlong sequences, no encoded surrogates and no
+    /// code points above U+10FFFF.
+    ///
+    /// \param str the string to validate
+    /// \return \c true if \p str is valid UTF-8
+    bool is_valid_utf8( string_view str ) noexcept;
+
+    /// \copydoc is_valid_utf8( string_view )
+    template<std::ptrdiff_t Extent>
+    bool is_valid_utf8( string_span<Extent> str ) noexcept;
+
+    /// \brief Determines whether \p str is valid UTF-16
+    ///
+    /// Valid UTF-16 has every high surrogate followed by a low surrogate,
+    /// and no other surrogates.
+    ///
+    /// \param str the string to validate
+    /// \return \c true if \p str is valid UTF-16
+    bool is_valid_utf16( u16string_view str ) noexcept;
+
+    /// \copydoc is_valid_utf16( u16string_view )
+    template<std::ptrdiff_t Extent>
+    bool is_valid_utf16( u16string_span<Extent> str ) noexcept;
+
+    /// \brief Determines whether \p str is valid UTF-32
+    ///
+    /// Valid UTF-32 has no surrogates and no code points above U+10FFFF.
+    ///
+    /// \param str the string to validate
+    /// \return \c true if \p str is valid UTF-32
+    bool is_valid_utf32( u32string_view str ) noexcept;
+
+    /// \copydoc is_valid_utf32( u32string_view )
+    template<std::ptrdiff_t Extent>
+    bool is_valid_utf32( u32string_span<Extent> str ) noexcept;
+
+    //=========================================================================
+    // Lengths
+    //=========================================================================
+
+    /// \brief Counts the code units of the UTF-8 encoding of \p str
+    ///
+    /// The count is only meaningful if \p str is valid.
+    ///
+    /// \param str the UTF-16 or UTF-32 string to measure
+    /// \return the number of bytes that converting \p str to UTF-8 writes
+    std::size_t utf8_length( u16string_view str ) noexcept;
+
+    /// \copydoc utf8_length( u16string_view )
+    std::size_t utf8_length( u32string_view str ) noexcept;
+
+    /// \brief Counts the code units of the UTF-16 encoding of \p str
+    ///
+    /// The count is only meaningful if \p str is valid.
+    ///
+    /// \param str the UTF-8 or UTF-32 string to measure
+    /// \return the number of code units that converting \p str to UTF-16
+    ///         writes
+    std::size_t utf16_length( string_view str ) noexcept;
+
+    /// \copydoc utf16_length( string_view )
+    std::size_t utf16_length( u32string_view str ) noexcept;
+
+    /// \brief Counts the code points of \p str
+    ///
+    /// The count is only meaningful if \p str is valid.
+    ///
+    /// \param str the UTF-8 or UTF-16 string to measure
+    /// \return the number of code units that converting \p str to UTF-32
+    ///         writes
+    std::size_t utf32_length( string_view str ) noexcept;
+
+    /// \copydoc utf32_length( string_view )
+    std::size_t utf32_length( u16string_view str ) noexcept;
+
+    //=========================================================================
+    // Conversion
+    //=========================================================================
+
+    /// \brief Converts the UTF-8 string \p str to UTF-16 in \p buffer
+    ///
+    /// The input is validated as it is converted, and the conversion stops
+    /// at the first invalid sequence or at the first code point that does
+    /// not fit in \p buffer. A buffer of utf16_length(str) code units, or of
+    /// \c str.size() code units without measuring, is always large enough.
+    ///
+    /// The contents of \p buffer past the returned string are unspecified,
+    /// as are its contents if the conversion fails.
+    ///
+    /// \code
+    /// char16_t buffer[256];
+    /// auto utf16 = bit::core::utf8_to_utf16( payload, buffer );
+    /// if( !utf16 ) { ... }
+    /// \endcode
+    ///
+    /// \param str the string to convert
+    /// \param buffer the buffer to write into
+    /// \return the converted string, which refers to \p buffer
+    expected<u16string_view,unicode_error>
+      utf8_to_utf16( string_view str, span<char16_t> buffer ) noexcept;
+
+    /// \copydoc utf8_to_utf16( string_view, span<char16_t> )
+    template<std::ptrdiff_t Extent>
+    expected<u16string_view,unicode_error>
+      utf8_to_utf16( string_span<Extent> str, span<char16_t> buffer ) noexcept;
+
+    /// \brief Converts the UTF-8 string \p str to UTF-32 in \p buffer
+    ///
+    /// The conversion behaves as utf8_to_utf16. A buffer of
+    /// utf32_length(str) code units, or of \c str.size() code units without
+    /// measuring, is always large enough.
+    ///
+    /// \param str the string to convert
+    /// \param buffer the buffer to write into
+    /// \return the converted string, which refers to \p buffer
+    expected<u32string_view,unicode_error>
+      utf8_to_utf32( string_view str, span<char32_t> buffer ) noexcept;
+
+    /// \copydoc utf8_to_utf32( string_view, span<char32_t> )
+    template<std::ptrdiff_t Extent>
+    expected<u32string_view,unicode_error>
+      utf8_to_utf32( string_span<Extent> str, span<char32_t> buffer ) noexcept;
+
+    /// \brief Converts the UTF-16 string \p str to UTF-8 in \p buffer
+    ///
+    /// The conversion behaves as utf8_to_utf16. A buffer of
+    /// utf8_length(str) bytes, or of <tt>3 * str.size()</tt> bytes without
+    /// measuring, is always large enough.
+    ///
+    /// \param str the string to convert
+    /// \param buffer the buffer to write into
+    /// \return the converted string, which refers to \p buffer
+    expected<string_view,unicode_error>
+      utf16_to_utf8( u16string_view str, span<char> buffer ) noexcept;
+
+    /// \copydoc utf16_to_utf8( u16string_view, span<char> )
+    template<std::ptrdiff_t Extent>
+    expected<string_view,unicode_error>
+      utf16_to_utf8( u16string_span<Extent> str, span<char> buffer ) noexcept;
+
+    /// \brief Converts the UTF-16 string \p str to UTF-32 in \p buffer
+    ///
+    /// The conversion behaves as utf8_to_utf16. A buffer of
+    /// utf32_length(str) code units, or of \c str.size() code units without
+    /// measuring, is always large enough.
+    ///
+    /// \param str the string to convert
+    /// \param buffer the buffer to write into
+    /// \return the converted string, which refers to \p buffer
+    expected<u32string_view,unicode_error>
+      utf16_to_utf32( u16string_view str, span<char32_t> buffer ) noexcept;
+
+    /// \copydoc utf16_to_utf32( u16string_view, span<char32_t> )
+    template<std::ptrdiff_t Extent>
+    expected<u32string_view,unicode_error>
+      utf16_to_utf32( u16string_span<Extent> str, span<char32_t> buffer ) noexcept;
+
+    /// \brief Converts the UTF-32 string \p str to UTF-8 in \p buffer
+    ///
+    /// The conversion behaves as utf8_to_utf16. A buffer of
+    /// utf8_length(str) bytes, or of <tt>4 * str.size()</tt> bytes without
+    /// measuring, is always large enough.
+    ///
+    /// \param str the string to convert
+    /// \param buffer the buffer to write into
+    /// \return the converted string, which refers to \p buffer
+    expected<string_view,unicode_error>
+      utf32_to_utf8( u32string_view str, span<char> buffer ) noexcept;
+
+    /// \copydoc utf32_to_utf8( u32string_view, span<char> )
+    template<std::ptrdiff_t Extent>
+    expected<string_view,unicode_error>
+      utf32_to_utf8( u32string_span<Extent> str, span<char> buffer ) noexcept;
+
+    /// \brief Converts the UTF-32 string \p str to UTF-16 in \p buffer
+    ///
+    /// The conversion behaves as utf8_to_utf16. A buffer of
+    /// utf16_length(str) code units, or of <tt>2 * str.size()</tt> code
+    /// units without measuring, is always large enough.
+    ///
+    /// \param str the string to convert
+    /// \param buffer the buffer to write into
+    /// \return the converted string, which refers to \p buffer
+    expected<u16string_view,unicode_error>
+      utf32_to_utf16( u32string_view str, span<char16_t> buffer ) noexcept;
+
+    /// \copydoc utf32_to_utf16( u32string_view, span<char16_t> )
+    template<std::ptrdiff_t Extent>
+    expected<u16string_view,unicode_error>
+      utf32_to_utf16( u32string_span<Extent> str, span<char16_t> buffer ) noexcept;
+
+  } // namespace core
+} // namespace bit
+
+#include "detail/unicode.inl"
+
+#endif /* BIT_CORE_UTILITIES_UNICODE_HPP */
@@ -0,0 +1,151 @@
+/*****************************************************************************
+ * \file
+ * \brief This header defines the reproducible test data and reference
+ *        searches shared by the unit tests
+ *****************************************************************************/
+
+#ifndef BIT_CORE_TEST_TEST_SUPPORT_HPP
+#define BIT_CORE_TEST_TEST_SUPPORT_HPP
+
+#include <bit/core/utilities/byte.hpp> // byte
+
+#include <cstddef> // std::size_t
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+namespace test {
+
+  //--------------------------------------------------------------------------
+  // Test Data
+  //--------------------------------------------------------------------------
+
+  /// \brief Advances the linear congruential generator \p state, and gets
+  ///        its next value
+  ///
+  /// The low bits of the state are discarded, since they have short periods
+  ///
+  /// \param state the state of the generator
+  /// \return the next value
+  inline std::size_t next_random( std::size_t& state )
+    noexcept
+  {
+    state = state * 1103515245u + 12345u;
+    return state >> 16;
+  }
+
+  /// \brief Makes \p size pseudo-random bytes, the same on every run
+  ///
+  /// \param size the number of bytes to make
+  /// \return the bytes
+  inline std::vector<bit::core::byte> make_test_bytes( std::size_t size )
+  {
+    auto result = std::vector<bit::core::byte>{};
+    result.reserve( size );
+
+    auto state = std::size_t{0x2545f491u};
+    for( auto i = std::size_t{0}; i < size; ++i ) {
+      result.push_back( static_cast<bit::core::byte>(next_random( state )) );
+    }
+    return result;
+  }
+
+  /// \brief Makes a string of \p size pseudo-random characters of any value
+  ///
+  /// \param size the length of the string
+  /// \param seed the seed of the generator
+  /// \return the string
+  inline std::string make_test_string( std::size_t size, unsigned seed )
+  {
+    auto result = std::string( size, '\0' );
+
+    auto state = std::size_t{seed};
+    for( auto& c : result ) {
+      c = static_cast<char>(next_random( state ));
+    }
+    return result;
+  }
+
+  /// \brief Makes a string of \p size pseudo-random characters drawn from
+  ///        \p alphabet
+  ///
+  /// A small alphabet makes partial matches of a needle common
+  ///
+  /// \param size the length of the string
+  /// \param alphabet the characters to draw from
+  /// \param seed the seed of the generator
+  /// \return the string
+  inline std::string make_test_string( std::size_t size,
+                                       const std::string& alphabet,
+                                       unsigned seed )
+  {
+    auto result = std::string( size, '\0' );
+
+    auto state = std::size_t{seed};
+    for( auto& c : result ) {
+      c = alphabet[next_random( state ) % alphabet.size()];
+    }
+    return result;
+  }
+
+  //--------------------------------------------------------------------------
+  // Reference Searches
+  //--------------------------------------------------------------------------
+
+  // These have the semantics of std::basic_string: forward searches start
+  // at pos, and backward searches end at pos (or the last candidate)
+
+  /// \brief Finds the first occurrence of \p x in \p h at or after \p pos
+  inline std::size_t naive_find( const std::string& h,
+                                 const std::string& x,
+                                 std::size_t pos )
+  {
+    for( auto i = pos; i + x.size() <= h.size(); ++i ) {
+      if( h.compare( i, x.size(), x ) == 0 ) return i;
+    }
+    return std::string::npos;
+  }
+
+  /// \brief Finds the last occurrence of \p x in \p h starting at or before
+  ///        \p pos
+  inline std::size_t naive_rfind( const std::string& h,
+                                  const std::string& x,
+                                  std::size_t pos )
+  {
+    if( x.size() > h.size() ) return std::string::npos;
+
+    const auto max = h.size() - x.size() + 1;
+    for( auto i = (pos < max) ? pos + 1 : max; i > 0; --i ) {
+      if( h.compare( i - 1, x.size(), x ) == 0 ) return i - 1;
+    }
+    return std::string::npos;
+  }
+
+  /// \brief Finds the first character of \p h at or after \p pos whose
+  ///        membership in \p set equals \p member
+  inline std::size_t naive_find_first_of( const std::string& h,
+                                          const std::string& set,
+                                          std::size_t pos,
+                                          bool member )
+  {
+    for( auto i = pos; i < h.size(); ++i ) {
+      if( (set.find( h[i] ) != std::string::npos) == member ) return i;
+    }
+    return std::string::npos;
+  }
+
+  /// \brief Finds the last character of \p h at or before \p pos whose
+  ///        membership in \p set equals \p member
+  inline std::size_t naive_find_last_of( const std::string& h,
+                                         const std::string& set,
+                                         std::size_t pos,
+                                         bool member )
+  {
+    for( auto i = (pos < h.size()) ? pos + 1 : h.size(); i > 0; --i ) {
+      if( (set.find( h[i - 1] ) != std::string::npos) == member ) return i - 1;
+    }
+    return std::string::npos;
+  }
+
+} // namespace test
+
+#endif /* BIT_CORE_TEST_TEST_SUPPORT_HPP */
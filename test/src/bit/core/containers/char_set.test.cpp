@@ -0,0 +1,234 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for bit::core::char_set
+ *****************************************************************************/
+
+#include <bit/core/containers/char_set.hpp>
+
+#include "test_support.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  constexpr auto npos = static_cast<std::size_t>(bit::core::char_set::npos);
+
+  void check_matches_naive( const std::string& set_chars )
+  {
+    const auto set = bit::core::char_set( set_chars.data(), set_chars.size() );
+
+    for( auto size = std::size_t{0}; size <= 80; ++size ) {
+      // Draw haystack characters from the set half of the time, so that
+      // both members and non-members are common
+      auto s = test::make_test_string( size, static_cast<unsigned>(size + set_chars.size()) );
+      for( auto i = std::size_t{0}; i < s.size(); ++i ) {
+        if( (static_cast<unsigned char>(s[i]) & 1u) != 0u && !set_chars.empty() ) {
+          s[i] = set_chars[static_cast<unsigned char>(s[i]) % set_chars.size()];
+        }
+      }
+
+      for( auto pos = std::size_t{0}; pos <= size; pos += 3 ) {
+        REQUIRE( set.find_first_in( s.data(), s.size(), pos ) == test::naive_find_first_of( s, set_chars, pos, true ) );
+        REQUIRE( set.find_first_not_in( s.data(), s.size(), pos ) == test::naive_find_first_of( s, set_chars, pos, false ) );
+        REQUIRE( set.find_last_in( s.data(), s.size(), pos ) == test::naive_find_last_of( s, set_chars, pos, true ) );
+        REQUIRE( set.find_last_not_in( s.data(), s.size(), pos ) == test::naive_find_last_of( s, set_chars, pos, false ) );
+      }
+      REQUIRE( set.find_last_in( s.data(), s.size() ) == test::naive_find_last_of( s, set_chars, npos, true ) );
+      REQUIRE( set.find_last_not_in( s.data(), s.size() ) == test::naive_find_last_of( s, set_chars, npos, false ) );
+    }
+  }
+
+  constexpr bit::core::char_set constexpr_set( " \t\r\n", 4 );
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+TEST_CASE("char_set::char_set()", "[char_set]")
+{
+  const auto set = bit::core::char_set{};
+
+  SECTION("Is empty")
+  {
+    REQUIRE( set.empty() );
+    REQUIRE( set.size() == 0u );
+  }
+
+  SECTION("Contains no characters")
+  {
+    for( auto c = 0; c < 256; ++c ) {
+      REQUIRE_FALSE( set.contains( static_cast<char>(c) ) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("char_set::char_set( const char* )", "[char_set]")
+{
+  const auto set = bit::core::char_set( "abca\xff" );
+
+  SECTION("Contains each distinct character once")
+  {
+    REQUIRE( set.size() == 4u );
+  }
+
+  SECTION("Contains the characters of the string")
+  {
+    REQUIRE( set.contains( 'a' ) );
+    REQUIRE( set.contains( 'b' ) );
+    REQUIRE( set.contains( 'c' ) );
+    REQUIRE( set.contains( '\xff' ) );
+  }
+
+  SECTION("Does not contain other characters")
+  {
+    REQUIRE_FALSE( set.contains( 'd' ) );
+    REQUIRE_FALSE( set.contains( '\0' ) );
+    REQUIRE_FALSE( set.contains( '\x7f' ) );
+  }
+
+  SECTION("Is usable in constant expressions")
+  {
+    STATIC_REQUIRE( constexpr_set.contains( '\t' ) );
+    STATIC_REQUIRE( !constexpr_set.contains( 'x' ) );
+    STATIC_REQUIRE( constexpr_set.size() == 4u );
+    STATIC_REQUIRE( constexpr_set.find_first_in( "ab cd", 5 ) == 2u );
+    STATIC_REQUIRE( constexpr_set.find_last_not_in( "ab  ", 4 ) == 1u );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+TEST_CASE("char_set::insert( char )", "[char_set]")
+{
+  auto set = bit::core::char_set( "ab" );
+  set.insert( '\x80' );
+
+  SECTION("Adds the character")
+  {
+    REQUIRE( set.contains( '\x80' ) );
+    REQUIRE( set.size() == 3u );
+  }
+
+  SECTION("Is found by searches")
+  {
+    const auto s = std::string( 40, 'z' ) + "\x80";
+
+    REQUIRE( set.find_first_in( s.data(), s.size() ) == 40u );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("char_set::erase( char )", "[char_set]")
+{
+  auto set = bit::core::char_set( "ab" );
+  set.erase( 'a' );
+
+  SECTION("Removes the character")
+  {
+    REQUIRE_FALSE( set.contains( 'a' ) );
+    REQUIRE( set.size() == 1u );
+  }
+
+  SECTION("Is not found by searches")
+  {
+    const auto s = std::string( 40, 'a' ) + "b";
+
+    REQUIRE( set.find_first_in( s.data(), s.size() ) == 40u );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Operations
+//----------------------------------------------------------------------------
+
+TEST_CASE("char_set::find_first_in( const char*, size_type, size_type )", "[char_set]")
+{
+  const auto set = bit::core::char_set( ",;" );
+  const auto s   = std::string( "key=value;other,last" );
+
+  SECTION("Returns the first member at or after pos")
+  {
+    REQUIRE( set.find_first_in( s.data(), s.size() ) == 9u );
+    REQUIRE( set.find_first_in( s.data(), s.size(), 10 ) == 15u );
+  }
+
+  SECTION("Returns npos if there is no member")
+  {
+    REQUIRE( set.find_first_in( s.data(), s.size(), 16 ) == npos );
+    REQUIRE( set.find_first_in( s.data(), s.size(), 100 ) == npos );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("char_set::find_last_in( const char*, size_type, size_type )", "[char_set]")
+{
+  const auto set = bit::core::char_set( ",;" );
+  const auto s   = std::string( "key=value;other,last" );
+
+  SECTION("Returns the last member at or before pos")
+  {
+    REQUIRE( set.find_last_in( s.data(), s.size() ) == 15u );
+    REQUIRE( set.find_last_in( s.data(), s.size(), 14 ) == 9u );
+  }
+
+  SECTION("Returns a member exactly at pos")
+  {
+    REQUIRE( set.find_last_in( s.data(), s.size(), 9 ) == 9u );
+    REQUIRE( set.find_last_in( s.data(), s.size(), 15 ) == 15u );
+
+    // Long enough to be scanned in blocks
+    const auto long_s = std::string( 70, '.' ) + ";" + std::string( 40, '.' );
+    REQUIRE( set.find_last_in( long_s.data(), long_s.size(), 70 ) == 70u );
+    REQUIRE( set.find_last_not_in( long_s.data(), long_s.size(), 70 ) == 69u );
+  }
+
+  SECTION("Returns npos if there is no member")
+  {
+    REQUIRE( set.find_last_in( s.data(), s.size(), 8 ) == npos );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("char_set searches", "[char_set]")
+{
+  SECTION("Match a naive search for small sets")
+  {
+    check_matches_naive( "," );
+    check_matches_naive( " \t\r\n" );
+    check_matches_naive( "<>&\"'" );
+  }
+
+  SECTION("Match a naive search for sets of high characters")
+  {
+    check_matches_naive( "\x80\x9f\xff\xc0\x01" );
+  }
+
+  SECTION("Match a naive search for sets spanning many nibble rows")
+  {
+    // 16 characters with distinct high nibbles cannot be classified with 8
+    // buckets, and are searched with the table alone
+    auto chars = std::string{};
+    for( auto h = 0; h < 16; ++h ) {
+      chars.push_back( static_cast<char>(h * 16 + h) );
+    }
+    check_matches_naive( chars );
+  }
+
+  SECTION("Match a naive search for the empty set")
+  {
+    check_matches_naive( "" );
+  }
+}
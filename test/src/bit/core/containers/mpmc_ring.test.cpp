@@ -0,0 +1,293 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for mpmc_ring and mpmc_ring_array
+ *****************************************************************************/
+
+#include <bit/core/containers/mpmc_ring.hpp>
+
+#include <atomic>    // std::atomic
+#include <cstddef>   // std::size_t
+#include <limits>    // std::numeric_limits
+#include <memory>    // std::shared_ptr
+#include <stdexcept> // std::runtime_error, std::length_error
+#include <thread>    // std::thread
+#include <vector>    // std::vector
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  struct throws_on_negative
+  {
+    throws_on_negative( int i )
+      : value(i)
+    {
+      if( i < 0 ) throw std::runtime_error("negative");
+    }
+
+    int value;
+  };
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mpmc_ring::mpmc_ring( size_type, const Allocator& )", "[mpmc_ring]")
+{
+  SECTION("Capacity is a power of two")
+  {
+    SECTION("Keeps the capacity")
+    {
+      const bit::core::mpmc_ring<int> ring( 8 );
+
+      REQUIRE( ring.capacity() == 8u );
+      REQUIRE( ring.empty() );
+    }
+  }
+
+  SECTION("Capacity is not a power of two")
+  {
+    SECTION("Rounds the capacity up")
+    {
+      const bit::core::mpmc_ring<int> ring( 5 );
+
+      REQUIRE( ring.capacity() == 8u );
+    }
+  }
+
+  SECTION("Capacity is less than 2")
+  {
+    SECTION("Rounds the capacity up to 2")
+    {
+      const bit::core::mpmc_ring<int> empty_ring( 0 );
+      const bit::core::mpmc_ring<int> single_ring( 1 );
+
+      REQUIRE( empty_ring.capacity() == 2u );
+      REQUIRE( single_ring.capacity() == 2u );
+    }
+  }
+
+  SECTION("Capacity is larger than the largest power of two")
+  {
+    SECTION("Throws std::length_error")
+    {
+      const auto largest = (std::numeric_limits<std::size_t>::max() >> 1) + 1u;
+
+      REQUIRE( bit::core::detail::mpmc_ring_capacity( largest ) == largest );
+      REQUIRE_THROWS_AS( bit::core::detail::mpmc_ring_capacity( largest + 1u ), std::length_error );
+      REQUIRE_THROWS_AS( bit::core::mpmc_ring<int>( largest + 1u ), std::length_error );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mpmc_ring at the minimum capacity", "[mpmc_ring]")
+{
+  bit::core::mpmc_ring<std::shared_ptr<int>> ring( 1 );
+  const auto first  = std::make_shared<int>( 1 );
+  const auto second = std::make_shared<int>( 2 );
+  const auto third  = std::make_shared<int>( 3 );
+  auto value = std::shared_ptr<int>{};
+
+  SECTION("Fills, refuses to overwrite, and drains in order")
+  {
+    REQUIRE( ring.try_push( first ) );
+    REQUIRE( ring.try_push( second ) );
+    REQUIRE_FALSE( ring.try_push( third ) );
+    REQUIRE( third.use_count() == 1 );
+
+    REQUIRE( ring.try_pop( value ) );
+    REQUIRE( value == first );
+    REQUIRE( ring.try_pop( value ) );
+    REQUIRE( value == second );
+    REQUIRE_FALSE( ring.try_pop( value ) );
+
+    value.reset();
+    REQUIRE( first.use_count() == 1 );
+    REQUIRE( second.use_count() == 1 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mpmc_ring::try_push( T&& )", "[mpmc_ring]")
+{
+  bit::core::mpmc_ring<int> ring( 4 );
+
+  SECTION("Ring is not full")
+  {
+    SECTION("Adds the value")
+    {
+      REQUIRE( ring.try_push( 1 ) );
+      REQUIRE( ring.size() == 1u );
+    }
+  }
+
+  SECTION("Ring is full")
+  {
+    for( auto i = 0; i < 4; ++i ) {
+      ring.try_push( i );
+    }
+
+    SECTION("Fails without adding")
+    {
+      REQUIRE_FALSE( ring.try_push( 4 ) );
+      REQUIRE( ring.size() == 4u );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mpmc_ring::try_emplace( Args&&... )", "[mpmc_ring]")
+{
+  bit::core::mpmc_ring<throws_on_negative> ring( 2 );
+
+  SECTION("Constructor throws")
+  {
+    REQUIRE_THROWS( ring.try_emplace( -1 ) );
+
+    SECTION("Leaves the ring usable")
+    {
+      auto value = throws_on_negative{ 0 };
+
+      REQUIRE( ring.empty() );
+      REQUIRE( ring.try_emplace( 7 ) );
+      REQUIRE( ring.try_pop( value ) );
+      REQUIRE( value.value == 7 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mpmc_ring::try_pop( T& )", "[mpmc_ring]")
+{
+  bit::core::mpmc_ring<int> ring( 4 );
+  auto value = 0;
+
+  SECTION("Ring is empty")
+  {
+    SECTION("Fails")
+    {
+      REQUIRE_FALSE( ring.try_pop( value ) );
+    }
+  }
+
+  SECTION("Ring wraps around many times")
+  {
+    auto in_order = true;
+    for( auto i = 0; i < 100; ++i ) {
+      ring.try_push( i );
+      ring.try_push( i + 1000 );
+      in_order = in_order && ring.try_pop( value ) && value == i;
+      in_order = in_order && ring.try_pop( value ) && value == i + 1000;
+    }
+
+    SECTION("Removes entries in the order they were added")
+    {
+      REQUIRE( in_order );
+      REQUIRE( ring.empty() );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mpmc_ring::~mpmc_ring()", "[mpmc_ring]")
+{
+  const auto value = std::make_shared<int>( 42 );
+  {
+    bit::core::mpmc_ring<std::shared_ptr<int>> ring( 4 );
+    ring.try_push( value );
+    ring.try_push( value );
+    REQUIRE( value.use_count() == 3 );
+  }
+
+  SECTION("Destructs remaining entries")
+  {
+    REQUIRE( value.use_count() == 1 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mpmc_ring_array::try_push( T&& )", "[mpmc_ring]")
+{
+  bit::core::mpmc_ring_array<int,2> ring;
+  auto value = 0;
+
+  SECTION("Adds values until full, and removes them in order")
+  {
+    REQUIRE( ring.capacity() == 2u );
+    REQUIRE( ring.try_push( 1 ) );
+    REQUIRE( ring.try_push( 2 ) );
+    REQUIRE_FALSE( ring.try_push( 3 ) );
+    REQUIRE( ring.try_pop( value ) );
+    REQUIRE( value == 1 );
+    REQUIRE( ring.try_pop( value ) );
+    REQUIRE( value == 2 );
+    REQUIRE_FALSE( ring.try_pop( value ) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("mpmc_ring hands values between many threads", "[mpmc_ring]")
+{
+  bit::core::mpmc_ring<int> ring( 64 );
+  const auto producers = 3;
+  const auto consumers = 3;
+  const auto count = 20000;
+
+  auto threads  = std::vector<std::thread>{};
+  auto received = std::vector<std::vector<int>>( consumers );
+  std::atomic<int> popped{ 0 };
+
+  for( auto p = 0; p < producers; ++p ) {
+    threads.emplace_back( [&ring, p, count]{
+      for( auto i = 0; i < count; ++i ) {
+        while( !ring.try_push( p * count + i ) ) std::this_thread::yield();
+      }
+    } );
+  }
+  for( auto c = 0; c < consumers; ++c ) {
+    threads.emplace_back( [&, c]{
+      auto value = 0;
+      while( popped.load() < producers * count ) {
+        if( ring.try_pop( value ) ) {
+          received[c].push_back( value );
+          ++popped;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    } );
+  }
+  for( auto& thread : threads ) {
+    thread.join();
+  }
+
+  SECTION("Each value is received once, in order per producer")
+  {
+    auto seen = std::vector<int>( producers * count, 0 );
+    auto in_order = true;
+    for( const auto& values : received ) {
+      auto last = std::vector<int>( producers, -1 );
+      for( const auto v : values ) {
+        ++seen[v];
+        in_order = in_order && v > last[v / count];
+        last[v / count] = v;
+      }
+    }
+
+    auto once = true;
+    for( const auto s : seen ) {
+      once = once && s == 1;
+    }
+    REQUIRE( once );
+    REQUIRE( in_order );
+    REQUIRE( ring.empty() );
+  }
+}
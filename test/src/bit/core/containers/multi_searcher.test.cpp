@@ -0,0 +1,191 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for bit::core::multi_searcher
+ *****************************************************************************/
+
+#include <bit/core/containers/multi_searcher.hpp>
+
+#include "test_support.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  constexpr auto npos = static_cast<std::size_t>(bit::core::multi_searcher::npos);
+
+  using match_tuple = std::tuple<std::size_t,std::size_t,std::size_t>;
+
+  std::vector<match_tuple> naive_find_all( const std::string& h,
+                                           const std::vector<std::string>& patterns )
+  {
+    auto result = std::vector<match_tuple>{};
+    for( auto i = std::size_t{0}; i < h.size(); ++i ) {
+      for( auto p = std::size_t{0}; p < patterns.size(); ++p ) {
+        const auto& x = patterns[p];
+        if( !x.empty() && h.compare( i, x.size(), x ) == 0 ) {
+          result.emplace_back( i, x.size(), p );
+        }
+      }
+    }
+    return result;
+  }
+
+  match_tuple naive_find_first( const std::string& h,
+                                const std::vector<std::string>& patterns,
+                                std::size_t pos )
+  {
+    for( const auto& m : naive_find_all( h, patterns ) ) {
+      if( std::get<0>(m) >= pos ) return m;
+    }
+    return match_tuple{ npos, 0u, npos };
+  }
+
+  void check_matches_naive( const std::vector<std::string>& patterns,
+                            const std::string& alphabet )
+  {
+    const auto searcher = bit::core::multi_searcher( patterns.begin(), patterns.end() );
+
+    for( auto seed = 0u; seed < 8u; ++seed ) {
+      const auto h = test::make_test_string( 200u + seed * 37u, alphabet, seed );
+      const auto view = bit::core::string_view( h.data(), h.size() );
+
+      for( auto pos = std::size_t{0}; pos <= h.size(); pos += 11 ) {
+        const auto m = searcher.find_first( view, pos );
+        REQUIRE( match_tuple{ m.position, m.length, m.pattern } == naive_find_first( h, patterns, pos ) );
+      }
+
+      auto all = std::vector<match_tuple>{};
+      searcher.find_all( view, [&]( const bit::core::multi_searcher::match& m ) {
+        all.emplace_back( m.position, m.length, m.pattern );
+      });
+      auto expected = naive_find_all( h, patterns );
+      std::sort( all.begin(), all.end() );
+      std::sort( expected.begin(), expected.end() );
+      REQUIRE( all == expected );
+    }
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+TEST_CASE("multi_searcher::multi_searcher( std::initializer_list<string_view> )", "[multi_searcher]")
+{
+  const auto searcher = bit::core::multi_searcher{ "he", "she", "", "hers" };
+
+  SECTION("Stores every pattern")
+  {
+    REQUIRE( searcher.size() == 4u );
+    REQUIRE( searcher.pattern( 1 ) == "she" );
+    REQUIRE( searcher.pattern( 2 ).empty() );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Operations
+//----------------------------------------------------------------------------
+
+TEST_CASE("multi_searcher::find_first( string_view, size_type )", "[multi_searcher]")
+{
+  const auto searcher = bit::core::multi_searcher{ "hers", "she", "he", "his", "" };
+
+  SECTION("Finds the leftmost match")
+  {
+    const auto m = searcher.find_first( "ushers" );
+
+    REQUIRE( m.position == 1u );
+    REQUIRE( m.length == 3u );
+    REQUIRE( m.pattern == 1u );
+  }
+
+  SECTION("Prefers the lowest pattern index at the same position")
+  {
+    const auto m = searcher.find_first( "xhers" );
+
+    REQUIRE( m.position == 1u );
+    REQUIRE( m.pattern == 0u );
+  }
+
+  SECTION("Starts at the given position")
+  {
+    REQUIRE( searcher.find_first( "ushers", 2 ).position == 2u );
+    REQUIRE( searcher.find_first( "ushers", 3 ).position == npos );
+  }
+
+  SECTION("Returns npos when no pattern occurs")
+  {
+    const auto m = searcher.find_first( "nothing to see" );
+
+    REQUIRE( m.position == npos );
+    REQUIRE( m.pattern == npos );
+  }
+
+  SECTION("Searches string_span")
+  {
+    char buffer[] = "that is his";
+    const auto span = bit::core::string_span<bit::core::dynamic_extent>( buffer, sizeof(buffer) - 1 );
+
+    REQUIRE( searcher.find_first( span ).position == 8u );
+  }
+}
+
+TEST_CASE("multi_searcher::find_all( string_view, Fn&& )", "[multi_searcher]")
+{
+  SECTION("Reports overlapping matches")
+  {
+    const auto searcher = bit::core::multi_searcher{ "he", "she", "hers" };
+    auto count = 0;
+    searcher.find_all( "ushers", [&]( const bit::core::multi_searcher::match& ) { ++count; } );
+
+    REQUIRE( count == 3 );
+  }
+
+  SECTION("Reports nothing without patterns")
+  {
+    const auto searcher = bit::core::multi_searcher{};
+    auto count = 0;
+    searcher.find_all( "ushers", [&]( const bit::core::multi_searcher::match& ) { ++count; } );
+
+    REQUIRE( count == 0 );
+    REQUIRE( searcher.find_first( "ushers" ).position == npos );
+  }
+}
+
+TEST_CASE("multi_searcher matches a naive search", "[multi_searcher]")
+{
+  SECTION("Small pattern set")
+  {
+    check_matches_naive( { "ab", "ba", "abc", "ca", "b", "aab" }, "abcd" );
+  }
+
+  SECTION("Small pattern set with long patterns")
+  {
+    check_matches_naive( { "abcab", "bcabca", "cabcab", "aaaa" }, "abc" );
+  }
+
+  SECTION("Small pattern set with shared prefixes")
+  {
+    auto patterns = std::vector<std::string>{};
+    for( auto i = 0u; i < 16u; ++i ) {
+      patterns.push_back( "ab" + test::make_test_string( 2u + i % 3u, "abcd", i ) );
+    }
+    check_matches_naive( patterns, "abcd" );
+  }
+
+  SECTION("Large pattern set")
+  {
+    auto patterns = std::vector<std::string>{};
+    for( auto i = 0u; i < 200u; ++i ) {
+      patterns.push_back( test::make_test_string( 1u + i % 7u, "abcdefgh", i + 100u ) );
+    }
+    check_matches_naive( patterns, "abcdefghij" );
+  }
+}
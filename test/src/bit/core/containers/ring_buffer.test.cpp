@@ -8,6 +8,8 @@
 #include <bit/core/utilities/aligned_storage.hpp> // aligned_storage_for
 
 #include <algorithm> // std::equal
+#include <iterator>  // std::reverse_iterator
+#include <memory>    // std::shared_ptr
 #include <utility>   // std::move
 
 #include <catch2/catch.hpp>
@@ -766,3 +768,428 @@ TEST_CASE("ring_buffer::pop_front()","[modifier]")
     REQUIRE( old_value != new_value );
   }
 }
+
+TEST_CASE("ring_buffer::pop_back() destructs the back entry","[modifier]")
+{
+  using storage_type = bit::core::aligned_storage_for<std::shared_ptr<int>[3]>;
+
+  auto storage = storage_type{};
+  auto buffer = bit::core::ring_buffer<std::shared_ptr<int>>(&storage,3);
+  const auto front = std::make_shared<int>( 1 );
+  const auto back  = std::make_shared<int>( 2 );
+
+  buffer.push_back( front );
+  buffer.push_back( back );
+  buffer.pop_back();
+
+  SECTION("Only the back entry is released")
+  {
+    REQUIRE( front.use_count() == 2 );
+    REQUIRE( back.use_count() == 1 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_buffer::push_back( InputIt, InputIt )","[modifier]")
+{
+  SECTION("Entries are trivially copyable")
+  {
+    using storage_type = bit::core::aligned_storage_for<int[5]>;
+
+    auto storage = storage_type{};
+    auto buffer = bit::core::ring_buffer<int>(&storage,5);
+
+    buffer.push_back( 0 );
+    buffer.push_back( 1 );
+    buffer.push_back( 2 );
+    buffer.pop_front( 2 );
+
+    SECTION("Range wraps around the storage")
+    {
+      const int values[] = {3, 4, 5, 6};
+      buffer.push_back( values, values + 4 );
+      const int expected[] = {2, 3, 4, 5, 6};
+
+      REQUIRE( buffer.full() );
+      REQUIRE( std::equal( buffer.begin(), buffer.end(), expected, expected + 5 ) );
+    }
+
+    SECTION("Range overflows the buffer")
+    {
+      const int values[] = {3, 4, 5, 6, 7, 8};
+      buffer.push_back( values, values + 6 );
+      const int expected[] = {4, 5, 6, 7, 8};
+
+      REQUIRE( buffer.full() );
+      REQUIRE( std::equal( buffer.begin(), buffer.end(), expected, expected + 5 ) );
+    }
+
+    SECTION("Range is longer than the capacity")
+    {
+      const int values[] = {10, 11, 12, 13, 14, 15, 16, 17};
+      buffer.push_back( values, values + 8 );
+
+      REQUIRE( buffer.full() );
+      REQUIRE( std::equal( buffer.begin(), buffer.end(), values + 3, values + 8 ) );
+    }
+  }
+
+  SECTION("Capacity is a power of two")
+  {
+    using storage_type = bit::core::aligned_storage_for<int[4]>;
+
+    auto storage = storage_type{};
+    auto buffer = bit::core::ring_buffer<int,true>(&storage,4);
+
+    for( auto i = 0; i < 7; ++i ) {
+      buffer.push_back( i );
+    }
+    const int values[] = {7, 8, 9};
+    buffer.push_back( values, values + 3 );
+    const int expected[] = {6, 7, 8, 9};
+
+    SECTION("Keeps the newest entries in order")
+    {
+      REQUIRE( std::equal( buffer.begin(), buffer.end(), expected, expected + 4 ) );
+    }
+  }
+
+  SECTION("Entries are not trivially copyable")
+  {
+    using storage_type = bit::core::aligned_storage_for<std::shared_ptr<int>[2]>;
+
+    auto storage = storage_type{};
+    auto buffer = bit::core::ring_buffer<std::shared_ptr<int>>(&storage,2);
+    const std::shared_ptr<int> values[] = {
+      std::make_shared<int>( 0 ),
+      std::make_shared<int>( 1 ),
+      std::make_shared<int>( 2 )
+    };
+    buffer.push_back( values, values + 3 );
+
+    SECTION("Copies each entry, destructing overwritten ones")
+    {
+      REQUIRE( values[0].use_count() == 1 );
+      REQUIRE( values[1].use_count() == 2 );
+      REQUIRE( values[2].use_count() == 2 );
+      REQUIRE( buffer.front() == values[1] );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_buffer::pop_front( size_type )","[modifier]")
+{
+  SECTION("Entries are trivially destructible")
+  {
+    using storage_type = bit::core::aligned_storage_for<int[4]>;
+
+    auto storage = storage_type{};
+    auto buffer = bit::core::ring_buffer<int>(&storage,4);
+
+    for( auto i = 0; i < 6; ++i ) {
+      buffer.push_back( i );
+    }
+    buffer.pop_front( 3 );
+
+    SECTION("Removes entries from the front")
+    {
+      REQUIRE( buffer.size() == 1u );
+      REQUIRE( buffer.front() == 5 );
+    }
+  }
+
+  SECTION("Entries are not trivially destructible")
+  {
+    using storage_type = bit::core::aligned_storage_for<std::shared_ptr<int>[3]>;
+
+    auto storage = storage_type{};
+    auto buffer = bit::core::ring_buffer<std::shared_ptr<int>>(&storage,3);
+    const auto value = std::make_shared<int>( 1 );
+
+    buffer.push_back( value );
+    buffer.push_back( value );
+    buffer.push_back( value );
+    buffer.pop_front( 2 );
+
+    SECTION("Destructs the removed entries")
+    {
+      REQUIRE( buffer.size() == 1u );
+      REQUIRE( value.use_count() == 2 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_buffer::assign( size_type, const T& )","[modifier]")
+{
+  using storage_type = bit::core::aligned_storage_for<int[3]>;
+
+  auto storage = storage_type{};
+  auto buffer = bit::core::ring_buffer<int>(&storage,3);
+
+  buffer.push_back( 1 );
+
+  SECTION("Replaces the entries with copies of the value")
+  {
+    buffer.assign( 2, 7 );
+    const int expected[] = {7, 7};
+
+    REQUIRE( std::equal( buffer.begin(), buffer.end(), expected, expected + 2 ) );
+  }
+
+  SECTION("Count is limited to the capacity")
+  {
+    buffer.assign( 10, 7 );
+
+    REQUIRE( buffer.size() == 3u );
+  }
+
+  SECTION("Replaces the entries with a range")
+  {
+    const int values[] = {4, 5};
+    buffer.assign( values, values + 2 );
+
+    REQUIRE( std::equal( buffer.begin(), buffer.end(), values, values + 2 ) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Element Access
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_buffer::operator[]( size_type )","[element access]")
+{
+  SECTION("Capacity is not a power of two")
+  {
+    using storage_type = bit::core::aligned_storage_for<int[5]>;
+
+    auto storage = storage_type{};
+    auto buffer = bit::core::ring_buffer<int>(&storage,5);
+
+    for( auto i = 0; i < 8; ++i ) {
+      buffer.push_back( i );
+    }
+
+    SECTION("Indexes from the front across the wrap")
+    {
+      for( auto i = 0u; i < buffer.size(); ++i ) {
+        REQUIRE( buffer[i] == static_cast<int>(i) + 3 );
+      }
+    }
+  }
+
+  SECTION("Capacity is a power of two")
+  {
+    using storage_type = bit::core::aligned_storage_for<int[4]>;
+
+    auto storage = storage_type{};
+    auto buffer = bit::core::ring_buffer<int,true>(&storage,4);
+
+    for( auto i = 0; i < 7; ++i ) {
+      buffer.push_back( i );
+    }
+
+    SECTION("Indexes from the front across the wrap")
+    {
+      for( auto i = 0u; i < buffer.size(); ++i ) {
+        REQUIRE( buffer[i] == static_cast<int>(i) + 3 );
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Power of Two
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_buffer<T,true> masks monotonic positions","[modifier]")
+{
+  using storage_type = bit::core::aligned_storage_for<int[4]>;
+
+  auto storage = storage_type{};
+  auto buffer = bit::core::ring_buffer<int,true>(&storage,4);
+
+  SECTION("Pushing past the capacity keeps the newest entries")
+  {
+    for( auto i = 0; i < 10; ++i ) {
+      buffer.push_back( i );
+    }
+    const int expected[] = {6, 7, 8, 9};
+
+    REQUIRE( buffer.full() );
+    REQUIRE( buffer.size() == 4u );
+    REQUIRE( std::equal( buffer.begin(), buffer.end(), expected, expected + 4 ) );
+    REQUIRE( std::equal( buffer.rbegin(), buffer.rend(),
+                         std::reverse_iterator<const int*>(expected + 4),
+                         std::reverse_iterator<const int*>(expected) ) );
+  }
+
+  SECTION("Pushing to the front wraps below the start")
+  {
+    buffer.push_back( 2 );
+    buffer.push_front( 1 );
+    buffer.push_front( 0 );
+    const int expected[] = {0, 1, 2};
+
+    REQUIRE( buffer.size() == 3u );
+    REQUIRE( buffer.front() == 0 );
+    REQUIRE( buffer.back() == 2 );
+    REQUIRE( std::equal( buffer.begin(), buffer.end(), expected, expected + 3 ) );
+  }
+
+  SECTION("Popping every entry leaves the buffer empty")
+  {
+    for( auto i = 0; i < 6; ++i ) {
+      buffer.push_back( i );
+    }
+    buffer.pop_front();
+    buffer.pop_back();
+    buffer.pop_front();
+    buffer.pop_back();
+
+    REQUIRE( buffer.empty() );
+    REQUIRE( buffer.begin() == buffer.end() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_buffer::array_one() / array_two()","[element access]")
+{
+  SECTION("Entries do not wrap around")
+  {
+    using storage_type = bit::core::aligned_storage_for<int[5]>;
+
+    auto storage = storage_type{};
+    auto buffer = bit::core::ring_buffer<int>(&storage,5);
+    buffer.push_back( 1 );
+    buffer.push_back( 2 );
+
+    SECTION("The first range holds every entry")
+    {
+      const auto one = buffer.array_one();
+
+      REQUIRE( one.size() == 2 );
+      REQUIRE( std::equal( one.begin(), one.end(), buffer.begin(), buffer.end() ) );
+      REQUIRE( buffer.array_two().empty() );
+    }
+  }
+
+  SECTION("Entries wrap around")
+  {
+    using storage_type = bit::core::aligned_storage_for<int[5]>;
+
+    auto storage = storage_type{};
+    auto buffer = bit::core::ring_buffer<int>(&storage,5);
+    for( auto i = 0; i < 7; ++i ) {
+      buffer.push_back( i );
+    }
+    const auto& cbuffer = buffer;
+
+    SECTION("The ranges hold the entries in order")
+    {
+      const auto one = cbuffer.array_one();
+      const auto two = cbuffer.array_two();
+      const int expected[] = {2, 3, 4, 5, 6};
+
+      REQUIRE( one.size() == 3 );
+      REQUIRE( two.size() == 2 );
+      REQUIRE( std::equal( one.begin(), one.end(), expected, expected + 3 ) );
+      REQUIRE( std::equal( two.begin(), two.end(), expected + 3, expected + 5 ) );
+    }
+  }
+
+  SECTION("Capacity is a power of two")
+  {
+    using storage_type = bit::core::aligned_storage_for<int[4]>;
+
+    auto storage = storage_type{};
+    auto buffer = bit::core::ring_buffer<int,true>(&storage,4);
+    for( auto i = 0; i < 6; ++i ) {
+      buffer.push_back( i );
+    }
+    buffer.pop_front();
+
+    SECTION("The ranges hold the entries in order")
+    {
+      const auto one = buffer.array_one();
+      const auto two = buffer.array_two();
+      const int expected[] = {3, 4, 5};
+
+      REQUIRE( one.size() == 1 );
+      REQUIRE( two.size() == 2 );
+      REQUIRE( std::equal( one.begin(), one.end(), expected, expected + 1 ) );
+      REQUIRE( std::equal( two.begin(), two.end(), expected + 1, expected + 3 ) );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_buffer::free_array_one() / free_array_two()","[element access]")
+{
+  using storage_type = bit::core::aligned_storage_for<int[5]>;
+
+  auto storage = storage_type{};
+  auto buffer = bit::core::ring_buffer<int>(&storage,5);
+  for( auto i = 0; i < 4; ++i ) {
+    buffer.push_back( i );
+  }
+  buffer.pop_front( 3 );
+
+  SECTION("The ranges cover every free entry")
+  {
+    const auto one = buffer.free_array_one();
+    const auto two = buffer.free_array_two();
+
+    REQUIRE( one.size() == 1 );
+    REQUIRE( two.size() == 3 );
+    REQUIRE( two.data() == buffer.data() );
+  }
+
+  SECTION("Committed entries are appended in order")
+  {
+    auto one = buffer.free_array_one();
+    auto two = buffer.free_array_two();
+    one[0] = 4;
+    two[0] = 5;
+    two[1] = 6;
+
+    buffer.commit_back( 3 );
+    const int expected[] = {3, 4, 5, 6};
+
+    REQUIRE( buffer.size() == 4 );
+    REQUIRE( std::equal( buffer.begin(), buffer.end(), expected, expected + 4 ) );
+    REQUIRE( buffer.free_array_one().size() == 1 );
+    REQUIRE( buffer.free_array_two().empty() );
+  }
+
+  SECTION("Capacity is a power of two")
+  {
+    using pow2_storage_type = bit::core::aligned_storage_for<int[4]>;
+
+    auto pow2_storage = pow2_storage_type{};
+    auto pow2_buffer = bit::core::ring_buffer<int,true>(&pow2_storage,4);
+    pow2_buffer.push_back( 0 );
+    pow2_buffer.push_back( 1 );
+    pow2_buffer.push_back( 2 );
+    pow2_buffer.pop_front( 2 );
+
+    auto one = pow2_buffer.free_array_one();
+    auto two = pow2_buffer.free_array_two();
+    one[0] = 3;
+    two[0] = 4;
+    two[1] = 5;
+    pow2_buffer.commit_back( 3 );
+    const int expected[] = {2, 3, 4, 5};
+
+    REQUIRE( pow2_buffer.full() );
+    REQUIRE( std::equal( pow2_buffer.begin(), pow2_buffer.end(), expected, expected + 4 ) );
+    REQUIRE( pow2_buffer.free_array_one().empty() );
+    REQUIRE( pow2_buffer.free_array_two().empty() );
+  }
+}
@@ -6,7 +6,12 @@
 #include <bit/core/containers/ring_deque.hpp>
 
 #include <algorithm> // std::equal
+#include <iterator>  // std::istream_iterator, std::next
+#include <memory>    // std::shared_ptr
+#include <numeric>   // std::iota
+#include <sstream>   // std::istringstream
 #include <utility>   // std::move
+#include <vector>    // std::vector
 
 #include <catch2/catch.hpp>
 
@@ -84,8 +89,28 @@ namespace {
   int nothrow_moveable::move_calls = 0;
   int nothrow_moveable::copy_calls = 0;
 
+  struct relocatable
+  {
+    relocatable( int i ) : value(i){}
+    relocatable( relocatable&& other ) noexcept
+    {
+      value = other.value;
+      ++move_calls;
+    }
+
+    static int move_calls;
+    int value;
+  };
+
+  int relocatable::move_calls = 0;
+
 }
 
+namespace bit { namespace core {
+  template<>
+  struct is_trivially_relocatable<relocatable> : std::true_type{};
+} } // namespace bit::core
+
 //-----------------------------------------------------------------------------
 // Constructors / Assignment
 //-----------------------------------------------------------------------------
@@ -1022,3 +1047,249 @@ TEST_CASE("ring_deque::resize( size_type )", "[modifier]")
 }
 
 
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_deque::push_back( InputIt, InputIt )","[modifier]")
+{
+  auto deque = bit::core::ring_deque<int>{4};
+  const auto values = std::vector<int>{ 0, 1, 2, 3, 4, 5 };
+
+  deque.push_back( values.begin(), values.begin() + 3 );
+  deque.pop_front( 2 );
+  deque.push_back( values.begin() + 3, values.end() );
+
+  SECTION("Entries are in order")
+  {
+    REQUIRE( std::equal( deque.begin(), deque.end(), values.begin() + 2, values.end() ) );
+  }
+
+  SECTION("Segments cover every entry")
+  {
+    const auto one = deque.array_one();
+    const auto two = deque.array_two();
+
+    REQUIRE( one.size() + two.size() == 4 );
+    REQUIRE( std::equal( one.begin(), one.end(), values.begin() + 2 ) );
+    REQUIRE( std::equal( two.begin(), two.end(), values.begin() + 2 + one.size() ) );
+  }
+
+  SECTION("Assign replaces the entries")
+  {
+    deque.assign( values.begin(), values.begin() + 2 );
+
+    REQUIRE( std::equal( deque.begin(), deque.end(), values.begin(), values.begin() + 2 ) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_deque::commit_back( size_type )","[modifier]")
+{
+  auto deque = bit::core::ring_deque<int>{4};
+  deque.push_back( 0 );
+  deque.push_back( 1 );
+  deque.push_back( 2 );
+  deque.pop_front( 2 );
+
+  auto one = deque.free_array_one();
+  auto two = deque.free_array_two();
+  std::iota( one.begin(), one.end(), 3 );
+  std::iota( two.begin(), two.end(), 3 + static_cast<int>(one.size()) );
+
+  deque.commit_back( one.size() + two.size() );
+
+  SECTION("Committed entries are appended in order")
+  {
+    const int expected[] = {2, 3, 4, 5};
+
+    REQUIRE( deque.size() == 4 );
+    REQUIRE( std::equal( deque.begin(), deque.end(), expected, expected + 4 ) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Grow Policy
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_deque<T,Allocator,ring_grow_policy>::push_back( T&& )","[modifier]")
+{
+  using deque_type = bit::core::ring_deque<int,std::allocator<int>,bit::core::ring_grow_policy>;
+
+  SECTION("Deque is default-constructed")
+  {
+    auto deque = deque_type{};
+    deque.push_back( 1 );
+
+    SECTION("Allocates on the first push")
+    {
+      REQUIRE( deque.size() == 1u );
+      REQUIRE( deque.capacity() >= 1u );
+      REQUIRE( deque.front() == 1 );
+    }
+  }
+
+  SECTION("Deque is full and wraps around")
+  {
+    auto deque = deque_type{4};
+    for( auto i = 0; i < 6; ++i ) {
+      deque.push_back( i );
+      if( i < 2 ) deque.pop_front();
+    }
+    const auto old_capacity = deque.capacity();
+    for( auto i = 6; i < 20; ++i ) {
+      deque.push_back( i );
+    }
+
+    SECTION("Grows instead of overwriting")
+    {
+      REQUIRE( deque.size() == 18u );
+      REQUIRE( deque.capacity() >= 2u * old_capacity );
+    }
+
+    SECTION("Keeps the entries in order")
+    {
+      auto in_order = true;
+      for( auto i = 0u; i < deque.size(); ++i ) {
+        in_order = in_order && deque[i] == static_cast<int>(i) + 2;
+      }
+      REQUIRE( in_order );
+    }
+  }
+
+  SECTION("Value refers to an entry of the full deque")
+  {
+    auto deque = deque_type{2};
+    deque.push_back( 1 );
+    deque.push_back( 2 );
+    deque.push_back( deque.front() );
+
+    SECTION("Copies the value before growing")
+    {
+      REQUIRE( deque.size() == 3u );
+      REQUIRE( deque.back() == 1 );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_deque<T,Allocator,ring_grow_policy>::push_front( T&& )","[modifier]")
+{
+  using deque_type = bit::core::ring_deque<int,std::allocator<int>,bit::core::ring_grow_policy>;
+
+  auto deque = deque_type{2};
+  for( auto i = 0; i < 5; ++i ) {
+    deque.push_front( i );
+  }
+  const int expected[] = {4, 3, 2, 1, 0};
+
+  SECTION("Grows instead of overwriting")
+  {
+    REQUIRE( std::equal( deque.begin(), deque.end(), expected, expected + 5 ) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_deque<T,Allocator,ring_grow_policy>::push_back( InputIt, InputIt )","[modifier]")
+{
+  using deque_type = bit::core::ring_deque<int,std::allocator<int>,bit::core::ring_grow_policy>;
+
+  auto deque = deque_type{4};
+  deque.push_back( 0 );
+
+  SECTION("Iterators are forward iterators")
+  {
+    const auto values = std::vector<int>{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    deque.push_back( values.begin(), values.end() );
+
+    SECTION("Grows to fit the whole range")
+    {
+      REQUIRE( deque.size() == 10u );
+      REQUIRE( deque.front() == 0 );
+      REQUIRE( std::equal( std::next( deque.begin() ), deque.end(), values.begin(), values.end() ) );
+    }
+  }
+
+  SECTION("Iterators are input iterators")
+  {
+    auto stream = std::istringstream{ "1 2 3 4 5 6" };
+    deque.push_back( std::istream_iterator<int>{ stream }, std::istream_iterator<int>{} );
+    const int expected[] = {0, 1, 2, 3, 4, 5, 6};
+
+    SECTION("Grows as entries arrive")
+    {
+      REQUIRE( std::equal( deque.begin(), deque.end(), expected, expected + 7 ) );
+    }
+  }
+
+  SECTION("Assigns more entries than the capacity")
+  {
+    deque.assign( 9, 3 );
+
+    REQUIRE( deque.size() == 9u );
+    REQUIRE( deque.front() == 3 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("ring_deque<T,Allocator,ring_grow_policy> relocates entries","[modifier]")
+{
+  SECTION("T is trivially relocatable")
+  {
+    using deque_type = bit::core::ring_deque<relocatable,std::allocator<relocatable>,bit::core::ring_grow_policy>;
+
+    auto deque = deque_type{4};
+    for( auto i = 0; i < 4; ++i ) {
+      deque.emplace_back( i );
+    }
+    deque.pop_front();
+    deque.emplace_back( 4 );
+
+    relocatable::move_calls = 0;
+    deque.emplace_back( 5 );
+
+    SECTION("Does not call move constructors")
+    {
+      REQUIRE( relocatable::move_calls == 1 ); // the new entry only
+    }
+
+    SECTION("Keeps the entries in order")
+    {
+      auto in_order = true;
+      for( auto i = 0u; i < deque.size(); ++i ) {
+        in_order = in_order && deque[i].value == static_cast<int>(i) + 1;
+      }
+      REQUIRE( deque.size() == 5u );
+      REQUIRE( in_order );
+    }
+  }
+
+  SECTION("T is not trivially relocatable")
+  {
+    using deque_type = bit::core::ring_deque<std::shared_ptr<int>,
+                                             std::allocator<std::shared_ptr<int>>,
+                                             bit::core::ring_grow_policy>;
+
+    const auto value = std::make_shared<int>( 1 );
+    {
+      auto deque = deque_type{2};
+      for( auto i = 0; i < 5; ++i ) {
+        deque.push_back( value );
+      }
+
+      SECTION("Moves each entry without leaking or copying")
+      {
+        REQUIRE( deque.size() == 5u );
+        REQUIRE( value.use_count() == 6 );
+      }
+    }
+
+    SECTION("Destructs the entries with the deque")
+    {
+      REQUIRE( value.use_count() == 1 );
+    }
+  }
+}
@@ -0,0 +1,231 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for spsc_ring
+ *****************************************************************************/
+
+#include <bit/core/containers/spsc_ring.hpp>
+
+#include <bit/core/utilities/aligned_storage.hpp> // aligned_storage_for
+
+#include <memory>  // std::shared_ptr
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+#include <catch2/catch.hpp>
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("spsc_ring::spsc_ring( void*, size_type )", "[spsc_ring]")
+{
+  using storage_type = bit::core::aligned_storage_for<int[5]>;
+
+  auto storage = storage_type{};
+  const bit::core::spsc_ring<int> ring( &storage, 5 );
+
+  SECTION("Ring is empty")
+  {
+    REQUIRE( ring.empty() );
+    REQUIRE( ring.size() == 0u );
+  }
+  SECTION("Capacity is the size of the buffer")
+  {
+    REQUIRE( ring.capacity() == 5u );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("spsc_ring::try_push( T&& )", "[spsc_ring]")
+{
+  using storage_type = bit::core::aligned_storage_for<int[3]>;
+
+  auto storage = storage_type{};
+  bit::core::spsc_ring<int> ring( &storage, 3 );
+
+  SECTION("Ring is not full")
+  {
+    SECTION("Adds the value")
+    {
+      REQUIRE( ring.try_push( 1 ) );
+      REQUIRE( ring.size() == 1u );
+    }
+  }
+
+  SECTION("Ring is full")
+  {
+    ring.try_push( 1 );
+    ring.try_push( 2 );
+    ring.try_push( 3 );
+
+    SECTION("Fails without adding")
+    {
+      REQUIRE_FALSE( ring.try_push( 4 ) );
+      REQUIRE( ring.size() == 3u );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("spsc_ring::try_pop( T& )", "[spsc_ring]")
+{
+  using storage_type = bit::core::aligned_storage_for<int[3]>;
+
+  auto storage = storage_type{};
+  bit::core::spsc_ring<int> ring( &storage, 3 );
+  auto value = 0;
+
+  SECTION("Ring is empty")
+  {
+    SECTION("Fails")
+    {
+      REQUIRE_FALSE( ring.try_pop( value ) );
+    }
+  }
+
+  SECTION("Ring wraps around")
+  {
+    auto popped = std::vector<int>{};
+    for( auto i = 0; i < 10; ++i ) {
+      ring.try_push( i );
+      ring.try_push( i + 100 );
+      ring.try_pop( value );
+      popped.push_back( value );
+      ring.try_pop( value );
+      popped.push_back( value );
+    }
+
+    SECTION("Removes entries in the order they were added")
+    {
+      for( auto i = 0; i < 10; ++i ) {
+        REQUIRE( popped[2 * i] == i );
+        REQUIRE( popped[2 * i + 1] == i + 100 );
+      }
+      REQUIRE( ring.empty() );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("spsc_ring::try_push( InputIt, size_type )", "[spsc_ring]")
+{
+  using storage_type = bit::core::aligned_storage_for<int[4]>;
+
+  auto storage = storage_type{};
+  bit::core::spsc_ring<int> ring( &storage, 4 );
+  const int values[] = {1, 2, 3, 4, 5, 6};
+
+  SECTION("Values fit")
+  {
+    SECTION("Adds every value")
+    {
+      REQUIRE( ring.try_push( values, 3 ) == 3u );
+      REQUIRE( ring.size() == 3u );
+    }
+  }
+
+  SECTION("Values do not fit")
+  {
+    SECTION("Adds as many as fit")
+    {
+      REQUIRE( ring.try_push( values, 6 ) == 4u );
+      REQUIRE( ring.try_push( values, 6 ) == 0u );
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("spsc_ring::try_pop( OutputIt, size_type )", "[spsc_ring]")
+{
+  using storage_type = bit::core::aligned_storage_for<int[4]>;
+
+  auto storage = storage_type{};
+  bit::core::spsc_ring<int> ring( &storage, 4 );
+  const int values[] = {1, 2, 3};
+  int popped[4] = {};
+
+  ring.try_push( values, 3 );
+
+  SECTION("Removes up to count entries in order")
+  {
+    REQUIRE( ring.try_pop( popped, 2 ) == 2u );
+    REQUIRE( popped[0] == 1 );
+    REQUIRE( popped[1] == 2 );
+    REQUIRE( ring.try_pop( popped, 4 ) == 1u );
+    REQUIRE( popped[0] == 3 );
+    REQUIRE( ring.empty() );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("spsc_ring::~spsc_ring()", "[spsc_ring]")
+{
+  using storage_type = bit::core::aligned_storage_for<std::shared_ptr<int>[4]>;
+
+  auto storage = storage_type{};
+  const auto value = std::make_shared<int>( 42 );
+  {
+    bit::core::spsc_ring<std::shared_ptr<int>> ring( &storage, 4 );
+    ring.try_push( value );
+    ring.try_push( value );
+    REQUIRE( value.use_count() == 3 );
+  }
+
+  SECTION("Destructs remaining entries")
+  {
+    REQUIRE( value.use_count() == 1 );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("spsc_ring hands values between threads", "[spsc_ring]")
+{
+  using storage_type = bit::core::aligned_storage_for<int[64]>;
+
+  auto storage = storage_type{};
+  bit::core::spsc_ring<int> ring( &storage, 64 );
+  const auto count = 100000;
+
+  auto producer = std::thread( [&ring, count]{
+    int batch[16];
+    for( auto i = 0; i < count; ) {
+      if( i % 3 == 0 ) {
+        while( !ring.try_push( i ) ) std::this_thread::yield();
+        ++i;
+        continue;
+      }
+      auto n = 0;
+      for( ; n < 16 && i + n < count; ++n ) batch[n] = i + n;
+      auto pushed = 0;
+      while( pushed < n ) {
+        pushed += static_cast<int>(ring.try_push( batch + pushed, static_cast<std::size_t>(n - pushed) ));
+        if( pushed < n ) std::this_thread::yield();
+      }
+      i += n;
+    }
+  } );
+
+  auto received = std::vector<int>{};
+  received.reserve( count );
+  int batch[7];
+  while( static_cast<int>(received.size()) < count ) {
+    const auto n = ring.try_pop( batch, 7 );
+    if( n == 0u ) std::this_thread::yield();
+    received.insert( received.end(), batch, batch + n );
+  }
+  producer.join();
+
+  SECTION("Receives every value in order")
+  {
+    auto in_order = true;
+    for( auto i = 0; i < count; ++i ) {
+      in_order = in_order && received[i] == i;
+    }
+    REQUIRE( in_order );
+    REQUIRE( ring.empty() );
+  }
+}
@@ -0,0 +1,218 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for bit::core::insensitive_char_traits and the
+ *        case-insensitive hashes
+ *****************************************************************************/
+
+#include <bit/core/containers/string_view.hpp>
+
+#include "test_support.hpp"
+
+#include <cctype>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  using traits = bit::core::insensitive_char_traits<char>;
+
+  /// Makes a string of letters, their neighbours in ASCII, and non-ASCII
+  /// bytes that only differ from letters in the high bit
+  std::string make_test_string( std::size_t size, unsigned seed )
+  {
+    return test::make_test_string( size, "abcXYZ@[`{ -_09\xc1\xe1", seed );
+  }
+
+  /// Flips the case of every other ASCII letter
+  std::string flip_case( std::string s )
+  {
+    for( auto i = std::size_t{0}; i < s.size(); i += 2 ) {
+      const auto c = s[i];
+      if( c >= 'a' && c <= 'z' ) s[i] = static_cast<char>(c - 'a' + 'A');
+      else if( c >= 'A' && c <= 'Z' ) s[i] = static_cast<char>(c - 'A' + 'a');
+    }
+    return s;
+  }
+
+  int naive_compare( const std::string& a, const std::string& b )
+  {
+    for( auto i = std::size_t{0}; i < a.size(); ++i ) {
+      const auto x = traits::to_upper( a[i] );
+      const auto y = traits::to_upper( b[i] );
+      if( x != y ) return (x < y) ? -1 : 1;
+    }
+    return 0;
+  }
+
+  bit::core::hash_t lowered_hash( std::string s )
+  {
+    for( auto& c : s ) {
+      if( c >= 'A' && c <= 'Z' ) c = static_cast<char>(c - 'A' + 'a');
+    }
+    return bit::core::hash_string_segment( s.data(), s.size(), bit::core::wide_hash_policy{} );
+  }
+
+  struct header_hash
+  {
+    std::size_t operator()( bit::core::ci::string_view s ) const noexcept
+    {
+      return static_cast<std::size_t>( hash_value( s ) );
+    }
+  };
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// insensitive_char_traits
+//----------------------------------------------------------------------------
+
+TEST_CASE("insensitive_char_traits<char>::to_upper( char )", "[string]")
+{
+  SECTION("Raises ASCII letters only")
+  {
+    STATIC_REQUIRE( traits::to_upper( 'a' ) == 'A' );
+    STATIC_REQUIRE( traits::to_upper( 'z' ) == 'Z' );
+    STATIC_REQUIRE( traits::to_upper( 'Q' ) == 'Q' );
+    STATIC_REQUIRE( traits::to_upper( '{' ) == '{' );
+    STATIC_REQUIRE( traits::to_upper( '\xe1' ) == '\xe1' );
+  }
+}
+
+TEST_CASE("insensitive_char_traits<char>::to_lower( char )", "[string]")
+{
+  SECTION("Lowers ASCII letters only")
+  {
+    STATIC_REQUIRE( traits::to_lower( 'A' ) == 'a' );
+    STATIC_REQUIRE( traits::to_lower( 'Z' ) == 'z' );
+    STATIC_REQUIRE( traits::to_lower( 'q' ) == 'q' );
+    STATIC_REQUIRE( traits::to_lower( '@' ) == '@' );
+    STATIC_REQUIRE( traits::to_lower( '\xc1' ) == '\xc1' );
+  }
+}
+
+TEST_CASE("insensitive_char_traits<char>::compare( const char*, const char*, std::size_t )", "[string]")
+{
+  SECTION("Ignores case")
+  {
+    for( auto size = std::size_t{0}; size <= 100; ++size ) {
+      const auto a = make_test_string( size, static_cast<unsigned>(size) );
+      const auto b = flip_case( a );
+
+      REQUIRE( traits::compare( a.data(), b.data(), size ) == 0 );
+    }
+  }
+
+  SECTION("Orders by the first difference")
+  {
+    for( auto size = std::size_t{1}; size <= 100; ++size ) {
+      const auto a = make_test_string( size, static_cast<unsigned>(size) );
+
+      // every mismatch position, including the block boundaries and the tail
+      for( auto i = std::size_t{0}; i < size; ++i ) {
+        auto b = flip_case( a );
+        b[i] = static_cast<char>(b[i] + 1);
+
+        REQUIRE( traits::compare( a.data(), b.data(), size ) == naive_compare( a, b ) );
+        REQUIRE( traits::compare( b.data(), a.data(), size ) == naive_compare( b, a ) );
+      }
+    }
+  }
+
+  SECTION("Is usable in constant expressions")
+  {
+    STATIC_REQUIRE( traits::compare( "Hello", "hELLO", 5 ) == 0 );
+    STATIC_REQUIRE( traits::compare( "Hello", "hELLP", 5 ) < 0 );
+  }
+}
+
+TEST_CASE("insensitive_char_traits<char>::find( const char*, std::size_t, char )", "[string]")
+{
+  const auto s = std::string( 70, '.' ) + "xX" + std::string( 5, '.' ) + "@";
+
+  SECTION("Finds either case of a letter")
+  {
+    REQUIRE( traits::find( s.data(), s.size(), 'X' ) == s.data() + 70 );
+    REQUIRE( traits::find( s.data() + 71, s.size() - 71, 'x' ) == s.data() + 71 );
+  }
+
+  SECTION("Finds other characters exactly")
+  {
+    REQUIRE( traits::find( s.data(), s.size(), '@' ) == s.data() + 77 );
+    REQUIRE( traits::find( s.data(), s.size(), '`' ) == nullptr );
+  }
+
+  SECTION("Returns null when not found")
+  {
+    REQUIRE( traits::find( s.data(), 70, 'x' ) == nullptr );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Hashing
+//----------------------------------------------------------------------------
+
+TEST_CASE("hash_insensitive_string_segment( const CharT*, std::size_t )", "[string]")
+{
+  SECTION("Hashes equal strings equally")
+  {
+    for( auto size : {0u, 1u, 3u, 4u, 9u, 16u, 17u, 31u, 32u, 33u, 100u, 256u, 300u, 1000u} ) {
+      const auto a = make_test_string( size, size );
+      const auto b = flip_case( a );
+
+      REQUIRE( bit::core::hash_insensitive_string_segment( a.data(), a.size() ) ==
+               bit::core::hash_insensitive_string_segment( b.data(), b.size() ) );
+    }
+  }
+
+  SECTION("Is the hash of the lowercased string")
+  {
+    for( auto size : {0u, 5u, 20u, 33u, 300u} ) {
+      const auto a = make_test_string( size, size + 1u );
+
+      REQUIRE( bit::core::hash_insensitive_string_segment( a.data(), a.size() ) == lowered_hash( a ) );
+    }
+  }
+
+  SECTION("Is the same at compile-time and at runtime")
+  {
+    constexpr auto expected = bit::core::hash_insensitive_string_segment( "Content-Type", 12 );
+    const auto* str = "cONTENT-tYPE";
+
+    REQUIRE( bit::core::hash_insensitive_string_segment( str, 12 ) == expected );
+  }
+
+  SECTION("Hashes wide strings equally")
+  {
+    const auto a = std::u16string( u"Accept-Encoding" );
+    const auto b = std::u16string( u"aCCEPT-eNCODING" );
+
+    REQUIRE( bit::core::hash_insensitive_string_segment( a.data(), a.size() ) ==
+             bit::core::hash_insensitive_string_segment( b.data(), b.size() ) );
+  }
+}
+
+TEST_CASE("hash_value( const ci::string_view& )", "[string]")
+{
+  SECTION("Views that compare equal hash equally")
+  {
+    const auto a = bit::core::ci::string_view( "Content-Length" );
+    const auto b = bit::core::ci::string_view( "content-length" );
+
+    REQUIRE( a == b );
+    REQUIRE( hash_value( a ) == hash_value( b ) );
+  }
+
+  SECTION("Keys a map without lowered copies")
+  {
+    auto headers = std::unordered_map<bit::core::ci::string_view,int,header_hash>{};
+    headers["Content-Type"] = 1;
+    headers["ACCEPT"] = 2;
+
+    REQUIRE( headers.at( "content-type" ) == 1 );
+    REQUIRE( headers.at( "Accept" ) == 2 );
+    REQUIRE( headers.count( "Accept-Encoding" ) == 0u );
+  }
+}
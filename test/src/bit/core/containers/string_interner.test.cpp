@@ -0,0 +1,196 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for bit::core::basic_string_interner
+ *****************************************************************************/
+
+#include <bit/core/containers/string_interner.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+//----------------------------------------------------------------------------
+// Interned Strings
+//----------------------------------------------------------------------------
+
+TEST_CASE("basic_interned_string()", "[string_interner]")
+{
+  const auto str = bit::core::interned_string();
+
+  SECTION("Refers to the empty string")
+  {
+    REQUIRE( str.empty() );
+    REQUIRE( str.size() == 0u );
+    REQUIRE( *str.c_str() == '\0' );
+  }
+
+  SECTION("Hashes like an empty view")
+  {
+    REQUIRE( str.hash() == hash_value( bit::core::string_view() ) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Interning
+//----------------------------------------------------------------------------
+
+TEST_CASE("basic_string_interner::intern( view_type )", "[string_interner]")
+{
+  auto interner = bit::core::string_interner();
+
+  SECTION("String is new")
+  {
+    const auto str = interner.intern( "hello" );
+
+    SECTION("Copies the string")
+    {
+      REQUIRE( str.view() == "hello" );
+      REQUIRE( str.c_str()[5] == '\0' );
+      REQUIRE( interner.size() == 1u );
+    }
+
+    SECTION("Caches the hash of the string")
+    {
+      REQUIRE( str.hash() == hash_value( bit::core::string_view( "hello" ) ) );
+      REQUIRE( hash_value( str ) == str.hash() );
+    }
+  }
+
+  SECTION("String was already interned")
+  {
+    const auto source = std::string( "hello" );
+    const auto first  = interner.intern( "hello" );
+    const auto second = interner.intern( bit::core::string_view( source.data(), source.size() ) );
+
+    SECTION("Returns an equal handle to the same characters")
+    {
+      REQUIRE( first == second );
+      REQUIRE( first.data() == second.data() );
+      REQUIRE( interner.size() == 1u );
+    }
+  }
+
+  SECTION("Strings are different")
+  {
+    const auto first  = interner.intern( "hello" );
+    const auto second = interner.intern( "world" );
+
+    SECTION("Returns different handles")
+    {
+      REQUIRE( first != second );
+      REQUIRE( interner.size() == 2u );
+    }
+  }
+
+  SECTION("String is empty")
+  {
+    SECTION("Returns the default handle without storing it")
+    {
+      REQUIRE( interner.intern( "" ) == bit::core::interned_string() );
+      REQUIRE( interner.empty() );
+    }
+  }
+
+  SECTION("Many strings are interned")
+  {
+    auto handles = std::vector<bit::core::interned_string>();
+    for( auto i = 0; i < 20000; ++i ) {
+      const auto str = std::to_string( i % 5000 );
+      handles.push_back( interner.intern( bit::core::string_view( str.data(), str.size() ) ) );
+    }
+
+    SECTION("Keeps every handle valid while growing")
+    {
+      REQUIRE( interner.size() == 5000u );
+      for( auto i = 0; i < 20000; ++i ) {
+        REQUIRE( handles[i] == handles[i % 5000] );
+        REQUIRE( handles[i].view() == bit::core::string_view( std::to_string( i % 5000 ).c_str() ) );
+      }
+    }
+  }
+}
+
+TEST_CASE("basic_string_interner::intern( basic_string_span )", "[string_interner]")
+{
+  auto interner = bit::core::string_interner();
+  char buffer[] = "hello";
+  const auto span = bit::core::string_span<bit::core::dynamic_extent>( buffer, sizeof(buffer) - 1 );
+
+  REQUIRE( interner.intern( span ) == interner.intern( "hello" ) );
+}
+
+TEST_CASE("basic_string_interner::find( view_type )", "[string_interner]")
+{
+  auto interner = bit::core::string_interner();
+  const auto str = interner.intern( "hello" );
+
+  SECTION("String was interned")
+  {
+    SECTION("Returns its handle")
+    {
+      REQUIRE( interner.find( "hello" ) == str );
+      REQUIRE( interner.contains( "hello" ) );
+    }
+  }
+
+  SECTION("String was not interned")
+  {
+    SECTION("Returns nullopt without interning it")
+    {
+      REQUIRE_FALSE( interner.find( "world" ).has_value() );
+      REQUIRE_FALSE( interner.contains( "world" ) );
+      REQUIRE( interner.size() == 1u );
+    }
+  }
+}
+
+TEST_CASE("basic_string_interner( basic_string_interner&& )", "[string_interner]")
+{
+  auto interner = bit::core::string_interner();
+  const auto str = interner.intern( "hello" );
+
+  const auto moved = std::move(interner);
+
+  SECTION("Keeps handles valid")
+  {
+    REQUIRE( moved.find( "hello" ) == str );
+    REQUIRE( str.view() == "hello" );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrent Interning
+//----------------------------------------------------------------------------
+
+TEST_CASE("basic_concurrent_string_interner::intern( view_type )", "[string_interner]")
+{
+  bit::core::concurrent_string_interner interner;
+
+  SECTION("Threads intern the same strings")
+  {
+    auto handles = std::vector<std::vector<bit::core::interned_string>>( 4 );
+    auto threads = std::vector<std::thread>();
+    for( auto t = 0u; t < handles.size(); ++t ) {
+      threads.emplace_back( [&interner, &handles, t]{
+        for( auto i = 0; i < 2000; ++i ) {
+          const auto str = std::to_string( i );
+          handles[t].push_back( interner.intern( bit::core::string_view( str.data(), str.size() ) ) );
+        }
+      } );
+    }
+    for( auto& thread : threads ) {
+      thread.join();
+    }
+
+    SECTION("Every thread gets the same handles")
+    {
+      REQUIRE( interner.size() == 2000u );
+      for( auto t = 1u; t < handles.size(); ++t ) {
+        REQUIRE( handles[t] == handles[0] );
+      }
+      REQUIRE( interner.find( "1999" ) == handles[0][1999] );
+    }
+  }
+}
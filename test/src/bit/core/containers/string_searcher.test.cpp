@@ -0,0 +1,183 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for bit::core::basic_boyer_moore_horspool_searcher and
+ *        bit::core::basic_simd_searcher
+ *****************************************************************************/
+
+#include <bit/core/containers/string_searcher.hpp>
+
+#include "test_support.hpp"
+
+#include <cstddef>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  constexpr auto npos = static_cast<std::size_t>(bit::core::simd_searcher::npos);
+
+  template<typename Searcher>
+  void check_matches_naive( const std::string& alphabet )
+  {
+    for( auto m = std::size_t{1}; m <= 70; m += (m < 8) ? 1 : 7 ) {
+      for( auto seed = 0u; seed < 4u; ++seed ) {
+        const auto h = test::make_test_string( 300, alphabet, seed + static_cast<unsigned>(m) );
+        // Take needles from the haystack so that most of them occur
+        const auto x = (seed == 3u) ? test::make_test_string( m, alphabet, 99u )
+                                    : h.substr( (seed * 97u + m) % (h.size() - m), m );
+        const auto searcher = Searcher( bit::core::string_view( x.data(), x.size() ) );
+        const auto view = bit::core::string_view( h.data(), h.size() );
+
+        for( auto pos = std::size_t{0}; pos <= h.size(); pos += 13 ) {
+          REQUIRE( searcher( view, pos ) == test::naive_find( h, x, pos ) );
+        }
+      }
+    }
+  }
+
+} // anonymous namespace
+
+//============================================================================
+// basic_boyer_moore_horspool_searcher
+//============================================================================
+
+TEST_CASE("boyer_moore_horspool_searcher::operator()( string_view, size_type )", "[string_searcher]")
+{
+  using searcher_type = bit::core::boyer_moore_horspool_searcher;
+
+  SECTION("Matches a naive search over a small alphabet")
+  {
+    check_matches_naive<searcher_type>( "ab" );
+  }
+
+  SECTION("Matches a naive search over a large alphabet")
+  {
+    check_matches_naive<searcher_type>( "abcdefghijklmnopqrstuvwxyz \xe9\xff" );
+  }
+
+  SECTION("Empty needle returns npos")
+  {
+    const auto searcher = searcher_type( "" );
+
+    REQUIRE( searcher( "hello" ) == npos );
+  }
+
+  SECTION("Needle longer than haystack returns npos")
+  {
+    const auto searcher = searcher_type( "hello world" );
+
+    REQUIRE( searcher( "hello" ) == npos );
+  }
+}
+
+TEST_CASE("u16boyer_moore_horspool_searcher::operator()( u16string_view, size_type )", "[string_searcher]")
+{
+  // 0x0161 and 0x0261 share a low byte with 'a', which must not shift past
+  // a match
+  const char16_t haystack[] = { u'x', 0x0161, u'a', 0x0261, u'b', u'a', u'b', u'y' };
+  const char16_t needle[]   = { 0x0261, u'b', u'a', u'b' };
+
+  const auto searcher = bit::core::u16boyer_moore_horspool_searcher(
+    bit::core::u16string_view( needle, 4 ) );
+
+  REQUIRE( searcher( bit::core::u16string_view( haystack, 8 ) ) == 3u );
+  REQUIRE( searcher( bit::core::u16string_view( haystack, 8 ), 4 ) == npos );
+}
+
+//============================================================================
+// basic_simd_searcher
+//============================================================================
+
+TEST_CASE("simd_searcher::operator()( string_view, size_type )", "[string_searcher]")
+{
+  using searcher_type = bit::core::simd_searcher;
+
+  SECTION("Matches a naive search over a small alphabet")
+  {
+    check_matches_naive<searcher_type>( "ab" );
+  }
+
+  SECTION("Matches a naive search over a large alphabet")
+  {
+    check_matches_naive<searcher_type>( "abcdefghijklmnopqrstuvwxyz \xe9\xff" );
+  }
+
+  SECTION("Matches a naive search over a repetitive haystack")
+  {
+    // Every position passes the filter, so the Two-Way fallback is used
+    const auto h = std::string( 4000, 'a' ) + "b";
+    const auto x = std::string( 40, 'a' ) + "b";
+    const auto searcher = searcher_type( bit::core::string_view( x.data(), x.size() ) );
+
+    REQUIRE( searcher( bit::core::string_view( h.data(), h.size() ) ) == h.size() - x.size() );
+  }
+
+  SECTION("Empty needle returns npos")
+  {
+    const auto searcher = searcher_type( "" );
+
+    REQUIRE( searcher( "hello" ) == npos );
+  }
+
+  SECTION("Position past the end returns npos")
+  {
+    const auto searcher = searcher_type( "lo" );
+
+    REQUIRE( searcher( "hello", 4 ) == npos );
+  }
+}
+
+//============================================================================
+// Usage
+//============================================================================
+
+TEST_CASE("searchers are usable over string_span", "[string_searcher]")
+{
+  char buffer[] = "one two three two one";
+  const auto span = bit::core::string_span<bit::core::dynamic_extent>( buffer, sizeof(buffer) - 1 );
+
+  REQUIRE( bit::core::simd_searcher( "two" )( span ) == 4u );
+  REQUIRE( bit::core::boyer_moore_horspool_searcher( "two" )( span, 5 ) == 14u );
+}
+
+TEST_CASE("string_view::find( const searcher&, size_type )", "[string_searcher]")
+{
+  const auto view = bit::core::string_view( "the quick brown fox jumps over the lazy dog" );
+
+  SECTION("Finds with a boyer_moore_horspool_searcher")
+  {
+    const auto searcher = bit::core::boyer_moore_horspool_searcher( "the" );
+
+    REQUIRE( view.find( searcher ) == 0u );
+    REQUIRE( view.find( searcher, 1 ) == 31u );
+    REQUIRE( view.find( searcher, 32 ) == npos );
+  }
+
+  SECTION("Finds with a simd_searcher")
+  {
+    const auto searcher = bit::core::simd_searcher( "lazy" );
+
+    REQUIRE( view.find( searcher ) == view.find( "lazy" ) );
+    REQUIRE( view.find( searcher, 36 ) == npos );
+  }
+}
+
+TEST_CASE("string_view::find with searchers declared", "[string_searcher]")
+{
+  // Views that no searcher supports still find through their own overloads
+  SECTION("Finds in a u16string_view")
+  {
+    const auto view = bit::core::u16string_view( u"abxcx" );
+
+    REQUIRE( view.find( u"x" ) == 2u );
+    REQUIRE( view.find( u'x', 3 ) == 4u );
+  }
+
+  SECTION("Finds in an insensitive string_view")
+  {
+    const auto view = bit::core::ci::string_view( "abc" );
+
+    REQUIRE( view.find( "B" ) == 1u );
+  }
+}
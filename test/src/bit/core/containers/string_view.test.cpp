@@ -6,6 +6,9 @@
 #include <bit/core/containers/string_view.hpp>
 #include <bit/core/containers/array_view.hpp>
 
+#include "test_support.hpp"
+
+#include <algorithm>
 #include <string>
 #include <cstring>
 
@@ -431,6 +434,259 @@ TEST_CASE("string_view::substr( size_t, size_t )","[operation]")
 
 //----------------------------------------------------------------------------
 
+namespace {
+
+  constexpr auto npos = static_cast<std::size_t>(bit::core::string_view::npos);
+
+  // Builds a haystack over a small alphabet, so that partial matches of the
+  // needle are common
+  std::string make_haystack( std::size_t size, unsigned alphabet, unsigned seed )
+  {
+    return test::make_test_string( size, std::string( "abcdefghijklmnopqrstuvwxyz", alphabet ), seed );
+  }
+
+  constexpr bit::core::string_view constexpr_view( "Hello World", 11 );
+
+} // anonymous namespace
+
+TEST_CASE("string_view::find( string_view, size_type )","[operation]")
+{
+  bit::core::string_view view = "Hello World";
+
+  SECTION("Returns the first position of the substring")
+  {
+    REQUIRE( view.find("o") == 4 );
+    REQUIRE( view.find("World") == 6 );
+    REQUIRE( view.find("Hello World") == 0 );
+  }
+
+  SECTION("Starts searching at pos")
+  {
+    REQUIRE( view.find("o", 5) == 7 );
+    REQUIRE( view.find("l", 10) == npos );
+  }
+
+  SECTION("Returns npos if the substring is absent or too long")
+  {
+    REQUIRE( view.find("Worlds") == npos );
+    REQUIRE( view.find("Hello World!") == npos );
+    REQUIRE( view.find("o", 20) == npos );
+  }
+
+  SECTION("Is usable in constant expressions")
+  {
+    STATIC_REQUIRE( constexpr_view.find( bit::core::string_view("World", 5) ) == 6 );
+    STATIC_REQUIRE( constexpr_view.find( bit::core::string_view("o", 1), 5 ) == 7 );
+  }
+
+  SECTION("Matches a naive search for short and long needles")
+  {
+    for( auto alphabet : {2u, 4u, 26u} ) {
+      const auto haystack = make_haystack( 1000, alphabet, alphabet );
+      const auto view     = bit::core::string_view( haystack );
+
+      for( auto length = std::size_t{1}; length <= 100; length += (length < 40 ? 1 : 7) ) {
+        for( auto start : {std::size_t{0}, std::size_t{300}, std::size_t{997}} ) {
+          // Needles taken from the haystack are guaranteed to be found
+          const auto needle = haystack.substr( start, length );
+          for( auto pos : {std::size_t{0}, std::size_t{1}, std::size_t{17}, std::size_t{500}} ) {
+            REQUIRE( view.find( needle, pos ) == test::naive_find( haystack, needle, pos ) );
+          }
+        }
+      }
+    }
+  }
+
+  SECTION("Matches a naive search for periodic needles")
+  {
+    const auto haystack = std::string( 300, 'a' ) + "b" + std::string( 300, 'a' );
+    const auto view     = bit::core::string_view( haystack );
+
+    for( auto length = std::size_t{1}; length <= 80; ++length ) {
+      const auto absent = std::string( length, 'a' ) + "c";
+      const auto suffix = std::string( length, 'a' ) + "b";
+      const auto prefix = "b" + std::string( length, 'a' );
+
+      REQUIRE( view.find( absent ) == test::naive_find( haystack, absent, 0 ) );
+      REQUIRE( view.find( suffix ) == test::naive_find( haystack, suffix, 0 ) );
+      REQUIRE( view.find( prefix, 3 ) == test::naive_find( haystack, prefix, 3 ) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("string_view::rfind( string_view, size_type )","[operation]")
+{
+  bit::core::string_view view = "Hello World";
+
+  SECTION("Returns the last position of the substring")
+  {
+    REQUIRE( view.rfind("o") == 7 );
+    REQUIRE( view.rfind("Hello") == 0 );
+    REQUIRE( view.rfind("Hello World") == 0 );
+  }
+
+  SECTION("Returns npos if the substring is absent or too long")
+  {
+    REQUIRE( view.rfind("Worlds") == npos );
+    REQUIRE( view.rfind("Hello World!") == npos );
+  }
+
+  SECTION("Returns a substring starting exactly at pos")
+  {
+    bit::core::string_view fields = "key=value;other,last";
+
+    REQUIRE( fields.rfind(';', 9) == 9 );
+    REQUIRE( fields.rfind("value", 4) == 4 );
+    REQUIRE( fields.rfind("value", 3) == npos );
+
+    // Backward searches agree on where they start
+    REQUIRE( fields.rfind(';', 9) == fields.find_last_of(';', 9) );
+    REQUIRE( fields.rfind(';', 8) == fields.find_last_of(';', 8) );
+  }
+
+  SECTION("Is usable in constant expressions")
+  {
+    STATIC_REQUIRE( constexpr_view.rfind( bit::core::string_view("o", 1) ) == 7 );
+    STATIC_REQUIRE( constexpr_view.rfind( bit::core::string_view("l", 1), 5 ) == 3 );
+  }
+
+  SECTION("Matches a naive search for short and long needles")
+  {
+    for( auto alphabet : {2u, 4u, 26u} ) {
+      const auto haystack = make_haystack( 1000, alphabet, alphabet + 7u );
+      const auto view     = bit::core::string_view( haystack );
+
+      for( auto length = std::size_t{1}; length <= 100; length += (length < 40 ? 1 : 7) ) {
+        for( auto start : {std::size_t{0}, std::size_t{300}, std::size_t{850}} ) {
+          const auto needle = haystack.substr( start, length );
+          for( auto pos : {std::size_t{1}, std::size_t{290}, std::size_t{700}, npos} ) {
+            REQUIRE( view.rfind( needle, pos ) == test::naive_rfind( haystack, needle, pos ) );
+          }
+        }
+      }
+    }
+  }
+
+  SECTION("Matches a naive search for periodic needles")
+  {
+    const auto haystack = std::string( 300, 'a' ) + "b" + std::string( 300, 'a' );
+    const auto view     = bit::core::string_view( haystack );
+
+    for( auto length = std::size_t{1}; length <= 80; ++length ) {
+      const auto absent = "c" + std::string( length, 'a' );
+      const auto prefix = "b" + std::string( length, 'a' );
+      const auto suffix = std::string( length, 'a' ) + "b";
+
+      REQUIRE( view.rfind( absent ) == test::naive_rfind( haystack, absent, npos ) );
+      REQUIRE( view.rfind( prefix ) == test::naive_rfind( haystack, prefix, npos ) );
+      REQUIRE( view.rfind( suffix, 500 ) == test::naive_rfind( haystack, suffix, 500 ) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("string_view::find_first_of( string_view, size_type )","[operation]")
+{
+  bit::core::string_view view = "key=value;other,last";
+
+  SECTION("Returns the first character in the set")
+  {
+    REQUIRE( view.find_first_of(",;") == 9 );
+    REQUIRE( view.find_first_of(",;", 10) == 15 );
+    REQUIRE( view.find_first_of(bit::core::char_set(",;"), 10) == 15 );
+  }
+
+  SECTION("Returns npos if no character is in the set")
+  {
+    REQUIRE( view.find_first_of("!?") == npos );
+    REQUIRE( view.find_first_of(bit::core::char_set("!?")) == npos );
+  }
+
+  SECTION("Is usable in constant expressions")
+  {
+    STATIC_REQUIRE( constexpr_view.find_first_of( bit::core::string_view("ow", 2) ) == 4 );
+    STATIC_REQUIRE( constexpr_view.find_first_of( bit::core::char_set("ow") ) == 4 );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("string_view::find_last_of( string_view, size_type )","[operation]")
+{
+  bit::core::string_view view = "key=value;other,last";
+
+  SECTION("Returns the last character in the set at or before pos")
+  {
+    REQUIRE( view.find_last_of(",;") == 15 );
+    REQUIRE( view.find_last_of(",;", 14) == 9 );
+    REQUIRE( view.find_last_of(bit::core::char_set(",;"), 14) == 9 );
+  }
+
+  SECTION("Returns a character exactly at pos")
+  {
+    REQUIRE( view.find_last_of(",;", 9) == 9 );
+    REQUIRE( view.find_last_of(';', 9) == 9 );
+    REQUIRE( view.find_last_of(bit::core::char_set(",;"), 9) == 9 );
+    REQUIRE( view.find_last_not_of("ekyv", 3) == 3 );
+    REQUIRE( view.find_last_not_of(bit::core::char_set("ekyv"), 3) == 3 );
+
+    // Long enough that the searches build a char_set
+    const auto haystack = std::string( 70, '.' ) + ";" + std::string( 40, '.' );
+    const auto long_view = bit::core::string_view( haystack );
+    REQUIRE( long_view.find_last_of(",;", 70) == 70 );
+    REQUIRE( long_view.find_last_of(bit::core::char_set(",;"), 70) == 70 );
+  }
+
+  SECTION("Returns npos if no character is in the set")
+  {
+    REQUIRE( view.find_last_of(",;", 8) == npos );
+    REQUIRE( view.find_last_of(bit::core::char_set(",;"), 8) == npos );
+  }
+
+  SECTION("Is usable in constant expressions")
+  {
+    STATIC_REQUIRE( constexpr_view.find_last_of( bit::core::string_view("o", 1), 4 ) == 4 );
+    STATIC_REQUIRE( constexpr_view.find_last_of( bit::core::char_set("o"), 4 ) == 4 );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("string_view::find_first_of family","[operation]")
+{
+  const std::string sets[] = { ",", " \t\r\n", "aeiou", "0123456789abcdef", "abcdefghijklmnopqrstu" };
+
+  for( const auto& set_chars : sets ) {
+    const auto set = bit::core::char_set( set_chars.data(), set_chars.size() );
+
+    // Long enough that the searches build a char_set
+    for( auto alphabet : {4u, 26u} ) {
+      auto haystack = make_haystack( 600, alphabet, alphabet );
+      for( auto i = std::size_t{0}; i < haystack.size(); i += 97 ) {
+        haystack[i] = set_chars[i % set_chars.size()];
+      }
+      const auto view = bit::core::string_view( haystack );
+
+      for( auto pos : {std::size_t{0}, std::size_t{5}, std::size_t{300}, std::size_t{599}, npos} ) {
+        REQUIRE( view.find_first_of( set_chars, pos ) == test::naive_find_first_of( haystack, set_chars, pos, true ) );
+        REQUIRE( view.find_first_not_of( set_chars, pos ) == test::naive_find_first_of( haystack, set_chars, pos, false ) );
+        REQUIRE( view.find_last_of( set_chars, pos ) == test::naive_find_last_of( haystack, set_chars, pos, true ) );
+        REQUIRE( view.find_last_not_of( set_chars, pos ) == test::naive_find_last_of( haystack, set_chars, pos, false ) );
+
+        REQUIRE( view.find_first_of( set, pos ) == test::naive_find_first_of( haystack, set_chars, pos, true ) );
+        REQUIRE( view.find_first_not_of( set, pos ) == test::naive_find_first_of( haystack, set_chars, pos, false ) );
+        REQUIRE( view.find_last_of( set, pos ) == test::naive_find_last_of( haystack, set_chars, pos, true ) );
+        REQUIRE( view.find_last_not_of( set, pos ) == test::naive_find_last_of( haystack, set_chars, pos, false ) );
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
 TEST_CASE("string_view::compare( string_view )","[comparison]")
 {
   SECTION("Returns 0 for identical views")
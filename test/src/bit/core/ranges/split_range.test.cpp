@@ -0,0 +1,240 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for bit::core::split
+ *****************************************************************************/
+
+#include <bit/core/ranges/split_range.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  template<typename Range>
+  std::vector<std::string> collect( Range r )
+  {
+    auto result = std::vector<std::string>{};
+    for( auto piece : r ) {
+      result.emplace_back( piece.data(), piece.size() );
+    }
+    return result;
+  }
+
+  // Reference split built on std::string::find
+  std::vector<std::string> naive_split( const std::string& s,
+                                        const std::string& delimiter )
+  {
+    auto result = std::vector<std::string>{};
+    auto start  = std::size_t{0};
+    while( true ) {
+      const auto p = s.find( delimiter, start );
+      if( p == std::string::npos ) break;
+      result.push_back( s.substr( start, p - start ) );
+      start = p + delimiter.size();
+    }
+    result.push_back( s.substr( start ) );
+    return result;
+  }
+
+  constexpr std::size_t count_pieces( bit::core::string_view s, char delimiter )
+  {
+    auto count = std::size_t{0};
+    for( auto it = bit::core::split( s, delimiter ).begin(); it != decltype(it){}; ++it ) {
+      ++count;
+    }
+    return count;
+  }
+
+  using strings = std::vector<std::string>;
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Character delimiter
+//----------------------------------------------------------------------------
+
+TEST_CASE("split( string_view, char )", "[split]")
+{
+  SECTION("String without delimiters")
+  {
+    SECTION("Yields the whole string")
+    {
+      REQUIRE( collect( bit::core::split( bit::core::string_view{"hello"}, ',' ) ) == strings{"hello"} );
+    }
+  }
+
+  SECTION("Empty string")
+  {
+    SECTION("Yields one empty piece")
+    {
+      REQUIRE( collect( bit::core::split( bit::core::string_view{""}, ',' ) ) == strings{""} );
+    }
+  }
+
+  SECTION("Adjacent and trailing delimiters")
+  {
+    SECTION("Yield empty pieces")
+    {
+      const auto s = bit::core::string_view{",a,,b,"};
+
+      REQUIRE( collect( bit::core::split( s, ',' ) ) == strings{"", "a", "", "b", ""} );
+    }
+  }
+
+  SECTION("Pieces view the original string")
+  {
+    const auto s = bit::core::string_view{"ab,cd"};
+    auto r = bit::core::split( s, ',' );
+    auto it = r.begin();
+
+    REQUIRE( it->data() == s.data() );
+    ++it;
+    REQUIRE( it->data() == s.data() + 3 );
+  }
+
+  SECTION("Is usable in constant expressions")
+  {
+    STATIC_REQUIRE( count_pieces( bit::core::string_view{"a,b,c", 5}, ',' ) == 3u );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Substring delimiter
+//----------------------------------------------------------------------------
+
+TEST_CASE("split( string_view, string_view )", "[split]")
+{
+  SECTION("Multi-character delimiter")
+  {
+    SECTION("Splits at each occurrence")
+    {
+      const auto s = bit::core::string_view{"a::b::::c"};
+
+      REQUIRE( collect( bit::core::split( s, "::" ) ) == strings{"a", "b", "", "c"} );
+    }
+  }
+
+  SECTION("Empty delimiter")
+  {
+    SECTION("Yields the whole string")
+    {
+      const auto s = bit::core::string_view{"abc"};
+
+      REQUIRE( collect( bit::core::split( s, bit::core::string_view{} ) ) == strings{"abc"} );
+    }
+  }
+
+  SECTION("Matches a reference split")
+  {
+    const auto delimiters = strings{"a", "ab", "aba", "bb"};
+
+    for( const auto& delimiter : delimiters ) {
+      for( auto n = 0u; n < 300u; ++n ) {
+        auto s = std::string{};
+        for( auto i = n; i != 0; i /= 3 ) {
+          s.push_back( "abc"[i % 3] );
+          s.push_back( "ab"[(i >> 1) % 2] );
+        }
+        const auto view = bit::core::string_view{s.data(), s.size()};
+        const auto d    = bit::core::string_view{delimiter.data(), delimiter.size()};
+
+        REQUIRE( collect( bit::core::split( view, d ) ) == naive_split( s, delimiter ) );
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Character set delimiter
+//----------------------------------------------------------------------------
+
+TEST_CASE("split( string_view, const char_set& )", "[split]")
+{
+  SECTION("Splits at any character of the set")
+  {
+    const auto set = bit::core::char_set{" \t\n"};
+    const auto s   = bit::core::string_view{"one two\tthree\nfour"};
+
+    REQUIRE( collect( bit::core::split( s, set ) ) == strings{"one", "two", "three", "four"} );
+  }
+
+  SECTION("Splits strings longer than a vector")
+  {
+    const auto set = bit::core::char_set{";|"};
+    auto s = std::string{};
+    auto expected = strings{};
+    for( auto i = 0; i < 20; ++i ) {
+      expected.emplace_back( static_cast<std::size_t>(i), 'x' );
+      s += expected.back();
+      s += (i % 2 == 0) ? ';' : '|';
+    }
+    expected.emplace_back();
+
+    REQUIRE( collect( bit::core::split( bit::core::string_view{s.data(), s.size()}, set ) ) == expected );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Options
+//----------------------------------------------------------------------------
+
+TEST_CASE("split( ..., split_options )", "[split]")
+{
+  const auto s = bit::core::string_view{",a,,b,c,"};
+
+  SECTION("max_splits")
+  {
+    SECTION("Is zero")
+    {
+      SECTION("Yields the whole string")
+      {
+        auto options = bit::core::split_options{};
+        options.max_splits = 0;
+
+        REQUIRE( collect( bit::core::split( s, ',', options ) ) == strings{",a,,b,c,"} );
+      }
+    }
+
+    SECTION("Is less than the number of delimiters")
+    {
+      SECTION("Leaves the rest in the last piece")
+      {
+        auto options = bit::core::split_options{};
+        options.max_splits = 2;
+
+        REQUIRE( collect( bit::core::split( s, ',', options ) ) == strings{"", "a", ",b,c,"} );
+      }
+    }
+  }
+
+  SECTION("skip_empty")
+  {
+    SECTION("Skips empty pieces")
+    {
+      auto options = bit::core::split_options{};
+      options.skip_empty = true;
+
+      REQUIRE( collect( bit::core::split( s, ',', options ) ) == strings{"a", "b", "c"} );
+    }
+
+    SECTION("Skips an empty string")
+    {
+      auto options = bit::core::split_options{};
+      options.skip_empty = true;
+
+      REQUIRE( collect( bit::core::split( bit::core::string_view{""}, ',', options ) ).empty() );
+    }
+
+    SECTION("Does not count skipped splits")
+    {
+      auto options = bit::core::split_options{};
+      options.skip_empty = true;
+      options.max_splits = 1;
+
+      REQUIRE( collect( bit::core::split( s, ',', options ) ) == strings{"a", ",b,c,"} );
+    }
+  }
+}
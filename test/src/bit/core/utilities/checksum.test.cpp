@@ -0,0 +1,172 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the CRC32C checksum
+ *****************************************************************************/
+
+#include <bit/core/utilities/checksum.hpp>
+
+#include "test_support.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  std::vector<bit::core::byte> make_bytes( const char* str, std::size_t size )
+  {
+    auto result = std::vector<bit::core::byte>{};
+    for( auto i = std::size_t{0}; i < size; ++i ) {
+      result.push_back( static_cast<bit::core::byte>(str[i]) );
+    }
+    return result;
+  }
+
+  bit::core::span<const bit::core::byte>
+    subspan( const std::vector<bit::core::byte>& bytes,
+             std::size_t offset,
+             std::size_t size )
+  {
+    return { bytes.data() + offset, static_cast<std::ptrdiff_t>(size) };
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// CRC32C
+//----------------------------------------------------------------------------
+
+TEST_CASE("crc32c( span<const byte> )", "[checksum]")
+{
+  SECTION("Empty input has a checksum of 0")
+  {
+    REQUIRE( bit::core::crc32c( nullptr ) == 0u );
+  }
+
+  SECTION("Matches the standard check value")
+  {
+    const auto bytes = make_bytes( "123456789", 9u );
+
+    REQUIRE( bit::core::crc32c( bytes ) == 0xe3069283u );
+  }
+
+  SECTION("Matches the RFC 3720 test vectors")
+  {
+    auto bytes = std::vector<bit::core::byte>( 32u );
+
+    REQUIRE( bit::core::crc32c( bytes ) == 0x8a9136aau );
+
+    for( auto& b : bytes ) b = static_cast<bit::core::byte>(0xff);
+    REQUIRE( bit::core::crc32c( bytes ) == 0x62a8ab43u );
+
+    for( auto i = 0u; i < 32u; ++i ) bytes[i] = static_cast<bit::core::byte>(i);
+    REQUIRE( bit::core::crc32c( bytes ) == 0x46dd794eu );
+
+    for( auto i = 0u; i < 32u; ++i ) bytes[i] = static_cast<bit::core::byte>(31u - i);
+    REQUIRE( bit::core::crc32c( bytes ) == 0x113fdb5cu );
+  }
+
+  SECTION("Software and hardware implementations agree")
+  {
+    const auto bytes = test::make_test_bytes( 300u );
+
+    for( auto offset = 0u; offset < 8u; ++offset ) {
+      for( auto size = 0u; size + offset <= bytes.size(); size += 7u ) {
+        const auto* p = reinterpret_cast<const unsigned char*>(bytes.data() + offset);
+        const auto expected = ~bit::core::detail::crc32c_software( ~0u, p, size );
+
+        REQUIRE( bit::core::crc32c( subspan( bytes, offset, size ) ) == expected );
+#if defined(BIT_CORE_CRC32C_HARDWARE)
+        if( bit::core::detail::crc32c_has_hardware() ) {
+          REQUIRE( ~bit::core::detail::crc32c_hardware( ~0u, p, size ) == expected );
+        }
+#endif
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("crc32c( std::uint32_t, span<const byte> )", "[checksum]")
+{
+  const auto bytes    = test::make_test_bytes( 1000u );
+  const auto expected = bit::core::crc32c( bytes );
+
+  for( auto split : { 0u, 1u, 8u, 333u, 999u, 1000u } ) {
+    const auto first = bit::core::crc32c( subspan( bytes, 0u, split ) );
+
+    REQUIRE( bit::core::crc32c( first, subspan( bytes, split, 1000u - split ) ) == expected );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("crc32c_combine( std::uint32_t, std::uint32_t, std::size_t )", "[checksum]")
+{
+  const auto bytes    = test::make_test_bytes( 5000u );
+  const auto expected = bit::core::crc32c( bytes );
+
+  for( auto split : { 0u, 1u, 17u, 4096u, 4999u, 5000u } ) {
+    const auto size2 = 5000u - split;
+    const auto crc1  = bit::core::crc32c( subspan( bytes, 0u, split ) );
+    const auto crc2  = bit::core::crc32c( subspan( bytes, split, size2 ) );
+
+    REQUIRE( bit::core::crc32c_combine( crc1, crc2, size2 ) == expected );
+  }
+}
+
+TEST_CASE("crc32c_combine( std::uint32_t, std::uint32_t, std::size_t ) with a long second part", "[checksum]")
+{
+  // Lengths of 2^29 bytes and more need powers of x past x^(2^32)
+  const auto zeros = std::vector<bit::core::byte>( 1u << 20, static_cast<bit::core::byte>(0) );
+  const auto chunk = bit::core::span<const bit::core::byte>( zeros );
+  const auto bytes = test::make_test_bytes( 100u );
+  const auto size2 = (std::size_t{1u} << 29) + 3u;
+
+  const auto crc1 = bit::core::crc32c( bytes );
+  auto expected = crc1;
+  auto crc2 = std::uint32_t{0};
+  for( auto i = 0u; i < 512u; ++i ) {
+    expected = bit::core::crc32c( expected, chunk );
+    crc2     = bit::core::crc32c( crc2, chunk );
+  }
+  expected = bit::core::crc32c( expected, subspan( zeros, 0u, 3u ) );
+  crc2     = bit::core::crc32c( crc2, subspan( zeros, 0u, 3u ) );
+
+  REQUIRE( bit::core::crc32c_combine( crc1, crc2, size2 ) == expected );
+}
+
+//----------------------------------------------------------------------------
+// class : crc32c_checksum
+//----------------------------------------------------------------------------
+
+TEST_CASE("crc32c_checksum", "[checksum]")
+{
+  const auto bytes = test::make_test_bytes( 777u );
+  auto checksum = bit::core::crc32c_checksum{};
+
+  SECTION("Default constructed has the checksum of no input")
+  {
+    REQUIRE( checksum.finalize() == 0u );
+  }
+
+  SECTION("Updating in pieces matches checksumming all at once")
+  {
+    for( auto i = std::size_t{0}; i < bytes.size(); i += 13u ) {
+      checksum.update( subspan( bytes, i, std::min<std::size_t>( 13u, bytes.size() - i ) ) );
+    }
+
+    REQUIRE( checksum.finalize() == bit::core::crc32c( bytes ) );
+  }
+
+  SECTION("Reset discards consumed input")
+  {
+    checksum.update( bytes );
+    checksum.reset();
+
+    REQUIRE( checksum.finalize() == 0u );
+  }
+}
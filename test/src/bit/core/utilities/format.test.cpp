@@ -0,0 +1,210 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for bit::core::format_to
+ *****************************************************************************/
+
+#include <bit/core/utilities/format.hpp>
+#include <bit/core/utilities/parse.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  template<typename T>
+  std::string format( T value )
+  {
+    char buffer[bit::core::max_formatted_size_v<T>];
+    const auto result = bit::core::format_to( buffer, value );
+
+    return { result.data(), result.size() };
+  }
+
+  std::uint64_t next_random( std::uint64_t& state )
+  {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state ^ (state >> 29);
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Integers
+//----------------------------------------------------------------------------
+
+TEST_CASE("format_to( span<char>, Integer )", "[format]")
+{
+  SECTION("Value is zero")
+  {
+    SECTION("Writes 0")
+    {
+      REQUIRE( format( 0 ) == "0" );
+      REQUIRE( format( 0u ) == "0" );
+    }
+  }
+
+  SECTION("Value is positive")
+  {
+    SECTION("Writes the digits")
+    {
+      REQUIRE( format( 7 ) == "7" );
+      REQUIRE( format( 42 ) == "42" );
+      REQUIRE( format( 1234567890 ) == "1234567890" );
+    }
+  }
+
+  SECTION("Value is negative")
+  {
+    SECTION("Writes a leading '-'")
+    {
+      REQUIRE( format( -1 ) == "-1" );
+      REQUIRE( format( -100 ) == "-100" );
+    }
+  }
+
+  SECTION("Value is a limit of the type")
+  {
+    SECTION("Writes the limit")
+    {
+      REQUIRE( format( std::numeric_limits<signed char>::min() ) == "-128" );
+      REQUIRE( format( std::numeric_limits<std::int64_t>::min() ) == "-9223372036854775808" );
+      REQUIRE( format( std::numeric_limits<std::int64_t>::max() ) == "9223372036854775807" );
+      REQUIRE( format( std::numeric_limits<std::uint64_t>::max() ) == "18446744073709551615" );
+    }
+  }
+
+  SECTION("Matches std::to_string")
+  {
+    auto state = std::uint64_t{3};
+    for( auto i = 0; i < 10000; ++i ) {
+      const auto value = static_cast<long long>( next_random( state ) >> (next_random( state ) % 64u) );
+
+      REQUIRE( format( value ) == std::to_string( value ) );
+      REQUIRE( format( -value ) == std::to_string( -value ) );
+    }
+  }
+
+  SECTION("Buffer is too small")
+  {
+    SECTION("Returns an empty view")
+    {
+      char buffer[3];
+
+      REQUIRE( bit::core::format_to( buffer, 1234 ).empty() );
+      REQUIRE( bit::core::format_to( buffer, -123 ).empty() );
+      REQUIRE( bit::core::format_to( buffer, 123 ) == "123" );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Floating Point
+//----------------------------------------------------------------------------
+
+TEST_CASE("format_to( span<char>, Float )", "[format]")
+{
+  SECTION("Value is zero")
+  {
+    SECTION("Writes 0 with its sign")
+    {
+      REQUIRE( format( 0.0 ) == "0" );
+      REQUIRE( format( -0.0 ) == "-0" );
+    }
+  }
+
+  SECTION("Value is infinity or NaN")
+  {
+    SECTION("Writes inf or nan")
+    {
+      REQUIRE( format( std::numeric_limits<double>::infinity() ) == "inf" );
+      REQUIRE( format( -std::numeric_limits<float>::infinity() ) == "-inf" );
+      REQUIRE( format( std::numeric_limits<double>::quiet_NaN() ) == "nan" );
+    }
+  }
+
+  SECTION("Value has a short decimal")
+  {
+    SECTION("Writes the shortest digits")
+    {
+      REQUIRE( format( 0.1 ) == "0.1" );
+      REQUIRE( format( 0.3 ) == "0.3" );
+      REQUIRE( format( 1.5 ) == "1.5" );
+      REQUIRE( format( 0.1f ) == "0.1" );
+      REQUIRE( format( 123456.0 ) == "123456" );
+      REQUIRE( format( -2.5e-3 ) == "-0.0025" );
+    }
+  }
+
+  SECTION("Scientific notation is shorter")
+  {
+    SECTION("Writes scientific notation")
+    {
+      REQUIRE( format( 1e6 ) == "1e+06" );
+      REQUIRE( format( 1e-5 ) == "1e-05" );
+      REQUIRE( format( 1.5e300 ) == "1.5e+300" );
+      REQUIRE( format( 5e-324 ) == "5e-324" );
+      REQUIRE( format( std::numeric_limits<double>::max() ) == "1.7976931348623157e+308" );
+      REQUIRE( format( std::numeric_limits<float>::max() ) == "3.4028235e+38" );
+    }
+  }
+
+  SECTION("Notations are the same length")
+  {
+    SECTION("Writes fixed notation")
+    {
+      REQUIRE( format( 100.0 ) == "100" );
+      REQUIRE( format( 0.001 ) == "0.001" );
+    }
+  }
+
+  SECTION("Value is an integer beyond the precision of the type")
+  {
+    SECTION("Writes the exact value in fixed notation")
+    {
+      REQUIRE( format( 12345678901234567.0 ) == "12345678901234568" );
+      REQUIRE( format( 969728693705784320.0 ) == "969728693705784320" );
+    }
+  }
+
+  SECTION("Buffer is too small")
+  {
+    SECTION("Returns an empty view")
+    {
+      char buffer[4];
+
+      REQUIRE( bit::core::format_to( buffer, 0.125 ).empty() );
+      REQUIRE( bit::core::format_to( buffer, 0.25 ) == "0.25" );
+    }
+  }
+
+  SECTION("Round trips through parse")
+  {
+    auto state = std::uint64_t{5};
+    for( auto i = 0; i < 100000; ++i ) {
+      const auto bits = next_random( state );
+
+      auto d = 0.0;
+      std::memcpy( &d, &bits, sizeof(d) );
+      if( std::isfinite( d ) ) {
+        const auto text = format( d );
+
+        REQUIRE( bit::core::parse<double>( { text.data(), text.size() } ).value() == d );
+      }
+
+      auto f = 0.0f;
+      const auto bits32 = static_cast<std::uint32_t>( bits );
+      std::memcpy( &f, &bits32, sizeof(f) );
+      if( std::isfinite( f ) ) {
+        const auto text = format( f );
+
+        REQUIRE( bit::core::parse<float>( { text.data(), text.size() } ).value() == f );
+      }
+    }
+  }
+}
@@ -0,0 +1,361 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the hashing utilities
+ *****************************************************************************/
+
+#include <bit/core/utilities/hash.hpp>
+#include <bit/core/containers/string_view.hpp>
+#include <bit/core/containers/span.hpp>
+#include <bit/core/traits/concepts/is_contiguous_iterator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+static_assert( bit::core::is_contiguous_iterator<std::vector<char>::iterator>::value,
+               "std::vector<char> iterators must be contiguous" );
+static_assert( bit::core::is_contiguous_iterator<std::vector<char>::const_iterator>::value,
+               "std::vector<char> iterators must be contiguous" );
+static_assert( bit::core::is_contiguous_iterator<std::vector<unsigned char>::iterator>::value,
+               "std::vector<unsigned char> iterators must be contiguous" );
+static_assert( bit::core::is_contiguous_iterator<std::string::iterator>::value,
+               "std::string iterators must be contiguous" );
+static_assert( bit::core::is_contiguous_iterator<std::string::const_iterator>::value,
+               "std::string iterators must be contiguous" );
+static_assert( !bit::core::is_contiguous_iterator<std::vector<bool>::iterator>::value,
+               "std::vector<bool> iterators must not be contiguous" );
+static_assert( !bit::core::is_contiguous_iterator<std::list<char>::iterator>::value,
+               "std::list iterators must not be contiguous" );
+
+namespace {
+
+  // 640 characters; long enough to span more than one 512-byte block
+  constexpr char test_text[] =
+    "The quick brown fox jumps over the lazy dog. Pack my box with five dozen "
+    "liquor jugs! How vexingly quick daft zebras jump; sphinx of black quartz,"
+    " judge my vow. 0123456789 abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRST"
+    "UVWXYZ ~!@#$%^&*()_+`-={}|[]\\:\";'<>?,./ The five boxing wizards jump qu"
+    "ickly. Jackdaws love my big sphinx of quartz. Mr. Jock, TV quiz PhD, bags"
+    " few lynx. Waltz, bad nymph, for quick jigs vex. Glib jocks quiz nymph to"
+    " vex dwarf. Bright vixens jump; dozy fowl quack. Quick wafting zephyrs ve"
+    "x bold Jim. Two driven jocks help fax my big quiz. Five quacking zephyrs "
+    "jolt my wax bed. The jay, pig, fox, zebra and my wolves quack! Blowzy red";
+
+  constexpr std::size_t test_text_size = sizeof(test_text) - 1;
+
+  struct prefix_hashes
+  {
+    bit::core::hash_t values[test_text_size + 1];
+  };
+
+  template<typename HashPolicy>
+  constexpr prefix_hashes make_prefix_hashes( const HashPolicy& policy )
+  {
+    auto result = prefix_hashes{};
+    for( auto i = std::size_t{0}; i <= test_text_size; ++i ) {
+      result.values[i] = bit::core::hash_string_segment( test_text, i, policy );
+    }
+    return result;
+  }
+
+  constexpr std::uint64_t test_ids[] = {
+    0x0123456789abcdefull, 42u, 0u, 0xffffffffffffffffull, 7u, 1u << 20u
+  };
+
+  enum class test_enum : short { a = 1, b = -2, c = 300 };
+
+  // Counts the number of distinct buckets used by the hashes of the keys
+  template<typename Hasher, typename Key>
+  std::size_t count_used_buckets( const std::vector<Key>& keys,
+                                  std::size_t bucket_count,
+                                  Hasher hasher )
+  {
+    auto used = std::vector<bool>( bucket_count, false );
+    for( const auto& key : keys ) {
+      used[static_cast<std::size_t>(hasher(key)) & (bucket_count - 1)] = true;
+    }
+    return static_cast<std::size_t>( std::count( used.begin(), used.end(), true ) );
+  }
+
+  std::size_t reference_fnv1( const char* str, std::size_t count )
+  {
+    auto result = static_cast<std::size_t>(sizeof(std::size_t) == 8 ? 14695981039346656037ull : 2166136261ul);
+    const auto prime = static_cast<std::size_t>(sizeof(std::size_t) == 8 ? 1099511628211ull : 16777619ul);
+
+    while( count-- ) {
+      result ^= static_cast<std::size_t>(*(str++));
+      result *= prime;
+    }
+    return result;
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Hash Policies
+//----------------------------------------------------------------------------
+
+TEST_CASE("fnv1_hash_policy::operator()( const CharT*, std::size_t )","[hash]")
+{
+  const auto str = std::string{test_text};
+
+  SECTION("Reproduces the original FNV-1 string hash")
+  {
+    for( auto i = std::size_t{0}; i <= test_text_size; ++i ) {
+      const auto result = bit::core::hash_string_segment( str.data(), i, bit::core::fnv1_hash_policy{} );
+
+      REQUIRE( static_cast<std::size_t>(result) == reference_fnv1( str.data(), i ) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("wide_hash_policy::operator()( const CharT*, std::size_t )","[hash]")
+{
+  constexpr auto expected = make_prefix_hashes( bit::core::wide_hash_policy{} );
+
+  // Copy to a buffer offset by one byte to exercise unaligned loads
+  const auto buffer = std::string{"_"} + test_text;
+  const auto* str   = buffer.data() + 1;
+
+  SECTION("Runtime results match compile-time results for all lengths")
+  {
+    for( auto i = std::size_t{0}; i <= test_text_size; ++i ) {
+      const auto result = bit::core::hash_string_segment( str, i, bit::core::wide_hash_policy{} );
+
+      REQUIRE( result == expected.values[i] );
+    }
+  }
+
+  SECTION("Different lengths produce different hashes")
+  {
+    for( auto i = std::size_t{1}; i <= test_text_size; ++i ) {
+      REQUIRE( expected.values[i] != expected.values[i-1] );
+    }
+  }
+
+  SECTION("Single bit changes produce different hashes")
+  {
+    auto copy = std::string{test_text};
+    const auto original = bit::core::hash_string_segment( copy.data(), copy.size() );
+
+    for( auto i = std::size_t{0}; i < copy.size(); i += 37 ) {
+      copy[i] ^= 0x01;
+      REQUIRE( bit::core::hash_string_segment( copy.data(), copy.size() ) != original );
+      copy[i] ^= 0x01;
+    }
+  }
+
+  SECTION("Wide characters hash identically at compile-time and runtime")
+  {
+    constexpr char16_t wide[] = u"wide characters are hashed as little-endian bytes";
+    constexpr auto size       = (sizeof(wide) / sizeof(char16_t)) - 1;
+    constexpr auto compile_time = bit::core::hash_string_segment( wide, size );
+
+    const auto str = std::u16string{wide};
+
+    REQUIRE( bit::core::hash_string_segment( str.data(), str.size() ) == compile_time );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Hashing Functions
+//----------------------------------------------------------------------------
+
+TEST_CASE("hash_string_segment( const CharT*, std::size_t )","[hash]")
+{
+  SECTION("Uses the default hash policy")
+  {
+    const auto str = std::string{test_text};
+    const auto expected = bit::core::default_hash_policy{}( str.data(), str.size() );
+
+    REQUIRE( bit::core::hash_string_segment( str.data(), str.size() ) == expected );
+  }
+
+  SECTION("Is usable in constant expressions")
+  {
+    constexpr auto result = bit::core::hash_string_segment( "hello", 5 );
+    constexpr auto view   = bit::core::hash_value( bit::core::string_view{"hello",5} );
+
+    REQUIRE( result == view );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("operator \"\" _hash( const CharT*, std::size_t )","[hash]")
+{
+  using namespace bit::core::literals;
+
+  SECTION("Is the hash of the string segment")
+  {
+    STATIC_REQUIRE( "content-length"_hash == bit::core::hash_string_segment( "content-length", 14 ) );
+    STATIC_REQUIRE( u"text"_hash == bit::core::hash_string_segment( u"text", 4 ) );
+  }
+
+  SECTION("Is usable as a case label")
+  {
+    const auto str = std::string{"post"};
+    auto result = 0;
+
+    switch( bit::core::hash_string_segment( str.data(), str.size() ) ) {
+      case "get"_hash:  result = 1; break;
+      case "post"_hash: result = 2; break;
+      default: break;
+    }
+
+    REQUIRE( result == 2 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Mixing Functions
+//----------------------------------------------------------------------------
+
+TEST_CASE("hash_mix( hash_t )","[hash]")
+{
+  SECTION("Is usable in constant expressions")
+  {
+    constexpr auto result = bit::core::hash_mix( static_cast<bit::core::hash_t>(1) );
+
+    REQUIRE( result != static_cast<bit::core::hash_t>(1) );
+  }
+
+  SECTION("Does not introduce collisions")
+  {
+    auto hashes = std::vector<bit::core::hash_t>{};
+    for( auto i = std::size_t{0}; i < 4096; ++i ) {
+      hashes.push_back( bit::core::hash_mix( static_cast<bit::core::hash_t>(i << 4) ) );
+    }
+    std::sort( hashes.begin(), hashes.end() );
+
+    REQUIRE( std::adjacent_find( hashes.begin(), hashes.end() ) == hashes.end() );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("hash_combine_mixed( hash_t, hash_t )","[hash]")
+{
+  const auto a = static_cast<bit::core::hash_t>(1);
+  const auto b = static_cast<bit::core::hash_t>(2);
+
+  SECTION("Depends on the order of the hashes")
+  {
+    REQUIRE( bit::core::hash_combine_mixed(a,b) != bit::core::hash_combine_mixed(b,a) );
+  }
+
+  SECTION("Combines several hashes in order")
+  {
+    const auto c = static_cast<bit::core::hash_t>(3);
+    const auto expected = bit::core::hash_combine_mixed( bit::core::hash_combine_mixed(a,b), c );
+
+    REQUIRE( bit::core::hash_combine_mixed(a,b,c) == expected );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("mixed_hash<Key>::operator()( const Key& )","[hash]")
+{
+  constexpr auto bucket_count = std::size_t{1024};
+
+  SECTION("Spreads aligned pointers over power-of-two buckets")
+  {
+    alignas(64) static char storage[bucket_count * 64];
+
+    auto keys = std::vector<const char*>{};
+    for( auto i = std::size_t{0}; i < bucket_count; ++i ) {
+      keys.push_back( storage + i * 64 );
+    }
+
+    const auto identity = count_used_buckets( keys, bucket_count, bit::core::hash<const char*>{} );
+    const auto mixed    = count_used_buckets( keys, bucket_count, bit::core::mixed_hash<const char*>{} );
+
+    REQUIRE( identity <= bucket_count / 64 );
+    REQUIRE( mixed > bucket_count / 2 );
+  }
+
+  SECTION("Spreads strided integers over power-of-two buckets")
+  {
+    auto keys = std::vector<std::uint32_t>{};
+    for( auto i = std::uint32_t{0}; i < bucket_count; ++i ) {
+      keys.push_back( i << 12 );
+    }
+
+    const auto mixed = count_used_buckets( keys, bucket_count, bit::core::mixed_hash<std::uint32_t>{} );
+
+    REQUIRE( mixed > bucket_count / 2 );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("hash_range( InputIterator, InputIterator )","[hash]")
+{
+  SECTION("Contiguous ranges of integers hash identically for all sources")
+  {
+    constexpr auto compile_time = bit::core::hash_range( std::begin(test_ids), std::end(test_ids) );
+
+    const auto vec  = std::vector<std::uint64_t>( std::begin(test_ids), std::end(test_ids) );
+    const auto view = bit::core::span<const std::uint64_t>{ vec.data(), static_cast<std::ptrdiff_t>(vec.size()) };
+
+    REQUIRE( bit::core::hash_range( vec.begin(), vec.end() ) == compile_time );
+    REQUIRE( bit::core::hash_range( vec.cbegin(), vec.cend() ) == compile_time );
+    REQUIRE( bit::core::hash_range( view.begin(), view.end() ) == compile_time );
+    REQUIRE( bit::core::hash_range( vec.data(), vec.data() + vec.size() ) == compile_time );
+  }
+
+  SECTION("Contiguous ranges are hashed as a single block of memory")
+  {
+    const auto vec = std::vector<std::uint64_t>( std::begin(test_ids), std::end(test_ids) );
+    const auto expected = bit::core::hash_string_segment(
+      reinterpret_cast<const unsigned char*>(vec.data()),
+      vec.size() * sizeof(std::uint64_t)
+    );
+
+    REQUIRE( bit::core::hash_range( vec.begin(), vec.end() ) == expected );
+  }
+
+  SECTION("Contiguous ranges of enums hash identically at compile-time and runtime")
+  {
+    constexpr test_enum values[] = { test_enum::a, test_enum::b, test_enum::c };
+    constexpr auto compile_time = bit::core::hash_range( std::begin(values), std::end(values) );
+
+    const auto vec = std::vector<test_enum>( std::begin(values), std::end(values) );
+
+    REQUIRE( bit::core::hash_range( vec.begin(), vec.end() ) == compile_time );
+  }
+
+  SECTION("Non-contiguous ranges combine the hash of each element")
+  {
+    const auto list = std::list<std::uint64_t>( std::begin(test_ids), std::end(test_ids) );
+
+    auto expected = static_cast<bit::core::hash_t>(0);
+    for( auto id : test_ids ) {
+      expected = bit::core::hash_combine( expected, bit::core::hash_value(id) );
+    }
+
+    REQUIRE( bit::core::hash_range( list.begin(), list.end() ) == expected );
+  }
+
+  SECTION("Contiguous ranges of types without a unique representation combine element hashes")
+  {
+    // hash_value converts floating-point values to std::size_t, which is
+    // undefined for negative values, so only non-negative ones are used
+    const auto vec = std::vector<double>{ 0.0, 1.5, 2.25 };
+
+    auto expected = static_cast<bit::core::hash_t>(0);
+    for( auto v : vec ) {
+      expected = bit::core::hash_combine( expected, bit::core::hash_value(v) );
+    }
+
+    REQUIRE( bit::core::hash_range( vec.begin(), vec.end() ) == expected );
+  }
+}
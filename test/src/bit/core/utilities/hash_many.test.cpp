@@ -0,0 +1,142 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for batch hashing
+ *****************************************************************************/
+
+#include <bit/core/utilities/hash_many.hpp>
+
+#include "test_support.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  template<typename CharT>
+  std::vector<std::basic_string<CharT>> make_test_keys( std::size_t count )
+  {
+    auto result = std::vector<std::basic_string<CharT>>{};
+    result.reserve( count );
+
+    auto state = std::size_t{0x2545f491u};
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      auto key = std::basic_string<CharT>( test::next_random( state ) % 101u, CharT{} );
+      for( auto& c : key ) {
+        c = static_cast<CharT>( 'a' + test::next_random( state ) % 26u );
+      }
+      result.push_back( std::move(key) );
+    }
+    return result;
+  }
+
+  template<typename CharT>
+  std::vector<bit::core::basic_string_view<CharT>>
+    make_views( const std::vector<std::basic_string<CharT>>& keys )
+  {
+    auto result = std::vector<bit::core::basic_string_view<CharT>>{};
+    for( const auto& key : keys ) {
+      result.emplace_back( key.data(), key.size() );
+    }
+    return result;
+  }
+
+  template<typename CharT>
+  void check_hash_many( std::size_t count )
+  {
+    const auto keys  = make_test_keys<CharT>( count );
+    const auto views = make_views( keys );
+    auto hashes = std::vector<bit::core::hash_t>( count );
+
+    bit::core::hash_many( views, hashes );
+
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      REQUIRE( hashes[i] == bit::core::hash_value( views[i] ) );
+    }
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// String Keys
+//----------------------------------------------------------------------------
+
+TEST_CASE("hash_many( span<const string_view>, span<hash_t> )", "[hash_many]")
+{
+  SECTION("No keys")
+  {
+    check_hash_many<char>( 0u );
+  }
+
+  SECTION("Fewer keys than lanes")
+  {
+    check_hash_many<char>( 3u );
+  }
+
+  SECTION("Key count is not a multiple of the lane count")
+  {
+    check_hash_many<char>( 1003u );
+  }
+
+  SECTION("Other character types")
+  {
+    check_hash_many<wchar_t>( 257u );
+    check_hash_many<char16_t>( 257u );
+    check_hash_many<char32_t>( 257u );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("hash_many with fnv1_hash_policy", "[hash_many]")
+{
+  const auto policy = bit::core::fnv1_hash_policy{};
+
+  for( auto count : { std::size_t{0}, std::size_t{3}, std::size_t{4}, std::size_t{1001} } ) {
+    const auto keys  = make_test_keys<char>( count );
+    const auto views = make_views( keys );
+    auto hashes = std::vector<bit::core::hash_t>( count );
+
+    bit::core::detail::hash_many_strings( views.data(), count, hashes.data(), policy );
+
+    for( auto i = std::size_t{0}; i < count; ++i ) {
+      REQUIRE( hashes[i] == policy( views[i].data(), views[i].size() ) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Other Keys
+//----------------------------------------------------------------------------
+
+TEST_CASE("hash_many( span<const T>, span<hash_t> )", "[hash_many]")
+{
+  auto keys = std::vector<std::uint64_t>( 37u );
+  for( auto i = std::size_t{0}; i < keys.size(); ++i ) {
+    keys[i] = i << 32;
+  }
+  auto hashes = std::vector<bit::core::hash_t>( keys.size() );
+
+  SECTION("Hashes match hash_value")
+  {
+    bit::core::hash_many<std::uint64_t>( keys, hashes );
+
+    for( auto i = std::size_t{0}; i < keys.size(); ++i ) {
+      REQUIRE( hashes[i] == bit::core::hash_value( keys[i] ) );
+    }
+  }
+
+  SECTION("Hashes match the supplied hasher")
+  {
+    const auto hasher = bit::core::mixed_hash<std::uint64_t>{};
+
+    bit::core::hash_many<std::uint64_t>( keys, hashes, hasher );
+
+    for( auto i = std::size_t{0}; i < keys.size(); ++i ) {
+      REQUIRE( hashes[i] == hasher( keys[i] ) );
+    }
+  }
+}
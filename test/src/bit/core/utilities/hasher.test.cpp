@@ -0,0 +1,153 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the incremental hasher
+ *****************************************************************************/
+
+#include <bit/core/utilities/hasher.hpp>
+
+#include "test_support.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  template<typename HashPolicy>
+  bit::core::hash_t hash_in_pieces( const std::vector<bit::core::byte>& bytes,
+                                    std::size_t piece_size )
+  {
+    auto hasher = bit::core::basic_hasher<HashPolicy>{};
+
+    for( auto i = std::size_t{0}; i < bytes.size(); i += piece_size ) {
+      const auto n = std::min( piece_size, bytes.size() - i );
+      hasher.update( { bytes.data() + i, static_cast<std::ptrdiff_t>(n) } );
+    }
+    return hasher.finalize();
+  }
+
+  template<typename HashPolicy>
+  void check_matches_one_shot()
+  {
+    const auto bytes = test::make_test_bytes( 1200 );
+
+    for( auto size : { 0u, 1u, 3u, 16u, 31u, 32u, 33u, 63u, 64u, 65u, 511u, 512u, 513u, 1200u } ) {
+      const auto input    = std::vector<bit::core::byte>( bytes.begin(), bytes.begin() + size );
+      const auto expected = bit::core::hash_string_segment( input.data(), input.size(), HashPolicy{} );
+
+      for( auto piece_size : { 1u, 2u, 7u, 31u, 32u, 33u, 64u, 100u, 1200u } ) {
+        INFO( "size = " << size << ", piece size = " << piece_size );
+
+        REQUIRE( hash_in_pieces<HashPolicy>( input, piece_size ) == expected );
+      }
+    }
+  }
+
+  template<typename HashPolicy, typename CharT>
+  void check_chars_match_one_shot( const CharT* str, std::size_t count )
+  {
+    const auto expected = bit::core::hash_string_segment( str, count, HashPolicy{} );
+
+    for( auto split = std::size_t{0}; split <= count; ++split ) {
+      INFO( "split = " << split );
+
+      auto hasher = bit::core::basic_hasher<HashPolicy>{};
+      hasher.update( str, split );
+      hasher.update( str + split, count - split );
+
+      REQUIRE( hasher.finalize() == expected );
+    }
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Modifiers / Observers
+//----------------------------------------------------------------------------
+
+TEST_CASE("basic_hasher<fnv1_hash_policy>::update( span<const byte> )","[hasher]")
+{
+  SECTION("Finalizes to the one-shot hash for any partitioning of the input")
+  {
+    check_matches_one_shot<bit::core::fnv1_hash_policy>();
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("basic_hasher<wide_hash_policy>::update( span<const byte> )","[hasher]")
+{
+  SECTION("Finalizes to the one-shot hash for any partitioning of the input")
+  {
+    check_matches_one_shot<bit::core::wide_hash_policy>();
+  }
+
+  SECTION("Empty updates do not change the result")
+  {
+    const auto bytes = test::make_test_bytes( 100 );
+
+    auto hasher = bit::core::hasher{};
+    hasher.update( { bytes.data(), 40 } );
+    hasher.update( {} );
+    hasher.update( { bytes.data() + 40, 60 } );
+    hasher.update( {} );
+
+    const auto expected = bit::core::hash_string_segment( bytes.data(), bytes.size() );
+
+    REQUIRE( hasher.finalize() == expected );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("basic_hasher<wide_hash_policy>::finalize()","[hasher]")
+{
+  const auto bytes = test::make_test_bytes( 100 );
+
+  auto hasher = bit::core::hasher{};
+  hasher.update( { bytes.data(), 50 } );
+
+  SECTION("Does not modify the hasher")
+  {
+    const auto first = hasher.finalize();
+    hasher.update( { bytes.data() + 50, 50 } );
+
+    const auto expected = bit::core::hash_string_segment( bytes.data(), bytes.size() );
+
+    REQUIRE( first == bit::core::hash_string_segment( bytes.data(), 50 ) );
+    REQUIRE( hasher.finalize() == expected );
+  }
+
+  SECTION("Returns the hash of empty input after reset")
+  {
+    hasher.reset();
+
+    REQUIRE( hasher.finalize() == bit::core::hash_string_segment( bytes.data(), 0 ) );
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST_CASE("basic_hasher<HashPolicy>::update( const CharT*, std::size_t )","[hasher]")
+{
+  // Bytes of 0x80 and above are negative if char is signed
+  const char narrow[] = "caf\xc3\xa9 \xff\x80 na\xc3\xafve";
+  const wchar_t wide[] = L"caf\u00e9 \u4e2d\u6587 na\u00efve";
+  const char16_t utf16[] = u"\u00ff\u0100\u4e2d";
+
+  SECTION("fnv1_hash_policy finalizes to the one-shot hash")
+  {
+    check_chars_match_one_shot<bit::core::fnv1_hash_policy>( narrow, sizeof(narrow) - 1u );
+    check_chars_match_one_shot<bit::core::fnv1_hash_policy>( wide, sizeof(wide) / sizeof(wchar_t) - 1u );
+    check_chars_match_one_shot<bit::core::fnv1_hash_policy>( utf16, 3u );
+  }
+
+  SECTION("wide_hash_policy finalizes to the one-shot hash")
+  {
+    check_chars_match_one_shot<bit::core::wide_hash_policy>( narrow, sizeof(narrow) - 1u );
+    check_chars_match_one_shot<bit::core::wide_hash_policy>( wide, sizeof(wide) / sizeof(wchar_t) - 1u );
+    check_chars_match_one_shot<bit::core::wide_hash_policy>( utf16, 3u );
+  }
+}
@@ -0,0 +1,178 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the keyed hash
+ *****************************************************************************/
+
+#include <bit/core/utilities/keyed_hash.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  // The key 00 01 02 ... 0f used by the SipHash reference vectors
+  constexpr auto reference_key = bit::core::hash_key{
+    0x0706050403020100ull, 0x0f0e0d0c0b0a0908ull
+  };
+
+  constexpr auto other_key = bit::core::hash_key{ 1u, 2u };
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// SipHash
+//----------------------------------------------------------------------------
+
+TEST_CASE("detail::siphash", "[keyed_hash]")
+{
+  unsigned char message[64];
+  for( auto i = 0u; i < 64u; ++i ) {
+    message[i] = static_cast<unsigned char>(i);
+  }
+
+  SECTION("SipHash-2-4 matches the reference vectors")
+  {
+    const auto siphash24 = [&message]( std::size_t size ) {
+      return bit::core::detail::siphash<2,4>( reference_key, message, size );
+    };
+
+    REQUIRE( siphash24( 0u ) == 0x726fdb47dd0e0e31ull );
+    REQUIRE( siphash24( 7u ) == 0xab0200f58b01d137ull );
+    REQUIRE( siphash24( 8u ) == 0x93f5f5799a932462ull );
+    REQUIRE( siphash24( 15u ) == 0xa129ca6149be45e5ull );
+    REQUIRE( siphash24( 63u ) == 0x958a324ceb064572ull );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Keyed Hashing Functions
+//----------------------------------------------------------------------------
+
+TEST_CASE("hash_bytes_keyed( const hash_key&, const void*, std::size_t )", "[keyed_hash]")
+{
+  const auto str = std::string{"hello world"};
+
+  SECTION("Same key and input produce the same hash")
+  {
+    const auto a = bit::core::hash_bytes_keyed( reference_key, str.data(), str.size() );
+    const auto b = bit::core::hash_bytes_keyed( reference_key, str.data(), str.size() );
+
+    REQUIRE( a == b );
+  }
+
+  SECTION("Different keys produce different hashes")
+  {
+    const auto a = bit::core::hash_bytes_keyed( reference_key, str.data(), str.size() );
+    const auto b = bit::core::hash_bytes_keyed( other_key, str.data(), str.size() );
+
+    REQUIRE( a != b );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("hash_combine_keyed( const hash_key&, hash_t, hash_t )", "[keyed_hash]")
+{
+  const auto a = static_cast<bit::core::hash_t>(1u);
+  const auto b = static_cast<bit::core::hash_t>(2u);
+
+  SECTION("Depends on the order of the hashes")
+  {
+    REQUIRE( bit::core::hash_combine_keyed( reference_key, a, b ) !=
+             bit::core::hash_combine_keyed( reference_key, b, a ) );
+  }
+
+  SECTION("Depends on the key")
+  {
+    REQUIRE( bit::core::hash_combine_keyed( reference_key, a, b ) !=
+             bit::core::hash_combine_keyed( other_key, a, b ) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Policy
+//----------------------------------------------------------------------------
+
+TEST_CASE("keyed_hash_policy", "[keyed_hash]")
+{
+  const auto policy = bit::core::keyed_hash_policy{ reference_key };
+  const auto str = bit::core::string_view{"hello world"};
+
+  SECTION("Is usable with hash_string_segment")
+  {
+    const auto hash = bit::core::hash_string_segment( str.data(), str.size(), policy );
+
+    REQUIRE( hash == bit::core::hash_bytes_keyed( reference_key, str.data(), str.size() ) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// class : keyed_hash
+//----------------------------------------------------------------------------
+
+TEST_CASE("keyed_hash<Key>", "[keyed_hash]")
+{
+  SECTION("Default constructed uses the process key")
+  {
+    const auto hasher = bit::core::keyed_hash<int>{};
+
+    REQUIRE( hasher.key().k0 == bit::core::process_hash_key().k0 );
+    REQUIRE( hasher.key().k1 == bit::core::process_hash_key().k1 );
+  }
+
+  SECTION("Strings hash their characters")
+  {
+    const auto view   = bit::core::keyed_hash<bit::core::string_view>{ reference_key };
+    const auto string = bit::core::keyed_hash<std::string>{ reference_key };
+
+    REQUIRE( view( "hello world" ) == string( std::string{"hello world"} ) );
+    REQUIRE( view( "hello world" ) != view( "hello worle" ) );
+  }
+
+  SECTION("Case-insensitive strings that compare equal hash equally")
+  {
+    using view_type   = bit::core::ci::string_view;
+    using wview_type  = bit::core::ci::u16string_view;
+    using string_type = std::basic_string<char,bit::core::insensitive_char_traits<char>>;
+
+    const auto view    = bit::core::keyed_hash<view_type>{ reference_key };
+    const auto wview   = bit::core::keyed_hash<wview_type>{ reference_key };
+    const auto string  = bit::core::keyed_hash<string_type>{ reference_key };
+    const auto lowered = bit::core::keyed_hash<bit::core::string_view>{ reference_key };
+
+    // Lengths on both sides of a word, so the tail is folded too
+    REQUIRE( view_type{ "Content-Length" } == view_type{ "content-length" } );
+    REQUIRE( view( "Content-Length" ) == view( "content-length" ) );
+    REQUIRE( view( "X-REQUEST-ID" ) == view( "x-request-id" ) );
+    REQUIRE( view( "Content-Length" ) == string( string_type{ "CONTENT-LENGTH" } ) );
+    REQUIRE( view( "Content-Length" ) == lowered( "content-length" ) );
+    REQUIRE( view( "Content-Length" ) != view( "Content-Type" ) );
+    REQUIRE( wview( u"Accept-Encoding" ) == wview( u"accept-ENCODING" ) );
+  }
+
+  SECTION("Integers hash their object representation")
+  {
+    const auto hasher = bit::core::keyed_hash<std::uint64_t>{ reference_key };
+    const auto value  = std::uint64_t{42u};
+
+    REQUIRE( hasher( value ) == bit::core::hash_bytes_keyed( reference_key, &value, sizeof(value) ) );
+  }
+
+  SECTION("Keys that share low bits are spread over buckets")
+  {
+    const auto hasher = bit::core::keyed_hash<std::uint64_t>{ reference_key };
+    auto used = std::vector<bool>( 256u, false );
+
+    for( auto i = std::uint64_t{0}; i < 256u; ++i ) {
+      used[static_cast<std::size_t>( hasher( i << 16 ) ) & 255u] = true;
+    }
+
+    // A uniformly random hash fills about 162 of 256 buckets
+    REQUIRE( std::count( used.begin(), used.end(), true ) > 128 );
+  }
+}
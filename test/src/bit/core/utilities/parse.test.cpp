@@ -0,0 +1,324 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for bit::core::parse
+ *****************************************************************************/
+
+#include <bit/core/utilities/parse.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  bit::core::string_view view( const std::string& s )
+  {
+    return { s.data(), s.size() };
+  }
+
+  template<typename T>
+  bool same_bits( T a, T b )
+  {
+    return std::memcmp( &a, &b, sizeof(T) ) == 0;
+  }
+
+  // Draws pseudo-random 64-bit values
+  std::uint64_t next_random( std::uint64_t& state )
+  {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return state ^ (state >> 29);
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Integers
+//----------------------------------------------------------------------------
+
+TEST_CASE("parse<Integer>( string_view, std::size_t& )", "[parse]")
+{
+  auto length = std::size_t{};
+
+  SECTION("String starts with digits")
+  {
+    SECTION("Consumes only the digits")
+    {
+      const auto result = bit::core::parse<int>( "8080/tcp", length );
+
+      REQUIRE( result.value() == 8080 );
+      REQUIRE( length == 4u );
+    }
+  }
+
+  SECTION("String has more than 8 digits")
+  {
+    SECTION("Parses all digits")
+    {
+      REQUIRE( bit::core::parse<long long>( "1234567890123456789", length ).value() == 1234567890123456789ll );
+      REQUIRE( length == 19u );
+      REQUIRE( bit::core::parse<unsigned long long>( "00000000000000000000000042", length ).value() == 42u );
+      REQUIRE( length == 26u );
+    }
+  }
+
+  SECTION("String is negative")
+  {
+    SECTION("Type is signed")
+    {
+      SECTION("Parses the negative value")
+      {
+        REQUIRE( bit::core::parse<int>( "-42", length ).value() == -42 );
+        REQUIRE( length == 3u );
+      }
+    }
+
+    SECTION("Type is unsigned")
+    {
+      SECTION("Fails with invalid_argument")
+      {
+        const auto result = bit::core::parse<unsigned>( "-42", length );
+
+        REQUIRE( result.error() == bit::core::parse_error::invalid_argument );
+        REQUIRE( length == 0u );
+      }
+    }
+  }
+
+  SECTION("String has no digits")
+  {
+    SECTION("Fails with invalid_argument")
+    {
+      for( auto s : { "", "-", "+1", " 1", "x1" } ) {
+        REQUIRE( bit::core::parse<int>( s, length ).error() == bit::core::parse_error::invalid_argument );
+        REQUIRE( length == 0u );
+      }
+    }
+  }
+
+  SECTION("Value is at the limits of the type")
+  {
+    SECTION("Parses the limit")
+    {
+      REQUIRE( bit::core::parse<signed char>( "-128", length ).value() == -128 );
+      REQUIRE( bit::core::parse<signed char>( "127", length ).value() == 127 );
+      REQUIRE( bit::core::parse<std::int64_t>( "-9223372036854775808", length ).value() == std::numeric_limits<std::int64_t>::min() );
+      REQUIRE( bit::core::parse<std::uint64_t>( "18446744073709551615", length ).value() == std::numeric_limits<std::uint64_t>::max() );
+    }
+  }
+
+  SECTION("Value is out of range")
+  {
+    SECTION("Fails with out_of_range and consumes the number")
+    {
+      REQUIRE( bit::core::parse<signed char>( "128", length ).error() == bit::core::parse_error::out_of_range );
+      REQUIRE( bit::core::parse<signed char>( "-129", length ).error() == bit::core::parse_error::out_of_range );
+      REQUIRE( bit::core::parse<unsigned char>( "256", length ).error() == bit::core::parse_error::out_of_range );
+      REQUIRE( bit::core::parse<std::uint64_t>( "18446744073709551616", length ).error() == bit::core::parse_error::out_of_range );
+      REQUIRE( length == 20u );
+      REQUIRE( bit::core::parse<std::int64_t>( "99999999999999999999999x", length ).error() == bit::core::parse_error::out_of_range );
+      REQUIRE( length == 23u );
+    }
+  }
+
+  SECTION("Matches strtoll")
+  {
+    auto state = std::uint64_t{1};
+    for( auto i = 0; i < 20000; ++i ) {
+      auto s = std::string{};
+      if( next_random( state ) % 2u == 0u ) s += '-';
+      const auto digits = next_random( state ) % 21u + 1u;
+      for( auto j = 0u; j < digits; ++j ) {
+        s += static_cast<char>( '0' + next_random( state ) % 10u );
+      }
+      s += ",tail";
+
+      auto end = static_cast<char*>(nullptr);
+      const auto expected = std::strtoll( s.c_str(), &end, 10 );
+      const auto result   = bit::core::parse<long long>( view( s ), length );
+
+      REQUIRE( length == static_cast<std::size_t>( end - s.c_str() ) );
+      if( result ) {
+        REQUIRE( result.value() == expected );
+      } else {
+        REQUIRE( (expected == std::numeric_limits<long long>::max() ||
+                  expected == std::numeric_limits<long long>::min()) );
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Floating Point
+//----------------------------------------------------------------------------
+
+TEST_CASE("parse<Float>( string_view, std::size_t& )", "[parse]")
+{
+  auto length = std::size_t{};
+
+  SECTION("String is a decimal")
+  {
+    SECTION("Consumes the decimal")
+    {
+      REQUIRE( bit::core::parse<double>( "3.25;", length ).value() == 3.25 );
+      REQUIRE( length == 4u );
+      REQUIRE( bit::core::parse<double>( "-.5e1", length ).value() == -5.0 );
+      REQUIRE( length == 5u );
+      REQUIRE( bit::core::parse<double>( "1.", length ).value() == 1.0 );
+      REQUIRE( length == 2u );
+      REQUIRE( bit::core::parse<float>( "1e-3", length ).value() == 1e-3f );
+      REQUIRE( length == 4u );
+    }
+  }
+
+  SECTION("Exponent is malformed")
+  {
+    SECTION("Exponent is not consumed")
+    {
+      REQUIRE( bit::core::parse<double>( "2e", length ).value() == 2.0 );
+      REQUIRE( length == 1u );
+      REQUIRE( bit::core::parse<double>( "2e+x", length ).value() == 2.0 );
+      REQUIRE( length == 1u );
+    }
+  }
+
+  SECTION("String is negative zero")
+  {
+    SECTION("Keeps the sign")
+    {
+      REQUIRE( std::signbit( bit::core::parse<double>( "-0", length ).value() ) );
+    }
+  }
+
+  SECTION("String is infinity or NaN")
+  {
+    SECTION("Parses the special value")
+    {
+      REQUIRE( bit::core::parse<double>( "-Infinity", length ).value() == -std::numeric_limits<double>::infinity() );
+      REQUIRE( length == 9u );
+      REQUIRE( bit::core::parse<double>( "inFx", length ).value() == std::numeric_limits<double>::infinity() );
+      REQUIRE( length == 3u );
+      REQUIRE( std::isnan( bit::core::parse<float>( "nan(0x7f)", length ).value() ) );
+      REQUIRE( length == 9u );
+      REQUIRE( std::isnan( bit::core::parse<float>( "NaN(", length ).value() ) );
+      REQUIRE( length == 3u );
+    }
+  }
+
+  SECTION("String has no digits")
+  {
+    SECTION("Fails with invalid_argument")
+    {
+      for( auto s : { "", "-", ".", "-.e1", "e1", "+1", "in" } ) {
+        REQUIRE( bit::core::parse<double>( s, length ).error() == bit::core::parse_error::invalid_argument );
+        REQUIRE( length == 0u );
+      }
+    }
+  }
+
+  SECTION("Value overflows")
+  {
+    SECTION("Fails with out_of_range")
+    {
+      REQUIRE( bit::core::parse<double>( "1e309", length ).error() == bit::core::parse_error::out_of_range );
+      REQUIRE( length == 5u );
+      REQUIRE( bit::core::parse<float>( "3.5e38", length ).error() == bit::core::parse_error::out_of_range );
+    }
+  }
+
+  SECTION("Value underflows")
+  {
+    SECTION("Rounds to zero or a subnormal")
+    {
+      REQUIRE( bit::core::parse<double>( "1e-400", length ).value() == 0.0 );
+      REQUIRE( bit::core::parse<double>( "4.9e-324", length ).value() == std::numeric_limits<double>::denorm_min() );
+      REQUIRE( bit::core::parse<float>( "1.4e-45", length ).value() == std::numeric_limits<float>::denorm_min() );
+    }
+  }
+
+  SECTION("Value is halfway between two doubles")
+  {
+    SECTION("Rounds to even")
+    {
+      REQUIRE( bit::core::parse<double>( "9007199254740993", length ).value() == 9007199254740992.0 );
+      REQUIRE( bit::core::parse<double>( "9007199254740995", length ).value() == 9007199254740996.0 );
+    }
+
+    SECTION("Digits past the 19th break the tie")
+    {
+      REQUIRE( bit::core::parse<double>( "9007199254740993.00000000000000000000001", length ).value() == 9007199254740994.0 );
+      REQUIRE( bit::core::parse<double>( "9007199254740992.99999999999999999999999", length ).value() == 9007199254740992.0 );
+    }
+  }
+
+  SECTION("Matches strtod")
+  {
+    auto state = std::uint64_t{7};
+    char buffer[64];
+
+    for( auto i = 0; i < 50000; ++i ) {
+      const auto bits = next_random( state );
+      auto d = 0.0;
+      std::memcpy( &d, &bits, sizeof(d) );
+      if( !std::isfinite( d ) ) continue;
+
+      const auto precision = static_cast<int>( next_random( state ) % 20u ) + 1;
+      std::snprintf( buffer, sizeof(buffer), "%.*e", precision, d );
+
+      const auto expected = std::strtod( buffer, nullptr );
+      const auto result   = bit::core::parse<double>( buffer );
+
+      REQUIRE( same_bits( result.value(), expected ) );
+    }
+  }
+
+  SECTION("Matches strtof")
+  {
+    auto state = std::uint64_t{11};
+    char buffer[64];
+
+    for( auto i = 0; i < 50000; ++i ) {
+      const auto bits = static_cast<std::uint32_t>( next_random( state ) );
+      auto f = 0.0f;
+      std::memcpy( &f, &bits, sizeof(f) );
+      if( !std::isfinite( f ) ) continue;
+
+      const auto precision = static_cast<int>( next_random( state ) % 12u ) + 1;
+      std::snprintf( buffer, sizeof(buffer), "%.*g", precision, static_cast<double>(f) );
+
+      const auto expected = std::strtof( buffer, nullptr );
+      const auto result   = bit::core::parse<float>( buffer );
+
+      REQUIRE( same_bits( result.value(), expected ) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("parse<T>( string_view )", "[parse]")
+{
+  SECTION("String is a whole number")
+  {
+    SECTION("Returns the value")
+    {
+      REQUIRE( bit::core::parse<int>( "-17" ).value() == -17 );
+      REQUIRE( bit::core::parse<double>( "0.1" ).value() == 0.1 );
+    }
+  }
+
+  SECTION("String has trailing characters")
+  {
+    SECTION("Fails with invalid_argument")
+    {
+      REQUIRE( bit::core::parse<int>( "17 " ).error() == bit::core::parse_error::invalid_argument );
+      REQUIRE( bit::core::parse<double>( "0.1f" ).error() == bit::core::parse_error::invalid_argument );
+    }
+  }
+}
@@ -0,0 +1,135 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the compile-time perfect hash table
+ *****************************************************************************/
+
+#include <bit/core/utilities/perfect_hash.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  constexpr auto http_headers = bit::core::make_perfect_hash(
+    "Accept", "Accept-Encoding", "Accept-Language", "Authorization",
+    "Cache-Control", "Connection", "Content-Length", "Content-Type",
+    "Cookie", "Date", "ETag", "Expect", "Host", "If-Match",
+    "If-Modified-Since", "If-None-Match", "Location", "Origin", "Pragma",
+    "Range", "Referer", "Server", "Set-Cookie", "Transfer-Encoding",
+    "Upgrade", "User-Agent", "Vary", "Via", "WWW-Authenticate"
+  );
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+TEST_CASE("make_perfect_hash( const CharT(&...)[Ns] )","[perfect_hash]")
+{
+  SECTION("Contains one entry per key")
+  {
+    STATIC_REQUIRE( http_headers.size() == 29 );
+  }
+
+  SECTION("Preserves the order of the keys")
+  {
+    REQUIRE( http_headers[0] == "Accept" );
+    REQUIRE( http_headers[28] == "WWW-Authenticate" );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Lookup
+//----------------------------------------------------------------------------
+
+TEST_CASE("basic_perfect_hash::find( view_type )","[perfect_hash]")
+{
+  SECTION("Finds every key at its original index")
+  {
+    for( auto i = std::size_t{0}; i < http_headers.size(); ++i ) {
+      const auto key = std::string{ http_headers[i].data(), http_headers[i].size() };
+
+      REQUIRE( http_headers.find( key ) == i );
+    }
+  }
+
+  SECTION("Is usable in constant expressions")
+  {
+    using namespace bit::core::literals;
+
+    STATIC_REQUIRE( http_headers.find( "Host"_sv ) == 12 );
+    STATIC_REQUIRE( http_headers.find( "Hostname"_sv ) == decltype(http_headers)::npos );
+  }
+
+  SECTION("Returns npos for strings that are not keys")
+  {
+    const auto npos = decltype(http_headers)::npos;
+
+    REQUIRE( http_headers.find( "" ) == npos );
+    REQUIRE( http_headers.find( "host" ) == npos );
+    REQUIRE( http_headers.find( "Accept-" ) == npos );
+    REQUIRE( http_headers.find( "X-Forwarded-For" ) == npos );
+  }
+
+  SECTION("Accepts a precomputed hash")
+  {
+    using namespace bit::core::literals;
+
+    REQUIRE( http_headers.find( "Cookie", "Cookie"_hash ) == 8 );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("basic_perfect_hash::contains( view_type )","[perfect_hash]")
+{
+  using namespace bit::core::literals;
+
+  constexpr auto table = bit::core::make_perfect_hash( u"alpha", u"beta" );
+
+  SECTION("Works with wide characters")
+  {
+    STATIC_REQUIRE( table.contains( u"beta"_sv ) );
+    STATIC_REQUIRE_FALSE( table.contains( u"gamma"_sv ) );
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("basic_perfect_hash with insensitive_char_traits","[perfect_hash]")
+{
+  using traits_type = bit::core::insensitive_char_traits<char>;
+  using table_type  = bit::core::basic_perfect_hash<char,3,traits_type>;
+
+  SECTION("Finds keys regardless of case")
+  {
+    const bit::core::ci::string_view keys[] = { "content-type", "host", "accept" };
+    const auto table = table_type( keys );
+
+    REQUIRE( table.find( "host" ) == 1 );
+    REQUIRE( table.find( "HOST" ) == 1 );
+    REQUIRE( table.find( "Content-Type" ) == 0 );
+    REQUIRE( table.find( "hosts" ) == table_type::npos );
+  }
+
+  SECTION("Is usable in constant expressions")
+  {
+    constexpr bit::core::ci::string_view keys[] = {
+      { "content-type", 12 }, { "host", 4 }, { "accept", 6 }
+    };
+    constexpr auto table = table_type( keys );
+
+    STATIC_REQUIRE( table.find( bit::core::ci::string_view( "ACCEPT", 6 ) ) == 2 );
+  }
+
+  SECTION("Rejects keys that are equal under the traits")
+  {
+    const bit::core::ci::string_view keys[] = { "Host", "accept", "host" };
+
+    REQUIRE_THROWS_AS( table_type( keys ), std::invalid_argument );
+  }
+}
@@ -0,0 +1,93 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the parallel tree hash
+ *****************************************************************************/
+
+#include <bit/core/utilities/tree_hash.hpp>
+
+#include "test_support.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  bit::core::span<const bit::core::byte>
+    prefix( const std::vector<bit::core::byte>& bytes, std::size_t size )
+  {
+    return { bytes.data(), static_cast<std::ptrdiff_t>(size) };
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("tree_hash( span<const byte>, std::size_t )", "[tree_hash]")
+{
+  constexpr auto chunk = bit::core::tree_hash_chunk_size();
+
+  auto bytes = test::make_test_bytes( 5u * chunk + 123u );
+
+  SECTION("Result does not depend on the thread count")
+  {
+    const std::size_t sizes[] = {
+      0u, 1u, chunk - 1u, chunk, chunk + 1u, 5u * chunk + 123u
+    };
+
+    for( auto size : sizes ) {
+      const auto expected = bit::core::tree_hash( prefix( bytes, size ), 1u );
+
+      for( auto threads : { 0u, 2u, 3u, 8u } ) {
+        REQUIRE( bit::core::tree_hash( prefix( bytes, size ), threads ) == expected );
+      }
+    }
+  }
+
+  SECTION("Root hashes the chunk hashes as little-endian words")
+  {
+    const auto size = 2u * chunk + 5u;
+
+    auto leaves = std::vector<unsigned char>{};
+    for( auto i = std::size_t{0}; i < 3u; ++i ) {
+      const auto offset = i * chunk;
+      const auto leaf   = bit::core::detail::wide_hash_bytes( bytes.data() + offset,
+                                                              (std::min)( chunk, size - offset ),
+                                                              i );
+      for( auto j = 0u; j < 8u; ++j ) {
+        leaves.push_back( static_cast<unsigned char>(leaf >> (8u * j)) );
+      }
+    }
+    const auto expected = bit::core::detail::wide_hash_bytes( leaves.data(), leaves.size(), size );
+
+    REQUIRE( bit::core::tree_hash( prefix( bytes, size ) ) == static_cast<bit::core::hash_t>(expected) );
+  }
+
+  SECTION("Result depends on the length")
+  {
+    const auto a = bit::core::tree_hash( prefix( bytes, chunk ) );
+    const auto b = bit::core::tree_hash( prefix( bytes, chunk + 1u ) );
+
+    REQUIRE( a != b );
+  }
+
+  SECTION("Result depends on the content of every chunk")
+  {
+    const auto expected = bit::core::tree_hash( bytes );
+
+    bytes[3u * chunk + 7u] ^= static_cast<bit::core::byte>(1u);
+
+    REQUIRE( bit::core::tree_hash( bytes ) != expected );
+  }
+
+  SECTION("Result depends on the order of the chunks")
+  {
+    const auto expected = bit::core::tree_hash( bytes );
+
+    std::swap_ranges( bytes.begin(), bytes.begin() + chunk, bytes.begin() + chunk );
+
+    REQUIRE( bit::core::tree_hash( bytes ) != expected );
+  }
+}
@@ -0,0 +1,411 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the UTF-8, UTF-16 and UTF-32 utilities
+ *****************************************************************************/
+
+#include <bit/core/utilities/unicode.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <catch2/catch.hpp>
+
+namespace {
+
+  // "aé中😀" in each encoding
+  const char     mixed_utf8[]  = "a\xc3\xa9\xe4\xb8\xad\xf0\x9f\x98\x80";
+  const char16_t mixed_utf16[] = { 0x61, 0xe9, 0x4e2d, 0xd83d, 0xde00, 0 };
+  const char32_t mixed_utf32[] = { 0x61, 0xe9, 0x4e2d, 0x1f600, 0 };
+
+  bit::core::string_view utf8( const std::string& str )
+  {
+    return { str.data(), str.size() };
+  }
+
+  /// Repeats \p str until it is at least \p size bytes long, so that the
+  /// block-wise paths are exercised
+  std::string repeat( const std::string& str, std::size_t size )
+  {
+    auto result = std::string{};
+    while( result.size() < size ) {
+      result += str;
+    }
+    return result;
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Validation
+//----------------------------------------------------------------------------
+
+TEST_CASE("is_valid_utf8( string_view )", "[unicode]")
+{
+  SECTION("Input is empty")
+  {
+    SECTION("Returns true")
+    {
+      REQUIRE( bit::core::is_valid_utf8( "" ) );
+    }
+  }
+
+  SECTION("Input is well-formed")
+  {
+    SECTION("Returns true")
+    {
+      REQUIRE( bit::core::is_valid_utf8( mixed_utf8 ) );
+      REQUIRE( bit::core::is_valid_utf8( "\xf4\x8f\xbf\xbf" ) );
+      REQUIRE( bit::core::is_valid_utf8( utf8( repeat( mixed_utf8, 1000 ) ) ) );
+    }
+  }
+
+  SECTION("Input contains an overlong encoding")
+  {
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( bit::core::is_valid_utf8( "\xc0\xaf" ) );
+      REQUIRE_FALSE( bit::core::is_valid_utf8( "\xe0\x80\xaf" ) );
+      REQUIRE_FALSE( bit::core::is_valid_utf8( "\xf0\x80\x80\xaf" ) );
+    }
+  }
+
+  SECTION("Input encodes a surrogate")
+  {
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( bit::core::is_valid_utf8( "\xed\xa0\x80" ) );
+    }
+  }
+
+  SECTION("Input encodes a value past U+10FFFF")
+  {
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( bit::core::is_valid_utf8( "\xf4\x90\x80\x80" ) );
+      REQUIRE_FALSE( bit::core::is_valid_utf8( "\xf8\x88\x80\x80\x80" ) );
+    }
+  }
+
+  SECTION("Input ends inside a sequence")
+  {
+    SECTION("Returns false")
+    {
+      REQUIRE_FALSE( bit::core::is_valid_utf8( "\xe4\xb8" ) );
+      REQUIRE_FALSE( bit::core::is_valid_utf8( utf8( repeat( mixed_utf8, 1000 ) + "\xf0\x9f\x98" ) ) );
+    }
+  }
+
+  SECTION("Input contains a stray continuation byte")
+  {
+    SECTION("Returns false")
+    {
+      auto str = repeat( mixed_utf8, 1000 );
+      str[700] = '\x80';
+
+      REQUIRE_FALSE( bit::core::is_valid_utf8( utf8( str ) ) );
+    }
+  }
+}
+
+TEST_CASE("is_valid_utf16( u16string_view )", "[unicode]")
+{
+  SECTION("Input is well-formed")
+  {
+    SECTION("Returns true")
+    {
+      REQUIRE( bit::core::is_valid_utf16( mixed_utf16 ) );
+    }
+  }
+
+  SECTION("Input contains an unpaired surrogate")
+  {
+    SECTION("Returns false")
+    {
+      const char16_t high[] = { 0x61, 0xd83d, 0x61, 0 };
+      const char16_t low[]  = { 0x61, 0xde00, 0 };
+
+      REQUIRE_FALSE( bit::core::is_valid_utf16( high ) );
+      REQUIRE_FALSE( bit::core::is_valid_utf16( low ) );
+    }
+  }
+}
+
+TEST_CASE("is_valid_utf32( u32string_view )", "[unicode]")
+{
+  SECTION("Input is well-formed")
+  {
+    SECTION("Returns true")
+    {
+      REQUIRE( bit::core::is_valid_utf32( mixed_utf32 ) );
+    }
+  }
+
+  SECTION("Input contains a surrogate or a value past U+10FFFF")
+  {
+    SECTION("Returns false")
+    {
+      const char32_t surrogate[] = { 0x61, 0xd800, 0 };
+      const char32_t large[]     = { 0x61, 0x110000, 0 };
+
+      REQUIRE_FALSE( bit::core::is_valid_utf32( surrogate ) );
+      REQUIRE_FALSE( bit::core::is_valid_utf32( large ) );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Lengths
+//----------------------------------------------------------------------------
+
+TEST_CASE("utfN_length( ... )", "[unicode]")
+{
+  SECTION("Returns the length in the target encoding")
+  {
+    REQUIRE( bit::core::utf8_length( mixed_utf16 ) == 10u );
+    REQUIRE( bit::core::utf8_length( mixed_utf32 ) == 10u );
+    REQUIRE( bit::core::utf16_length( mixed_utf8 ) == 5u );
+    REQUIRE( bit::core::utf16_length( mixed_utf32 ) == 5u );
+    REQUIRE( bit::core::utf32_length( mixed_utf8 ) == 4u );
+    REQUIRE( bit::core::utf32_length( mixed_utf16 ) == 4u );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Conversions
+//----------------------------------------------------------------------------
+
+TEST_CASE("utf8_to_utf16( string_view, span<char16_t> )", "[unicode]")
+{
+  char16_t buffer[16];
+
+  SECTION("Input is valid")
+  {
+    SECTION("Returns the converted string")
+    {
+      const auto result = bit::core::utf8_to_utf16( mixed_utf8, buffer );
+
+      REQUIRE( result.has_value() );
+      REQUIRE( *result == bit::core::u16string_view( mixed_utf16 ) );
+    }
+  }
+
+  SECTION("Input is invalid")
+  {
+    SECTION("Returns invalid_encoding")
+    {
+      const auto result = bit::core::utf8_to_utf16( "a\xed\xa0\x80", buffer );
+
+      REQUIRE( result.error() == bit::core::unicode_error::invalid_encoding );
+    }
+  }
+
+  SECTION("Buffer is too small")
+  {
+    SECTION("Returns buffer_too_small")
+    {
+      const auto result = bit::core::utf8_to_utf16( mixed_utf8, bit::core::span<char16_t>( buffer, 4 ) );
+
+      REQUIRE( result.error() == bit::core::unicode_error::buffer_too_small );
+    }
+  }
+}
+
+TEST_CASE("utf8_to_utf32( string_view, span<char32_t> )", "[unicode]")
+{
+  char32_t buffer[16];
+
+  SECTION("Input is valid")
+  {
+    SECTION("Returns the converted string")
+    {
+      const auto result = bit::core::utf8_to_utf32( mixed_utf8, buffer );
+
+      REQUIRE( result.has_value() );
+      REQUIRE( *result == bit::core::u32string_view( mixed_utf32 ) );
+    }
+  }
+
+  SECTION("Input is invalid")
+  {
+    SECTION("Returns invalid_encoding")
+    {
+      const auto result = bit::core::utf8_to_utf32( "a\xc0\xaf", buffer );
+
+      REQUIRE( result.error() == bit::core::unicode_error::invalid_encoding );
+    }
+  }
+
+  SECTION("Buffer is too small")
+  {
+    SECTION("Returns buffer_too_small")
+    {
+      const auto result = bit::core::utf8_to_utf32( mixed_utf8, bit::core::span<char32_t>( buffer, 3 ) );
+
+      REQUIRE( result.error() == bit::core::unicode_error::buffer_too_small );
+    }
+  }
+}
+
+TEST_CASE("utf16_to_utf8( u16string_view, span<char> )", "[unicode]")
+{
+  char buffer[16];
+
+  SECTION("Input is valid")
+  {
+    SECTION("Returns the converted string")
+    {
+      const auto result = bit::core::utf16_to_utf8( mixed_utf16, buffer );
+
+      REQUIRE( result.has_value() );
+      REQUIRE( *result == bit::core::string_view( mixed_utf8 ) );
+    }
+  }
+
+  SECTION("Input is invalid")
+  {
+    SECTION("Returns invalid_encoding")
+    {
+      const char16_t input[] = { 0x61, 0xde00, 0 };
+      const auto result = bit::core::utf16_to_utf8( input, buffer );
+
+      REQUIRE( result.error() == bit::core::unicode_error::invalid_encoding );
+    }
+  }
+
+  SECTION("Buffer is too small")
+  {
+    SECTION("Returns buffer_too_small")
+    {
+      const auto result = bit::core::utf16_to_utf8( mixed_utf16, bit::core::span<char>( buffer, 9 ) );
+
+      REQUIRE( result.error() == bit::core::unicode_error::buffer_too_small );
+    }
+  }
+}
+
+TEST_CASE("utf16_to_utf32( u16string_view, span<char32_t> )", "[unicode]")
+{
+  char32_t buffer[16];
+
+  SECTION("Input is valid")
+  {
+    SECTION("Returns the converted string")
+    {
+      const auto result = bit::core::utf16_to_utf32( mixed_utf16, buffer );
+
+      REQUIRE( result.has_value() );
+      REQUIRE( *result == bit::core::u32string_view( mixed_utf32 ) );
+    }
+  }
+
+  SECTION("Input is invalid")
+  {
+    SECTION("Returns invalid_encoding")
+    {
+      const char16_t input[] = { 0x61, 0xd83d, 0 };
+      const auto result = bit::core::utf16_to_utf32( input, buffer );
+
+      REQUIRE( result.error() == bit::core::unicode_error::invalid_encoding );
+    }
+  }
+}
+
+TEST_CASE("utf32_to_utf8( u32string_view, span<char> )", "[unicode]")
+{
+  char buffer[16];
+
+  SECTION("Input is valid")
+  {
+    SECTION("Returns the converted string")
+    {
+      const auto result = bit::core::utf32_to_utf8( mixed_utf32, buffer );
+
+      REQUIRE( result.has_value() );
+      REQUIRE( *result == bit::core::string_view( mixed_utf8 ) );
+    }
+  }
+
+  SECTION("Input is invalid")
+  {
+    SECTION("Returns invalid_encoding")
+    {
+      const char32_t input[] = { 0x61, 0x110000, 0 };
+      const auto result = bit::core::utf32_to_utf8( input, buffer );
+
+      REQUIRE( result.error() == bit::core::unicode_error::invalid_encoding );
+    }
+  }
+}
+
+TEST_CASE("utf32_to_utf16( u32string_view, span<char16_t> )", "[unicode]")
+{
+  char16_t buffer[16];
+
+  SECTION("Input is valid")
+  {
+    SECTION("Returns the converted string")
+    {
+      const auto result = bit::core::utf32_to_utf16( mixed_utf32, buffer );
+
+      REQUIRE( result.has_value() );
+      REQUIRE( *result == bit::core::u16string_view( mixed_utf16 ) );
+    }
+  }
+
+  SECTION("Buffer is too small")
+  {
+    SECTION("Returns buffer_too_small")
+    {
+      const auto result = bit::core::utf32_to_utf16( mixed_utf32, bit::core::span<char16_t>( buffer, 4 ) );
+
+      REQUIRE( result.error() == bit::core::unicode_error::buffer_too_small );
+    }
+  }
+}
+
+TEST_CASE("conversions round-trip long inputs", "[unicode]")
+{
+  const auto input = repeat( std::string{"plain ascii text "} + mixed_utf8, 4096 );
+  const auto units = bit::core::utf16_length( utf8( input ) );
+  const auto points = bit::core::utf32_length( utf8( input ) );
+
+  auto utf16 = std::u16string( units, u'\0' );
+  auto utf32 = std::u32string( points, U'\0' );
+  auto bytes = std::string( input.size(), '\0' );
+
+  SECTION("Through UTF-16")
+  {
+    const auto to = bit::core::utf8_to_utf16( utf8( input ), { &utf16[0], static_cast<std::ptrdiff_t>(units) } );
+    REQUIRE( to.has_value() );
+    REQUIRE( to->size() == units );
+
+    const auto back = bit::core::utf16_to_utf8( *to, { &bytes[0], static_cast<std::ptrdiff_t>(bytes.size()) } );
+    REQUIRE( back.has_value() );
+    REQUIRE( *back == utf8( input ) );
+  }
+
+  SECTION("Through UTF-32")
+  {
+    const auto to = bit::core::utf8_to_utf32( utf8( input ), { &utf32[0], static_cast<std::ptrdiff_t>(points) } );
+    REQUIRE( to.has_value() );
+    REQUIRE( to->size() == points );
+
+    const auto back = bit::core::utf32_to_utf8( *to, { &bytes[0], static_cast<std::ptrdiff_t>(bytes.size()) } );
+    REQUIRE( back.has_value() );
+    REQUIRE( *back == utf8( input ) );
+  }
+}
+
+TEST_CASE("conversions accept string_span", "[unicode]")
+{
+  char input[] = "a\xc3\xa9\xe4\xb8\xad\xf0\x9f\x98\x80";
+  const auto span = bit::core::string_span<bit::core::dynamic_extent>( input, sizeof(input) - 1 );
+  char32_t buffer[16];
+
+  REQUIRE( bit::core::is_valid_utf8( span ) );
+
+  const auto result = bit::core::utf8_to_utf32( span, buffer );
+  REQUIRE( result.has_value() );
+  REQUIRE( *result == bit::core::u32string_view( mixed_utf32 ) );
+}